@@ -0,0 +1,139 @@
+#ifndef AXIS_CONFIG_H
+#define AXIS_CONFIG_H
+
+#include <stdint.h>
+
+// Microstep setting of the CL86T drivers (1 = full steps)
+// This is the only value to change after changing the DIP switches: positions, limits, speeds and accelerations all follow
+#define MICROSTEPS 1
+
+/**
+ * Function to get the number of steps for one revolution of the chair side of the gearbox
+ */
+constexpr int32_t axisStepsPerRevolution(int32_t gearRatio, int32_t fullStepsPerRevolution, int32_t microsteps) {
+  return gearRatio * fullStepsPerRevolution * microsteps;
+}
+
+/**
+ * Function to get the steps per centidegree as a Q16 multiplier
+ * It is rounded up so that angles which are a whole number of steps convert to exactly that number
+ */
+constexpr uint32_t axisStepsPerCentidegreeQ16(int32_t stepsPerRevolution) {
+  return (uint32_t)(((uint64_t)stepsPerRevolution * 65536 + 35999) / 36000);
+}
+
+/**
+ * Function to convert centidegrees to steps with a Q16 multiplier, rounding towards zero so both directions match
+ */
+constexpr int32_t axisCentidegreesToSteps(int32_t centidegrees, uint32_t multiplierQ16) {
+  return centidegrees < 0 ? -(int32_t)(((uint32_t)-centidegrees * multiplierQ16) >> 16) : (int32_t)(((uint32_t)centidegrees * multiplierQ16) >> 16);
+}
+
+/**
+ * Compile-time description of one motor and the part of the chair it drives
+ * Everything is worked out by the compiler, so converting and clamping positions costs one multiply and a few compares
+ * @param GearRatio reduction of the gearbox (1:5 -> 5)
+ * @param FullStepsPerRevolution full steps of the motor per revolution
+ * @param Microsteps microstep setting of the driver
+ * @param Direction 1 if a positive move of the motor is a positive angle, -1 if it is reversed
+ * @param LimitDegrees largest angle in either direction
+ * @param MaxFullStepSpeed fastest allowed speed in full steps/sec
+ * @param MaxFullStepAcceleration largest allowed acceleration in full steps/sec^2
+ * @param MaxFullStepJerk largest allowed change of acceleration in full steps/sec^3, used by the S-curve moves
+ * @param BrakeFullStepAcceleration hardest the motor can brake in full steps/sec^2, only used by the safety envelope
+ */
+template <int32_t GearRatio, int32_t FullStepsPerRevolution, int32_t Microsteps, int8_t Direction,
+          int16_t LimitDegrees, uint32_t MaxFullStepSpeed, uint32_t MaxFullStepAcceleration, uint32_t MaxFullStepJerk,
+          uint32_t BrakeFullStepAcceleration>
+struct AxisConfig {
+  static constexpr int32_t STEPS_PER_REVOLUTION = axisStepsPerRevolution(GearRatio, FullStepsPerRevolution, Microsteps);
+  static constexpr uint32_t STEPS_PER_CENTIDEGREE_Q16 = axisStepsPerCentidegreeQ16(STEPS_PER_REVOLUTION);
+  static constexpr int8_t DIRECTION = Direction;
+
+  static constexpr int16_t LIMIT_CENTIDEGREES = LimitDegrees * 100;
+  static constexpr int32_t MAX_POSITION = axisCentidegreesToSteps(LIMIT_CENTIDEGREES, STEPS_PER_CENTIDEGREE_Q16);
+  static constexpr int32_t MIN_POSITION = -MAX_POSITION;
+
+  static constexpr uint32_t MAX_SPEED = MaxFullStepSpeed * Microsteps;
+  static constexpr uint32_t MAX_ACCELERATION = MaxFullStepAcceleration * Microsteps;
+  static constexpr uint32_t MAX_JERK = MaxFullStepJerk * Microsteps;
+  static constexpr uint32_t BRAKE_ACCELERATION = BrakeFullStepAcceleration * Microsteps;
+
+  static_assert(Direction == 1 || Direction == -1, "Direction must be 1 or -1");
+  static_assert(BrakeFullStepAcceleration >= MaxFullStepAcceleration, "The motor has to be able to brake at least as hard as it accelerates");
+  static_assert(LimitDegrees > 0 && LimitDegrees <= 180, "The limit must be between 1 and 180 degrees");
+  static_assert((uint64_t)LIMIT_CENTIDEGREES * STEPS_PER_CENTIDEGREE_Q16 < 0x80000000ULL, "Microsteps too fine to convert in 32 bits");
+
+  /**
+   * Function to convert an angle to steps without clamping
+   * @param centidegrees the angle in hundredths of a degree, within the limit
+   */
+  static constexpr int32_t toSteps(int32_t centidegrees) {
+    return axisCentidegreesToSteps(centidegrees, STEPS_PER_CENTIDEGREE_Q16);
+  }
+
+  /**
+   * Function to convert an angle to steps, clamping it to the limit first
+   * @param centidegrees the angle in hundredths of a degree
+   */
+  static constexpr int32_t positionFromCentidegrees(int32_t centidegrees) {
+    return toSteps(clampCentidegrees(centidegrees));
+  }
+
+  static constexpr int32_t clampCentidegrees(int32_t centidegrees) {
+    return centidegrees > LIMIT_CENTIDEGREES ? LIMIT_CENTIDEGREES : (centidegrees < -LIMIT_CENTIDEGREES ? -LIMIT_CENTIDEGREES : centidegrees);
+  }
+
+  static constexpr int32_t clampPosition(int32_t steps) {
+    return steps > MAX_POSITION ? MAX_POSITION : (steps < MIN_POSITION ? MIN_POSITION : steps);
+  }
+
+  static constexpr bool isWithinLimits(int32_t steps) {
+    return steps >= MIN_POSITION && steps <= MAX_POSITION;
+  }
+
+  /**
+   * Function to scale a speed, acceleration or distance given in full steps to the microstep setting
+   * Ride segments are written in full steps so they stay the same when the microstepping changes
+   */
+  static constexpr uint32_t fromFullSteps(uint32_t fullSteps) {
+    return fullSteps * Microsteps;
+  }
+};
+
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr int32_t AxisConfig<G, F, M, D, L, S, A, J, B>::STEPS_PER_REVOLUTION;
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr uint32_t AxisConfig<G, F, M, D, L, S, A, J, B>::STEPS_PER_CENTIDEGREE_Q16;
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr int8_t AxisConfig<G, F, M, D, L, S, A, J, B>::DIRECTION;
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr int16_t AxisConfig<G, F, M, D, L, S, A, J, B>::LIMIT_CENTIDEGREES;
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr int32_t AxisConfig<G, F, M, D, L, S, A, J, B>::MAX_POSITION;
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr int32_t AxisConfig<G, F, M, D, L, S, A, J, B>::MIN_POSITION;
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr uint32_t AxisConfig<G, F, M, D, L, S, A, J, B>::MAX_SPEED;
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr uint32_t AxisConfig<G, F, M, D, L, S, A, J, B>::MAX_ACCELERATION;
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr uint32_t AxisConfig<G, F, M, D, L, S, A, J, B>::MAX_JERK;
+template <int32_t G, int32_t F, int32_t M, int8_t D, int16_t L, uint32_t S, uint32_t A, uint32_t J, uint32_t B>
+constexpr uint32_t AxisConfig<G, F, M, D, L, S, A, J, B>::BRAKE_ACCELERATION;
+
+// stepper1 and stepper2 tilt the seat, together they make pitch (same direction) and roll (opposite directions)
+// stepper3 turns the seat for yaw
+// With the jerk limits the full acceleration builds up in 100 ms, or 200 ms for the yaw motor that turns the whole seat
+// The motors can brake harder than the moves accelerate, the safety envelope keeps that in reserve
+//                   gear, steps/rev, microsteps, direction, limit (degrees), max speed, max acceleration, max jerk, brake (full steps)
+typedef AxisConfig<5, 200, MICROSTEPS, 1, 30, 10000, 10000, 100000, 20000> Stepper1Axis;
+typedef AxisConfig<5, 200, MICROSTEPS, 1, 30, 10000, 10000, 100000, 20000> Stepper2Axis;
+typedef AxisConfig<5, 200, MICROSTEPS, 1, 20, 10000, 10000, 50000, 15000> Stepper3Axis;
+
+// Pitch and roll use the drive train of the seat motors, yaw the one of the turning motor
+typedef Stepper1Axis PitchAxis;
+typedef Stepper1Axis RollAxis;
+typedef Stepper3Axis YawAxis;
+
+#endif
@@ -0,0 +1,270 @@
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "Backlash.h"
+#include "SerialProtocol.h"
+#include "AxisConfig.h"
+#include "StepTrack.h"
+
+// Offset of the CRC within the record
+#define RECORD_CRC 3
+
+// Take-up steps run no faster than the motor is allowed to, time they need beyond their command is taken off pauses
+static const uint16_t TAKE_UP_TICKS[3] = { TICKS_PER_S / Stepper1Axis::MAX_SPEED, TICKS_PER_S / Stepper2Axis::MAX_SPEED, TICKS_PER_S / Stepper3Axis::MAX_SPEED };
+// A ramp that takes up the play is sped up to cover it in the time of the move, as far as the motor allows
+static const uint32_t TAKE_UP_MAX_SPEED[3] = { Stepper1Axis::MAX_SPEED, Stepper2Axis::MAX_SPEED, Stepper3Axis::MAX_SPEED };
+static const uint32_t TAKE_UP_MAX_ACCELERATION[3] = { Stepper1Axis::MAX_ACCELERATION, Stepper2Axis::MAX_ACCELERATION, Stepper3Axis::MAX_ACCELERATION };
+
+// The gears of stepper1, stepper2 and stepper3
+static uint8_t backlash[3] = { 0, 0, 0 };
+static int8_t gearDirection[3] = { 0, 0, 0 }; // 1 if the gears were last driven up, -1 if down, 0 if not yet
+static int32_t takeUp[3] = { 0, 0, 0 };       // How far the motor is ahead of the chair, in steps
+static uint32_t takeUpDebt[3] = { 0, 0, 0 };  // Ticks the take-up made the queue late by
+
+// A ramp sped up for the take-up, with the speed and acceleration it is put back to once its motor stops
+static bool rampRaised[3] = { false, false, false };
+static uint32_t ownRampSpeed[3] = { 0, 0, 0 }; // mHz
+static uint32_t ownRampAcceleration[3] = { 0, 0, 0 };
+
+// The gears before the S-curve slice waiting for the step queue was read, a halt drops the slice and puts them back
+static int8_t markedDirection[3] = { 0, 0, 0 };
+static int32_t markedTakeUp[3] = { 0, 0, 0 };
+
+/**
+ * Function to get how far a motor is ahead of the chair once its gears have been driven one way
+ * The play is split around the middle, where a motor starts out before its gears have been driven either way
+ * @param backlash the backlash of the motor in steps
+ * @param direction 1 if the gears were last driven up, -1 if down, 0 if not yet
+ * @return the motor position minus the chair position, in steps
+ */
+int32_t takeUpSteps(uint8_t backlash, int8_t direction) {
+  if (direction > 0) {
+    return (backlash + 1) / 2;
+  }
+  return direction < 0 ? -(int32_t)(backlash / 2) : 0;
+}
+
+/**
+ * Function to read the backlash measured at the last homing
+ * @param backlash filled with the backlash of stepper1, stepper2 and stepper3 in steps, all 0 without a record
+ * @return false if there is no good record
+ */
+bool loadBacklash(uint8_t *backlash) {
+  uint8_t record[BACKLASH_RECORD_SIZE];
+  uint16_t crc = 0xFFFF;
+  for (uint8_t i = 0; i < BACKLASH_RECORD_SIZE; i++) {
+    record[i] = EEPROM.read(BACKLASH_STORE_ADDRESS + i);
+  }
+  for (uint8_t i = 0; i < RECORD_CRC; i++) {
+    crc = updateCrc(crc, record[i]);
+  }
+
+  bool good = crc == readUint16(record + RECORD_CRC);
+  for (uint8_t i = 0; i < 3; i++) {
+    backlash[i] = good ? min(record[i], (uint8_t)BACKLASH_MAX_STEPS) : 0;
+  }
+  return good;
+}
+
+/**
+ * Function to keep the backlash in EEPROM
+ * Waits for the writes, up to 17 ms, so it is only called while the chair is at rest
+ * @param backlash the backlash of stepper1, stepper2 and stepper3 in steps
+ */
+void saveBacklash(const uint8_t *backlash) {
+  uint8_t record[BACKLASH_RECORD_SIZE];
+  uint16_t crc = 0xFFFF;
+  for (uint8_t i = 0; i < RECORD_CRC; i++) {
+    record[i] = backlash[i];
+    crc = updateCrc(crc, record[i]);
+  }
+  writeUint16(record + RECORD_CRC, crc);
+
+  for (uint8_t i = 0; i < BACKLASH_RECORD_SIZE; i++) {
+    EEPROM.update(BACKLASH_STORE_ADDRESS + i, record[i]);
+  }
+}
+
+/**
+ * Function to set the backlash of every stepper and which way its gears were last driven
+ * @param steps the backlash of stepper1, stepper2 and stepper3 in steps
+ * @param direction 1 if the gears of every stepper were last driven up, which is how homing ends, 0 if not known
+ */
+void initGears(const uint8_t *steps, int8_t direction) {
+  for (uint8_t i = 0; i < 3; i++) {
+    backlash[i] = min(steps[i], (uint8_t)BACKLASH_MAX_STEPS);
+    gearDirection[i] = direction;
+    takeUp[i] = takeUpSteps(backlash[i], direction);
+  }
+}
+
+/**
+ * Function to change the backlash of a stepper
+ * It takes effect the next time the stepper turns around, until then the motor stays ahead of the chair as it is
+ * @param index the stepper, 0 is stepper1
+ * @param steps the backlash in steps, up to BACKLASH_MAX_STEPS
+ */
+void setBacklash(uint8_t index, uint8_t steps) {
+  backlash[index] = min(steps, (uint8_t)BACKLASH_MAX_STEPS);
+}
+
+/**
+ * Function to get the backlash a stepper is compensated for, in steps
+ */
+uint8_t getBacklash(uint8_t index) {
+  return backlash[index];
+}
+
+/**
+ * Function to get how far a motor is ahead of the chair because of the play in its gears, in steps
+ * It changes when a move that turns the motor around is planned, before the motor gets there
+ */
+int32_t getTakeUpSteps(uint8_t index) {
+  return takeUp[index];
+}
+
+/**
+ * Function to note which way the gears of a stepper are about to be driven
+ * @param index the stepper
+ * @param direction 1 for up, -1 for down
+ * @return how many steps further the motor has to go to take up the play, 0 if it doesn't turn around
+ */
+static int32_t turnGears(uint8_t index, int8_t direction) {
+  if (direction == gearDirection[index]) {
+    return 0;
+  }
+  gearDirection[index] = direction;
+  int32_t offset = takeUpSteps(backlash[index], direction);
+  int32_t change = offset - takeUp[index];
+  takeUp[index] = offset;
+  return change < 0 ? -change : change;
+}
+
+/**
+ * Function to convert a target of the chair into one of the motor, taking up the play when the motor turns around
+ * Which way the motor goes is judged from where it is now, a ramp that still has to brake before it turns is
+ * already counted as turned
+ * @param index the stepper
+ * @param position the target of the chair in steps
+ * @param motorPosition where the motor is now in steps
+ */
+int32_t motorTarget(uint8_t index, int32_t position, int32_t motorPosition) {
+  int32_t ahead = position + takeUp[index] - motorPosition;
+  if (ahead != 0) {
+    turnGears(index, ahead > 0 ? 1 : -1);
+  }
+  return position + takeUp[index];
+}
+
+/**
+ * Function to scale the ramp of a move up so that it covers the take-up steps as well in the same time
+ * Speed and acceleration scaled alike keep the shape of the ramp in time
+ * @param value the speed in mHz or the acceleration planned for the move of the chair
+ * @param distance the steps the chair moves
+ * @param extra the take-up steps on top
+ * @param limit the largest value the motor allows
+ */
+static uint32_t scaleForTakeUp(uint32_t value, uint32_t distance, int32_t extra, uint32_t limit) {
+  if (distance == 0 || extra == 0 || value >= limit) {
+    return value;
+  }
+  uint64_t scaled = (uint64_t)value * (distance + extra) / distance;
+  return scaled > limit ? limit : (uint32_t)scaled;
+}
+
+/**
+ * Function to speed up the ramp of a stepper that turns around so that it takes up the play within the time of
+ * its move
+ * The ramp it had is put back by lowerRamp() once it stops, a move that blends in before then keeps the pace,
+ * putting it back while moving would leave the motor too little acceleration to brake in time.
+ * @param stepper the stepper, already sent to its new target
+ * @param index the stepper, 0 is stepper1
+ * @param distance the steps the chair moves
+ * @param extra the take-up steps on top, 0 if the stepper doesn't turn around
+ */
+void raiseRampForTakeUp(FastAccelStepper *stepper, uint8_t index, uint32_t distance, int32_t extra) {
+  if (extra == 0 || distance == 0) {
+    return;
+  }
+  if (!rampRaised[index]) {
+    ownRampSpeed[index] = stepper -> getSpeedInMilliHz();
+    ownRampAcceleration[index] = stepper -> getAcceleration();
+  }
+  stepper -> setSpeedInMilliHz(scaleForTakeUp(ownRampSpeed[index], distance, extra, TAKE_UP_MAX_SPEED[index] * 1000));
+  stepper -> setAcceleration(scaleForTakeUp(ownRampAcceleration[index], distance, extra, TAKE_UP_MAX_ACCELERATION[index]));
+  stepper -> applySpeedAcceleration();
+  rampRaised[index] = true;
+}
+
+/**
+ * Function to put back the ramp a stepper had before it was sped up for the take-up
+ * @param stepper the stepper
+ * @param index the stepper, 0 is stepper1
+ */
+void lowerRamp(FastAccelStepper *stepper, uint8_t index) {
+  if (rampRaised[index]) {
+    stepper -> setSpeedInMilliHz(ownRampSpeed[index]);
+    stepper -> setAcceleration(ownRampAcceleration[index]);
+    rampRaised[index] = false;
+  }
+}
+
+/**
+ * Function to add the take-up steps to a command for the step queue that turns its stepper around
+ * The command keeps its length as long as its steps can go at the speed limit of the motor, anything beyond that
+ * is taken off the pauses after it so that S-curves and tracks stay on time.
+ * Called once for every command as it is read, not again when the queue was full.
+ * @param index the stepper
+ * @param ticks the ticks between the steps of the command, or the length of a pause, changed in place
+ * @param steps the steps of the command, changed in place
+ * @param countUp which way the command steps
+ */
+void takeUpInCommand(uint8_t index, uint16_t &ticks, uint8_t &steps, bool countUp) {
+  if (steps == 0) {
+    uint32_t spare = ticks > TRACK_MIN_PAUSE_TICKS ? ticks - TRACK_MIN_PAUSE_TICKS : 0;
+    uint32_t paid = min(spare, takeUpDebt[index]);
+    ticks -= paid;
+    takeUpDebt[index] -= paid;
+    return;
+  }
+
+  int32_t extra = turnGears(index, countUp ? 1 : -1);
+  if (extra == 0) {
+    return;
+  }
+  uint32_t length = (uint32_t)ticks * steps;
+  uint8_t total = steps + extra;
+  uint32_t shortest = (uint32_t)TAKE_UP_TICKS[index] * total;
+  if (length < shortest) {
+    takeUpDebt[index] += shortest - length;
+    length = shortest;
+  }
+  ticks = length / total;
+  steps = total;
+}
+
+/**
+ * Function to forget the time the take-up made the step queue late by, when an S-curve or a track starts
+ * @param index the stepper
+ */
+void clearTakeUpDebt(uint8_t index) {
+  takeUpDebt[index] = 0;
+}
+
+/**
+ * Function to remember the gears of a stepper before a command for its step queue is read
+ * @param index the stepper
+ */
+void markGears(uint8_t index) {
+  markedDirection[index] = gearDirection[index];
+  markedTakeUp[index] = takeUp[index];
+}
+
+/**
+ * Function to put the gears of a stepper back to where markGears() found them
+ * A command that was read but never queued didn't turn them
+ * @param index the stepper
+ */
+void rewindGears(uint8_t index) {
+  gearDirection[index] = markedDirection[index];
+  takeUp[index] = markedTakeUp[index];
+}
@@ -0,0 +1,50 @@
+#ifndef BACKLASH_H
+#define BACKLASH_H
+
+#include <stdint.h>
+#include "FastAccelStepper.h"
+#include "PositionStore.h"
+
+// The play in the gearbox behind each motor
+//
+// When a motor turns around, it turns by the backlash of its gearbox before the teeth meet on the other side and the
+// chair moves again. Every reversal loses that much motion, which eats most of a short fast swing like a rumble.
+//
+// The scheduler keeps track of which way the gears of each motor were last driven. A move that turns a motor around
+// gets the backlash added to its own steps: to the target of a ramp, which is sped up to cover them in the time of
+// the move, or to the first command of an S-curve or a step track in the new direction, squeezed into the time of
+// that command. Taking up the play never costs a move of its own. From then on the motor is ahead of the chair by
+// takeUpSteps() in the way it was driven, and everything that works with where the chair is (targets, limits,
+// telemetry and the saved positions) takes that off.
+//
+// Homing measures the backlash of every motor at its switch (Homing.h) and keeps it in EEPROM, after the position
+// records:
+//   stepper1 | stepper2 | stepper3 (uint8 steps) | CRC low | CRC high
+// with the CRC of SerialProtocol.h. A chair that has never homed has no record and compensates nothing. The
+// BACKLASH command of the shell shows the values and sets one by hand.
+
+#define BACKLASH_STORE_ADDRESS (POSITION_STORE_ADDRESS + POSITION_STORE_SLOTS * POSITION_RECORD_SIZE)
+#define BACKLASH_RECORD_SIZE 5
+
+// Largest backlash that is compensated, in steps
+// A step track command has up to 127 steps and an S-curve slice up to 100, the take-up has to fit on top of either
+// within the 255 steps of a queue entry
+#define BACKLASH_MAX_STEPS 100
+
+int32_t takeUpSteps(uint8_t backlash, int8_t direction);
+bool loadBacklash(uint8_t *backlash);
+void saveBacklash(const uint8_t *backlash);
+
+void initGears(const uint8_t *steps, int8_t direction);
+void setBacklash(uint8_t index, uint8_t steps);
+uint8_t getBacklash(uint8_t index);
+int32_t getTakeUpSteps(uint8_t index);
+int32_t motorTarget(uint8_t index, int32_t position, int32_t motorPosition);
+void raiseRampForTakeUp(FastAccelStepper *stepper, uint8_t index, uint32_t distance, int32_t extra);
+void lowerRamp(FastAccelStepper *stepper, uint8_t index);
+void takeUpInCommand(uint8_t index, uint16_t &ticks, uint8_t &steps, bool countUp);
+void clearTakeUpDebt(uint8_t index);
+void markGears(uint8_t index);
+void rewindGears(uint8_t index);
+
+#endif
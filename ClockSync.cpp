@@ -0,0 +1,126 @@
+#include "ClockSync.h"
+
+/**
+ * Function to start the estimate over, the counters since startup are kept
+ * Without a fix the timeline is taken to be micros()
+ * @param sync the estimate
+ */
+static void restartClockSync(ClockSync &sync) {
+  sync.newest.local = 0;
+  sync.newest.shared = 0;
+  sync.anchor = sync.newest;
+  sync.midpoint = sync.newest;
+  sync.best = sync.newest;
+  sync.bestResidual = 0;
+  sync.windowCount = 0;
+  sync.fixes = 0;
+  sync.driftPpb = 0;
+  sync.lastCorrection = 0;
+}
+
+/**
+ * Function to set up the estimate before the first sync
+ * @param sync the estimate
+ */
+void initClockSync(ClockSync &sync) {
+  restartClockSync(sync);
+  sync.syncs = 0;
+  sync.restarts = 0;
+}
+
+/**
+ * Function to add a fix and measure the drift from the anchor to it
+ * @param sync the estimate
+ * @param fix the earliest sync of the window
+ */
+static void addFix(ClockSync &sync, const SyncFix &fix) {
+  if (sync.fixes == 0) {
+    sync.anchor = fix;
+    sync.midpoint = fix;
+  } else if (fix.local - sync.midpoint.local >= SYNC_DRIFT_SPAN_MS * 1000 / 2) {
+    sync.anchor = sync.midpoint;
+    sync.midpoint = fix;
+  }
+  sync.newest = fix;
+  if (sync.fixes < 0xFF) {
+    sync.fixes++;
+  }
+
+  int32_t local = (int32_t)(fix.local - sync.anchor.local);
+  if (local <= 0) {
+    return;
+  }
+  int32_t shared = (int32_t)(fix.shared - sync.anchor.shared);
+  int64_t drift = (int64_t)(shared - local) * 1000000000LL / local;
+  if (drift > SYNC_MAX_DRIFT_PPM * 1000 || drift < -SYNC_MAX_DRIFT_PPM * 1000) {
+    restartClockSync(sync);
+    sync.restarts++;
+    return;
+  }
+  sync.driftPpb = (int32_t)drift;
+}
+
+/**
+ * Function to take in a sync from the host
+ * @param sync the estimate
+ * @param sharedMicros the timeline in the sync
+ * @param localMicros micros() when it arrived
+ * @return true when the sync ended a window and there is a new fix
+ */
+bool takeSync(ClockSync &sync, uint32_t sharedMicros, uint32_t localMicros) {
+  int32_t residual = (int32_t)(sharedMicros - toSharedMicros(sync, localMicros));
+  sync.syncs++;
+
+  if (sync.fixes > 0 && (residual > SYNC_MAX_STEP_MICROS || residual < -SYNC_MAX_STEP_MICROS)) {
+    restartClockSync(sync);
+    sync.restarts++;
+    residual = (int32_t)(sharedMicros - localMicros);
+  }
+
+  // The sync that waited least on the way is the one furthest ahead of the estimate
+  if (sync.windowCount == 0 || residual > sync.bestResidual) {
+    sync.best.local = localMicros;
+    sync.best.shared = sharedMicros;
+    sync.bestResidual = residual;
+  }
+  if (++sync.windowCount < SYNC_WINDOW) {
+    return false;
+  }
+
+  sync.windowCount = 0;
+  sync.lastCorrection = sync.fixes > 0 ? sync.bestResidual : 0;
+  addFix(sync, sync.best);
+  return true;
+}
+
+/**
+ * Function to check whether the chair knows the timeline well enough to play on it
+ * That takes two fixes, one for the offset and one more for the drift
+ * @param sync the estimate
+ */
+bool isClockSynced(const ClockSync &sync) {
+  return sync.fixes >= 2;
+}
+
+/**
+ * Function to convert a time of the chair to the timeline
+ * @param sync the estimate
+ * @param localMicros a time on micros()
+ * @return the same time on the timeline
+ */
+uint32_t toSharedMicros(const ClockSync &sync, uint32_t localMicros) {
+  int32_t elapsed = (int32_t)(localMicros - sync.newest.local);
+  return sync.newest.shared + elapsed + (int32_t)((int64_t)elapsed * sync.driftPpb / 1000000000LL);
+}
+
+/**
+ * Function to convert a time on the timeline to the clock of the chair
+ * The drift is at most a few thousandths, so taking it off the timeline instead of dividing is close enough
+ * @param sync the estimate
+ * @param sharedMicros a time on the timeline
+ * @return the same time on micros()
+ */
+uint32_t toLocalMicros(const ClockSync &sync, uint32_t sharedMicros) {
+  int32_t elapsed = (int32_t)(sharedMicros - sync.newest.shared);
+  return sync.newest.local + elapsed - (int32_t)((int64_t)elapsed * sync.driftPpb / 1000000000LL);
+}
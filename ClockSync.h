@@ -0,0 +1,60 @@
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+
+#include <stdint.h>
+
+// The clock of the chair against the shared timeline of a host that plays one ride on several chairs
+//
+// The host sends MSG_SYNC frames with its timeline in microseconds, stamped with the moment the frame is written
+// plus the link latency it measured with MSG_PING. A sync can only arrive late, by however long it waited in the
+// buffers on the way and for the next pass through loop(), never early. So of every SYNC_WINDOW syncs only the one
+// that arrived earliest against the current estimate is kept, as a fix. The offset is taken from the newest fix.
+// The drift of the crystal is the slope from an older fix to the newest one, between SYNC_DRIFT_SPAN_MS / 2 and
+// SYNC_DRIFT_SPAN_MS apart once the chair has been synced that long, so the noise of the fixes is spread over a
+// long time.
+//
+// Ride times on the timeline are turned into micros() of the chair right before they are waited for, so every fix
+// is taken into account, and step tracks are stretched by the drift so they play at the rate of the timeline.
+
+// Syncs per fix, at the SYNC_INTERVAL_MS of the host a fix every second
+#define SYNC_WINDOW 10
+
+// The host sends a sync this often
+#define SYNC_INTERVAL_MS 100
+
+// Longest time the drift is measured over
+#define SYNC_DRIFT_SPAN_MS 60000UL
+
+// A sync further off than this means the host started a new timeline, the estimate starts over
+#define SYNC_MAX_STEP_MICROS 50000L
+
+// More drift than this is not a crystal, the estimate starts over
+#define SYNC_MAX_DRIFT_PPM 5000L
+
+// One point where the clock of the chair and the timeline are known to meet
+struct SyncFix {
+  uint32_t local;  // micros() of the chair
+  uint32_t shared; // The timeline in microseconds
+};
+
+struct ClockSync {
+  SyncFix newest;         // The offset is taken from here
+  SyncFix anchor;         // The drift is the slope from here to the newest fix
+  SyncFix midpoint;       // Becomes the anchor once the newest fix is half a span past it
+  SyncFix best;           // Earliest sync of the window so far
+  int32_t bestResidual;   // How far its timeline was ahead of the estimate, in microseconds
+  uint8_t windowCount;    // Syncs in the window so far
+  uint8_t fixes;          // Fixes since the estimate started, up to 255
+  int32_t driftPpb;       // How much faster the timeline runs than micros(), in parts per billion
+  int32_t lastCorrection; // How far the newest fix was from the estimate before it, in microseconds
+  uint16_t syncs;         // Syncs received since startup
+  uint16_t restarts;      // Times the estimate started over
+};
+
+void initClockSync(ClockSync &sync);
+bool takeSync(ClockSync &sync, uint32_t sharedMicros, uint32_t localMicros);
+bool isClockSynced(const ClockSync &sync);
+uint32_t toSharedMicros(const ClockSync &sync, uint32_t localMicros);
+uint32_t toLocalMicros(const ClockSync &sync, uint32_t sharedMicros);
+
+#endif
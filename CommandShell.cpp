@@ -0,0 +1,304 @@
+#include "Arduino.h"
+#include "CommandShell.h"
+
+// How the words after the name of a command are read
+enum CommandArguments : uint8_t {
+  ARGUMENTS_NONE,
+  ARGUMENTS_MOVE,   // An axis, an angle and options
+  ARGUMENTS_NUMBER, // A number that may be left out
+  ARGUMENTS_PAIR    // Two numbers that may be left out together
+};
+
+struct CommandEntry {
+  char name[9];
+  uint8_t id;        // CommandId
+  uint8_t arguments; // CommandArguments
+  char usage[64];
+  char description[52];
+};
+
+// The commands, in the order HELP lists them
+static const CommandEntry COMMANDS[] PROGMEM = {
+  { "HELP", COMMAND_HELP, ARGUMENTS_NONE, "HELP", "List the commands" },
+  { "MOVE", COMMAND_MOVE, ARGUMENTS_MOVE, "MOVE PITCH|ROLL|YAW degrees [SPEED steps/s] [ACCEL steps/s^2]",
+    "Swing to the angle, to the opposite one and back" },
+  { "FULL", COMMAND_FULL, ARGUMENTS_NONE, "FULL", "Full experience of motion" },
+  { "COASTER", COMMAND_COASTER, ARGUMENTS_NONE, "COASTER", "Roller coaster simulation" },
+  { "RIDE", COMMAND_RIDE, ARGUMENTS_NUMBER, "RIDE [number]", "Ride from the library, without a number the list" },
+  { "STREAM", COMMAND_STREAM, ARGUMENTS_NONE, "STREAM", "Follow the poses sent by a host until the next line" },
+  { "STOP", COMMAND_STOP, ARGUMENTS_NONE, "STOP", "Drop everything queued, the current move ends" },
+  { "STATS", COMMAND_STATS, ARGUMENTS_NONE, "STATS", "Free SRAM and how long commands take to parse" },
+  { "BACKLASH", COMMAND_BACKLASH, ARGUMENTS_PAIR, "BACKLASH [motor steps]", "Backlash of the motors, or set one by hand" }
+};
+#define COMMAND_COUNT (sizeof(COMMANDS) / sizeof(COMMANDS[0]))
+
+// In the order of AxisId
+static const char AXIS_NAMES[][6] PROGMEM = { "PITCH", "ROLL", "YAW" };
+#define AXIS_COUNT (sizeof(AXIS_NAMES) / sizeof(AXIS_NAMES[0]))
+
+// In the order of the OPTION_ flags
+static const char OPTION_NAMES[][6] PROGMEM = { "SPEED", "ACCEL" };
+#define OPTION_COUNT (sizeof(OPTION_NAMES) / sizeof(OPTION_NAMES[0]))
+
+/**
+ * Function to cut the next word out of the line, the space after it is overwritten to end it
+ * @param cursor where the rest of the line starts, moved past the word
+ * @return the word, or nullptr at the end of the line
+ */
+static char *cutWord(char *&cursor) {
+  while (*cursor == ' ' || *cursor == '\t') {
+    cursor++;
+  }
+  if (*cursor == '\0') {
+    return nullptr;
+  }
+
+  char *word = cursor;
+  while (*cursor != '\0' && *cursor != ' ' && *cursor != '\t') {
+    cursor++;
+  }
+  if (*cursor != '\0') {
+    *cursor++ = '\0';
+  }
+  return word;
+}
+
+/**
+ * Function to look a word up in a table of names in flash, ignoring case
+ * @param word the word
+ * @param names the first name of the table
+ * @param count the number of names
+ * @param stride the bytes from one name to the next
+ * @return the index of the name, or -1 if it is not in the table
+ */
+static int8_t findName(const char *word, const char *names, uint8_t count, uint8_t stride) {
+  for (uint8_t i = 0; i < count; i++) {
+    if (strcasecmp_P(word, names + i * stride) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * Function to read a decimal number without floating point math
+ * @param word the number, with an optional sign and decimal point
+ * @param decimals how many digits after the point are kept, the value is scaled by 10 to this power
+ * @param value set to the number, cut off at COMMAND_NUMBER_LIMIT either way
+ * @return false if the word is not a number
+ */
+static bool parseNumber(const char *word, uint8_t decimals, int32_t &value) {
+  bool negative = *word == '-';
+  if (*word == '-' || *word == '+') {
+    word++;
+  }
+
+  int32_t number = 0;
+  bool digits = false;
+  bool point = false;
+  for (; *word != '\0'; word++) {
+    if (*word == '.' && !point) {
+      point = true;
+      continue;
+    }
+    if (*word < '0' || *word > '9') {
+      return false;
+    }
+    digits = true;
+
+    // Digits beyond the ones kept are dropped, like a float cast to an integer would
+    if (point) {
+      if (decimals == 0) {
+        continue;
+      }
+      decimals--;
+    }
+    if (number <= COMMAND_NUMBER_LIMIT) {
+      number = number * 10 + (*word - '0');
+    }
+  }
+  if (!digits) {
+    return false;
+  }
+
+  for (; decimals > 0; decimals--) {
+    number *= 10;
+  }
+  if (number > COMMAND_NUMBER_LIMIT) {
+    number = COMMAND_NUMBER_LIMIT;
+  }
+  value = negative ? -number : number;
+  return true;
+}
+
+/**
+ * Function to read the axis, the angle and the options of MOVE
+ * @param cursor where the words after MOVE start
+ * @param command the command to fill in
+ */
+static ShellError parseMove(char *&cursor, Command &command) {
+  char *word = cutWord(cursor);
+  if (!word) {
+    return SHELL_MISSING_ARGUMENT;
+  }
+  command.word = word;
+  int8_t axis = findName(word, AXIS_NAMES[0], AXIS_COUNT, sizeof(AXIS_NAMES[0]));
+  if (axis < 0) {
+    return SHELL_UNKNOWN_AXIS;
+  }
+  command.axis = (AxisId)axis;
+
+  word = cutWord(cursor);
+  if (!word) {
+    return SHELL_MISSING_ARGUMENT;
+  }
+  command.word = word;
+  if (!parseNumber(word, 2, command.centidegrees)) {
+    return SHELL_BAD_NUMBER;
+  }
+
+  // The options can come in any order, each is a name and a value
+  while ((word = cutWord(cursor)) != nullptr) {
+    command.word = word;
+    int8_t option = findName(word, OPTION_NAMES[0], OPTION_COUNT, sizeof(OPTION_NAMES[0]));
+    if (option < 0) {
+      return SHELL_UNKNOWN_OPTION;
+    }
+
+    word = cutWord(cursor);
+    if (!word) {
+      return SHELL_MISSING_ARGUMENT;
+    }
+    command.word = word;
+    if (!parseNumber(word, 0, (1 << option) == OPTION_SPEED ? command.speed : command.acceleration)) {
+      return SHELL_BAD_NUMBER;
+    }
+    command.options |= 1 << option;
+  }
+  return SHELL_OK;
+}
+
+/**
+ * Function to parse a line of input into a command
+ * The line is cut into words where it lies, so it must not be used as text afterwards
+ * @param line the line, ended by '\0'
+ * @param command set to the command, COMMAND_NONE for an empty line
+ * @return SHELL_OK, or what is wrong with the line, command.word points at where
+ */
+ShellError parseCommand(char *line, Command &command) {
+  memset(&command, 0, sizeof(command));
+
+  char *cursor = line;
+  char *word = cutWord(cursor);
+  if (!word) {
+    return SHELL_OK;
+  }
+  command.word = word;
+  int8_t entry = findName(word, COMMANDS[0].name, COMMAND_COUNT, sizeof(COMMANDS[0]));
+  if (entry < 0) {
+    return SHELL_UNKNOWN_COMMAND;
+  }
+  command.id = (CommandId)pgm_read_byte(&COMMANDS[entry].id);
+
+  switch (pgm_read_byte(&COMMANDS[entry].arguments)) {
+    case ARGUMENTS_MOVE: {
+      ShellError error = parseMove(cursor, command);
+      if (error != SHELL_OK) {
+        return error;
+      }
+      break;
+    }
+
+    case ARGUMENTS_NUMBER:
+    case ARGUMENTS_PAIR:
+      word = cutWord(cursor);
+      if (word) {
+        command.word = word;
+        if (!parseNumber(word, 0, command.number)) {
+          return SHELL_BAD_NUMBER;
+        }
+      }
+      if (word && pgm_read_byte(&COMMANDS[entry].arguments) == ARGUMENTS_PAIR) {
+        word = cutWord(cursor);
+        if (!word) {
+          return SHELL_MISSING_ARGUMENT;
+        }
+        command.word = word;
+        if (!parseNumber(word, 0, command.steps)) {
+          return SHELL_BAD_NUMBER;
+        }
+      }
+      break;
+  }
+
+  word = cutWord(cursor);
+  if (word) {
+    command.word = word;
+    return SHELL_TOO_MANY_ARGUMENTS;
+  }
+  return SHELL_OK;
+}
+
+/**
+ * Function to print how a command is used and what it does
+ */
+static void printUsage(uint8_t entry) {
+  Serial.print((const __FlashStringHelper *)COMMANDS[entry].usage);
+  Serial.print(F(" - "));
+  Serial.println((const __FlashStringHelper *)COMMANDS[entry].description);
+}
+
+/**
+ * Function to print the list of commands
+ */
+void printCommandHelp() {
+  Serial.println(F("Commands:"));
+  for (uint8_t i = 0; i < COMMAND_COUNT; i++) {
+    printUsage(i);
+  }
+  Serial.println(F("Ctrl-X stops at once, Ctrl-\\ pauses and Ctrl-] resumes, also in the middle of a line"));
+  Serial.println();
+}
+
+/**
+ * Function to tell the user what is wrong with a line
+ * @param error what parseCommand() found
+ * @param command the command it was parsing, for the word and the usage
+ */
+void printShellError(ShellError error, const Command &command) {
+  switch (error) {
+    case SHELL_OK:
+      return;
+    case SHELL_UNKNOWN_COMMAND:
+      Serial.print(F("Unknown command: "));
+      break;
+    case SHELL_UNKNOWN_AXIS:
+      Serial.print(F("Unknown axis: "));
+      break;
+    case SHELL_UNKNOWN_OPTION:
+      Serial.print(F("Unknown option: "));
+      break;
+    case SHELL_BAD_NUMBER:
+      Serial.print(F("Not a number: "));
+      break;
+    case SHELL_MISSING_ARGUMENT:
+      Serial.print(F("Missing a value after: "));
+      break;
+    case SHELL_TOO_MANY_ARGUMENTS:
+      Serial.print(F("Unexpected: "));
+      break;
+  }
+  Serial.println(command.word);
+
+  if (error == SHELL_UNKNOWN_COMMAND) {
+    Serial.println(F("Enter HELP for the list of commands."));
+  } else {
+    for (uint8_t i = 0; i < COMMAND_COUNT; i++) {
+      if (pgm_read_byte(&COMMANDS[i].id) == command.id) {
+        Serial.print(F("Usage: "));
+        printUsage(i);
+      }
+    }
+  }
+  Serial.println();
+}
@@ -0,0 +1,73 @@
+#ifndef COMMAND_SHELL_H
+#define COMMAND_SHELL_H
+
+#include <stdint.h>
+
+// Line commands typed into the serial port, one per line, for example
+//
+//   MOVE PITCH 20 SPEED 2000 ACCEL 1000
+//   RIDE 3
+//   STOP
+//
+// A line is parsed where it was read: the words are cut apart by writing over the spaces between them and looked up
+// in tables kept in flash, like every message the shell prints, so a command costs no heap and no SRAM for its text.
+// Words are not case sensitive and HELP lists the commands. The sketch carries them out, see handleCommand() in
+// MotionSimulationChair.cpp. The control bytes of SerialProtocol.h never get into a line, the sketch acts on them as
+// they arrive.
+
+// Longest line that is kept, anything beyond it is dropped
+#define COMMAND_LINE_LENGTH 48
+
+// Numbers are cut off here so that they never overflow
+#define COMMAND_NUMBER_LIMIT 999999L
+
+enum CommandId : uint8_t {
+  COMMAND_NONE,       // An empty line
+  COMMAND_HELP,       // HELP
+  COMMAND_MOVE,       // MOVE axis degrees [SPEED steps/s] [ACCEL steps/s^2]
+  COMMAND_FULL,       // FULL, the full experience of motion
+  COMMAND_COASTER,    // COASTER, the roller coaster simulation
+  COMMAND_RIDE,       // RIDE [number], a ride from the library, or the list of them
+  COMMAND_STREAM,     // STREAM, follow the poses sent by a host
+  COMMAND_STOP,       // STOP, drop everything queued
+  COMMAND_STATS,      // STATS, free SRAM and parse time
+  COMMAND_BACKLASH    // BACKLASH [motor steps], the backlash of the motors, or set one
+};
+
+enum AxisId : uint8_t {
+  AXIS_PITCH,
+  AXIS_ROLL,
+  AXIS_YAW
+};
+
+enum ShellError : uint8_t {
+  SHELL_OK,
+  SHELL_UNKNOWN_COMMAND,
+  SHELL_UNKNOWN_AXIS,
+  SHELL_UNKNOWN_OPTION,
+  SHELL_BAD_NUMBER,
+  SHELL_MISSING_ARGUMENT,
+  SHELL_TOO_MANY_ARGUMENTS
+};
+
+// Options given to MOVE
+#define OPTION_SPEED 0x01
+#define OPTION_ACCELERATION 0x02
+
+struct Command {
+  CommandId id;
+  AxisId axis;
+  uint8_t options;      // OPTION_ flags of the values that were given
+  int32_t centidegrees; // Angle of MOVE
+  int32_t speed;        // steps/sec of MOVE, checked by the sketch
+  int32_t acceleration; // steps/sec^2 of MOVE, checked by the sketch
+  int32_t number;       // Ride of RIDE counted from 1, or motor of BACKLASH, 0 if none was given
+  int32_t steps;        // Backlash of BACKLASH, checked by the sketch
+  const char *word;     // The word an error was found at, in the line
+};
+
+ShellError parseCommand(char *line, Command &command);
+void printCommandHelp();
+void printShellError(ShellError error, const Command &command);
+
+#endif
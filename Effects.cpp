@@ -0,0 +1,343 @@
+#include "Arduino.h"
+#include "Effects.h"
+#include "AxisConfig.h"
+
+// Effects may use half of a motor's acceleration, the other half is left to the motion under them
+#define EFFECT_ACCELERATION_SHARE 2
+
+// Times up to this long before the start of an effect count as before it, not as a wrapped around micros()
+#define BEFORE_START_MICROS 1000000UL
+
+// One running effect, with everything worked out when it started
+struct EffectSlot {
+  uint8_t type;
+  int16_t amplitude[3];   // Centidegrees after trimming to the acceleration limits
+  uint32_t phaseStep[3];  // Cycles per microsecond in Q32
+  uint32_t startedAt;
+  uint32_t durationMicros; // 0 runs until stopped
+};
+
+static EffectSlot slots[EFFECT_SLOTS];
+
+// First quarter of a sine wave in Q15, the other three quarters are mirrored from it
+static const int16_t SINE_QUARTER[65] PROGMEM = {
+  0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+  6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+  12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+  18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+  23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+  27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+  30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+  32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+  32767
+};
+
+// Engine vibrations start a quarter cycle apart on each axis, so the seat circles instead of rocking along a line
+static const uint32_t ENGINE_PHASE[3] = { 0, 0x40000000UL, 0x80000000UL };
+
+// Added to the noise cell number so every axis gets its own noise
+static const uint32_t NOISE_SALT[3] = { 0x9E3779B9UL, 0x7F4A7C15UL, 0x2545F491UL };
+
+// Effects the ride scripts start by number, in the order of EffectPreset
+static const EffectSettings PRESETS[EFFECT_PRESETS] PROGMEM = {
+  // slot, type, amplitude (pitch, roll, yaw), frequency (pitch, roll, yaw), duration
+  { EFFECT_ALL_SLOTS, EFFECT_OFF, { 0, 0, 0 }, { 0, 0, 0 }, 0 },
+  { 0, EFFECT_ROAD, { 120, 150, 80 }, { 600, 700, 500 }, 0 },
+  { 1, EFFECT_ENGINE, { 40, 0, 20 }, { 1000, 0, 1000 }, 0 },
+  { 2, EFFECT_IMPACT, { 200, 80, 0 }, { 400, 400, 0 }, 500 }
+};
+
+/**
+ * Function to look up the sine of a phase
+ * @param phase the phase in cycles in Q32, a whole cycle wraps around to 0
+ * @return the sine in Q15
+ */
+static int16_t sine(uint32_t phase) {
+  // Position within the quarter in Q10 table entries
+  uint32_t position = (phase & 0x3FFFFFFFUL) >> 14;
+  if (phase & 0x40000000UL) {
+    position = 65536 - position;
+  }
+
+  uint8_t index = position >> 10;
+  int16_t value = pgm_read_word(&SINE_QUARTER[index]);
+  if (index < 64) {
+    int16_t next = pgm_read_word(&SINE_QUARTER[index + 1]);
+    value += ((int32_t)(next - value) * (position & 1023)) >> 10;
+  }
+  return (phase & 0x80000000UL) ? -value : value;
+}
+
+/**
+ * Function to turn a number into a random looking one, the same number always gives the same result
+ * Integer hash of xorshifts and multiplies (lowbias32), which is all a random generator without state needs
+ */
+static uint32_t hash(uint32_t value) {
+  value ^= value >> 16;
+  value *= 0x7FEB352DUL;
+  value ^= value >> 15;
+  value *= 0x846CA68BUL;
+  value ^= value >> 16;
+  return value;
+}
+
+/**
+ * Function to work out how many noise cells have passed at a time
+ * The product of the time and the step is up to 49 bits, only the bits from 16 up are needed. They are put together
+ * from 32 x 16 and 16 x 16 bit multiplies, a 64-bit multiply is a slow library call on the AVR.
+ * @param elapsed the time in microseconds
+ * @param phaseStep cells per microsecond in Q32
+ * @return the cells in Q16, wrapped around after 65536 cells
+ */
+static uint32_t noisePhase(uint32_t elapsed, uint32_t phaseStep) {
+  uint16_t elapsedHigh = elapsed >> 16;
+  uint16_t elapsedLow = elapsed;
+  uint16_t stepHigh = phaseStep >> 16;
+  uint16_t stepLow = phaseStep;
+  return elapsed * stepHigh + (uint32_t)elapsedHigh * stepLow + (((uint32_t)elapsedLow * stepLow) >> 16);
+}
+
+/**
+ * Function to get smooth noise: a random value at the start of every cell, eased into the next one
+ * @param phase the time in cells in Q16 from noisePhase()
+ * @param salt makes the noise of each axis different
+ * @return the noise in Q15
+ */
+static int16_t noise(uint32_t phase, uint32_t salt) {
+  // The cell after the last one is the first, so the noise stays smooth where the phase wraps around
+  uint16_t cell = phase >> 16;
+  uint16_t nextCell = cell + 1;
+
+  // Q14 so the difference of two values still fits when it is scaled
+  int32_t from = (int16_t)hash(cell + salt) >> 1;
+  int32_t to = (int16_t)hash(nextCell + salt) >> 1;
+
+  // Smoothstep 3t^2 - 2t^3 in Q16 keeps the speed continuous between cells
+  uint32_t t = phase & 0xFFFF;
+  uint32_t eased = (((t * t) >> 16) * ((3 * 65536UL - 2 * t) >> 2)) >> 14;
+
+  return (from + (((to - from) * (int32_t)(eased >> 1)) >> 15)) << 1;
+}
+
+/**
+ * Function to work out the peak acceleration of a sine on one motor
+ * @param amplitude centidegrees
+ * @param frequency centihertz
+ * @param stepsPerCentidegreeQ16 see AxisConfig.h
+ * @return steps/sec^2 in Q16, times 10^7 to keep the centihertz and 4 pi^2 in integers
+ */
+static uint64_t peakAcceleration(int16_t amplitude, uint16_t frequency, uint32_t stepsPerCentidegreeQ16) {
+  uint32_t magnitude = amplitude < 0 ? -amplitude : amplitude;
+  return (uint64_t)magnitude * stepsPerCentidegreeQ16 * frequency * frequency * 39478; // 4 pi^2 = 39.478
+}
+
+/**
+ * Function to start an effect, replacing whatever ran in its slot
+ * Amplitudes and frequencies are clamped to EFFECT_MAX_AMPLITUDE and EFFECT_MAX_FREQUENCY and then scaled
+ * down together until no motor has to accelerate harder than its share of the limit
+ * @param settings the effect, an EFFECT_OFF effect stops the slot
+ * @param nowMicros micros() at the start of the effect
+ */
+void startEffect(const EffectSettings &settings, uint32_t nowMicros) {
+  if (settings.type == EFFECT_OFF || settings.type > EFFECT_IMPACT) {
+    stopEffects(settings.slot);
+    return;
+  }
+  if (settings.slot >= EFFECT_SLOTS) {
+    return;
+  }
+
+  EffectSlot &slot = slots[settings.slot];
+  uint16_t frequency[3];
+  for (uint8_t i = 0; i < 3; i++) {
+    slot.amplitude[i] = constrain(settings.amplitude[i], -EFFECT_MAX_AMPLITUDE, EFFECT_MAX_AMPLITUDE);
+    frequency[i] = min(settings.frequency[i], (uint16_t)EFFECT_MAX_FREQUENCY);
+    slot.phaseStep[i] = (uint32_t)(((uint64_t)frequency[i] << 32) / 100000000UL);
+  }
+
+  // Pitch and roll share stepper1 and stepper2, so they are trimmed together
+  uint64_t pitchRoll = peakAcceleration(slot.amplitude[0], frequency[0], PitchAxis::STEPS_PER_CENTIDEGREE_Q16) +
+                       peakAcceleration(slot.amplitude[1], frequency[1], RollAxis::STEPS_PER_CENTIDEGREE_Q16);
+  uint64_t pitchRollLimit = ((uint64_t)min(Stepper1Axis::MAX_ACCELERATION, Stepper2Axis::MAX_ACCELERATION) << 16) * 10000000ULL / EFFECT_ACCELERATION_SHARE;
+  if (pitchRoll > pitchRollLimit) {
+    slot.amplitude[0] = (int64_t)slot.amplitude[0] * (int64_t)pitchRollLimit / (int64_t)pitchRoll;
+    slot.amplitude[1] = (int64_t)slot.amplitude[1] * (int64_t)pitchRollLimit / (int64_t)pitchRoll;
+  }
+
+  uint64_t yaw = peakAcceleration(slot.amplitude[2], frequency[2], YawAxis::STEPS_PER_CENTIDEGREE_Q16);
+  uint64_t yawLimit = ((uint64_t)Stepper3Axis::MAX_ACCELERATION << 16) * 10000000ULL / EFFECT_ACCELERATION_SHARE;
+  if (yaw > yawLimit) {
+    slot.amplitude[2] = (int64_t)slot.amplitude[2] * (int64_t)yawLimit / (int64_t)yaw;
+  }
+
+  slot.durationMicros = settings.durationMs * 1000UL;
+  if (settings.type == EFFECT_IMPACT && slot.durationMicros == 0) {
+    slot.durationMicros = EFFECT_DEFAULT_IMPACT_MS * 1000UL;
+  }
+  slot.startedAt = nowMicros;
+  slot.type = settings.type;
+}
+
+/**
+ * Function to stop effects right away, the offset drops back to zero at the next control tick
+ * @param slot the slot to stop, or EFFECT_ALL_SLOTS
+ */
+void stopEffects(uint8_t slot) {
+  for (uint8_t i = 0; i < EFFECT_SLOTS; i++) {
+    if (slot == i || slot == EFFECT_ALL_SLOTS) {
+      slots[i].type = EFFECT_OFF;
+    }
+  }
+}
+
+/**
+ * Function to check whether an effect is running in a slot at a given time
+ * @param elapsed set to the time since the effect started
+ */
+static bool isSlotActive(const EffectSlot &slot, uint32_t atMicros, uint32_t &elapsed) {
+  if (slot.type == EFFECT_OFF) {
+    return false;
+  }
+  elapsed = atMicros - slot.startedAt;
+
+  // The scheduler can ask about times a little before the effect started
+  if (elapsed > 0xFFFFFFFFUL - BEFORE_START_MICROS) {
+    return false;
+  }
+  return slot.durationMicros == 0 || elapsed < slot.durationMicros;
+}
+
+/**
+ * Function to check whether any effect adds an offset at a given time
+ */
+bool areEffectsActive(uint32_t atMicros) {
+  uint32_t elapsed;
+  for (uint8_t i = 0; i < EFFECT_SLOTS; i++) {
+    if (isSlotActive(slots[i], atMicros, elapsed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to check whether an effect that ends by itself is still running at a given time
+ */
+bool areTimedEffectsActive(uint32_t atMicros) {
+  uint32_t elapsed;
+  for (uint8_t i = 0; i < EFFECT_SLOTS; i++) {
+    if (slots[i].durationMicros > 0 && isSlotActive(slots[i], atMicros, elapsed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to work out the sum of the offsets of every effect at a given time
+ * @param atMicros the time in micros(), may be a little ahead of now
+ * @return the offset in centidegrees
+ */
+Pose getEffectOffset(uint32_t atMicros) {
+  int32_t offset[3] = { 0, 0, 0 };
+  uint32_t elapsed;
+
+  for (uint8_t s = 0; s < EFFECT_SLOTS; s++) {
+    const EffectSlot &slot = slots[s];
+    if (!isSlotActive(slot, atMicros, elapsed)) {
+      continue;
+    }
+
+    // An impact dies away with the square of the time it has left
+    int32_t envelope = 32767;
+    if (slot.type == EFFECT_IMPACT) {
+      uint32_t left = (slot.durationMicros - elapsed) / ((slot.durationMicros >> 15) + 1);
+      envelope = (left * left) >> 15;
+    }
+
+    for (uint8_t i = 0; i < 3; i++) {
+      if (slot.phaseStep[i] == 0 || slot.amplitude[i] == 0) {
+        continue;
+      }
+
+      int32_t wave;
+      if (slot.type == EFFECT_ROAD) {
+        wave = noise(noisePhase(elapsed, slot.phaseStep[i]), NOISE_SALT[i]);
+      } else {
+        wave = sine(elapsed * slot.phaseStep[i] + ENGINE_PHASE[i]);
+        wave = (wave * envelope) >> 15;
+      }
+      offset[i] += (slot.amplitude[i] * wave) >> 15;
+    }
+  }
+
+  Pose pose;
+  pose.pitch = offset[0];
+  pose.roll = offset[1];
+  pose.yaw = offset[2];
+  return pose;
+}
+
+/**
+ * Function to work out how far the effects can move each axis away from the pose under them
+ * @param atMicros the time in micros()
+ * @return the sum of the amplitudes of the running effects in centidegrees
+ */
+Pose getEffectReach(uint32_t atMicros) {
+  int32_t reach[3] = { 0, 0, 0 };
+  uint32_t elapsed;
+
+  for (uint8_t s = 0; s < EFFECT_SLOTS; s++) {
+    if (isSlotActive(slots[s], atMicros, elapsed)) {
+      for (uint8_t i = 0; i < 3; i++) {
+        if (slots[s].phaseStep[i] != 0) {
+          reach[i] += slots[s].amplitude[i] < 0 ? -slots[s].amplitude[i] : slots[s].amplitude[i];
+        }
+      }
+    }
+  }
+
+  Pose pose;
+  pose.pitch = reach[0];
+  pose.roll = reach[1];
+  pose.yaw = reach[2];
+  return pose;
+}
+
+/**
+ * Function to copy one of the preset effects out of flash
+ * @param preset an EffectPreset, anything else gives EFFECT_PRESET_STOP
+ */
+EffectSettings getEffectPreset(uint8_t preset) {
+  EffectSettings settings;
+  memcpy_P(&settings, &PRESETS[preset < EFFECT_PRESETS ? preset : (uint8_t)EFFECT_PRESET_STOP], sizeof(settings));
+  return settings;
+}
+
+/**
+ * Function to read an effect out of a MSG_EFFECT payload
+ */
+EffectSettings decodeEffectSettings(const uint8_t *payload) {
+  EffectSettings settings;
+  settings.slot = payload[0];
+  settings.type = payload[1];
+  for (uint8_t i = 0; i < 3; i++) {
+    settings.amplitude[i] = readInt16(payload + 2 + 2 * i);
+    settings.frequency[i] = readUint16(payload + 8 + 2 * i);
+  }
+  settings.durationMs = readUint16(payload + 14);
+  return settings;
+}
+
+/**
+ * Function to put an effect into a MSG_EFFECT payload
+ */
+void encodeEffectSettings(uint8_t *payload, const EffectSettings &settings) {
+  payload[0] = settings.slot;
+  payload[1] = settings.type;
+  for (uint8_t i = 0; i < 3; i++) {
+    writeInt16(payload + 2 + 2 * i, settings.amplitude[i]);
+    writeUint16(payload + 8 + 2 * i, settings.frequency[i]);
+  }
+  writeUint16(payload + 14, settings.durationMs);
+}
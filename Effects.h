@@ -0,0 +1,77 @@
+#ifndef EFFECTS_H
+#define EFFECTS_H
+
+#include <stdint.h>
+#include "SerialProtocol.h"
+
+// Vibration effects laid over whatever pose the chair is following
+//
+// An effect adds a small, fast offset to the pitch, roll and yaw the motion is heading for:
+//  - road texture: smooth random noise, a new random value per axis every 1/frequency seconds
+//  - engine: a steady sine per axis
+//  - impact: a sine that dies away over the duration of the effect, for bumps and hits
+// Up to EFFECT_SLOTS effects run at once and their offsets add up.
+//
+// The offset is a function of time only: the noise comes from hashing the number of the noise cell instead
+// of from a running random generator, and the sine comes from a table in flash. That makes every effect
+// play the same way every time, and lets the scheduler ask for the offset at the time a step command will
+// run rather than the time it is queued. Nothing is kept between evaluations, so asking costs the same
+// few integer multiplies at any rate.
+//
+// Amplitudes are trimmed when an effect starts so that the shaking never asks a motor for more than its
+// acceleration limit, see AxisConfig.h.
+
+#define EFFECT_SLOTS 3
+
+// Largest amplitude of one effect on one axis, in centidegrees
+#define EFFECT_MAX_AMPLITUDE 500
+
+// Highest frequency of an effect in centihertz, the motors can't shake any faster than this
+#define EFFECT_MAX_FREQUENCY 3000
+
+// Length of an impact that was started without a duration
+#define EFFECT_DEFAULT_IMPACT_MS 400
+
+// Selects every slot when stopping effects
+#define EFFECT_ALL_SLOTS 0xFF
+
+enum EffectType : uint8_t {
+  EFFECT_OFF,    // Stops the effect in the slot
+  EFFECT_ROAD,   // Smooth random noise
+  EFFECT_ENGINE, // Steady sine
+  EFFECT_IMPACT  // Sine that dies away over the duration
+};
+
+// Effects that ride scripts can start by number, in the order of the table in Effects.cpp
+enum EffectPreset : uint8_t {
+  EFFECT_PRESET_STOP,   // Stops every effect
+  EFFECT_PRESET_GRAVEL, // Road texture of a dirt track
+  EFFECT_PRESET_ENGINE, // Idling engine
+  EFFECT_PRESET_BUMP,   // A single hard bump
+  EFFECT_PRESETS
+};
+
+// One effect as it is started
+// Starting EFFECT_OFF stops the slot, or every slot with EFFECT_ALL_SLOTS
+struct EffectSettings {
+  uint8_t slot;
+  uint8_t type;          // EffectType
+  int16_t amplitude[3];  // Centidegrees of pitch, roll and yaw
+  uint16_t frequency[3]; // Centihertz of pitch, roll and yaw, an axis at 0 is left alone
+  uint16_t durationMs;   // 0 keeps the effect going until it is stopped
+};
+
+#define EFFECT_PAYLOAD_SIZE 16
+
+void startEffect(const EffectSettings &settings, uint32_t nowMicros);
+void stopEffects(uint8_t slot);
+bool areEffectsActive(uint32_t atMicros);
+bool areTimedEffectsActive(uint32_t atMicros);
+Pose getEffectOffset(uint32_t atMicros);
+Pose getEffectReach(uint32_t atMicros);
+
+EffectSettings getEffectPreset(uint8_t preset);
+EffectSettings decodeEffectSettings(const uint8_t *payload);
+void encodeEffectSettings(uint8_t *payload, const EffectSettings &settings);
+
+#endif
@@ -0,0 +1,149 @@
+#include "Arduino.h"
+#include "Homing.h"
+#include "AxisConfig.h"
+#include "Backlash.h"
+
+static const uint8_t HOME_PINS[3] = { STEPPER1_HOME_PIN, STEPPER2_HOME_PIN, STEPPER3_HOME_PIN };
+static const int32_t SWITCH_POSITION[3] = { homeSwitchPosition<Stepper1Axis>(), homeSwitchPosition<Stepper2Axis>(), homeSwitchPosition<Stepper3Axis>() };
+
+// A motor can be anywhere from its switch to its positive limit, the search goes a little further than that
+static const int32_t SEARCH_DISTANCE[3] = {
+  Stepper1Axis::MAX_POSITION - homeSwitchPosition<Stepper1Axis>() + (int32_t)Stepper1Axis::fromFullSteps(HOME_SWITCH_MARGIN_FULL_STEPS),
+  Stepper2Axis::MAX_POSITION - homeSwitchPosition<Stepper2Axis>() + (int32_t)Stepper2Axis::fromFullSteps(HOME_SWITCH_MARGIN_FULL_STEPS),
+  Stepper3Axis::MAX_POSITION - homeSwitchPosition<Stepper3Axis>() + (int32_t)Stepper3Axis::fromFullSteps(HOME_SWITCH_MARGIN_FULL_STEPS)
+};
+
+// Far enough off the switch that it opens again
+static const int32_t BACK_OFF_DISTANCE = 4 * Stepper1Axis::fromFullSteps(HOME_SWITCH_MARGIN_FULL_STEPS);
+
+// The chair is this far past the switch position when it opens again
+static const int32_t SWITCH_TRAVEL = Stepper1Axis::fromFullSteps(HOME_SWITCH_TRAVEL_FULL_STEPS);
+
+// Measuring the backlash backs off until the switch opens, which takes the most backlash that is compensated and then some
+static const int32_t MEASURE_DISTANCE = SWITCH_TRAVEL + BACKLASH_MAX_STEPS + BACK_OFF_DISTANCE;
+
+static bool isSwitchClosed(uint8_t index) {
+  return digitalRead(HOME_PINS[index]) == LOW;
+}
+
+/**
+ * Function to wait until none of the steppers is running
+ */
+static void waitUntilStopped(FastAccelStepper **steppers) {
+  bool running = true;
+  while (running) {
+    running = false;
+    for (uint8_t i = 0; i < 3; i++) {
+      running = running || (steppers[i] && steppers[i] -> isRunning());
+    }
+    delay(1);
+  }
+}
+
+/**
+ * Function to back the homed steppers off their switches and measure their backlash on the way
+ * Each stops on its own when its switch opens. The chair is then just off the switch and the gears were driven up,
+ * so the motor is ahead of it by the play it took up.
+ * @param homed the steppers whose switches closed
+ * @param backlash set to the backlash of the steppers whose switches opened again, in steps
+ */
+static void measureBacklash(FastAccelStepper **steppers, uint8_t homed, uint8_t *backlash) {
+  for (uint8_t i = 0; i < 3; i++) {
+    if (homed & (1 << i)) {
+      steppers[i] -> move(MEASURE_DISTANCE);
+    }
+  }
+
+  uint8_t measured = 0;
+  bool backingOff = true;
+  while (backingOff) {
+    backingOff = false;
+    for (uint8_t i = 0; i < 3; i++) {
+      if (!(homed & (1 << i)) || (measured & (1 << i))) {
+        continue;
+      }
+      if (!isSwitchClosed(i)) {
+        steppers[i] -> forceStop();
+        int32_t travel = steppers[i] -> getCurrentPosition() - SWITCH_POSITION[i] - SWITCH_TRAVEL;
+        backlash[i] = constrain(travel, 0L, (long)BACKLASH_MAX_STEPS);
+        steppers[i] -> setCurrentPosition(SWITCH_POSITION[i] + SWITCH_TRAVEL + takeUpSteps(backlash[i], 1));
+        measured |= 1 << i;
+      } else {
+        backingOff = backingOff || steppers[i] -> isRunning();
+      }
+    }
+    delay(1);
+  }
+}
+
+/**
+ * Function to find the positions of all steppers at their home switches, measure their backlash and move them to 0
+ * The steppers search together, each stops on its own when its switch closes
+ * A stepper whose switch never closes is left where the search ended, with its position unknown
+ * A stepper whose switch doesn't open again keeps the backlash it had
+ * @param backlash the backlash of stepper1, stepper2 and stepper3 in steps, updated for every stepper that was measured
+ * @return a mask with bit 0 set if stepper1 was homed, bit 1 for stepper2 and bit 2 for stepper3
+ */
+uint8_t homeSteppers(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third, uint8_t *backlash) {
+  FastAccelStepper *steppers[3] = { first, second, third };
+  uint32_t ownSpeed[3];
+  uint32_t ownAcceleration[3];
+
+  for (uint8_t i = 0; i < 3; i++) {
+    pinMode(HOME_PINS[i], INPUT_PULLUP);
+    if (steppers[i]) {
+      ownSpeed[i] = steppers[i] -> getSpeedInMilliHz();
+      ownAcceleration[i] = steppers[i] -> getAcceleration();
+      steppers[i] -> setSpeedInHz(Stepper1Axis::fromFullSteps(HOMING_SPEED_FULL_STEPS));
+      steppers[i] -> setAcceleration(Stepper1Axis::fromFullSteps(HOMING_ACCELERATION_FULL_STEPS));
+    }
+  }
+
+  // Off the switch first, so that the search finds where it closes
+  for (uint8_t i = 0; i < 3; i++) {
+    if (steppers[i] && isSwitchClosed(i)) {
+      steppers[i] -> move(BACK_OFF_DISTANCE);
+    }
+  }
+  waitUntilStopped(steppers);
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if (steppers[i]) {
+      steppers[i] -> move(-SEARCH_DISTANCE[i]);
+    }
+  }
+
+  uint8_t homed = 0;
+  bool searching = true;
+  while (searching) {
+    searching = false;
+    for (uint8_t i = 0; i < 3; i++) {
+      if (!steppers[i] || (homed & (1 << i))) {
+        continue;
+      }
+      if (isSwitchClosed(i)) {
+        steppers[i] -> forceStop();
+        steppers[i] -> setCurrentPosition(SWITCH_POSITION[i]);
+        homed |= 1 << i;
+      } else {
+        searching = searching || steppers[i] -> isRunning();
+      }
+    }
+    delay(1);
+  }
+  measureBacklash(steppers, homed, backlash);
+
+  // The gears are driven up from here on, the chair is at 0 with the motor ahead of it by the play
+  for (uint8_t i = 0; i < 3; i++) {
+    if (steppers[i]) {
+      steppers[i] -> setSpeedInMilliHz(ownSpeed[i]);
+      steppers[i] -> setAcceleration(ownAcceleration[i]);
+      if (homed & (1 << i)) {
+        steppers[i] -> moveTo(takeUpSteps(backlash[i], 1));
+      }
+    }
+  }
+  waitUntilStopped(steppers);
+
+  return homed;
+}
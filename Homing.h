@@ -0,0 +1,39 @@
+#ifndef HOMING_H
+#define HOMING_H
+
+#include "FastAccelStepper.h"
+
+// Finding where the motors are with limit switches, for when the positions saved at shutdown can't be trusted
+//
+// Each motor has a switch a little past its negative limit that closes to ground. Homing drives every motor
+// slowly towards its switch until it closes, then turns it back until the switch opens again. The motor has to turn
+// through the play of its gears before the chair lifts off the switch, so how much further it went than the switch
+// travels is its backlash (Backlash.h). The chair is at the switch there, and the motor is moved to where the chair
+// is at 0. A motor that starts on its switch backs off it first. Homing blocks, it only runs from setup().
+
+#define STEPPER1_HOME_PIN 22
+#define STEPPER2_HOME_PIN 23
+#define STEPPER3_HOME_PIN 24
+
+// How far past the negative limit the switches close, in full steps
+#define HOME_SWITCH_MARGIN_FULL_STEPS 5
+
+// How much further the chair has to move off a switch than onto it before it opens again, in full steps
+// This is part of what the motor turns when backing off, and is taken off the backlash measured there
+#define HOME_SWITCH_TRAVEL_FULL_STEPS 1
+
+// Slow enough that a motor stops within a step of where its switch closes
+#define HOMING_SPEED_FULL_STEPS 100
+#define HOMING_ACCELERATION_FULL_STEPS 1000
+
+/**
+ * Function to get the position at which the home switch of a motor closes
+ */
+template <class Axis>
+constexpr int32_t homeSwitchPosition() {
+  return Axis::MIN_POSITION - (int32_t)Axis::fromFullSteps(HOME_SWITCH_MARGIN_FULL_STEPS);
+}
+
+uint8_t homeSteppers(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third, uint8_t *backlash);
+
+#endif
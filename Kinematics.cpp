@@ -0,0 +1,65 @@
+#include "Kinematics.h"
+#include "AxisConfig.h"
+
+/**
+ * Function to work out the motor positions for a pose, clamping each motor to its own limits
+ * When pitch and roll together ask more of a motor than it can do, that motor stops at its limit
+ * @param pitch the pitch in hundredths of a degree
+ * @param roll the roll in hundredths of a degree
+ * @param yaw the yaw in hundredths of a degree
+ */
+MotorTargets mixPose(int16_t pitch, int16_t roll, int16_t yaw) {
+  int32_t pitchSteps = PitchAxis::positionFromCentidegrees(pitch);
+  int32_t rollSteps = RollAxis::positionFromCentidegrees(roll);
+
+  MotorTargets targets;
+  targets.position[0] = Stepper1Axis::clampPosition(pitchSteps + rollSteps);
+  targets.position[1] = Stepper2Axis::clampPosition(pitchSteps - rollSteps);
+  targets.position[2] = Stepper3Axis::clampPosition(YawAxis::positionFromCentidegrees(yaw));
+  return targets;
+}
+
+/**
+ * Function to scale the speed and acceleration of each motor so they all arrive at the same time
+ * The motor with the longest way to go gets the full speed and acceleration, the others get the same
+ * share of both as their share of the distance. A trapezoid ramp scaled like that keeps its duration,
+ * so every motor starts and stops together and the chair moves as one.
+ * @param from the current motor positions
+ * @param to the target motor positions
+ * @param speed the speed of the longest move in steps/sec
+ * @param acceleration the acceleration of the longest move in steps/sec^2
+ */
+MotorProfiles synchronizeMotion(const int32_t *from, const int32_t *to, uint32_t speed, uint32_t acceleration) {
+  uint32_t distance[3];
+  uint32_t longest = 0;
+
+  for (uint8_t i = 0; i < 3; i++) {
+    int32_t difference = to[i] - from[i];
+    distance[i] = difference < 0 ? -difference : difference;
+    if (distance[i] > longest) {
+      longest = distance[i];
+    }
+  }
+
+  MotorProfiles profiles;
+  for (uint8_t i = 0; i < 3; i++) {
+    // Motors that don't move keep the full profile in case they are retargeted later
+    uint32_t share = distance[i] == 0 ? longest : distance[i];
+    if (longest == 0) {
+      share = 1;
+      longest = 1;
+    }
+
+    // Only worked out once per move, so 64-bit math is fine here
+    profiles.speedInMilliHz[i] = (uint32_t)((uint64_t)speed * 1000 * share / longest);
+    profiles.acceleration[i] = (uint32_t)((uint64_t)acceleration * share / longest);
+
+    if (profiles.speedInMilliHz[i] < 1000) {
+      profiles.speedInMilliHz[i] = 1000;
+    }
+    if (profiles.acceleration[i] < 1) {
+      profiles.acceleration[i] = 1;
+    }
+  }
+  return profiles;
+}
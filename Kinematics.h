@@ -0,0 +1,28 @@
+#ifndef KINEMATICS_H
+#define KINEMATICS_H
+
+#include <stdint.h>
+
+// Mixing between chair angles and motor positions
+//
+// stepper1 and stepper2 both tilt the seat: moving them the same way pitches it, moving them in opposite
+// directions rolls it, so any pitch and roll can be reached at once with
+//   stepper1 = pitch + roll
+//   stepper2 = pitch - roll
+// stepper3 turns the seat for yaw on its own
+
+// Motor positions in steps, index 0 is stepper1
+struct MotorTargets {
+  int32_t position[3];
+};
+
+// Speed and acceleration for each motor so that all of them arrive together
+struct MotorProfiles {
+  uint32_t speedInMilliHz[3];
+  uint32_t acceleration[3];
+};
+
+MotorTargets mixPose(int16_t pitch, int16_t roll, int16_t yaw);
+MotorProfiles synchronizeMotion(const int32_t *from, const int32_t *to, uint32_t speed, uint32_t acceleration);
+
+#endif
@@ -0,0 +1,177 @@
+#include "MotionCueing.h"
+
+// Time between updates in milliseconds
+#define CUEING_PERIOD_MS (1000 / CUEING_RATE_HZ)
+
+// Q15 coefficients of the first-order filters
+// High-pass and leak: RC / (RC + dt), low-pass: dt / (RC + dt)
+#define HIGH_PASS_Q15(rcMs) ((int16_t)(32768L * (rcMs) / ((rcMs) + CUEING_PERIOD_MS)))
+#define LOW_PASS_Q15(rcMs) ((int16_t)(32768L * CUEING_PERIOD_MS / ((rcMs) + CUEING_PERIOD_MS)))
+
+static const int16_t ROTATION_HIGH_PASS = HIGH_PASS_Q15(CUEING_ROTATION_HIGH_PASS_MS);
+static const int16_t ROTATION_RETURN = HIGH_PASS_Q15(CUEING_ROTATION_RETURN_MS);
+static const int16_t TRANSLATION_HIGH_PASS = HIGH_PASS_Q15(CUEING_TRANSLATION_HIGH_PASS_MS);
+static const int16_t TILT_LOW_PASS = LOW_PASS_Q15(CUEING_TILT_LOW_PASS_MS);
+
+// The update period in seconds as a Q15 fraction, used to integrate rates into angles
+static const int16_t PERIOD_Q15 = (int16_t)(32768L / CUEING_RATE_HZ);
+
+// Q8 centidegrees of tilt per thousandth of g: asin(a) is taken as a for the small angles the chair can reach,
+// 1 mg = 0.001 rad = 5.7296 centidegrees
+static const int32_t TILT_Q8_PER_MG = 1467;
+
+// Share of the tilt-equivalent angle used as the onset kick, 5730 centidegrees is one radian
+static const int16_t ONSET_FACTOR = (int16_t)(32768L * CUEING_ONSET_GAIN / 5730);
+
+// Largest change of the coordinated tilt per update in Q8 centidegrees
+static const int32_t TILT_STEP_LIMIT = (int32_t)CUEING_TILT_RATE_LIMIT * 256 / CUEING_RATE_HZ;
+
+/**
+ * Function to multiply a Q8 value by a Q15 coefficient
+ * Split into two 32-bit multiplies so the ATmega2560 never needs 64-bit math
+ * @param value any int32 value
+ * @param coefficient the Q15 coefficient, -1 to just under 1
+ */
+static inline int32_t mulQ15(int32_t value, int16_t coefficient) {
+  int32_t high = value >> 16;
+  uint16_t low = (uint16_t)(value & 0xFFFF);
+  return high * coefficient * 2 + (((int32_t)low * coefficient) >> 15);
+}
+
+/**
+ * Function to run one step of a first-order high-pass filter
+ */
+static inline int32_t highPass(CueingFilter &filter, int32_t input, int16_t coefficient) {
+  filter.output = mulQ15(filter.output + input - filter.previousInput, coefficient);
+  filter.previousInput = input;
+  return filter.output;
+}
+
+/**
+ * Function to run one step of a first-order low-pass filter
+ */
+static inline int32_t lowPass(CueingFilter &filter, int32_t input, int16_t coefficient) {
+  filter.output += mulQ15(input - filter.output, coefficient);
+  return filter.output;
+}
+
+static inline int32_t clampQ8(int32_t value, int32_t limit) {
+  if (value > limit) {
+    return limit;
+  } else if (value < -limit) {
+    return -limit;
+  }
+  return value;
+}
+
+/**
+ * Function to integrate a high-passed rate into an angle that slowly returns to level
+ */
+static inline int32_t leakyIntegrate(int32_t angle, int32_t rate, int32_t limit) {
+  return clampQ8(mulQ15(angle, ROTATION_RETURN) + mulQ15(rate, PERIOD_Q15), limit);
+}
+
+/**
+ * Function to move the coordinated tilt towards its target no faster than the tilt rate limit
+ */
+static inline int32_t rateLimit(int32_t current, int32_t target) {
+  return current + clampQ8(target - current, TILT_STEP_LIMIT);
+}
+
+/**
+ * Function to convert a Q8 angle back to whole centidegrees, rounding to the nearest
+ */
+static inline int16_t toCentidegrees(int32_t value) {
+  return (int16_t)((value + 128) >> 8);
+}
+
+static void resetFilter(CueingFilter &filter) {
+  filter.output = 0;
+  filter.previousInput = 0;
+}
+
+/**
+ * Function to reset the cueing to a level chair
+ * @param cueing the cueing state
+ * @param pitchLimit largest pitch in either direction in centidegrees
+ * @param rollLimit largest roll in either direction in centidegrees
+ * @param yawLimit largest yaw in either direction in centidegrees
+ */
+void initMotionCueing(MotionCueing &cueing, int16_t pitchLimit, int16_t rollLimit, int16_t yawLimit) {
+  resetFilter(cueing.rollRateHighPass);
+  resetFilter(cueing.pitchRateHighPass);
+  resetFilter(cueing.yawRateHighPass);
+  resetFilter(cueing.surgeHighPass);
+  resetFilter(cueing.swayHighPass);
+  resetFilter(cueing.surgeLowPass);
+  resetFilter(cueing.swayLowPass);
+
+  cueing.rollAngle = 0;
+  cueing.pitchAngle = 0;
+  cueing.yawAngle = 0;
+  cueing.pitchTilt = 0;
+  cueing.rollTilt = 0;
+
+  cueing.pitchLimit = (int32_t)pitchLimit << 8;
+  cueing.rollLimit = (int32_t)rollLimit << 8;
+  cueing.yawLimit = (int32_t)yawLimit << 8;
+}
+
+/**
+ * Function to run the cueing once, must be called at exactly CUEING_RATE_HZ
+ * @param cueing the cueing state
+ * @param vehicle the latest accelerations and rates of the vehicle
+ * @return the chair pose in centidegrees
+ */
+Pose updateMotionCueing(MotionCueing &cueing, const VehicleState &vehicle) {
+  // Rotational channel
+  int32_t rollRate = highPass(cueing.rollRateHighPass, (int32_t)vehicle.rollRate << 8, ROTATION_HIGH_PASS);
+  int32_t pitchRate = highPass(cueing.pitchRateHighPass, (int32_t)vehicle.pitchRate << 8, ROTATION_HIGH_PASS);
+  int32_t yawRate = highPass(cueing.yawRateHighPass, (int32_t)vehicle.yawRate << 8, ROTATION_HIGH_PASS);
+  cueing.rollAngle = leakyIntegrate(cueing.rollAngle, rollRate, cueing.rollLimit);
+  cueing.pitchAngle = leakyIntegrate(cueing.pitchAngle, pitchRate, cueing.pitchLimit);
+  cueing.yawAngle = leakyIntegrate(cueing.yawAngle, yawRate, cueing.yawLimit);
+
+  // Accelerating pushes the rider back, so it is shown as nose up
+  // Accelerating to the right pushes the rider left, so it is shown as left side down
+  int32_t surgeTilt = vehicle.surge * TILT_Q8_PER_MG;
+  int32_t swayTilt = -vehicle.sway * TILT_Q8_PER_MG;
+
+  // Translational channel
+  int32_t surgeOnset = mulQ15(highPass(cueing.surgeHighPass, surgeTilt, TRANSLATION_HIGH_PASS), ONSET_FACTOR);
+  int32_t swayOnset = mulQ15(highPass(cueing.swayHighPass, swayTilt, TRANSLATION_HIGH_PASS), ONSET_FACTOR);
+
+  // Tilt coordination
+  cueing.pitchTilt = rateLimit(cueing.pitchTilt, clampQ8(lowPass(cueing.surgeLowPass, surgeTilt, TILT_LOW_PASS), cueing.pitchLimit));
+  cueing.rollTilt = rateLimit(cueing.rollTilt, clampQ8(lowPass(cueing.swayLowPass, swayTilt, TILT_LOW_PASS), cueing.rollLimit));
+
+  Pose pose;
+  pose.pitch = toCentidegrees(clampQ8(cueing.pitchAngle + surgeOnset + cueing.pitchTilt, cueing.pitchLimit));
+  pose.roll = toCentidegrees(clampQ8(cueing.rollAngle + swayOnset + cueing.rollTilt, cueing.rollLimit));
+  pose.yaw = toCentidegrees(clampQ8(cueing.yawAngle, cueing.yawLimit));
+  return pose;
+}
+
+/**
+ * Function to put a vehicle state into a MSG_VEHICLE_STATE payload
+ */
+void encodeVehicleState(uint8_t *payload, const VehicleState &vehicle) {
+  writeInt16(payload, vehicle.surge);
+  writeInt16(payload + 2, vehicle.sway);
+  writeInt16(payload + 4, vehicle.rollRate);
+  writeInt16(payload + 6, vehicle.pitchRate);
+  writeInt16(payload + 8, vehicle.yawRate);
+}
+
+/**
+ * Function to read a vehicle state out of a MSG_VEHICLE_STATE payload
+ */
+VehicleState decodeVehicleState(const uint8_t *payload) {
+  VehicleState vehicle;
+  vehicle.surge = readInt16(payload);
+  vehicle.sway = readInt16(payload + 2);
+  vehicle.rollRate = readInt16(payload + 4);
+  vehicle.pitchRate = readInt16(payload + 6);
+  vehicle.yawRate = readInt16(payload + 8);
+  return vehicle;
+}
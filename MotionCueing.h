@@ -0,0 +1,78 @@
+#ifndef MOTION_CUEING_H
+#define MOTION_CUEING_H
+
+#include <stdint.h>
+#include "SerialProtocol.h"
+
+// Classical washout motion cueing in fixed point
+//
+// Vehicle accelerations and angular rates are turned into chair angles the way a motion simulator would:
+//  - rotational channel: angular rate -> high-pass -> leaky integration into an angle that drifts back to level
+//  - translational channel: specific force -> high-pass -> a short tilt kick at the onset of a change
+//  - tilt coordination: specific force -> low-pass -> tilt so gravity stands in for a sustained acceleration,
+//    rate limited so the tilting itself stays below what the rider notices
+// The sum is clamped to the chair's envelope.
+//
+// The inner loop only uses integer math: angles are centidegrees in Q8 (int32) and filter coefficients are Q15
+// The filters are designed for one fixed update rate, their coefficients are worked out at compile time
+
+#define CUEING_RATE_HZ 200
+
+// Filter corner frequencies, as time constants in milliseconds
+#define CUEING_ROTATION_HIGH_PASS_MS 1000   // Angular rates
+#define CUEING_ROTATION_RETURN_MS 2000      // How fast the integrated angles drift back to level
+#define CUEING_TRANSLATION_HIGH_PASS_MS 500 // Onset cues
+#define CUEING_TILT_LOW_PASS_MS 800         // Sustained accelerations
+
+// Centidegrees of onset tilt per g of high-passed specific force
+#define CUEING_ONSET_GAIN 1500
+
+// Tilt coordination may not tilt the chair faster than this, in centidegrees per second
+#define CUEING_TILT_RATE_LIMIT 300
+
+// Inputs of one update
+// Accelerations are the specific force felt by the driver in thousandths of g, rates are centidegrees per second
+struct VehicleState {
+  int16_t surge;     // Forward acceleration
+  int16_t sway;      // Acceleration to the right
+  int16_t rollRate;  // Right side going down
+  int16_t pitchRate; // Nose going up
+  int16_t yawRate;   // Turning right
+};
+
+// One first-order filter, state in Q8
+struct CueingFilter {
+  int32_t output;
+  int32_t previousInput;
+};
+
+// Everything the cueing keeps between updates
+struct MotionCueing {
+  CueingFilter rollRateHighPass;
+  CueingFilter pitchRateHighPass;
+  CueingFilter yawRateHighPass;
+  int32_t rollAngle;
+  int32_t pitchAngle;
+  int32_t yawAngle;
+
+  CueingFilter surgeHighPass;
+  CueingFilter swayHighPass;
+  CueingFilter surgeLowPass;
+  CueingFilter swayLowPass;
+  int32_t pitchTilt;
+  int32_t rollTilt;
+
+  int32_t pitchLimit; // Envelope in Q8 centidegrees
+  int32_t rollLimit;
+  int32_t yawLimit;
+};
+
+#define VEHICLE_STATE_PAYLOAD_SIZE 10
+
+void initMotionCueing(MotionCueing &cueing, int16_t pitchLimit, int16_t rollLimit, int16_t yawLimit);
+Pose updateMotionCueing(MotionCueing &cueing, const VehicleState &vehicle);
+
+void encodeVehicleState(uint8_t *payload, const VehicleState &vehicle);
+VehicleState decodeVehicleState(const uint8_t *payload);
+
+#endif
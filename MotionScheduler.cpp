@@ -0,0 +1,1448 @@
+#include "MotionScheduler.h"
+#include "AxisConfig.h"
+#include "Backlash.h"
+#include "Trace.h"
+
+#if TICKS_PER_S != SCURVE_TICKS_PER_SECOND
+#error "The S-curve slices assume the 16 MHz step timer of the ATmega2560"
+#endif
+
+// A task is either still waiting for its steppers to arrive or holding its position
+enum TaskPhase : uint8_t {
+  PHASE_MOVING,
+  PHASE_HOLDING
+};
+
+// The steppers the tasks act on (index 0 is stepper1)
+static FastAccelStepper *steppers[3] = { nullptr, nullptr, nullptr };
+
+// Ring buffer of tasks that have not started yet
+static MotionTask queue[MOTION_QUEUE_SIZE];
+static uint8_t queueHead = 0;
+static uint8_t queueCount = 0;
+
+// While a segment is being expanded its tasks are inserted in front of the rest of the queue
+static bool expandingSegment = false;
+static uint8_t insertOffset = 0;
+
+// Room in the queue set aside by the commands that are queued, see reserveTasks()
+static uint8_t reservedTasks = 0;
+
+// The task that is currently running
+static MotionTask activeTask;
+static bool taskActive = false;
+static TaskPhase taskPhase = PHASE_MOVING;
+static uint32_t holdStartedAt = 0;
+
+// S-curve moves are handed to the stepper queues one slice at a time while the task runs
+static const uint32_t MAX_JERK[3] = { Stepper1Axis::MAX_JERK, Stepper2Axis::MAX_JERK, Stepper3Axis::MAX_JERK };
+static SCurveGenerator curves[3];
+static SCurveCommand pendingCommand[3];
+static bool commandWaiting[3] = { false, false, false };
+static bool curvesStarted = false;
+static uint32_t curvesStartedAt = 0;
+static uint16_t slicesQueued[3] = { 0, 0, 0 };
+
+// Step tracks are copied into the stepper queues the same way, they share commandWaiting with the S-curves
+static TrackReader trackReaders[3];
+static TrackCommand pendingTrackCommand[3];
+static bool trackStarted = false;
+
+// Step tracks are stretched by this many parts per million, so they play at the rate of a shared timeline
+static int32_t trackStretch = 0;
+static int32_t stretchCarry[3] = { 0, 0, 0 }; // Millionths of a tick left over from the commands so far
+
+// A paused track carries on from the end of a move, the steppers ramp there before the queues take over again
+static bool trackResuming = false;
+static int32_t trackResumeTarget[3] = { 0, 0, 0 };
+
+// A track that keeps to its timeline waits at that move end until the time it comes on the track, see rejoinTrack()
+static uint32_t trackStartedAt = 0;
+static bool trackRejoining = false;
+static uint32_t trackRejoinAt = 0;
+
+// The last command handed to each step queue, a halt brakes from its speed
+static stepper_command_s lastQueued[3];
+
+// A halt brakes every stepper at its braking limit, see haltScheduler()
+static const uint32_t BRAKE_ACCELERATION[3] = { Stepper1Axis::BRAKE_ACCELERATION, Stepper2Axis::BRAKE_ACCELERATION, Stepper3Axis::BRAKE_ACCELERATION };
+static HaltMode haltMode = HALT_NONE;
+static bool haltAtRest = false;
+static bool resumeRequested = false;
+static bool resumeOnTimeline = false;
+static uint32_t haltedAt = 0;
+static uint32_t haltedAtMillis = 0;
+static int32_t haltPosition[3] = { 0, 0, 0 };
+static HaltStats haltStats = { 0, 0, 0, 0, 0 };
+
+// Steppers on a trapezoid ramp brake at a raised acceleration, which is handed back once they are at rest
+static bool brakeRaised[3] = { false, false, false };
+static uint32_t ownAcceleration[3] = { 0, 0, 0 };
+
+// Steppers on the step queue brake with a ramp of queue commands, one per S-curve slice, after the queued ones
+static bool brakeRamp[3] = { false, false, false };
+static uint32_t brakeSpeed[3] = { 0, 0, 0 };  // steps/sec at the start of the next slice
+static uint16_t brakeCarry[3] = { 0, 0, 0 };  // Thousandths of a step left over from the slices so far
+
+// Where the motion without the effects is heading, the effects are added on top of it
+static int32_t baseTarget[3] = { 0, 0, 0 };
+
+// The effect offset in the current target of each stepper, or in the steps of its S-curve, in steps
+static int32_t effectOffset[3] = { 0, 0, 0 };
+
+// How far the effects can take each stepper away from its base target, in steps
+static int32_t effectReach[3] = { 0, 0, 0 };
+
+static bool effectsApplied = false;
+static uint32_t nextEffectTickAt = 0;
+static uint16_t effectTicksCarry[3] = { 0, 0, 0 };
+
+// The offset of the last time asked for, the three S-curves ask for the same slice times
+static uint32_t cachedEffectAt = 0;
+static int32_t cachedEffectSteps[3] = { 0, 0, 0 };
+static bool effectCached = false;
+
+// Command-to-motion latency bookkeeping
+static bool commandPending = false;
+static uint32_t commandReceivedAt = 0;
+static uint32_t lastCommandLatency = NO_LATENCY_MEASURED;
+
+/**
+ * Function to convert an offset from the head of the queue to an index into the ring buffer
+ * @param offset how many tasks away from the head of the queue
+ */
+static uint8_t queueSlot(uint8_t offset) {
+  return (queueHead + offset) % MOTION_QUEUE_SIZE;
+}
+
+/**
+ * Function to add a task to the queue
+ * Tasks scheduled by a segment go right after the tasks that segment already scheduled, all other tasks go to the back
+ * @param task the task to add
+ * @return false if the queue is full
+ */
+static bool insertTask(const MotionTask &task) {
+  if (queueCount >= MOTION_QUEUE_SIZE) {
+    traceEvent(TRACE_QUEUE_FULL, task.type);
+    return false;
+  }
+  traceEvent(TRACE_TASK_QUEUED, task.type);
+
+  uint8_t offset = expandingSegment ? insertOffset : queueCount;
+
+  // Shift the tasks behind the insertion point back by one
+  for (uint8_t i = queueCount; i > offset; i--) {
+    queue[queueSlot(i)] = queue[queueSlot(i - 1)];
+  }
+  queue[queueSlot(offset)] = task;
+  queueCount++;
+
+  if (expandingSegment) {
+    insertOffset++;
+  }
+  return true;
+}
+
+/**
+ * Function to check whether any of the selected steppers is still moving
+ * @param mask the steppers to check
+ */
+static bool anyRunning(uint8_t mask) {
+  for (uint8_t i = 0; i < 3; i++) {
+    if ((mask & (1 << i)) && steppers[i] && steppers[i] -> isRunning()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to check whether a stepper belongs to the S-curve or step track of the active task
+ * Those are driven through the step queue and must not be retargeted until their commands have run out
+ */
+static bool isQueueStepper(uint8_t index) {
+  return taskActive && (activeTask.type == TASK_MOVE_CURVE || activeTask.type == TASK_PLAY_TRACK) && taskPhase == PHASE_MOVING &&
+         (activeTask.stepperMask & (1 << index));
+}
+
+/**
+ * Function to check whether any of the selected steppers is still on its way
+ * While effects shake a stepper it never stops, so it counts as arrived once it is within their reach of its base target
+ * @param mask the steppers to check
+ */
+static bool anyMoving(uint8_t mask) {
+  for (uint8_t i = 0; i < 3; i++) {
+    if (!(mask & (1 << i)) || !steppers[i] || !steppers[i] -> isRunning()) {
+      continue;
+    }
+    if (!effectsApplied || isQueueStepper(i)) {
+      return true;
+    }
+    int32_t error = getChairPosition(i) - baseTarget[i];
+    if ((error < 0 ? -error : error) > effectReach[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to keep a target within the limits of a stepper
+ */
+static int32_t clampTarget(uint8_t index, int32_t position) {
+  switch (index) {
+    case 0:
+      return Stepper1Axis::clampPosition(position);
+    case 1:
+      return Stepper2Axis::clampPosition(position);
+    default:
+      return Stepper3Axis::clampPosition(position);
+  }
+}
+
+/**
+ * Function to convert centidegrees to steps, rounding to the nearest step so that small effects still move
+ */
+static int32_t roundedSteps(int32_t centidegrees, uint32_t stepsPerCentidegreeQ16) {
+  return (centidegrees * (int32_t)stepsPerCentidegreeQ16 + 32768) >> 16;
+}
+
+/**
+ * Function to work out the effect offset of each stepper at a given time, mixed like mixPose()
+ * @param atMicros the time in micros()
+ * @param steps set to the offsets in steps
+ */
+static void getEffectSteps(uint32_t atMicros, int32_t *steps) {
+  if (!effectCached || atMicros != cachedEffectAt) {
+    Pose offset = getEffectOffset(atMicros);
+    int32_t pitch = roundedSteps(offset.pitch, PitchAxis::STEPS_PER_CENTIDEGREE_Q16);
+    int32_t roll = roundedSteps(offset.roll, RollAxis::STEPS_PER_CENTIDEGREE_Q16);
+    cachedEffectSteps[0] = pitch + roll;
+    cachedEffectSteps[1] = pitch - roll;
+    cachedEffectSteps[2] = roundedSteps(offset.yaw, YawAxis::STEPS_PER_CENTIDEGREE_Q16);
+    cachedEffectAt = atMicros;
+    effectCached = true;
+  }
+  for (uint8_t i = 0; i < 3; i++) {
+    steps[i] = cachedEffectSteps[i];
+  }
+}
+
+/**
+ * Function to send a stepper to its base target plus its effect offset, never past its limits
+ * The safety envelope relies on every target being inside them, give or take the play of the gears
+ */
+static void driveToTarget(uint8_t index) {
+  steppers[index] -> moveTo(motorTarget(index, clampTarget(index, baseTarget[index] + effectOffset[index]), steppers[index] -> getCurrentPosition()), false);
+}
+
+/**
+ * Function to start the ramp of a stepper to a new base target
+ * A stepper that turns around is sped up so that it takes up the play within the time of the move, see
+ * raiseRampForTakeUp()
+ * @param index the stepper
+ * @param position the base target in steps
+ */
+static void rampToTarget(uint8_t index, int32_t position) {
+  int32_t from = getChairPosition(index);
+  int32_t before = getTakeUpSteps(index);
+  baseTarget[index] = position;
+  driveToTarget(index);
+
+  int32_t extra = abs(getTakeUpSteps(index) - before);
+  uint32_t distance = abs(clampTarget(index, position + effectOffset[index]) - from);
+  raiseRampForTakeUp(steppers[index], index, distance, extra);
+}
+
+/**
+ * Function to add the running effects to the targets of the steppers that are not on an S-curve
+ * Runs every EFFECT_TICK_MICROS, and once more after the effects end to put the steppers back on their base targets
+ */
+static void updateEffectTargets() {
+  uint32_t now = micros();
+  bool active = areEffectsActive(now);
+
+  // Effects that just ended are taken off the targets right away
+  if ((int32_t)(now - nextEffectTickAt) < 0 && (active || !effectsApplied)) {
+    return;
+  }
+  nextEffectTickAt = now + EFFECT_TICK_MICROS;
+
+  if (!active && !effectsApplied) {
+    return;
+  }
+
+  int32_t steps[3] = { 0, 0, 0 };
+  Pose reach = { 0, 0, 0 };
+  if (active) {
+    getEffectSteps(now, steps);
+    reach = getEffectReach(now);
+  }
+  int32_t pitchRoll = roundedSteps(reach.pitch, PitchAxis::STEPS_PER_CENTIDEGREE_Q16) + roundedSteps(reach.roll, RollAxis::STEPS_PER_CENTIDEGREE_Q16);
+  effectReach[0] = pitchRoll + 1;
+  effectReach[1] = pitchRoll + 1;
+  effectReach[2] = roundedSteps(reach.yaw, YawAxis::STEPS_PER_CENTIDEGREE_Q16) + 1;
+
+  // A stepper on an S-curve keeps its offset until the curve has arrived, the tick after that takes it back
+  effectsApplied = active;
+  for (uint8_t i = 0; i < 3; i++) {
+    if (steppers[i] && !isQueueStepper(i)) {
+      effectOffset[i] = steps[i];
+      driveToTarget(i);
+    }
+    effectsApplied = effectsApplied || effectOffset[i] != 0;
+  }
+}
+
+/**
+ * Function to record the command-to-motion latency the first time a command makes a motor move
+ */
+static void recordMotionStart() {
+  if (commandPending) {
+    lastCommandLatency = micros() - commandReceivedAt;
+    commandPending = false;
+  }
+}
+
+/**
+ * Function to plan the S-curves of the active task and start handing them out
+ * All selected steppers share the plan of the longest move so they arrive together. The jerk of that plan
+ * is lowered until no stepper goes over its own jerk limit.
+ */
+static void startCurves() {
+  int32_t steps[3] = { 0, 0, 0 };
+  uint32_t speed = activeTask.curve.speed;
+  uint32_t acceleration = activeTask.curve.acceleration;
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if ((activeTask.stepperMask & (1 << i)) && steppers[i]) {
+      // The part of the position the effects put there stays theirs, the curve moves the base target
+      int32_t position = getChairPosition(i);
+      effectOffset[i] = effectsApplied ? position - baseTarget[i] : 0;
+      int32_t target = clampTarget(i, activeTask.curve.position[i]);
+      steps[i] = target - (position - effectOffset[i]);
+      baseTarget[i] = target;
+    }
+  }
+
+  uint32_t longest = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    uint32_t distance = steps[i] < 0 ? -steps[i] : steps[i];
+    if (distance > longest) {
+      longest = distance;
+    }
+  }
+
+  // A stepper with a shorter move runs the same curve scaled down, including its jerk
+  uint32_t jerk = 0xFFFFFFFF;
+  for (uint8_t i = 0; i < 3; i++) {
+    uint32_t distance = steps[i] < 0 ? -steps[i] : steps[i];
+    if (distance > 0) {
+      uint64_t allowed = (uint64_t)MAX_JERK[i] * longest / distance;
+      if (allowed < jerk) {
+        jerk = allowed;
+      }
+    }
+  }
+
+  SCurvePlan plan = planSCurve(longest, speed, acceleration, jerk);
+  for (uint8_t i = 0; i < 3; i++) {
+    startSCurve(curves[i], plan, steps[i]);
+    commandWaiting[i] = false;
+    slicesQueued[i] = 0;
+    effectTicksCarry[i] = 0;
+    clearTakeUpDebt(i);
+  }
+  curvesStarted = true;
+  curvesStartedAt = micros();
+}
+
+/**
+ * Function to lay the effects over one slice of an S-curve
+ * The slice gets the change of the effect offset from its start to its end, at most a step so the shaking can't
+ * jolt the motor, and its steps are spread over the same time as before
+ * @param index the stepper of the slice
+ * @param command the slice, changed in place
+ */
+static void addEffectToSlice(uint8_t index, SCurveCommand &command) {
+  uint32_t sliceEnd = curvesStartedAt + (uint32_t)++slicesQueued[index] * SCURVE_SLICE_MICROS;
+  if (!areEffectsActive(sliceEnd) && effectOffset[index] == 0) {
+    return;
+  }
+
+  int32_t steps[3];
+  getEffectSteps(sliceEnd, steps);
+  int32_t change = constrain(steps[index] - effectOffset[index], -1L, 1L);
+
+  // The curve ends on its base target plus the offset, which has to stay inside the limits like any other target
+  int32_t end = baseTarget[index] + effectOffset[index] + change;
+  int32_t total = command.countUp ? command.steps : -(int32_t)command.steps;
+  if (change == 0 || total + change > 255 || total + change < -255 || clampTarget(index, end) != end) {
+    return;
+  }
+  effectOffset[index] += change;
+  total += change;
+
+  uint32_t ticks = (command.steps > 0 ? (uint32_t)command.ticks * command.steps : command.ticks) + effectTicksCarry[index];
+  uint8_t count = total < 0 ? -total : total;
+  if (count == 0) {
+    command.ticks = ticks;
+    effectTicksCarry[index] = 0;
+  } else {
+    command.ticks = ticks / count;
+    effectTicksCarry[index] = ticks - (uint32_t)command.ticks * count;
+    command.countUp = total > 0;
+  }
+  command.steps = count;
+}
+
+/**
+ * Function to top up the stepper queues with the next slices of the S-curves
+ * @return true once every slice has been queued
+ */
+static bool feedCurves() {
+  bool done = true;
+
+  for (uint8_t i = 0; i < 3; i++) {
+    while (steppers[i]) {
+      if (!commandWaiting[i]) {
+        if (!nextSCurveCommand(curves[i], pendingCommand[i])) {
+          break;
+        }
+        addEffectToSlice(i, pendingCommand[i]);
+        markGears(i);
+        takeUpInCommand(i, pendingCommand[i].ticks, pendingCommand[i].steps, pendingCommand[i].countUp);
+        commandWaiting[i] = true;
+      }
+
+      stepper_command_s command;
+      command.ticks = pendingCommand[i].ticks;
+      command.steps = pendingCommand[i].steps;
+      command.count_up = pendingCommand[i].countUp;
+
+      int8_t result = steppers[i] -> addQueueEntry(&command, true);
+      if (result == AQE_QUEUE_FULL) {
+        done = false;
+        break;
+      }
+      if (result == AQE_OK) {
+        lastQueued[i] = command;
+      }
+
+      // Any other error would come back on every retry, so that command is skipped
+      commandWaiting[i] = false;
+    }
+  }
+  return done;
+}
+
+/**
+ * Function to stretch the ticks of a track command by trackStretch
+ * What is left over below a tick is carried into the next command, so no time is lost over a long track.
+ * Called once for every command as it is read, not again when the queue was full.
+ * @param index the stepper
+ * @param command the command as it is in the track
+ * @return the ticks to queue, kept within the limits of a queue entry
+ */
+static uint16_t stretchTicks(uint8_t index, const TrackCommand &command) {
+  if (trackStretch == 0) {
+    return command.ticks;
+  }
+
+  // Every step of the command gets the same ticks, a pause counts as one
+  int32_t steps = command.steps > 0 ? command.steps : 1;
+  int64_t stretch = (int64_t)command.ticks * steps * trackStretch + stretchCarry[index];
+  int32_t perStep = (int32_t)(stretch / (steps * 1000000LL));
+  stretchCarry[index] = (int32_t)(stretch - (int64_t)perStep * steps * 1000000LL);
+
+  int32_t ticks = (int32_t)command.ticks + perStep;
+  int32_t shortest = command.steps > 0 ? TRACK_MIN_STEP_TICKS : TRACK_MIN_PAUSE_TICKS;
+  return (uint16_t)constrain(ticks, shortest, TRACK_MAX_TICKS);
+}
+
+/**
+ * Function to top up the stepper queues with the next commands of the step track
+ * @return true once the track has been handed out, or as much of it as is still to be played
+ */
+static bool feedTrack() {
+  bool done = true;
+
+  for (uint8_t i = 0; i < 3; i++) {
+    while (steppers[i]) {
+      if (!commandWaiting[i]) {
+        if (!nextTrackCommand(trackReaders[i], pendingTrackCommand[i])) {
+          break;
+        }
+        pendingTrackCommand[i].ticks = stretchTicks(i, pendingTrackCommand[i]);
+        takeUpInCommand(i, pendingTrackCommand[i].ticks, pendingTrackCommand[i].steps, pendingTrackCommand[i].countUp);
+        commandWaiting[i] = true;
+      }
+
+      stepper_command_s command;
+      command.ticks = pendingTrackCommand[i].ticks;
+      command.steps = pendingTrackCommand[i].steps;
+      command.count_up = pendingTrackCommand[i].countUp;
+
+      int8_t result = steppers[i] -> addQueueEntry(&command, true);
+      if (result == AQE_QUEUE_FULL) {
+        done = false;
+        break;
+      }
+      if (result == AQE_OK) {
+        lastQueued[i] = command;
+      }
+
+      // Any other error would come back on every retry, so that command is skipped
+      commandWaiting[i] = false;
+    }
+  }
+  return done;
+}
+
+/**
+ * Function to top up the step queues of the halted steppers with their brake ramps
+ * Each slice starts at the speed the one before it ended at and loses BRAKE_ACCELERATION over SCURVE_SLICE_MICROS,
+ * its steps are the distance covered in between
+ */
+static void feedBrakes() {
+  for (uint8_t i = 0; i < 3; i++) {
+    while (brakeRamp[i]) {
+      uint32_t slowdown = BRAKE_ACCELERATION[i] * (SCURVE_SLICE_MICROS / 100) / 10000;
+      uint32_t speed = brakeSpeed[i] > slowdown ? brakeSpeed[i] - slowdown : 0;
+      uint32_t milliSteps = brakeCarry[i] + (brakeSpeed[i] + speed) * (SCURVE_SLICE_MICROS / 100) / 20;
+      uint8_t steps = milliSteps / 1000;
+
+      if (steps > 0 || speed > 0) {
+        stepper_command_s command;
+        command.ticks = steps > 0 ? SCURVE_SLICE_TICKS / steps : SCURVE_SLICE_TICKS;
+        command.steps = steps;
+        command.count_up = lastQueued[i].count_up;
+        if (steppers[i] -> addQueueEntry(&command, true) == AQE_QUEUE_FULL) {
+          break;
+        }
+      }
+      brakeCarry[i] = milliSteps - steps * 1000;
+      brakeSpeed[i] = speed;
+      brakeRamp[i] = speed > 0;
+    }
+  }
+}
+
+/**
+ * Function to make the readers of a paused track carry on from the end of the move after the one the furthest
+ * reader is in, every stepper is at rest on the track there
+ * The steps passed over, and those of commands that were read but not queued, are where the steppers ramp to on
+ * resuming. Called before the brake ramps go into the queues.
+ */
+static void skipPausedTrack() {
+  uint16_t furthest = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    if (trackReaders[i].movesEnded > furthest) {
+      furthest = trackReaders[i].movesEnded;
+    }
+  }
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if (!steppers[i]) {
+      continue;
+    }
+    int32_t skipped = skipToMoveEnd(trackReaders[i], furthest + 1);
+    if (commandWaiting[i]) {
+      int32_t steps = pendingTrackCommand[i].steps;
+      skipped += pendingTrackCommand[i].countUp ? steps : -steps;
+      commandWaiting[i] = false;
+    }
+    trackResumeTarget[i] = steppers[i] -> getPositionAfterCommandsCompleted() + skipped - getTakeUpSteps(i);
+  }
+}
+
+/**
+ * Function to work out when a point of the track that is playing comes, stretched like its commands
+ * @param ticks how far into the track, see TrackReader::ticksRead
+ * @return micros() at that point
+ */
+static uint32_t trackMicros(uint32_t ticks) {
+  int64_t offset = (int64_t)ticks * 1000000 / TICKS_PER_S;
+  return trackStartedAt + (uint32_t)(offset + offset * trackStretch / 1000000);
+}
+
+/**
+ * Function to skip a paused track ahead to where its timeline is, instead of carrying on where it was paused
+ * The readers were already taken to the end of the move the pause came in. They skip whole moves until one ends
+ * at least REJOIN_LEAD_MS from now, the steppers drive to the end of that move and the track goes on from there
+ * at the time it comes on the track.
+ */
+static void rejoinTrack() {
+  uint32_t earliest = micros() + REJOIN_LEAD_MS * 1000UL;
+
+  while (true) {
+    // The moves of all steppers end together, up to the rounding of their steps
+    uint32_t ticks = 0;
+    uint16_t move = 0;
+    bool ended = true;
+    for (uint8_t i = 0; i < 3; i++) {
+      if (steppers[i]) {
+        ticks = max(ticks, trackReaders[i].ticksRead);
+        move = max(move, trackReaders[i].movesEnded);
+        ended = ended && trackReaders[i].offset >= trackReaders[i].end;
+      }
+    }
+    if (ended || (int32_t)(trackMicros(ticks) - earliest) >= 0) {
+      trackRejoining = !ended;
+      trackRejoinAt = trackMicros(ticks);
+      return;
+    }
+
+    for (uint8_t i = 0; i < 3; i++) {
+      if (steppers[i]) {
+        trackResumeTarget[i] += skipToMoveEnd(trackReaders[i], move + 1);
+      }
+    }
+  }
+}
+
+/**
+ * Function to print the message of a segment and let it schedule its tasks
+ * @param call the segment
+ * @param offset where its tasks go, counted from the head of the queue
+ */
+static void runSegment(const SegmentCall &call, uint8_t offset) {
+  if (call.message) {
+    Serial.println(call.message);
+  }
+  if (call.run) {
+    expandingSegment = true;
+    insertOffset = offset;
+    call.run();
+    expandingSegment = false;
+  }
+}
+
+/**
+ * Function to check whether the steppers of the active move are close enough to their targets to hand over
+ * That is where their ramps would start to slow down, plus the distance they cover in BLEND_MARGIN_MS
+ * @param mask the steppers to check
+ */
+static bool nearBlendPoint(uint8_t mask) {
+  for (uint8_t i = 0; i < 3; i++) {
+    if (!(mask & (1 << i)) || !steppers[i] || !steppers[i] -> isRunning()) {
+      continue;
+    }
+    int32_t speed = steppers[i] -> getCurrentSpeedInMilliHz() / 1000;
+    uint32_t velocity = speed < 0 ? -speed : speed; // steps/sec
+    uint32_t acceleration = steppers[i] -> getAcceleration();
+    uint64_t stoppingDistance = acceleration > 0 ? (uint64_t)velocity * velocity / (2ULL * acceleration) : 0;
+    uint32_t margin = velocity * BLEND_MARGIN_MS / 1000;
+
+    int32_t left = baseTarget[i] - getChairPosition(i);
+    if ((uint32_t)(left < 0 ? -left : left) > stoppingDistance + margin) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Function to find the next move in the queue
+ * Speed changes, effects and the ends of commands in front of it are passed over, they take effect before the move
+ * starts anyway.
+ * Segments in front of it are expanded in place, a little before they would be reached otherwise.
+ * @return the next move, or nullptr if anything else comes first
+ */
+static const MotionTask *lookAhead() {
+  uint8_t offset = 0;
+  while (offset < queueCount) {
+    MotionTask &task = queue[queueSlot(offset)];
+    switch (task.type) {
+      case TASK_MOVE_TO:
+      case TASK_MOVE:
+        return &task;
+
+      case TASK_SET_SPEED:
+      case TASK_EFFECT:
+      case TASK_RELEASE:
+        offset++;
+        break;
+
+      case TASK_CALL: {
+        // Take the segment out of the queue and put its tasks where it was
+        SegmentCall call = task.call;
+        for (uint8_t i = offset; i + 1 < queueCount; i++) {
+          queue[queueSlot(i)] = queue[queueSlot(i + 1)];
+        }
+        queueCount--;
+        traceEvent(TRACE_TASK_STARTED, TASK_CALL);
+        runSegment(call, offset);
+        traceEvent(TRACE_TASK_FINISHED, TASK_CALL);
+        break;
+      }
+
+      default:
+        return nullptr;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * Function to check whether the active move can hand over to the next one without waiting for its steppers to stop
+ * This is the corner blending of CNC planners along each motor: when the next move keeps every running stepper
+ * going the same way, it takes over just before the steppers would start to slow down and they run on through
+ * the target at speed. A stepper that has to turn around stops at its target as before.
+ * @return true if the active task can finish now
+ */
+static bool blendIntoNextMove() {
+  if ((activeTask.type != TASK_MOVE_TO && activeTask.type != TASK_MOVE) || activeTask.holdMs > 0 || !nearBlendPoint(activeTask.stepperMask)) {
+    return false;
+  }
+
+  const MotionTask *next = lookAhead();
+  if (!next) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if (!(next -> stepperMask & (1 << i)) || !steppers[i] || !steppers[i] -> isRunning()) {
+      continue;
+    }
+    int32_t ahead = next -> type == TASK_MOVE_TO ? next -> position[i] - baseTarget[i] : next -> position[i];
+    int32_t speed = steppers[i] -> getCurrentSpeedInMilliHz();
+    if ((ahead > 0 && speed < 0) || (ahead < 0 && speed > 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Function to issue the command of a task that has just been taken off the queue
+ */
+static void startTask() {
+  taskPhase = PHASE_MOVING;
+  curvesStarted = false;
+  trackStarted = false;
+  trackResuming = false;
+  trackRejoining = false;
+  traceEvent(TRACE_TASK_STARTED, activeTask.type);
+
+  switch (activeTask.type) {
+    case TASK_CALL:
+      runSegment(activeTask.call, 0);
+      break;
+
+    case TASK_MOVE_TO:
+    case TASK_MOVE:
+      recordMotionStart();
+      traceEvent(TRACE_MOVE_STARTED, activeTask.stepperMask);
+      for (uint8_t i = 0; i < 3; i++) {
+        if ((activeTask.stepperMask & (1 << i)) && steppers[i]) {
+          rampToTarget(i, activeTask.type == TASK_MOVE_TO ? activeTask.position[i] : baseTarget[i] + activeTask.position[i]);
+        }
+      }
+      break;
+
+    case TASK_MOVE_POSE: {
+      recordMotionStart();
+      traceEvent(TRACE_MOVE_STARTED, ALL_STEPPERS_MASK);
+
+      // Scale each motor's ramp so all three finish together, planned on where the chair goes
+      int32_t current[3];
+      for (uint8_t i = 0; i < 3; i++) {
+        current[i] = steppers[i] ? getChairPosition(i) : activeTask.pose.position[i];
+      }
+      MotorProfiles profiles = synchronizeMotion(current, activeTask.pose.position, activeTask.pose.speed, activeTask.pose.acceleration);
+
+      for (uint8_t i = 0; i < 3; i++) {
+        if (steppers[i]) {
+          // The profile of the pose replaces whatever ramp the motor had
+          lowerRamp(steppers[i], i);
+          steppers[i] -> setSpeedInMilliHz(profiles.speedInMilliHz[i]);
+          steppers[i] -> setAcceleration(profiles.acceleration[i]);
+          rampToTarget(i, activeTask.pose.position[i]);
+        }
+      }
+      break;
+    }
+
+    case TASK_MOVE_CURVE:
+    case TASK_PLAY_TRACK:
+      // The curves and tracks start once the steppers are at rest, see pollActiveTask()
+      break;
+
+    case TASK_EFFECT:
+      startEffect(activeTask.effect, micros());
+      effectCached = false;
+      nextEffectTickAt = micros();
+      break;
+
+    case TASK_SET_SPEED:
+      for (uint8_t i = 0; i < 3; i++) {
+        if ((activeTask.stepperMask & (1 << i)) && steppers[i]) {
+          lowerRamp(steppers[i], i);
+          steppers[i] -> setSpeedInHz(activeTask.motion.speed); // steps/sec
+          if (activeTask.motion.acceleration > 0) {
+            steppers[i] -> setAcceleration(activeTask.motion.acceleration); // steps/sec^2
+          }
+        }
+      }
+      break;
+
+    case TASK_WAIT:
+    case TASK_WAIT_UNTIL:
+      break;
+
+    case TASK_RELEASE:
+      reservedTasks -= activeTask.tasks;
+      break;
+  }
+}
+
+/**
+ * Function to check the active task against isRunning() and its hold deadline
+ * @return true once the task is finished
+ */
+static bool pollActiveTask() {
+  if (activeTask.type == TASK_CALL || activeTask.type == TASK_SET_SPEED || activeTask.type == TASK_EFFECT || activeTask.type == TASK_RELEASE) {
+    return true;
+  }
+  if (activeTask.type == TASK_WAIT_UNTIL) {
+    return (int32_t)(micros() - activeTask.untilMicros) >= 0;
+  }
+
+  if (taskPhase == PHASE_MOVING) {
+    if (activeTask.type == TASK_MOVE_CURVE) {
+      if (!curvesStarted) {
+        // The step queue can only take over from a stepper that has stopped
+        if (anyRunning(activeTask.stepperMask)) {
+          return false;
+        }
+        recordMotionStart();
+        traceEvent(TRACE_MOVE_STARTED, activeTask.stepperMask);
+        startCurves();
+      }
+      if (!feedCurves()) {
+        return false;
+      }
+    }
+
+    if (activeTask.type == TASK_PLAY_TRACK) {
+      if (!trackStarted) {
+        if (anyRunning(activeTask.stepperMask)) {
+          return false;
+        }
+        recordMotionStart();
+        traceEvent(TRACE_MOVE_STARTED, activeTask.stepperMask);
+        openStepTrack(trackReaders, activeTask.track);
+        trackStartedAt = micros();
+        for (uint8_t i = 0; i < 3; i++) {
+          commandWaiting[i] = false;
+          stretchCarry[i] = 0;
+          clearTakeUpDebt(i);
+        }
+        trackStarted = true;
+      }
+      if (trackResuming) {
+        // Back from a pause the steppers ramp onto the track first, the queues take over once they are there
+        if (anyRunning(activeTask.stepperMask)) {
+          return false;
+        }
+        if (trackRejoining && (int32_t)(micros() - trackRejoinAt) < 0) {
+          return false;
+        }
+        trackResuming = false;
+        trackRejoining = false;
+      }
+      if (!feedTrack()) {
+        return false;
+      }
+
+      // The track moved the steppers without the scheduler, where it ends is the new base
+      for (uint8_t i = 0; i < 3; i++) {
+        if (steppers[i]) {
+          baseTarget[i] = steppers[i] -> getPositionAfterCommandsCompleted() - getTakeUpSteps(i);
+          effectOffset[i] = 0;
+        }
+      }
+    }
+
+    if (anyMoving(activeTask.waitMask) && !blendIntoNextMove()) {
+      return false;
+    }
+    taskPhase = PHASE_HOLDING;
+    holdStartedAt = millis();
+    traceEvent(TRACE_HOLD_STARTED, activeTask.type);
+  }
+
+  return millis() - holdStartedAt >= activeTask.holdMs;
+}
+
+/**
+ * Function to remember the steppers the scheduler drives
+ * From here on every move goes through the scheduler or retargetSteppers(), so it knows the base targets
+ */
+void initScheduler(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third) {
+  steppers[0] = first;
+  steppers[1] = second;
+  steppers[2] = third;
+
+  for (uint8_t i = 0; i < 3; i++) {
+    baseTarget[i] = steppers[i] ? steppers[i] -> getCurrentPosition() : 0;
+  }
+}
+
+/**
+ * Function to note that every stepper has come to rest after a halt
+ */
+static void recordHaltAtRest() {
+  uint32_t took = micros() - haltedAt;
+  uint32_t furthest = 0;
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if (!steppers[i]) {
+      continue;
+    }
+    if (brakeRaised[i] && (uint32_t)steppers[i] -> getAcceleration() == BRAKE_ACCELERATION[i]) {
+      steppers[i] -> setAcceleration(ownAcceleration[i]);
+    }
+    brakeRaised[i] = false;
+
+    int32_t distance = steppers[i] -> getCurrentPosition() - haltPosition[i];
+    distance = distance < 0 ? -distance : distance;
+    if ((uint32_t)distance > furthest) {
+      furthest = distance;
+    }
+  }
+
+  haltStats.halts++;
+  haltStats.lastMicros = took;
+  haltStats.maxMicros = max(haltStats.maxMicros, took);
+  haltStats.lastSteps = furthest < 0xFFFF ? furthest : 0xFFFF;
+  haltStats.maxSteps = max(haltStats.maxSteps, haltStats.lastSteps);
+  haltAtRest = true;
+  traceEvent(TRACE_HALT_AT_REST, haltMode);
+}
+
+/**
+ * Function to carry on with the tasks that were paused
+ * Trapezoid moves and streamed targets are driven again, an S-curve is planned again from where its steppers are,
+ * a track ramps to the end of the move it was skipped to and a hold gets back the time it was paused.
+ * On a timeline nothing gets the time back: holds and waits end when they would have and a track skips ahead.
+ */
+static void resumeTasks() {
+  uint32_t pausedMillis = millis() - haltedAtMillis;
+  bool moving = taskActive && taskPhase == PHASE_MOVING;
+
+  if (taskActive && taskPhase == PHASE_HOLDING && !resumeOnTimeline) {
+    holdStartedAt += pausedMillis;
+  }
+  if (taskActive && activeTask.type == TASK_WAIT_UNTIL && !resumeOnTimeline) {
+    activeTask.untilMicros += micros() - haltedAt;
+  }
+  if (moving && activeTask.type == TASK_MOVE_CURVE && curvesStarted) {
+    for (uint8_t i = 0; i < 3; i++) {
+      if ((activeTask.stepperMask & (1 << i)) && steppers[i]) {
+        baseTarget[i] = getChairPosition(i) - effectOffset[i];
+      }
+    }
+    curvesStarted = false;
+  }
+  if (moving && activeTask.type == TASK_PLAY_TRACK && trackStarted) {
+    if (resumeOnTimeline) {
+      rejoinTrack();
+    }
+    for (uint8_t i = 0; i < 3; i++) {
+      baseTarget[i] = trackResumeTarget[i];
+      effectOffset[i] = 0;
+    }
+    trackResuming = true;
+  }
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if (steppers[i]) {
+      driveToTarget(i);
+    }
+  }
+  haltMode = HALT_NONE;
+  resumeRequested = false;
+  traceEvent(TRACE_RESUMED, 0);
+}
+
+/**
+ * Function to brake the halted steppers to a stop and end the halt once they are at rest
+ * A stop ends there, the base targets become where the steppers stopped. A pause waits for resumeScheduler().
+ */
+static void updateHalt() {
+  if (!haltAtRest) {
+    feedBrakes();
+    for (uint8_t i = 0; i < 3; i++) {
+      if (brakeRamp[i] || (steppers[i] && steppers[i] -> isRunning())) {
+        return;
+      }
+    }
+    recordHaltAtRest();
+  }
+
+  if (haltMode == HALT_STOP) {
+    for (uint8_t i = 0; i < 3; i++) {
+      if (steppers[i]) {
+        baseTarget[i] = getChairPosition(i);
+        effectOffset[i] = 0;
+      }
+    }
+    haltMode = HALT_NONE;
+  } else if (resumeRequested) {
+    resumeTasks();
+  }
+}
+
+/**
+ * Function to advance the queue, called on every pass through loop()
+ * Never blocks: tasks that finish immediately are chained, anything that needs time is polled on the next call
+ */
+void updateScheduler() {
+  if (haltMode != HALT_NONE) {
+    updateHalt();
+    if (haltMode != HALT_NONE) {
+      return;
+    }
+  }
+
+  // A ramp sped up for the take-up is put back once its motor stops, nothing after the move should see it
+  for (uint8_t i = 0; i < 3; i++) {
+    if (steppers[i] && !steppers[i] -> isRunning()) {
+      lowerRamp(steppers[i], i);
+    }
+  }
+
+  updateEffectTargets();
+
+  if (taskActive) {
+    if (!pollActiveTask()) {
+      return;
+    }
+    traceEvent(TRACE_TASK_FINISHED, activeTask.type);
+  }
+  taskActive = false;
+
+  while (queueCount > 0) {
+    activeTask = queue[queueHead];
+    queueHead = queueSlot(1);
+    queueCount--;
+
+    startTask();
+    if (!pollActiveTask()) {
+      taskActive = true;
+      return;
+    }
+    traceEvent(TRACE_TASK_FINISHED, activeTask.type);
+  }
+}
+
+/**
+ * Function to drop every queued task
+ * Steppers that are already moving keep going to their current target
+ */
+void clearScheduler() {
+  queueCount = 0;
+  expandingSegment = false;
+  reservedTasks = 0;
+
+  // A started S-curve has to be handed out to the end, the steppers would stop dead when their queues run dry
+  // A started track is cut short at the end of its current move
+  if (taskActive && (curvesStarted || trackStarted) && taskPhase == PHASE_MOVING) {
+    activeTask.holdMs = 0;
+    if (trackStarted) {
+      stopTrackAtMoveEnd(trackReaders);
+    }
+  } else {
+    taskActive = false;
+  }
+}
+
+/**
+ * Function to check whether there is nothing left to run
+ * An effect with a duration is still running until it has ended and the steppers are back on their base targets,
+ * an effect without one can go on under a stream and doesn't count
+ */
+bool isSchedulerIdle() {
+  return haltMode == HALT_NONE && !taskActive && queueCount == 0 && !areTimedEffectsActive(micros()) && !(effectsApplied && !areEffectsActive(micros()));
+}
+
+/**
+ * Function to set aside room in the queue for a command before any of its tasks are queued
+ * Segments are expanded in place, so a command queued behind another one could otherwise take the room the
+ * segments of the one in front need once they are reached. The room is given back by scheduleRelease().
+ * @param tasks the most tasks the command has in the queue at one time, its release included
+ * @return false if there isn't that much room left, nothing is set aside then
+ */
+bool reserveTasks(uint8_t tasks) {
+  if (reservedTasks + tasks > MOTION_QUEUE_SIZE) {
+    traceEvent(TRACE_QUEUE_FULL, TASK_RELEASE);
+    return false;
+  }
+  reservedTasks += tasks;
+  return true;
+}
+
+/**
+ * Function to queue the end of a command, which gives back the room it set aside once it is reached
+ * Tasks its segments schedule go in front of it, so the room is kept until the last of them has started
+ * @param tasks the room set aside with reserveTasks()
+ */
+bool scheduleRelease(uint8_t tasks) {
+  MotionTask task;
+  task.type = TASK_RELEASE;
+  task.stepperMask = 0;
+  task.waitMask = 0;
+  task.holdMs = 0;
+  task.tasks = tasks;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue a ride segment that is expanded into its moves only when it is reached
+ * This keeps the queue short and lets segments like levelOut() look at where the chair actually is
+ * @param run the function that schedules the segment's tasks
+ * @param message text in flash printed when the segment starts, from F()
+ */
+bool scheduleSegment(void (*run)(), const __FlashStringHelper *message) {
+  MotionTask task;
+  task.type = TASK_CALL;
+  task.stepperMask = 0;
+  task.waitMask = 0;
+  task.holdMs = 0;
+  task.call.run = run;
+  task.call.message = message;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue an absolute move
+ * @param stepperMask the steppers to move
+ * @param position1 target of stepper1 in steps
+ * @param position2 target of stepper2 in steps
+ * @param position3 target of stepper3 in steps
+ * @param waitMask the steppers that have to arrive before the hold time starts
+ * @param holdMs how long to stay once they arrived
+ */
+bool scheduleMoveTo(uint8_t stepperMask, int32_t position1, int32_t position2, int32_t position3, uint8_t waitMask, uint16_t holdMs) {
+  MotionTask task;
+  task.type = TASK_MOVE_TO;
+  task.stepperMask = stepperMask;
+  task.waitMask = waitMask;
+  task.holdMs = holdMs;
+  task.position[0] = position1;
+  task.position[1] = position2;
+  task.position[2] = position3;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue a coordinated move of all three steppers to a pose
+ * Pitch and roll are mixed onto stepper1 and stepper2, and each motor's speed and acceleration
+ * are scaled when the move starts so that all of them arrive at the same time
+ * @param pitch the pitch in hundredths of a degree
+ * @param roll the roll in hundredths of a degree
+ * @param yaw the yaw in hundredths of a degree
+ * @param speed the speed of the motor with the longest move in steps/sec
+ * @param acceleration the acceleration of the motor with the longest move in steps/sec^2
+ * @param holdMs how long to stay once all motors arrived
+ */
+bool scheduleMoveToPose(int16_t pitch, int16_t roll, int16_t yaw, uint32_t speed, uint32_t acceleration, uint16_t holdMs) {
+  MotorTargets targets = mixPose(pitch, roll, yaw);
+
+  MotionTask task;
+  task.type = TASK_MOVE_POSE;
+  task.stepperMask = ALL_STEPPERS_MASK;
+  task.waitMask = ALL_STEPPERS_MASK;
+  task.holdMs = holdMs;
+  for (uint8_t i = 0; i < 3; i++) {
+    task.pose.position[i] = targets.position[i];
+  }
+  task.pose.speed = speed;
+  task.pose.acceleration = acceleration;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue an absolute move with a jerk-limited S-curve instead of the trapezoid ramp of FastAccelStepper
+ * The move starts once the selected steppers are at rest, and they all arrive at the same time
+ * @param stepperMask the steppers to move
+ * @param position1 target of stepper1 in steps
+ * @param position2 target of stepper2 in steps
+ * @param position3 target of stepper3 in steps
+ * @param speed the speed of the longest move in steps/sec
+ * @param acceleration the acceleration of the longest move in steps/sec^2
+ * @param waitMask the steppers that have to arrive before the hold time starts
+ * @param holdMs how long to stay once they arrived
+ */
+bool scheduleCurveMoveTo(uint8_t stepperMask, int32_t position1, int32_t position2, int32_t position3, uint32_t speed, uint32_t acceleration, uint8_t waitMask, uint16_t holdMs) {
+  MotionTask task;
+  task.type = TASK_MOVE_CURVE;
+  task.stepperMask = stepperMask;
+  task.waitMask = waitMask;
+  task.holdMs = holdMs;
+  task.curve.position[0] = position1;
+  task.curve.position[1] = position2;
+  task.curve.position[2] = position3;
+  task.curve.speed = speed;
+  task.curve.acceleration = acceleration;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue a relative move, see scheduleMoveTo() for the parameters
+ */
+bool scheduleMove(uint8_t stepperMask, int32_t steps1, int32_t steps2, int32_t steps3, uint8_t waitMask, uint16_t holdMs) {
+  MotionTask task;
+  task.type = TASK_MOVE;
+  task.stepperMask = stepperMask;
+  task.waitMask = waitMask;
+  task.holdMs = holdMs;
+  task.position[0] = steps1;
+  task.position[1] = steps2;
+  task.position[2] = steps3;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue a change of speed and acceleration
+ * @param stepperMask the steppers to change
+ * @param speed the new speed in steps/sec
+ * @param acceleration the new acceleration in steps/sec^2, 0 keeps the current acceleration
+ */
+bool scheduleSpeedAndAcceleration(uint8_t stepperMask, uint32_t speed, uint32_t acceleration) {
+  MotionTask task;
+  task.type = TASK_SET_SPEED;
+  task.stepperMask = stepperMask;
+  task.waitMask = 0;
+  task.holdMs = 0;
+  task.motion.speed = speed;
+  task.motion.acceleration = acceleration;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue a pause, the non-blocking replacement for delay()
+ * @param waitMask the steppers that have to stop before the hold time starts
+ * @param holdMs how long to wait
+ */
+bool scheduleWait(uint8_t waitMask, uint16_t holdMs) {
+  MotionTask task;
+  task.type = TASK_WAIT;
+  task.stepperMask = 0;
+  task.waitMask = waitMask;
+  task.holdMs = holdMs;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue a wait until a point in time, more precise than a hold in milliseconds
+ * Used to start a ride at a time set by a host, a pause moves the time on by as long as it lasted
+ * @param atMicros the time on micros(), at most 35 minutes ahead
+ */
+bool scheduleWaitUntil(uint32_t atMicros) {
+  MotionTask task;
+  task.type = TASK_WAIT_UNTIL;
+  task.stepperMask = 0;
+  task.waitMask = 0;
+  task.holdMs = 0;
+  task.untilMicros = atMicros;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue the start or stop of a vibration effect
+ * The effect starts when the task is reached and shakes the chair around the moves of the tasks after it,
+ * until its duration is up or another effect task stops it
+ * @param settings the effect, see Effects.h
+ */
+bool scheduleEffect(const EffectSettings &settings) {
+  MotionTask task;
+  task.type = TASK_EFFECT;
+  task.stepperMask = 0;
+  task.waitMask = 0;
+  task.holdMs = 0;
+  task.effect = settings;
+  return insertTask(task);
+}
+
+/**
+ * Function to queue a ride that was compiled into step commands
+ * The track starts once every stepper is at rest and plays from where they are, so the chair has to be level
+ * @param track the step track in flash, see StepTrack.h
+ */
+bool scheduleTrack(const uint8_t *track) {
+  MotionTask task;
+  task.type = TASK_PLAY_TRACK;
+  task.stepperMask = ALL_STEPPERS_MASK;
+  task.waitMask = ALL_STEPPERS_MASK;
+  task.holdMs = 0;
+  task.track = track;
+  return insertTask(task);
+}
+
+/**
+ * Function to send the steppers to new targets right away, outside of the queue
+ * Used while streaming poses, the running effects are added on top like they are for queued moves
+ * While the scheduler is halted the targets are only remembered, a resumed pause drives the steppers there
+ * @param position1 target of stepper1 in steps
+ * @param position2 target of stepper2 in steps
+ * @param position3 target of stepper3 in steps
+ */
+void retargetSteppers(int32_t position1, int32_t position2, int32_t position3) {
+  baseTarget[0] = position1;
+  baseTarget[1] = position2;
+  baseTarget[2] = position3;
+  if (haltMode != HALT_NONE) {
+    return;
+  }
+  for (uint8_t i = 0; i < 3; i++) {
+    if (steppers[i] && !isQueueStepper(i)) {
+      driveToTarget(i);
+    }
+  }
+}
+
+/**
+ * Function to set the backlash of every stepper, right after initScheduler()
+ * @param steps the backlash of stepper1, stepper2 and stepper3 in steps, see Backlash.h
+ * @param direction 1 if the gears of every stepper were last driven up, which is how homing ends, 0 if not known
+ */
+void initBacklash(const uint8_t *steps, int8_t direction) {
+  initGears(steps, direction);
+  for (uint8_t i = 0; i < 3; i++) {
+    baseTarget[i] = steppers[i] ? getChairPosition(i) : 0;
+  }
+}
+
+/**
+ * Function to get where the chair side of the gears of a stepper is, in steps
+ */
+int32_t getChairPosition(uint8_t index) {
+  return steppers[index] ? steppers[index] -> getCurrentPosition() - getTakeUpSteps(index) : 0;
+}
+
+/**
+ * Function to set how much longer than compiled the step tracks are played
+ * A chair whose crystal runs slow against the timeline of a host plays them a little shorter, see ClockSync.h.
+ * Takes effect from the next command handed to the queues, also in the middle of a track.
+ * @param ppm parts per million longer, negative for shorter
+ */
+void setTrackStretch(int32_t ppm) {
+  trackStretch = ppm;
+}
+
+/**
+ * Function to brake every stepper to a stop at its braking limit, ahead of everything that is queued
+ * Nothing moves the steppers until they are at rest: the queue, the effects and retargetSteppers() are held back.
+ * A stop can follow a pause and drops its queue, anything else while halted is ignored.
+ * @param mode HALT_STOP to drop everything queued, HALT_PAUSE to keep it for resumeScheduler()
+ */
+void haltScheduler(HaltMode mode) {
+  if (mode == HALT_NONE || haltMode == HALT_STOP || haltMode == mode) {
+    return;
+  }
+  bool braking = haltMode != HALT_NONE;
+  haltMode = mode;
+  resumeRequested = false;
+  traceEvent(TRACE_HALTED, mode);
+
+  if (mode == HALT_STOP) {
+    queueCount = 0;
+    expandingSegment = false;
+    reservedTasks = 0;
+    taskActive = false;
+    trackResuming = false;
+    trackRejoining = false;
+  }
+  if (braking) {
+    // Already braking or at rest after a pause, the stop only drops what the pause kept
+    return;
+  }
+
+  // The track has to carry on from the end of a move, which is worked out before anything else is queued
+  if (taskActive && activeTask.type == TASK_PLAY_TRACK && trackStarted && taskPhase == PHASE_MOVING && !trackResuming) {
+    skipPausedTrack();
+  }
+
+  haltAtRest = false;
+  haltedAt = micros();
+  haltedAtMillis = millis();
+  for (uint8_t i = 0; i < 3; i++) {
+    brakeRaised[i] = false;
+    brakeRamp[i] = false;
+    if (!steppers[i]) {
+      continue;
+    }
+    haltPosition[i] = steppers[i] -> getCurrentPosition();
+    if (commandWaiting[i]) {
+      // An S-curve slice that was read but never queued didn't turn the gears, a track counts it as skipped instead
+      rewindGears(i);
+    }
+    commandWaiting[i] = false;
+
+    if (steppers[i] -> isRampGeneratorActive()) {
+      ownAcceleration[i] = steppers[i] -> getAcceleration();
+      if (ownAcceleration[i] < BRAKE_ACCELERATION[i]) {
+        steppers[i] -> setAcceleration(BRAKE_ACCELERATION[i]);
+        steppers[i] -> applySpeedAcceleration();
+        brakeRaised[i] = true;
+      }
+      steppers[i] -> stopMove();
+    } else if (steppers[i] -> isRunning()) {
+      // The queue can't be cut short, the brake ramp goes after the commands in it
+      const stepper_command_s &last = lastQueued[i];
+      brakeSpeed[i] = last.steps > 0 ? SCURVE_TICKS_PER_SECOND / last.ticks : 0;
+      brakeCarry[i] = 0;
+      brakeRamp[i] = brakeSpeed[i] > 0;
+    }
+  }
+  feedBrakes();
+}
+
+/**
+ * Function to carry on after haltScheduler(HALT_PAUSE), once the steppers have come to rest
+ * @param keepTimeline false to let everything queued wait for the pause, true to keep the tasks on the times they
+ * had, like a ride synced to a timeline: what was missed is skipped
+ * @return false if the scheduler was not paused
+ */
+bool resumeScheduler(bool keepTimeline) {
+  if (haltMode != HALT_PAUSE) {
+    return false;
+  }
+  resumeRequested = true;
+  resumeOnTimeline = keepTimeline;
+  return true;
+}
+
+/**
+ * Function to get how the scheduler is halted, HALT_NONE while it runs
+ */
+HaltMode getSchedulerHalt() {
+  return haltMode;
+}
+
+/**
+ * Function to get how long halts took to bring every stepper to rest, since startup
+ */
+const HaltStats &getHaltStats() {
+  return haltStats;
+}
+
+/**
+ * Function to note when a command was received so the delay until it moves a motor can be measured
+ * @param receivedAtMicros micros() at the time the command arrived
+ */
+void markCommandReceived(uint32_t receivedAtMicros) {
+  commandPending = true;
+  commandReceivedAt = receivedAtMicros;
+}
+
+/**
+ * Function to get the time between the last command arriving and its first move starting
+ * @return the latency in microseconds, or NO_LATENCY_MEASURED
+ */
+uint32_t getCommandLatency() {
+  return lastCommandLatency;
+}
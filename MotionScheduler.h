@@ -0,0 +1,145 @@
+#ifndef MOTION_SCHEDULER_H
+#define MOTION_SCHEDULER_H
+
+#include "Arduino.h"
+#include "FastAccelStepper.h"
+#include "Kinematics.h"
+#include "SCurve.h"
+#include "Effects.h"
+#include "StepTrack.h"
+
+// Number of tasks that can be waiting in the motion queue, each takes 25 bytes of SRAM on the AVR
+// A roller coaster has at most 35 tasks in the queue at one time (COASTER_TASKS, measured with chair_sim), twice that
+// lets any command be queued behind a coaster, another coaster included
+#define MOTION_QUEUE_SIZE 70
+
+// Masks used to select which steppers a task acts on or waits for
+#define STEPPER1_MASK 0x01
+#define STEPPER2_MASK 0x02
+#define STEPPER3_MASK 0x04
+#define PITCH_ROLL_MASK (STEPPER1_MASK | STEPPER2_MASK)
+#define ALL_STEPPERS_MASK (STEPPER1_MASK | STEPPER2_MASK | STEPPER3_MASK)
+
+// Value returned by getCommandLatency() before any command has reached the motors
+#define NO_LATENCY_MEASURED 0xFFFFFFFF
+
+// Running effects are added to the targets of trapezoid moves at this rate, the same 200 Hz as the stream tick
+// S-curve moves get them slice by slice as the slices are queued
+#define EFFECT_TICK_MICROS 5000
+
+// A step track on the timeline of a synced ride that is resumed after a pause skips to the end of the first move that
+// comes at least this much later, the time its steppers get to drive there
+#define REJOIN_LEAD_MS 500
+
+// A move without a hold is handed over to the next move this long before it would start to slow down,
+// which covers the time between two passes through loop()
+#define BLEND_MARGIN_MS 20
+
+// The kinds of tasks the scheduler knows how to run
+enum MotionTaskType : uint8_t {
+  TASK_CALL,       // Print an optional message and run a segment function that schedules more tasks
+  TASK_MOVE_TO,    // Move the selected steppers to absolute positions
+  TASK_MOVE,       // Move the selected steppers by relative amounts
+  TASK_MOVE_POSE,  // Move all steppers to a pose so that they arrive at the same time
+  TASK_MOVE_CURVE, // Move the selected steppers to absolute positions with a jerk-limited S-curve
+  TASK_SET_SPEED,  // Change the speed and acceleration of the selected steppers
+  TASK_WAIT,       // Only wait for the steppers in waitMask and/or the hold time
+  TASK_EFFECT,     // Start or stop a vibration effect, it runs on top of the tasks after it
+  TASK_PLAY_TRACK, // Play a ride compiled into step commands, see StepTrack.h
+  TASK_WAIT_UNTIL, // Wait until micros() reaches a given time
+  TASK_RELEASE     // End of a command, gives back the room it set aside with reserveTasks()
+};
+
+// How haltScheduler() stops the chair
+// Every motor brakes at its braking limit from AxisConfig.h right away. Motors on a trapezoid ramp start braking at
+// once, motors on the step queue (S-curves and step tracks) once the commands already in their queue have run out,
+// which is at most 16 commands: 32 ms of an S-curve, or 16 steps of a track.
+enum HaltMode : uint8_t {
+  HALT_NONE,
+  HALT_STOP, // Everything queued is dropped, the chair stays where it comes to rest
+  HALT_PAUSE // Everything queued is kept until resumeScheduler()
+};
+
+// How long halts took, from haltScheduler() until every motor was at rest
+struct HaltStats {
+  uint16_t halts;
+  uint32_t lastMicros;
+  uint32_t maxMicros;
+  uint16_t lastSteps; // Furthest a motor went after haltScheduler()
+  uint16_t maxSteps;
+};
+
+struct SpeedAndAcceleration {
+  uint32_t speed;        // steps/sec
+  uint32_t acceleration; // steps/sec^2
+};
+
+struct ProfiledMove {
+  int32_t position[3];   // Motor targets in steps
+  uint32_t speed;        // steps/sec of the motor with the longest move
+  uint32_t acceleration; // steps/sec^2 of the motor with the longest move
+};
+
+struct SegmentCall {
+  void (*run)();                      // Function that schedules the tasks of the segment, may be nullptr
+  const __FlashStringHelper *message; // Printed when the segment starts, may be nullptr
+};
+
+/**
+ * One queued piece of a motion
+ * A task first issues its command, then waits until every stepper in waitMask has stopped
+ * and finally holds for holdMs milliseconds before the next task starts
+ * A move to or by a position without a hold is blended into the move after it when none of its steppers has to
+ * turn around, so the steppers run on through the position instead of stopping there
+ */
+struct MotionTask {
+  MotionTaskType type;
+  uint8_t stepperMask;
+  uint8_t waitMask;
+  uint16_t holdMs;
+  union {
+    int32_t position[3];
+    SpeedAndAcceleration motion;
+    EffectSettings effect;
+    ProfiledMove pose;  // Targets worked out by mixPose()
+    ProfiledMove curve;
+    SegmentCall call;
+    const uint8_t *track; // Step track in flash
+    uint32_t untilMicros;
+    uint8_t tasks; // Room given back by TASK_RELEASE
+  };
+};
+
+void initScheduler(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third);
+void updateScheduler();
+void clearScheduler();
+bool isSchedulerIdle();
+
+bool reserveTasks(uint8_t tasks);
+bool scheduleRelease(uint8_t tasks);
+
+bool scheduleSegment(void (*run)(), const __FlashStringHelper *message);
+bool scheduleMoveTo(uint8_t stepperMask, int32_t position1, int32_t position2, int32_t position3, uint8_t waitMask, uint16_t holdMs);
+bool scheduleMoveToPose(int16_t pitch, int16_t roll, int16_t yaw, uint32_t speed, uint32_t acceleration, uint16_t holdMs);
+bool scheduleCurveMoveTo(uint8_t stepperMask, int32_t position1, int32_t position2, int32_t position3, uint32_t speed, uint32_t acceleration, uint8_t waitMask, uint16_t holdMs);
+bool scheduleMove(uint8_t stepperMask, int32_t steps1, int32_t steps2, int32_t steps3, uint8_t waitMask, uint16_t holdMs);
+bool scheduleSpeedAndAcceleration(uint8_t stepperMask, uint32_t speed, uint32_t acceleration);
+bool scheduleWait(uint8_t waitMask, uint16_t holdMs);
+bool scheduleWaitUntil(uint32_t atMicros);
+bool scheduleEffect(const EffectSettings &settings);
+bool scheduleTrack(const uint8_t *track);
+void retargetSteppers(int32_t position1, int32_t position2, int32_t position3);
+void setTrackStretch(int32_t ppm);
+
+void initBacklash(const uint8_t *steps, int8_t direction);
+int32_t getChairPosition(uint8_t index);
+
+void haltScheduler(HaltMode mode);
+bool resumeScheduler(bool keepTimeline);
+HaltMode getSchedulerHalt();
+const HaltStats &getHaltStats();
+
+void markCommandReceived(uint32_t receivedAtMicros);
+uint32_t getCommandLatency();
+
+#endif
@@ -1,679 +1,1412 @@
-#include "FastAccelStepper.h"
-
-// Define pins for the motors
-#define STEPPER1_STEP_PIN 6
-#define STEPPER1_DIR_PIN 3
-
-#define STEPPER2_STEP_PIN 7
-#define STEPPER2_DIR_PIN 4
-
-#define STEPPER3_STEP_PIN 8
-#define STEPPER3_DIR_PIN 5
-
-// These values can be tuned
-#define MAX_SPEED 10000
-#define MAX_ACCELERATION 10000
-#define MIN_SPEED 100
-#define MIN_ACCELERATION 100
-
-#define MAX_POS_PITCH_POSITION 83 // 30/(360/(5 * 200))
-#define MAX_NEG_PITCH_POSITION -83
-
-#define MAX_POS_ROLL_POSITION 83 // 30/(360/(5 * 200))
-#define MAX_NEG_ROLL_POSITION -83
-
-#define MAX_POS_YAW_POSITION 55 // 20/(360/(5 * 200))
-#define MAX_NEG_YAW_POSITION -55
-
-// Create the engine and the steppers
-FastAccelStepperEngine engine = FastAccelStepperEngine();
-FastAccelStepper *stepper1 = nullptr;
-FastAccelStepper *stepper2 = nullptr;
-FastAccelStepper *stepper3 = nullptr;
-
-// Enumeration of states to structure the simulation process
-enum State {
-  WAIT_FOR_INPUT,
-  WAIT_FOR_AXIS_CHOICE,
-  WAIT_FOR_SPEED_AND_ACCELERATION,
-  WAIT_FOR_POSITION,
-  PROCESSING
-};
-
-// Global variables //
-
-// Start at the first state
-State currentState = WAIT_FOR_INPUT;
-
-// Pitch, roll, or yaw
-String currentAxis = "";
-
-// Desired movement
-String choice = "";
-
-// The # of steps to achieve a certain position
-int32_t positionInSteps = 0;
-
-/**
- * Function to setup the Serial, steppers, and move the motors to the zero position if they are not already there 
-*/
-void setup() {
-  Serial.begin(4800);
-  while (!Serial); // Wait for the Serial to start
-  engine.init(); // Start the engine
-
-  // Initialize steppers (stepper1 and stepper2 are used for pitch and roll and stepper3 is used for yaw)
-  stepper1 = engine.stepperConnectToPin(STEPPER1_STEP_PIN);
-  if (stepper1) {
-    stepper1 -> setDirectionPin(STEPPER1_DIR_PIN);
-    stepper1 -> setSpeedInHz(1000); // steps/sec
-    stepper1 -> setAcceleration(1000); // steps/sec^2
-  }
-
-  stepper2 = engine.stepperConnectToPin(STEPPER2_STEP_PIN);
-  if (stepper2) {
-    stepper2 -> setDirectionPin(STEPPER2_DIR_PIN);
-    stepper2 -> setSpeedInHz(1000); // steps/sec
-    stepper2 -> setAcceleration(1000); // steps/sec^2
-  }
-
-  stepper3 = engine.stepperConnectToPin(STEPPER3_STEP_PIN);
-  if (stepper3) {
-    stepper3 -> setDirectionPin(STEPPER3_DIR_PIN);
-    stepper3 -> setSpeedInHz(1000); // steps/sec
-    stepper3 -> setAcceleration(1000); // steps/sec^2
-  }
-
-  // Move motors to the absolute 0 position
-  stepper1 -> moveTo(0, true);
-  stepper2 -> moveTo(0, true);
-  stepper3 -> moveTo(0, true);
-  stepper1 -> setCurrentPosition(0);
-  stepper2 -> setCurrentPosition(0);
-  stepper3 -> setCurrentPosition(0);
-  
-  // Begin the program
-  Serial.println("Welcome to our motion simulation chair!");
-  Serial.println();
-}
-
-/**
- * Function to continuously loop through the enumeration states
-*/
-void loop() {
-  switch (currentState) {
-    case WAIT_FOR_INPUT:
-      getExperience();
-      break;
-    case WAIT_FOR_AXIS_CHOICE:
-      getAxis();
-      break;
-    case WAIT_FOR_SPEED_AND_ACCELERATION:
-      getSpeedAndAcceleration();
-      break;
-    case WAIT_FOR_POSITION:
-      getPosition();
-      break;
-    case PROCESSING:
-      if (choice == "1") {
-        moveMotor(positionInSteps);
-
-      } else if (choice == "2") {
-        performFullExperienceMotion();
-      
-      } else if (choice == "3") {
-        performRollerCoasterSimulation();
-      }
-      break;
-  }
-}
-
-/**
- * Function to obtain the kind of experience that the user would like
-*/
-void getExperience() {
-  Serial.println("What kind of user experience would you like?");
-  Serial.println("1: Move in one direction");
-  Serial.println("2: Full experience of motion");
-  Serial.println("3: Roller coaster simulation");
-  Serial.println();
-
-  // Get the desired movement
-  while (!Serial.available()) {
-  }
-  choice = Serial.readStringUntil('\n');
-  choice.trim();
-
-  // If the user provided 1, change the state to WAIT_FOR_AXIS_CHOICE
-  // If the user provided 2 or 3, change the state to PROCESSING
-  // If the user didn't provide 1, 2 or 3, do not change the state so that the program can ask the user again 
-  if (choice.equals("1")) {
-    currentState = WAIT_FOR_AXIS_CHOICE;
-
-  } else if (choice.equals("2") || choice.equals("3")) {
-    currentState = PROCESSING;
-
-  } else {
-    Serial.println("Invalid choice. Please enter 1 for single direction or 2 for full experience.");
-    Serial.println();
-  }
-}
-
-/**
- * Function to get the axis that user would like to move in
- */
-void getAxis() { 
-  Serial.println("Enter axis (Pitch/Roll/Yaw):");
-  Serial.println();
-
-  // Get the desired axis of movement
-  while (!Serial.available()) {
-  }
-  String axisChoice = Serial.readStringUntil('\n');
-  axisChoice.trim();
-
-  // If the user provided a valid axis (pitch, roll, or yaw), set the desired axis
-  if (axisChoice.equalsIgnoreCase("Pitch") || axisChoice.equalsIgnoreCase("Roll") || axisChoice.equalsIgnoreCase("Yaw")) {
-    currentAxis = axisChoice;
-
-  // Otherwise the axis is invalid and the user is asked again
-  } else {
-    Serial.println("Invalid axis. Please enter Pitch, Roll, or Yaw.");
-    Serial.println();
-    return;
-  }
-
-  // Move to getting the speed and acceleration
-  currentAxis = axisChoice;
-  currentState = WAIT_FOR_SPEED_AND_ACCELERATION;
-}
-
-/**
- * Function to get the speed and acceleration that the user would like to move at
- */
-void getSpeedAndAcceleration() {
-  Serial.println("Enter the speed you want to move at (steps/second):");
-  Serial.println();
-
-  // Get the desired speed
-  while (!Serial.available()) {
-  }
-  String speedInput = Serial.readStringUntil('\n');
-  float speed = speedInput.toFloat();
-
-  Serial.println("Enter the acceleration you want to move at (steps/second^2):");
-  Serial.println();
-
-  // Get the desired accleration
-  while (!Serial.available()) {
-  }
-  String accelerationInput = Serial.readStringUntil('\n');
-  float acceleration = accelerationInput.toFloat();
-
-  // If the provided speed and acceleration are within the parameters, set the motors speed and acceleration
-  if (speed > 0 && speed <= MAX_SPEED && acceleration > 0 && acceleration <= MAX_ACCELERATION) {
-    if (currentAxis.equalsIgnoreCase("Pitch") || currentAxis.equalsIgnoreCase("Roll")) {
-      setMotorSpeedAndAcceleration(stepper1, speed, acceleration);
-      setMotorSpeedAndAcceleration(stepper2, speed, acceleration);
-
-    } else if (currentAxis.equalsIgnoreCase("Yaw")) {
-      setMotorSpeedAndAcceleration(stepper3, speed, acceleration);
-    }
-
-  // Otherwise, there is or are values that are not within the parameters
-  } else {
-    if (speed <= 0 && acceleration <= 0) {
-      Serial.println("Speed and acceleration values are 0 or below. Setting to " + String(MIN_SPEED) + " steps/s and " + String(MIN_ACCELERATION) + " steps/s^2.");
-      Serial.println();
-
-      speed = MIN_SPEED;
-      acceleration = MIN_ACCELERATION;
-
-    } else if (speed > MAX_SPEED && acceleration > MAX_ACCELERATION) {
-      Serial.println("Speed and acceleration values are above the specified limit. Setting to " + String(MAX_SPEED) + " steps/s and " + String(MAX_ACCELERATION) + " steps/s^2.");
-      Serial.println();
-
-      speed = MAX_SPEED;
-      acceleration = MAX_ACCELERATION;
-
-    } else if (speed <= 0 && acceleration > 0 && acceleration <= MAX_ACCELERATION) {
-      Serial.println("Speed value is 0 or below. Setting to " + String(MIN_SPEED) + " steps/s.");
-      Serial.println();
-
-      speed = MIN_SPEED;
-    
-    } else if (speed > MAX_SPEED && acceleration > 0 && acceleration <= MAX_ACCELERATION) {
-      Serial.println("Speed value is above the specified limit. Setting to " + String(MAX_SPEED) + " steps/s.");
-      Serial.println();
-
-      speed = MAX_SPEED;
-
-    } else if (speed > 0 && speed <= MAX_SPEED && acceleration <= 0) {
-      Serial.println("Acceleration value is 0 or below. Setting to " + String(MIN_ACCELERATION) + " steps/s^2.");
-      Serial.println();
-
-      acceleration = MIN_ACCELERATION;
-    
-    } else if (speed > 0 && speed <= MAX_SPEED && acceleration > MAX_ACCELERATION) {
-      Serial.println("Acceleration value is above the specified limit. Setting to " + String(MAX_ACCELERATION) + " steps/s^2.");
-      Serial.println();
-
-      acceleration = MAX_ACCELERATION;
-    }
-
-    // With the fixed speeds and accelerations, we can set the speed and acceleration of the motor(s)
-    if (currentAxis.equalsIgnoreCase("Pitch") || currentAxis.equalsIgnoreCase("Roll")) {
-      setMotorSpeedAndAcceleration(stepper1, speed, acceleration);
-      setMotorSpeedAndAcceleration(stepper2, speed, acceleration);
-
-    } else if (currentAxis.equalsIgnoreCase("Yaw")) {
-      setMotorSpeedAndAcceleration(stepper3, speed, acceleration);
-    }
-  }
-
-  // Move to getting the desired position
-  currentState = WAIT_FOR_POSITION;
-}
-
-/**
- * Function called to set the speed and acceleration for a specified stepper
- * @param stepper the stepper to set the speed and acceleration for
- * @param speed the speed to set the passed in stepper to
- * @param acceleration the acceleration to set the passed in stepper to
- */
-void setMotorSpeedAndAcceleration(FastAccelStepper* stepper, float speed, float acceleration) {
-  stepper->setSpeedInHz(speed); // steps/sec
-  stepper->setAcceleration(acceleration); // steps/sec^2
-}
-
-/**
- * Function to get the position the user would like to move to
- */
-void getPosition() {
-  String positionInput; // Variable to take in the angle input from user
-  float positionInDegrees; // Variable to hold the positionInput to float conversion
-
-  // Get wanted position in degrees if axis is pitch
-  if (currentAxis.equalsIgnoreCase("Pitch")) {
-    Serial.println("Enter a position in degrees (-30 to 30): ");
-    Serial.println();
-    while (!Serial.available()) {
-    }
-
-    positionInput = Serial.readStringUntil('\n');
-    positionInDegrees = positionInput.toFloat();
-
-    if (positionInDegrees < -30) {
-      positionInDegrees = -30;
-    
-    } else if (positionInDegrees > 30) {
-      positionInDegrees = 30;
-    }
-  } 
-
-  // Get wanted position in degrees if axis is roll
-  else if (currentAxis.equalsIgnoreCase("Roll")) {
-    Serial.println("Enter a position in degrees (-30 to 30): ");
-    Serial.println();
-    while (!Serial.available()) {
-    }    
-
-    positionInput = Serial.readStringUntil('\n');
-    positionInDegrees = positionInput.toFloat();
-
-    if (positionInDegrees < -30) {
-      positionInDegrees = -30;
-    
-    } else if (positionInDegrees > 30) {
-      positionInDegrees = 30;
-    }
-  }
-
-  // Get wanted position in degrees if axis is yaw
-  else if (currentAxis.equalsIgnoreCase("Yaw")) {
-    Serial.println("Enter a position in degrees (-20 to 20): ");
-    Serial.println();
-    while (!Serial.available()) {
-    }    
-
-    positionInput = Serial.readStringUntil('\n');
-    positionInDegrees = positionInput.toFloat();
-
-    if (positionInDegrees < -20) {
-      positionInDegrees = -20;
-
-    } else if (positionInDegrees > 20) {
-      positionInDegrees = 20;
-    }
-  }
-
-  // Utilize the calculatePosition function to convert the degrees to # of steps
-  positionInSteps = calculatePosition(positionInDegrees);
-
-  // Move to executing move of motor(s)
-  currentState = PROCESSING;
-}
-
-/**
- * Function to calculate the number of steps needed to move to a certain number of degrees
- * 360.0 is the degrees per revolution
- * 5 is for the 1:5 ratio due to the gearbox
- * 200 is the numbers of steps in a full rotation due to normal stepping
- * @param positionInDegrees degrees to be converted into steps 
-*/
-int32_t calculatePosition(float positionInDegrees) {
-  return floor((positionInDegrees/(360.0/(5 * 200))));
-}
-
-/**
- * Function to actually move the specified motor(s) to a specified position
- * @param position the number of steps to move to get to a certain position 
-*/
-void moveMotor(int32_t position) {
-  // If the desired movement is pitch, move stepper1 and stepper2 in the same direction
-  if (currentAxis.equalsIgnoreCase("Pitch")) {
-    stepper1 -> moveTo(position, false);
-    stepper2 -> moveTo(position, true);
-
-    stepper1 -> moveTo(position * -1, false);
-    stepper2 -> moveTo(position * -1, true);
-
-    stepper1 -> moveTo(0, false);
-    stepper2 -> moveTo(0, true);
-
-  // If the desired movement is roll, move stepper1 and stepper2 in opposite directions
-  } else if (currentAxis.equalsIgnoreCase("Roll")) {
-    stepper1 -> moveTo(position, false);
-    stepper2 -> moveTo(position * -1, true);
-
-    stepper1 -> moveTo(position * -1, false);
-    stepper2 -> moveTo(position, true);
-
-    stepper1 -> moveTo(0, false);
-    stepper2 -> moveTo(0, true);
-
-  // If the desired movement is yaw, move stepper3
-  } else if (currentAxis.equalsIgnoreCase("Yaw")) {
-    stepper3 -> moveTo(position, true);
-
-    stepper3 -> moveTo(position * -1, true);
-
-    stepper3 -> moveTo(0, true);
-  }
-  // Go back to getting a new user desired movement
-  currentState = WAIT_FOR_INPUT;
-}
-
-/**
- * Function that moves the chair in a multi-axial experience 
-*/
-void performFullExperienceMotion() {
-  Serial.println("Moving all three motors!");
-  Serial.println();
-  
-  // 30 degress up with two motors
-  // Then -60 degrees down with two motors
-  // Then 30 degrees up with two motors to go back to original location
-  currentAxis = "pitch";
-  moveMotor(MAX_POS_PITCH_POSITION);
-
-  // 30 degrees up with one motor and -30 degrees down with the other
-  // Then 60 degrees up with one motor and -60 degrees down with the other
-  // Then 30 degrees up with one motor and -30 degrees down with the other to go back to original location.
-  currentAxis = "roll";
-  moveMotor(MAX_POS_ROLL_POSITION); 
-
-  // 20 degrees yawing to the right
-  // Then -40 degrees yawing to the left
-  // Then 20 degrees yawing back to the original position
-  currentAxis = "yaw";
-  moveMotor(MAX_POS_YAW_POSITION);
-
-  // Go back to getting a new user desired movement
-  currentState = WAIT_FOR_INPUT;
-}
-
-
-/**
- * Function that mimics what it would be like to be on a roller coaster 
-*/
-void performRollerCoasterSimulation() {
-  Serial.println("Starting Roller Coaster Simulation...");
-
-  // Begin with a slow climb to the first peak
-  Serial.println("Climbing to the first peak...");
-  slowClimb();
-
-  // Level out at the first peak
-  Serial.println("Leveling out at the peak...");
-  levelOut();
-
-  // The first major drop
-  Serial.println("Descending the first major drop...");
-  fastFall();
-
-  // Level out at the bottom
-  Serial.println("Leveling out after the drop...");
-  levelOut();
-
-  // A series of smaller hills and dips
-  Serial.println("Navigating smaller hills...");
-  for (int i = 0; i < 4; i++) {
-    smallHill();
-    gentleDip();
-  }
-
-  // Level out after last dip
-  Serial.println("Leveling out after hills and dips...");
-  levelOut();
-
-  // Introduce a sharp turn
-  Serial.println("Executing a sharp turn...");
-  sharpRightTurn();
-  sharpLeftTurn();
-  stepper3 -> moveTo(0, true);
-
-  // Simulate a fast climb to another peak
-  Serial.println("Fast climbing to another peak...");
-  fastClimb();
-
-  // Level out at the second peak
-  Serial.println("Leveling out at the second peak...");
-  levelOut();
-
-  // Final major fall
-  Serial.println("Descending the final major fall...");
-  fastFall();
-
-  // Level out at the bottom to end the ride
-  Serial.println("Leveling out to end the ride...");
-  levelOut();
-
-  // End of the simulation
-  Serial.println("Roller Coaster Ride Complete!");
-
-  // Go back to getting a new user desired movement
-  currentState = WAIT_FOR_INPUT;
-}
-
-/**
- * Function to perform a slow climb up a hill
-*/
-void slowClimb() {
-  setMotorSpeedAndAcceleration(stepper1, 600, 300);
-  setMotorSpeedAndAcceleration(stepper2, 600, 300);
-  int climbingHeight;
-
-  // Inch up in 10 increments to simulate a climb
-  for (int i = 1; i <= 10; i++) {
-    climbingHeight = MAX_NEG_PITCH_POSITION * (0.1 * i);
-    stepper1 -> moveTo(climbingHeight, false);
-    stepper2 -> moveTo(climbingHeight, true);
-    delay(100);
-  }
-  // Stay at the max climb angle for 1 second
-  delay(1000);
-}
-
-/**
- * Function to perform a fast climb
-*/
-void fastClimb() {
-  setMotorSpeedAndAcceleration(stepper1, 2000, 1000); 
-  setMotorSpeedAndAcceleration(stepper2, 2000, 1000);
-
-  int climbingHeight = MAX_NEG_PITCH_POSITION;
-
-  stepper1 -> moveTo(climbingHeight, false);
-  stepper2 -> moveTo(climbingHeight, true);
-
-  // Stay at max climb angle for 2 seconds
-  delay(2000);
-}
-
-/**
- * Function to level out
-*/
-void levelOut() {
-  int currentHeight = stepper1->getCurrentPosition();
-  int levelingHeight;
-
-  // Get the average speed to have a dynamic level out
-  uint32_t speed1 = stepper1 -> getSpeedInMilliHz() * 1000;
-  uint32_t speed2 = stepper2 -> getSpeedInMilliHz() * 1000;
-  uint32_t averageSpeed = (speed1 + speed2) / 2;
-
-  // The faster the speed, the smaller the leveling factor
-  float levelingFactor = max(0.01, 1.0 - (averageSpeed / 1000.0));
-
-  // The faster the speed, the longer the delay between each level out
-  int dynamicDelay = min(500, max(100, int(averageSpeed / 10))); 
-
-  // Level out in 10 increments based on the levelingFactor and the dynamicDelay
-  for (int i = 9; i >= 0; i--) {
-    levelingHeight = int(currentHeight * levelingFactor * i / 9);
-    stepper1->moveTo(levelingHeight, false);
-    stepper2->moveTo(levelingHeight, true);
-    delay(dynamicDelay);
-  }
-}
-
-/**
- * Function to perform a fast fall
-*/
-void fastFall() {
-  setMotorSpeedAndAcceleration(stepper1, 3000, 1500);
-  setMotorSpeedAndAcceleration(stepper2, 3000, 1500);
-
-  int fallingHeight = MAX_POS_PITCH_POSITION;
-
-  stepper1 -> moveTo(fallingHeight, false);
-  stepper2 -> moveTo(fallingHeight, true);
-
-  // Stay at the max fall angle for 2 seconds
-  delay(2000);
-}
-
-/**
- * Function to perform a gentle dip
-*/
-void gentleDip() {
-  // Dip is half the max angle possible
-  int midHeight = MAX_POS_PITCH_POSITION / 2;
-
-  stepper1 -> moveTo(midHeight, false);
-  stepper2 -> moveTo(midHeight, true);
-
-  // Stay on the dip for only half a second
-  delay(500);
-}
-
-/**
- * Function to perform a small hill
-*/
-void smallHill() {
-  // Hill is half the max angle possible
-  int hillHeight = MAX_NEG_PITCH_POSITION / 2;
-
-  stepper1 -> moveTo(hillHeight, false);
-  stepper2 -> moveTo(hillHeight, true);
-
-  // Stay on the hill for only half a second
-  delay(500);
-}
-
-void sharpRightTurn() {
-  setMotorSpeedAndAcceleration(stepper3, 2000, 1000);
-
-  stepper3 -> moveTo(MAX_POS_YAW_POSITION, true);
-
-  // Let the sharp turn last 300ms
-  delay(300);
-}
-
-void sharpLeftTurn() {
-  setMotorSpeedAndAcceleration(stepper3, 2000, 1000);
-
-  stepper3 -> moveTo(MAX_NEG_YAW_POSITION, true);
-  
-  // Let the sharp turn last 300ms
-  delay(300);
-}
-
-/**
- * Function to perform a twist
-*/
-void suddenTwist() {
-  stepper1 -> setSpeedInHz(2000);
-
-  // Roll in one direction and stay there for 200ms
-  stepper1 -> moveTo(MAX_POS_ROLL_POSITION, false);
-  stepper2 -> moveTo(MAX_NEG_ROLL_POSITION, true);
-  delay(200);
-
-  // Roll in the other direction and stay there for 200ms
-  stepper1 -> moveTo(-MAX_POS_ROLL_POSITION, false);
-  stepper2 -> moveTo(-MAX_NEG_ROLL_POSITION, true);
-  delay(200);
-}
-
-/**
- * Function to perform a rumble of the chair
- * This function seems to be rather finicky when implemented with the other movement functions
- * @param numberOfRumbles how many rumbles should be performed (Ex: 40 rumbles is equal to 2 seconds of rumbles (50ms * 40))
-*/
-void rumble(int numberOfRumbles) {
-  int pitchIntensity = 20;
-  int rollIntensity = 30;
-  int yawIntensity = 30; 
-  
-  int32_t pitchCurrentPosition = stepper1 -> getCurrentPosition();
-  int32_t rollCurrentPosition = stepper2 -> getCurrentPosition();
-  int32_t yawCurrentPosition = stepper3 -> getCurrentPosition();
-
-  stepper1 -> setSpeedInHz(1000);
-  stepper2 -> setSpeedInHz(1000);
-  stepper3 -> setSpeedInHz(1000);
-
-  stepper1 -> setAcceleration(1000);
-  stepper2 -> setAcceleration(1000);
-  stepper3 -> setAcceleration(1000);
-
-  // Randomly vary the intensity and direction of the steps
-  for (int i = 0; i < numberOfRumbles; i++) {
-    stepper1 -> move(random(-pitchIntensity, pitchIntensity), false);
-    stepper2 -> move(random(-rollIntensity, rollIntensity), false);
-    stepper3 -> move(random(-yawIntensity, yawIntensity), true);
-    delay(50); // Short delay between the shakes
-  }
-
-  // Make sure the motors are done moving before continuing
-  while (stepper1 -> isRunning() || stepper2 -> isRunning() || stepper3 -> isRunning()) {
-    delay(10);
-  }
-
-  // Move the steppers back to their original position before the rumble happened
-  stepper1 -> moveTo(pitchCurrentPosition, true);
-  stepper2 -> moveTo(rollCurrentPosition, true);
-  stepper3 -> moveTo(yawCurrentPosition, true);
-}
+#include "FastAccelStepper.h"
+#include "MotionScheduler.h"
+#include "SerialProtocol.h"
+#include "PoseStream.h"
+#include "PosePredictor.h"
+#include "MotionCueing.h"
+#include "AxisConfig.h"
+#include "Kinematics.h"
+#include "RideLibrary.h"
+#include "Trace.h"
+#include "Telemetry.h"
+#include "Effects.h"
+#include "SafetyEnvelope.h"
+#include "PositionStore.h"
+#include "Homing.h"
+#include "Backlash.h"
+#include "CommandShell.h"
+#include "ClockSync.h"
+
+// Define pins for the motors
+#define STEPPER1_STEP_PIN 6
+#define STEPPER1_DIR_PIN 3
+
+#define STEPPER2_STEP_PIN 7
+#define STEPPER2_DIR_PIN 4
+
+#define STEPPER3_STEP_PIN 8
+#define STEPPER3_DIR_PIN 5
+
+// These values can be tuned
+// The largest speeds, accelerations and angles of each axis are set in AxisConfig.h
+#define MIN_SPEED (100 * MICROSTEPS)
+#define MIN_ACCELERATION (100 * MICROSTEPS)
+
+// Speed and acceleration of MOVE when they are not given
+#define DEFAULT_MOVE_SPEED PitchAxis::fromFullSteps(1000)
+#define DEFAULT_MOVE_ACCELERATION PitchAxis::fromFullSteps(1000)
+
+// Limits in steps, worked out from the axis descriptions at compile time
+#define MAX_POS_PITCH_POSITION PitchAxis::MAX_POSITION // 30 degrees
+#define MAX_NEG_PITCH_POSITION PitchAxis::MIN_POSITION
+
+#define MAX_POS_ROLL_POSITION RollAxis::MAX_POSITION // 30 degrees
+#define MAX_NEG_ROLL_POSITION RollAxis::MIN_POSITION
+
+#define MAX_POS_YAW_POSITION YawAxis::MAX_POSITION // 20 degrees
+#define MAX_NEG_YAW_POSITION YawAxis::MIN_POSITION
+
+// Speed and acceleration used while tracking streamed poses
+// Whatever comes after the stream takes over motors moving this fast, the safety envelope makes sure they still
+// stop inside their limits
+#define STREAM_SPEED PitchAxis::fromFullSteps(8000)
+#define STREAM_ACCELERATION PitchAxis::fromFullSteps(10000)
+
+// Most tasks each command has in the motion queue at one time, its release included, measured with chair_sim
+// The roller coaster peaks while the first climb is expanded in front of the 23 segments still waiting
+#define COASTER_TASKS 35
+#define FULL_TASKS 8
+#define MOVE_TASKS 5
+#define RIDE_TASKS 5
+#define STREAM_TASKS 2
+#define RESTORE_TASKS 2
+
+// Time between two updates of the washout
+#define CUEING_TICK_MICROS (1000000UL / CUEING_RATE_HZ)
+
+// How many cueing updates are timed for MSG_CUEING_BENCHMARK
+#define CUEING_BENCHMARK_UPDATES 200
+
+// The line commands and the binary frames share this rate
+#define SERIAL_BAUD_RATE 115200
+
+// Create the engine and the steppers
+FastAccelStepperEngine engine = FastAccelStepperEngine();
+FastAccelStepper *stepper1 = nullptr;
+FastAccelStepper *stepper2 = nullptr;
+FastAccelStepper *stepper3 = nullptr;
+
+// Enumeration of states to structure the simulation process
+enum State {
+  WAIT_FOR_COMMAND,
+  STREAMING
+};
+
+// Function prototypes
+void setState(State newState);
+void readSerialInput();
+void handleControlByte(uint8_t control);
+void handleFrame();
+void sendFrame(uint8_t type, const uint8_t *payload, uint8_t length);
+void sendTraceFrames();
+void sendTelemetryFrames();
+void handleInputLine();
+void handleCommand(const Command &command);
+void moveCommand(const Command &command);
+uint32_t limitSetting(int32_t value, uint32_t low, uint32_t high, const __FlashStringHelper *name, const __FlashStringHelper *unit);
+void rideCommand(int32_t number);
+void rideAtCommand(uint8_t number, uint32_t startsAt);
+bool queueRide(int32_t number, uint32_t receivedAt, bool synced, uint32_t startsAt);
+void listRides();
+void stopCommand();
+void statsCommand();
+void backlashCommand(const Command &command);
+bool checkHomed();
+bool reserveQueue(uint8_t tasks);
+int getFreeMemory();
+void updateStreaming();
+void retargetToPose(const Pose &pose);
+void updateCueing();
+void tunePredictor();
+void sendCueingBenchmark();
+void moveMotor(AxisId axis, int16_t position, uint32_t speed, uint32_t acceleration);
+void performFullExperienceMotion();
+void performRollerCoasterSimulation();
+void beginRide();
+void waitForRideStart();
+void playRideKeyframe();
+void endRide();
+void reportCommandLatency();
+void slowClimb();
+void fastClimb();
+void levelOut();
+void fastFall();
+void gentleDip();
+void smallHill();
+void sharpRightTurn();
+void sharpLeftTurn();
+void centerYaw();
+void suddenTwist();
+void rumble(int numberOfRumbles);
+
+// Global variables //
+
+// Start at the first state
+State currentState = WAIT_FOR_COMMAND;
+
+// Whether the positions of the motors are known, restored from the EEPROM or found by homing
+// Until they are, the limits would be checked against positions that are made up, so nothing moves the chair
+bool homed = false;
+
+// Whether the message of the current state has been printed yet
+bool promptShown = false;
+
+// Serial input is collected here one character at a time so loop() never waits for it
+// The command shell parses the line where it lies, see CommandShell.h
+char inputLine[COMMAND_LINE_LENGTH];
+uint8_t inputLength = 0;
+bool inputReady = false;
+uint32_t inputReceivedAt = 0;
+
+// How long the last command and the slowest one took to parse, for STATS
+uint32_t lastParseMicros = 0;
+uint32_t maxParseMicros = 0;
+
+// Binary frames are parsed from the same serial input without allocating anything
+FrameParser frameParser;
+uint8_t frameSequence = 0;
+
+// The last pose received in a MSG_POSE frame and when it arrived
+Pose latestPose = { 0, 0, 0 };
+uint32_t latestPoseReceivedAt = 0;
+
+// Jitter buffer depth used the next time streaming starts
+uint8_t jitterDepth = DEFAULT_JITTER_DEPTH;
+
+// Streamed poses are predicted ahead when the host asks for it, by a lead tuned from the link latency it measured
+PosePredictor predictor;
+bool predicting = false;
+uint32_t linkLatency = 0;
+
+// Ride scripts are played one keyframe at a time straight out of flash
+RideDecoder rideDecoder;
+uint8_t selectedRide = 0;
+bool rideQueued = false;
+uint32_t rideStartedAt = 0;
+
+// A ride started by MSG_RIDE_AT is timed on the timeline of the host instead, from rideStartsAt in microseconds
+bool rideSynced = false;
+uint32_t rideStartsAt = 0;
+
+// When CONTROL_PAUSE arrived, the ride clock is moved on by the time paused
+// A synced ride keeps to the timeline it shares with the other chairs instead and skips the keyframes it missed
+uint32_t pausedAt = 0;
+bool rideRejoining = false;
+
+// The clock of the chair against the timeline of a host playing rides on several chairs at once
+ClockSync clockSync;
+
+// Vehicle states streamed in MSG_VEHICLE_STATE frames are turned into poses by the washout at a fixed rate
+MotionCueing cueing;
+VehicleState latestVehicle = { 0, 0, 0, 0, 0 };
+uint32_t latestVehicleReceivedAt = 0;
+bool cueingActive = false;
+uint32_t nextCueingAt = 0;
+
+/**
+ * Function to setup the Serial, steppers, and move the motors to the zero position if they are not already there
+*/
+void setup() {
+  Serial.begin(SERIAL_BAUD_RATE);
+  while (!Serial); // Wait for the Serial to start
+  engine.init(); // Start the engine
+
+  // Initialize steppers (stepper1 and stepper2 are used for pitch and roll and stepper3 is used for yaw)
+  stepper1 = engine.stepperConnectToPin(STEPPER1_STEP_PIN);
+  if (stepper1) {
+    stepper1 -> setDirectionPin(STEPPER1_DIR_PIN, Stepper1Axis::DIRECTION > 0);
+    stepper1 -> setSpeedInHz(Stepper1Axis::fromFullSteps(1000)); // steps/sec
+    stepper1 -> setAcceleration(Stepper1Axis::fromFullSteps(1000)); // steps/sec^2
+  }
+
+  stepper2 = engine.stepperConnectToPin(STEPPER2_STEP_PIN);
+  if (stepper2) {
+    stepper2 -> setDirectionPin(STEPPER2_DIR_PIN, Stepper2Axis::DIRECTION > 0);
+    stepper2 -> setSpeedInHz(Stepper2Axis::fromFullSteps(1000)); // steps/sec
+    stepper2 -> setAcceleration(Stepper2Axis::fromFullSteps(1000)); // steps/sec^2
+  }
+
+  stepper3 = engine.stepperConnectToPin(STEPPER3_STEP_PIN);
+  if (stepper3) {
+    stepper3 -> setDirectionPin(STEPPER3_DIR_PIN, Stepper3Axis::DIRECTION > 0);
+    stepper3 -> setSpeedInHz(Stepper3Axis::fromFullSteps(1000)); // steps/sec
+    stepper3 -> setAcceleration(Stepper3Axis::fromFullSteps(1000)); // steps/sec^2
+  }
+
+  // Carry on from where the motors were at the last shutdown if the chair was at rest, otherwise find them
+  // Homing measures the backlash again, a motor it can't measure keeps what was measured the last time
+  int32_t savedPositions[3];
+  uint8_t backlash[3];
+  bool restored = loadPositions(savedPositions);
+  homed = restored;
+  loadBacklash(backlash);
+  if (restored) {
+    stepper1 -> setCurrentPosition(savedPositions[0]);
+    stepper2 -> setCurrentPosition(savedPositions[1]);
+    stepper3 -> setCurrentPosition(savedPositions[2]);
+    Serial.println(F("Positions restored from the last shutdown"));
+  } else {
+    Serial.println(F("The chair was not shut down at rest, homing..."));
+    uint8_t found = homeSteppers(stepper1, stepper2, stepper3, backlash);
+    homed = found == ALL_STEPPERS_MASK;
+    if (found) {
+      saveBacklash(backlash);
+    }
+    if (!homed) {
+      Serial.println(F("Homing failed, a home switch was not found. Check the switches and restart the chair"));
+    }
+  }
+
+  initFrameParser(frameParser);
+  initClockSync(clockSync);
+  initPosePredictor(predictor, PitchAxis::LIMIT_CENTIDEGREES, RollAxis::LIMIT_CENTIDEGREES, YawAxis::LIMIT_CENTIDEGREES);
+
+  // Everything after this point is run by the non-blocking scheduler
+  initScheduler(stepper1, stepper2, stepper3);
+  initBacklash(backlash, restored ? 0 : 1);
+  initTelemetry(stepper1, stepper2, stepper3);
+  initSafetyEnvelope(stepper1, stepper2, stepper3);
+  if (homed) {
+    initPositionStore(stepper1, stepper2, stepper3);
+  }
+
+  // Homing ends at 0, restored motors go there while the menu is already up
+  if (restored) {
+    reserveTasks(RESTORE_TASKS);
+    scheduleMoveTo(ALL_STEPPERS_MASK, 0, 0, 0, ALL_STEPPERS_MASK, 0);
+    scheduleRelease(RESTORE_TASKS);
+  }
+
+  // Begin the program
+  Serial.println(F("Welcome to our motion simulation chair!"));
+  Serial.println();
+  printCommandHelp();
+}
+
+/**
+ * Function to continuously loop through the enumeration states
+ * Nothing in here blocks: the scheduler advances the queued motion and serial input is read as it arrives,
+ * so a new command can be entered while a ride is still running
+*/
+void loop() {
+  updateScheduler();
+  updateSafetyEnvelope();
+  updatePositionStore(isSchedulerIdle());
+  readSerialInput();
+  updateTelemetry();
+  sendTelemetryFrames();
+  sendTraceFrames();
+
+  switch (currentState) {
+    case WAIT_FOR_COMMAND:
+      if (inputReady) {
+        handleInputLine();
+      }
+      break;
+    case STREAMING:
+      updateStreaming();
+      break;
+  }
+}
+
+/**
+ * Function to move to a new state, making sure its message gets printed
+ * @param newState the state to move to
+ */
+void setState(State newState) {
+  currentState = newState;
+  promptShown = false;
+  traceEvent(TRACE_STATE_CHANGED, newState);
+}
+
+/**
+ * Function to read whatever serial input has arrived without waiting for more
+ * Control bytes are acted on as soon as they are read, also in the middle of a line or a frame. Bytes that start or
+ * continue a binary frame go to the frame parser, everything else is collected into inputLine.
+ * Text stops being read while a complete line is waiting to be picked up, every state picks it up on the same pass
+ */
+void readSerialInput() {
+  while (Serial.available()) {
+    uint8_t next = Serial.peek();
+
+    if (isControlByte(next)) {
+      handleControlByte(Serial.read());
+      continue;
+    }
+
+    // Parse a run of frame bytes, timing it for the parse cost counter
+    if (isParsingFrame(frameParser) || next == FRAME_SYNC) {
+      uint32_t parseStartedAt = micros();
+      while (Serial.available() && (isParsingFrame(frameParser) || Serial.peek() == FRAME_SYNC) && !isControlByte(Serial.peek())) {
+        if (parseFrameByte(frameParser, Serial.read())) {
+          handleFrame();
+        }
+      }
+      frameParser.stats.parseMicros += micros() - parseStartedAt;
+      continue;
+    }
+
+    if (inputReady) {
+      return;
+    }
+
+    char c = Serial.read();
+    if (c == '\n') {
+      inputLine[inputLength] = '\0';
+      inputReady = true;
+      inputReceivedAt = micros();
+      traceEvent(TRACE_COMMAND_RECEIVED, inputLine[0]);
+
+    } else if (c != '\r' && inputLength < COMMAND_LINE_LENGTH - 1) {
+      inputLine[inputLength++] = c;
+    }
+  }
+}
+
+/**
+ * Function to act on a control byte, ahead of the text and frames before it
+ * The motors are sent braking first, the messages come after
+ * @param control CONTROL_STOP, CONTROL_PAUSE or CONTROL_RESUME
+ */
+void handleControlByte(uint8_t control) {
+  traceEvent(TRACE_COMMAND_RECEIVED, control);
+
+  switch (control) {
+    case CONTROL_STOP:
+      // Everything that would move the chair again is dropped as well: the stream, the effects and the ride
+      haltScheduler(HALT_STOP);
+      stopEffects(EFFECT_ALL_SLOTS);
+      rideQueued = false;
+      if (currentState == STREAMING) {
+        stopPoseStream();
+        cueingActive = false;
+        setState(WAIT_FOR_COMMAND);
+      }
+      Serial.println(F("Emergency stop, everything queued has been dropped."));
+      Serial.println();
+      break;
+
+    case CONTROL_PAUSE:
+      if (getSchedulerHalt() == HALT_NONE) {
+        haltScheduler(HALT_PAUSE);
+        pausedAt = millis();
+        Serial.println(F("Paused, Ctrl-] carries on."));
+        Serial.println();
+      }
+      break;
+
+    case CONTROL_RESUME:
+      if (resumeScheduler(rideQueued && rideSynced)) {
+        rideStartedAt += millis() - pausedAt;
+        rideRejoining = rideQueued && rideSynced;
+        Serial.println(F("Resuming."));
+        Serial.println();
+      }
+      break;
+  }
+}
+
+/**
+ * Function to act on a binary frame that has just been received
+ */
+void handleFrame() {
+  traceEvent(TRACE_COMMAND_RECEIVED, frameParser.type);
+
+  switch (frameParser.type) {
+    case MSG_POSE:
+      if (frameParser.length == POSE_PAYLOAD_SIZE) {
+        latestPose = decodePose(frameParser.payload);
+        latestPoseReceivedAt = micros();
+        pushStreamPose(latestPose, latestPoseReceivedAt);
+      }
+      break;
+
+    case MSG_STREAM_CONFIG:
+      if (frameParser.length == STREAM_CONFIG_PAYLOAD_SIZE) {
+        jitterDepth = frameParser.payload[0];
+      }
+      break;
+
+    case MSG_VEHICLE_STATE:
+      if (frameParser.length == VEHICLE_STATE_PAYLOAD_SIZE && isPoseStreaming()) {
+        latestVehicle = decodeVehicleState(frameParser.payload);
+        latestVehicleReceivedAt = micros();
+
+        // The first vehicle state starts the cueing from a level chair
+        if (!cueingActive) {
+          initMotionCueing(cueing, PitchAxis::LIMIT_CENTIDEGREES, RollAxis::LIMIT_CENTIDEGREES, YawAxis::LIMIT_CENTIDEGREES);
+          cueingActive = true;
+          nextCueingAt = latestVehicleReceivedAt;
+        }
+      }
+      break;
+
+    case MSG_CUEING_BENCHMARK_REQUEST:
+      sendCueingBenchmark();
+      break;
+
+    case MSG_STREAM_STATS_REQUEST: {
+      uint8_t payload[STREAM_STATS_PAYLOAD_SIZE];
+      encodeStreamStats(payload);
+      sendFrame(MSG_STREAM_STATS, payload, STREAM_STATS_PAYLOAD_SIZE);
+      break;
+    }
+
+    case MSG_TELEMETRY_CONFIG:
+      if (frameParser.length == TELEMETRY_CONFIG_PAYLOAD_SIZE) {
+        uint16_t periodMs = readUint16(frameParser.payload);
+        if (periodMs > 0) {
+          startTelemetry(periodMs, frameParser.payload[2]);
+        } else {
+          stopTelemetry();
+        }
+      }
+      break;
+
+    case MSG_TRACE_REQUEST:
+      startTraceDump();
+      break;
+
+    case MSG_EFFECT:
+      // Starts right away, on top of whatever the chair is doing
+      if (frameParser.length == EFFECT_PAYLOAD_SIZE && checkHomed()) {
+        startEffect(decodeEffectSettings(frameParser.payload), micros());
+      }
+      break;
+
+    case MSG_PREDICTOR_CONFIG:
+      if (frameParser.length == PREDICTOR_CONFIG_PAYLOAD_SIZE) {
+        predicting = frameParser.payload[0] != 0;
+        linkLatency = readUint32(frameParser.payload + 1);
+        tunePredictor();
+      }
+      break;
+
+    case MSG_PING:
+      // Answered before anything else, the host times the round trip. The host pings again now and then, so the
+      // lead follows the jitter buffer as well
+      if (frameParser.length == PING_PAYLOAD_SIZE) {
+        uint8_t payload[PONG_PAYLOAD_SIZE];
+        memcpy(payload, frameParser.payload, PING_PAYLOAD_SIZE);
+        writeUint32(payload + PING_PAYLOAD_SIZE, getStreamStats().averageLatency);
+        sendFrame(MSG_PONG, payload, PONG_PAYLOAD_SIZE);
+        tunePredictor();
+      }
+      break;
+
+    case MSG_SYNC:
+      // Once the drift is known the step tracks play at the rate of the timeline
+      if (frameParser.length == SYNC_PAYLOAD_SIZE && takeSync(clockSync, readUint32(frameParser.payload), micros())) {
+        setTrackStretch(isClockSynced(clockSync) ? -clockSync.driftPpb / 1000 : 0);
+      }
+      break;
+
+    case MSG_RIDE_AT:
+      if (frameParser.length == RIDE_AT_PAYLOAD_SIZE) {
+        rideAtCommand(frameParser.payload[0], readUint32(frameParser.payload + 1));
+      }
+      break;
+
+    case MSG_SYNC_STATS_REQUEST: {
+      uint8_t payload[SYNC_STATS_PAYLOAD_SIZE];
+      writeUint16(payload, clockSync.syncs);
+      payload[2] = clockSync.fixes;
+      writeUint32(payload + 3, clockSync.driftPpb);
+      writeUint32(payload + 7, clockSync.lastCorrection);
+      sendFrame(MSG_SYNC_STATS, payload, SYNC_STATS_PAYLOAD_SIZE);
+      break;
+    }
+
+    case MSG_STATS_REQUEST: {
+      uint8_t payload[STATS_PAYLOAD_SIZE];
+      encodeStats(payload, frameParser.stats);
+      sendFrame(MSG_STATS, payload, STATS_PAYLOAD_SIZE);
+      break;
+    }
+  }
+}
+
+/**
+ * Function to send a binary frame to the host
+ * @param type the message type
+ * @param payload the payload bytes
+ * @param length the number of payload bytes
+ */
+void sendFrame(uint8_t type, const uint8_t *payload, uint8_t length) {
+  uint8_t frame[FRAME_MAX_SIZE];
+  uint8_t size = encodeFrame(frame, type, frameSequence++, payload, length);
+  Serial.write(frame, size);
+}
+
+/**
+ * Function to send the trace a frame at a time, only while the frames fit into the serial transmit buffer
+ * so that loop() never waits for the port
+ */
+void sendTraceFrames() {
+  while (isTraceDumping() && Serial.availableForWrite() >= FRAME_MAX_SIZE) {
+    uint8_t payload[FRAME_MAX_PAYLOAD];
+    uint8_t length = nextTraceFrame(payload);
+    sendFrame(MSG_TRACE, payload, length);
+  }
+}
+
+/**
+ * Function to send the telemetry frames that are ready
+ * A frame that doesn't fit into the serial transmit buffer is dropped rather than waited for, its size is only
+ * known once it is encoded because of the escaped bytes
+ */
+void sendTelemetryFrames() {
+  uint8_t type;
+  uint8_t payload[FRAME_MAX_PAYLOAD];
+  uint8_t length;
+
+  while ((length = nextTelemetryFrame(type, payload)) > 0) {
+    uint8_t frame[FRAME_MAX_SIZE];
+    uint8_t size = encodeFrame(frame, type, frameSequence, payload, length);
+    if (Serial.availableForWrite() >= size) {
+      Serial.write(frame, size);
+      frameSequence++;
+    } else {
+      telemetryFrameDropped();
+    }
+  }
+}
+
+/**
+ * Function to parse the line that has been read, carry out its command and start collecting the next line
+ */
+void handleInputLine() {
+  Command command;
+  uint32_t parseStartedAt = micros();
+  ShellError error = parseCommand(inputLine, command);
+  lastParseMicros = micros() - parseStartedAt;
+  if (lastParseMicros > maxParseMicros) {
+    maxParseMicros = lastParseMicros;
+  }
+
+  // The words stay in inputLine until the command has been carried out, nothing is read in the meantime
+  if (error == SHELL_OK) {
+    handleCommand(command);
+  } else {
+    printShellError(error, command);
+  }
+  inputLength = 0;
+  inputReady = false;
+}
+
+/**
+ * Function to carry out a command, the motion it queues runs while the next one is entered
+ * @param command the command from parseCommand()
+ */
+void handleCommand(const Command &command) {
+  switch (command.id) {
+    case COMMAND_NONE:
+      break;
+
+    case COMMAND_HELP:
+      printCommandHelp();
+      break;
+
+    case COMMAND_MOVE:
+      if (checkHomed() && reserveQueue(MOVE_TASKS)) {
+        moveCommand(command);
+        scheduleRelease(MOVE_TASKS);
+      }
+      break;
+
+    case COMMAND_FULL:
+      if (checkHomed() && reserveQueue(FULL_TASKS)) {
+        markCommandReceived(inputReceivedAt);
+        performFullExperienceMotion();
+        scheduleRelease(FULL_TASKS);
+      }
+      break;
+
+    case COMMAND_COASTER:
+      if (checkHomed() && reserveQueue(COASTER_TASKS)) {
+        markCommandReceived(inputReceivedAt);
+        performRollerCoasterSimulation();
+        scheduleRelease(COASTER_TASKS);
+      }
+      break;
+
+    case COMMAND_RIDE:
+      rideCommand(command.number);
+      break;
+
+    case COMMAND_STREAM:
+      // Streaming starts once everything queued before it has finished
+      if (checkHomed() && reserveQueue(STREAM_TASKS)) {
+        markCommandReceived(inputReceivedAt);
+        scheduleSpeedAndAcceleration(ALL_STEPPERS_MASK, STREAM_SPEED, STREAM_ACCELERATION);
+        scheduleRelease(STREAM_TASKS);
+        setState(STREAMING);
+      }
+      break;
+
+    case COMMAND_STOP:
+      stopCommand();
+      break;
+
+    case COMMAND_STATS:
+      statsCommand();
+      break;
+
+    case COMMAND_BACKLASH:
+      backlashCommand(command);
+      break;
+  }
+}
+
+/**
+ * Function to queue the swing of MOVE
+ * The speed and acceleration are checked against the limits of the axis and the angle is clamped by its description
+ * @param command the MOVE command
+ */
+void moveCommand(const Command &command) {
+  bool isYaw = command.axis == AXIS_YAW;
+  uint32_t maxSpeed = isYaw ? YawAxis::MAX_SPEED : PitchAxis::MAX_SPEED;
+  uint32_t maxAcceleration = isYaw ? YawAxis::MAX_ACCELERATION : PitchAxis::MAX_ACCELERATION;
+
+  uint32_t speed = DEFAULT_MOVE_SPEED;
+  if (command.options & OPTION_SPEED) {
+    speed = limitSetting(command.speed, MIN_SPEED, maxSpeed, F("Speed"), F(" steps/s."));
+  }
+  uint32_t acceleration = DEFAULT_MOVE_ACCELERATION;
+  if (command.options & OPTION_ACCELERATION) {
+    acceleration = limitSetting(command.acceleration, MIN_ACCELERATION, maxAcceleration, F("Acceleration"), F(" steps/s^2."));
+  }
+
+  // Clamp the angle to the limits of the axis, the mixing converts it to # of steps
+  int16_t position;
+  if (command.axis == AXIS_YAW) {
+    position = YawAxis::clampCentidegrees(command.centidegrees);
+  } else if (command.axis == AXIS_ROLL) {
+    position = RollAxis::clampCentidegrees(command.centidegrees);
+  } else {
+    position = PitchAxis::clampCentidegrees(command.centidegrees);
+  }
+
+  markCommandReceived(inputReceivedAt);
+  moveMotor(command.axis, position, speed, acceleration);
+  scheduleSegment(reportCommandLatency, nullptr);
+}
+
+/**
+ * Function to keep a speed or acceleration given to MOVE within its limits, telling the user when it is changed
+ * @param value the value that was given
+ * @param low the value used instead of 0 or below
+ * @param high the largest value
+ * @param name what the value is
+ * @param unit its unit
+ * @return the value to use
+ */
+uint32_t limitSetting(int32_t value, uint32_t low, uint32_t high, const __FlashStringHelper *name, const __FlashStringHelper *unit) {
+  uint32_t limited;
+  if (value <= 0) {
+    limited = low;
+    Serial.print(name);
+    Serial.print(F(" value is 0 or below. Setting to "));
+  } else if ((uint32_t)value > high) {
+    limited = high;
+    Serial.print(name);
+    Serial.print(F(" value is above the specified limit. Setting to "));
+  } else {
+    return value;
+  }
+  Serial.print(limited);
+  Serial.println(unit);
+  Serial.println();
+  return limited;
+}
+
+/**
+ * Function to check that the positions of the motors are known before a command moves the chair
+ * @return true if they are, otherwise the command is refused with a message
+ */
+bool checkHomed() {
+  if (!homed) {
+    Serial.println(F("The chair has not homed, so it can't move. Check the home switches and restart the chair."));
+    Serial.println();
+  }
+  return homed;
+}
+
+/**
+ * Function to set aside room in the motion queue for all the tasks of a command before any of them are queued
+ * With the room set aside none of its tasks can be dropped, neither when the command is queued nor when its
+ * segments are expanded later. The command ends with scheduleRelease() to give the room back.
+ * @param tasks the most tasks the command has in the queue at one time
+ * @return true if there is room, otherwise the command is refused with a message
+ */
+bool reserveQueue(uint8_t tasks) {
+  if (!reserveTasks(tasks)) {
+    Serial.println(F("Too much is queued to take this command, enter it again once the chair has got further."));
+    Serial.println();
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Function to queue a ride from the library
+ * @param number the ride counted from 1, 0 to list the rides instead
+ */
+void rideCommand(int32_t number) {
+  if (number == 0) {
+    listRides();
+    return;
+  }
+  queueRide(number, inputReceivedAt, false, 0);
+}
+
+/**
+ * Function to queue a ride that starts at a time on the timeline of the host, like on the chairs next to this one
+ * @param number the ride counted from 1
+ * @param startsAt the start on the timeline in microseconds
+ */
+void rideAtCommand(uint8_t number, uint32_t startsAt) {
+  if (!isClockSynced(clockSync)) {
+    Serial.println(F("The clock is not synced to the host yet, the ride was not started."));
+    Serial.println();
+    return;
+  }
+  queueRide(number, micros(), true, startsAt);
+}
+
+/**
+ * Function to queue a ride once it is checked that it can be played
+ * @param number the ride counted from 1
+ * @param receivedAt micros() when the command arrived, for the command-to-motion latency
+ * @param synced whether the ride is timed on the timeline of the host
+ * @param startsAt the start on the timeline in microseconds, when synced
+ * @return true if the ride was queued
+ */
+bool queueRide(int32_t number, uint32_t receivedAt, bool synced, uint32_t startsAt) {
+  if (!checkHomed()) {
+    return false;
+  }
+  if (number <= 0 || number > getRideCount()) {
+    Serial.println(F("There is no ride with that number, enter RIDE for the list."));
+    Serial.println();
+    return false;
+  }
+
+  // Only one ride can be decoded at a time
+  if (rideQueued) {
+    Serial.println(F("A ride is already running, wait for it to finish."));
+    Serial.println();
+    return false;
+  }
+  if (!reserveQueue(RIDE_TASKS)) {
+    return false;
+  }
+  selectedRide = number - 1;
+  rideSynced = synced;
+  rideStartsAt = startsAt;
+  rideRejoining = false;
+  rideQueued = true;
+  markCommandReceived(receivedAt);
+  scheduleSegment(beginRide, nullptr);
+  scheduleRelease(RIDE_TASKS);
+  return true;
+}
+
+/**
+ * Function to print the rides of the library with their numbers
+ */
+void listRides() {
+  char name[RIDE_NAME_LENGTH + 1];
+
+  Serial.println(F("Rides:"));
+  for (uint8_t i = 0; i < getRideCount(); i++) {
+    getRideName(getRide(i), name, sizeof(name));
+    Serial.print(i + 1);
+    Serial.print(F(": "));
+    Serial.println(name);
+  }
+  Serial.println();
+}
+
+/**
+ * Function to drop everything that is queued
+ * The motors finish the move they are in, a ride that is playing ends with it
+ */
+void stopCommand() {
+  clearScheduler();
+  rideQueued = false;
+  Serial.println(F("Stopped, everything queued has been dropped."));
+  Serial.println();
+}
+
+/**
+ * Function to print the backlash of the motors, or set the one of a motor by hand and keep it
+ * Homing measures it again and overwrites what was set. Saving waits for the EEPROM, so it is only done at rest.
+ * @param command the BACKLASH command, without a motor it only prints
+ */
+void backlashCommand(const Command &command) {
+  if (command.number != 0) {
+    if (command.number < 1 || command.number > 3) {
+      Serial.println(F("The motor has to be 1, 2 or 3."));
+      Serial.println();
+      return;
+    }
+    if (!isSchedulerIdle()) {
+      Serial.println(F("The backlash can only be set while the chair is at rest."));
+      Serial.println();
+      return;
+    }
+    if (command.steps < 0 || command.steps > BACKLASH_MAX_STEPS) {
+      Serial.print(F("The backlash has to be from 0 to "));
+      Serial.print(BACKLASH_MAX_STEPS);
+      Serial.println(F(" steps."));
+      Serial.println();
+      return;
+    }
+    setBacklash(command.number - 1, command.steps);
+    uint8_t backlash[3] = { getBacklash(0), getBacklash(1), getBacklash(2) };
+    saveBacklash(backlash);
+  }
+
+  Serial.print(F("Backlash: "));
+  for (uint8_t i = 0; i < 3; i++) {
+    Serial.print(F("motor "));
+    Serial.print(i + 1);
+    Serial.print(F(" "));
+    Serial.print(getBacklash(i));
+    Serial.print(i < 2 ? F(" steps, ") : F(" steps"));
+  }
+  Serial.println();
+  Serial.println();
+}
+
+/**
+ * Function to print the free SRAM and how long commands take to parse
+ */
+void statsCommand() {
+  int freeMemory = getFreeMemory();
+  Serial.print(F("Free SRAM: "));
+  if (freeMemory < 0) {
+    Serial.println(F("unknown"));
+  } else {
+    Serial.print(freeMemory);
+    Serial.println(F(" bytes"));
+  }
+  Serial.print(F("Command parse time: "));
+  Serial.print(lastParseMicros);
+  Serial.print(F(" us, slowest: "));
+  Serial.print(maxParseMicros);
+  Serial.println(F(" us"));
+
+  // From a control byte to every motor at rest
+  const HaltStats &halts = getHaltStats();
+  Serial.print(F("Stops and pauses: "));
+  Serial.print(halts.halts);
+  Serial.print(F(", last took "));
+  Serial.print(halts.lastMicros / 1000);
+  Serial.print(F(" ms and "));
+  Serial.print(halts.lastSteps);
+  Serial.print(F(" steps, slowest: "));
+  Serial.print(halts.maxMicros / 1000);
+  Serial.print(F(" ms, furthest: "));
+  Serial.print(halts.maxSteps);
+  Serial.println(F(" steps"));
+
+  // How well the clock follows the timeline of a host, drift in parts per million
+  Serial.print(F("Clock sync: "));
+  Serial.print(clockSync.syncs);
+  Serial.print(F(" syncs, "));
+  Serial.print(isClockSynced(clockSync) ? F("synced") : F("not synced"));
+  Serial.print(F(", drift "));
+  Serial.print(clockSync.driftPpb / 1000);
+  Serial.print(F(" ppm, last correction "));
+  Serial.print(clockSync.lastCorrection);
+  Serial.println(F(" us"));
+  Serial.println();
+}
+
+#ifdef __AVR__
+extern char __heap_start;
+extern char *__brkval;
+#endif
+
+/**
+ * Function to measure the SRAM left between the top of the heap and the stack
+ * @return the free bytes, or -1 off the chair
+ */
+int getFreeMemory() {
+#ifdef __AVR__
+  char top;
+  return &top - (__brkval ? __brkval : &__heap_start);
+#else
+  return -1;
+#endif
+}
+
+/**
+ * Function to track the poses streamed by a host until the user enters a line
+ * The jitter buffer and the fixed-rate control tick live in PoseStream, this applies the poses they hand out
+ */
+void updateStreaming() {
+  if (!promptShown) {
+    Serial.println(F("Streaming poses, enter any line to stop."));
+    Serial.println();
+    promptShown = true;
+  }
+
+  // Any line of input ends the stream, a command on it is carried out once the stream has stopped
+  if (inputReady) {
+    stopPoseStream();
+    cueingActive = false;
+
+    const StreamStats &stats = getStreamStats();
+    Serial.print(F("Streaming stopped. Underruns: "));
+    Serial.print(stats.underruns);
+    Serial.print(F(", overruns: "));
+    Serial.print(stats.overruns);
+    Serial.print(F(", max latency: "));
+    Serial.print(stats.maxLatency);
+    Serial.println(F(" us"));
+
+    // How often the stream asked for more than the motors could stop from, since startup
+    const EnvelopeStats &envelope = getEnvelopeStats();
+    Serial.print(F("Safety envelope interventions: "));
+    Serial.print(envelope.interventions);
+    Serial.print(F(", breaches: "));
+    Serial.println(envelope.breaches);
+    Serial.println();
+
+    setState(WAIT_FOR_COMMAND);
+    handleInputLine();
+    return;
+  }
+
+  // Let whatever was queued before the stream finish first
+  if (!isPoseStreaming()) {
+    if (!isSchedulerIdle()) {
+      return;
+    }
+    startPoseStream(jitterDepth);
+    resetPosePredictor(predictor);
+  }
+
+  updateCueing();
+
+  Pose pose;
+  uint32_t receivedAt;
+  if (nextStreamPose(pose, receivedAt)) {
+    retargetToPose(predicting ? predictPose(predictor, pose) : pose);
+    recordStreamLatency(micros() - receivedAt);
+  }
+}
+
+/**
+ * Function to set the lead of the predictor from the link latency of the host and the wait in the jitter buffer
+ */
+void tunePredictor() {
+  setPredictorLead(predictor, tunePredictorLead(linkLatency, getStreamStats().averageLatency));
+}
+
+/**
+ * Function to run the washout at its fixed rate while vehicle states are being streamed
+ * Its poses go through the jitter buffer like streamed poses do, each one stamped with the time its tick was due so
+ * the latency of the stream counts from when the pose was worked out
+ */
+void updateCueing() {
+  if (!cueingActive || (int32_t)(micros() - nextCueingAt) < 0) {
+    return;
+  }
+
+  // Catch up instead of running a burst of ticks after a long pass through loop(), the ticks stay on their grid
+  uint32_t dueAt = nextCueingAt + (micros() - nextCueingAt) / CUEING_TICK_MICROS * CUEING_TICK_MICROS;
+  nextCueingAt = dueAt + CUEING_TICK_MICROS;
+
+  pushStreamPose(updateMotionCueing(cueing, latestVehicle), dueAt);
+}
+
+/**
+ * Function to time the washout on this board and send the result to the host
+ * Runs on a separate cueing state so a stream in progress is not disturbed
+ */
+void sendCueingBenchmark() {
+  MotionCueing benchmarkCueing;
+  VehicleState vehicle = { 400, -250, 1200, -800, 3000 };
+  volatile int16_t sink = 0;
+
+  initMotionCueing(benchmarkCueing, 3000, 3000, 2000);
+
+  uint32_t startedAt = micros();
+  for (uint16_t i = 0; i < CUEING_BENCHMARK_UPDATES; i++) {
+    sink = updateMotionCueing(benchmarkCueing, vehicle).pitch;
+  }
+  uint32_t elapsed = micros() - startedAt;
+  (void)sink;
+
+  uint8_t payload[CUEING_BENCHMARK_PAYLOAD_SIZE];
+  writeUint16(payload, CUEING_BENCHMARK_UPDATES);
+  writeUint32(payload + 2, elapsed);
+  writeUint16(payload + 6, elapsed * clockCyclesPerMicrosecond() / CUEING_BENCHMARK_UPDATES);
+  sendFrame(MSG_CUEING_BENCHMARK, payload, CUEING_BENCHMARK_PAYLOAD_SIZE);
+}
+
+/**
+ * Function to send the motors towards a pose without waiting for the previous move to finish
+ * @param pose the target in hundredths of a degree
+ */
+void retargetToPose(const Pose &pose) {
+  MotorTargets targets = mixPose(pose.pitch, pose.roll, pose.yaw);
+
+  // The scheduler adds the running effects on top
+  retargetSteppers(targets.position[0], targets.position[1], targets.position[2]);
+}
+
+/**
+ * Function to schedule the moves of the chosen axis to a specified position, to the opposite position and back
+ * The kinematic mixing decides which motors move and in which direction
+ * @param axis the axis to move
+ * @param position the angle to move to in hundredths of a degree
+ * @param speed the speed in steps/sec
+ * @param acceleration the acceleration in steps/sec^2
+*/
+void moveMotor(AxisId axis, int16_t position, uint32_t speed, uint32_t acceleration) {
+  int16_t pitch = axis == AXIS_PITCH ? position : 0;
+  int16_t roll = axis == AXIS_ROLL ? position : 0;
+  int16_t yaw = axis == AXIS_YAW ? position : 0;
+
+  scheduleMoveToPose(pitch, roll, yaw, speed, acceleration, 0);
+  scheduleMoveToPose(-pitch, -roll, -yaw, speed, acceleration, 0);
+  scheduleMoveToPose(0, 0, 0, speed, acceleration, 0);
+}
+
+/**
+ * Function that moves the chair in a multi-axial experience
+ * Yaw swings together with the pitch and roll swings, and all motors of a move arrive at the same time
+*/
+void performFullExperienceMotion() {
+  uint32_t speed = PitchAxis::fromFullSteps(1000);
+  uint32_t acceleration = PitchAxis::fromFullSteps(1000);
+
+  scheduleSegment(nullptr, F("Moving all three motors!"));
+
+  // 30 degrees up while yawing 20 degrees to the right
+  // Then 30 degrees down while yawing 20 degrees to the left
+  scheduleMoveToPose(PitchAxis::LIMIT_CENTIDEGREES, 0, YawAxis::LIMIT_CENTIDEGREES, speed, acceleration, 0);
+  scheduleMoveToPose(-PitchAxis::LIMIT_CENTIDEGREES, 0, -YawAxis::LIMIT_CENTIDEGREES, speed, acceleration, 0);
+
+  // 30 degrees of roll to one side while yawing back to the right
+  // Then 30 degrees of roll to the other side while yawing to the left
+  scheduleMoveToPose(0, RollAxis::LIMIT_CENTIDEGREES, YawAxis::LIMIT_CENTIDEGREES, speed, acceleration, 0);
+  scheduleMoveToPose(0, -RollAxis::LIMIT_CENTIDEGREES, -YawAxis::LIMIT_CENTIDEGREES, speed, acceleration, 0);
+
+  // Back to the original position
+  scheduleMoveToPose(0, 0, 0, speed, acceleration, 0);
+
+  scheduleSegment(reportCommandLatency, nullptr);
+}
+
+
+/**
+ * Function that mimics what it would be like to be on a roller coaster
+ * Every part of the ride is queued as a segment, which is only turned into moves once the ride gets to it
+*/
+void performRollerCoasterSimulation() {
+  scheduleSegment(nullptr, F("Starting Roller Coaster Simulation..."));
+
+  // Begin with a slow climb to the first peak
+  scheduleSegment(slowClimb, F("Climbing to the first peak..."));
+
+  // Level out at the first peak
+  scheduleSegment(levelOut, F("Leveling out at the peak..."));
+
+  // The first major drop
+  scheduleSegment(fastFall, F("Descending the first major drop..."));
+
+  // Level out at the bottom
+  scheduleSegment(levelOut, F("Leveling out after the drop..."));
+
+  // A series of smaller hills and dips
+  scheduleSegment(nullptr, F("Navigating smaller hills..."));
+  for (int i = 0; i < 4; i++) {
+    scheduleSegment(smallHill, nullptr);
+    scheduleSegment(gentleDip, nullptr);
+  }
+
+  // Level out after last dip
+  scheduleSegment(levelOut, F("Leveling out after hills and dips..."));
+
+  // Introduce a sharp turn
+  scheduleSegment(sharpRightTurn, F("Executing a sharp turn..."));
+  scheduleSegment(sharpLeftTurn, nullptr);
+  scheduleSegment(centerYaw, nullptr);
+
+  // Simulate a fast climb to another peak
+  scheduleSegment(fastClimb, F("Fast climbing to another peak..."));
+
+  // Level out at the second peak
+  scheduleSegment(levelOut, F("Leveling out at the second peak..."));
+
+  // Final major fall
+  scheduleSegment(fastFall, F("Descending the final major fall..."));
+
+  // Level out at the bottom to end the ride
+  scheduleSegment(levelOut, F("Leveling out to end the ride..."));
+
+  // End of the simulation
+  scheduleSegment(nullptr, F("Roller Coaster Ride Complete!"));
+  scheduleSegment(reportCommandLatency, nullptr);
+}
+
+/**
+ * Function to start decoding the selected ride once everything queued before it has finished
+ */
+void beginRide() {
+  char name[RIDE_NAME_LENGTH + 1];
+  const uint8_t *script = getRide(selectedRide);
+
+  if (!openRide(rideDecoder, script)) {
+    Serial.println(F("The ride script is damaged."));
+    rideQueued = false;
+    return;
+  }
+
+  getRideName(script, name, sizeof(name));
+  Serial.print(F("Starting ride: "));
+  Serial.println(name);
+
+  // A precompiled ride only has its step commands copied into the queues, it plays from level
+  // A track compiled for another MICROSTEPS would play at the wrong scale, the keyframes are played instead
+  const uint8_t *track = getRideTrack(selectedRide);
+  TrackReader readers[3];
+  if (track && !openStepTrack(readers, track)) {
+    Serial.println(F("The step track was compiled for another MICROSTEPS, playing the keyframes. Run make -C host rides."));
+    track = nullptr;
+  }
+  if (track) {
+    scheduleMoveTo(ALL_STEPPERS_MASK, 0, 0, 0, ALL_STEPPERS_MASK, 0);
+    if (rideSynced) {
+      scheduleSegment(waitForRideStart, nullptr);
+    }
+    scheduleTrack(track);
+    scheduleSegment(endRide, nullptr);
+    return;
+  }
+
+  rideStartedAt = millis();
+  scheduleSegment(playRideKeyframe, nullptr);
+}
+
+/**
+ * Function to hold a level chair until the start of a synced ride
+ * The start is turned into micros() only now, with the latest estimate of the clock
+ */
+void waitForRideStart() {
+  scheduleWaitUntil(toLocalMicros(clockSync, rideStartsAt));
+}
+
+/**
+ * Function to schedule the move to the next keyframe of the ride and then itself again
+ * Only one keyframe is decoded at a time, so a ride of any length takes the same little SRAM
+ * A move starts at the time of its keyframe, or as soon as the move before it has arrived if that is later
+ */
+void playRideKeyframe() {
+  if (!nextKeyframe(rideDecoder)) {
+    endRide();
+    return;
+  }
+
+  // Back from a pause, a synced ride carries on from the last keyframe that is already due
+  if (rideRejoining) {
+    RideDecoder ahead = rideDecoder;
+    while (nextKeyframe(ahead) && (int32_t)(toLocalMicros(clockSync, rideStartsAt + ahead.keyframe.timeMs * 1000) - micros()) <= 0) {
+      rideDecoder = ahead;
+    }
+    rideRejoining = false;
+  }
+
+  const RideKeyframe &keyframe = rideDecoder.keyframe;
+  if (rideSynced) {
+    // On the timeline of the host the moves start at the same time on every chair, however fast its crystal is
+    uint32_t dueAt = toLocalMicros(clockSync, rideStartsAt + keyframe.timeMs * 1000);
+    if ((int32_t)(dueAt - micros()) > 0) {
+      scheduleWaitUntil(dueAt);
+    }
+  } else {
+    uint32_t elapsed = millis() - rideStartedAt;
+    if (keyframe.timeMs > elapsed) {
+      // The ride compiler keeps keyframes less than 65 seconds apart
+      scheduleWait(0, keyframe.timeMs - elapsed);
+    }
+  }
+
+  uint32_t speed = PitchAxis::fromFullSteps(keyframe.speed);
+  uint32_t acceleration = PitchAxis::fromFullSteps(keyframe.acceleration);
+
+  if (keyframe.effect != RIDE_NO_EFFECT) {
+    scheduleEffect(getEffectPreset(keyframe.effect));
+  }
+
+  if (keyframe.curve) {
+    MotorTargets targets = mixPose(keyframe.pitch, keyframe.roll, keyframe.yaw);
+    scheduleCurveMoveTo(ALL_STEPPERS_MASK, targets.position[0], targets.position[1], targets.position[2], speed, acceleration, ALL_STEPPERS_MASK, 0);
+  } else {
+    scheduleMoveToPose(keyframe.pitch, keyframe.roll, keyframe.yaw, speed, acceleration, 0);
+  }
+
+  scheduleSegment(playRideKeyframe, nullptr);
+}
+
+/**
+ * Function to let another ride start once the last move of this one has been played
+ */
+void endRide() {
+  Serial.println(F("Ride complete!"));
+  rideQueued = false;
+  reportCommandLatency();
+}
+
+/**
+ * Function to print how long the last command waited before the motors started moving
+ */
+void reportCommandLatency() {
+  uint32_t latency = getCommandLatency();
+
+  if (latency != NO_LATENCY_MEASURED) {
+    Serial.print(F("Command-to-motion latency: "));
+    Serial.print(latency);
+    Serial.println(F(" us"));
+    Serial.println();
+  }
+}
+
+/**
+ * Function to perform a slow climb up a hill
+*/
+void slowClimb() {
+  scheduleSpeedAndAcceleration(PITCH_ROLL_MASK, PitchAxis::fromFullSteps(600), PitchAxis::fromFullSteps(300));
+  int climbingHeight;
+
+  // Inch up in 10 increments to simulate a climb
+  for (int i = 1; i <= 10; i++) {
+    climbingHeight = MAX_NEG_PITCH_POSITION * i / 10;
+    scheduleMoveTo(PITCH_ROLL_MASK, climbingHeight, climbingHeight, 0, STEPPER2_MASK, 100);
+  }
+  // Stay at the max climb angle for 1 second
+  scheduleWait(0, 1000);
+}
+
+/**
+ * Function to perform a fast climb
+*/
+void fastClimb() {
+  scheduleSpeedAndAcceleration(PITCH_ROLL_MASK, PitchAxis::fromFullSteps(2000), PitchAxis::fromFullSteps(1000));
+
+  int climbingHeight = MAX_NEG_PITCH_POSITION;
+
+  // Stay at max climb angle for 2 seconds
+  scheduleMoveTo(PITCH_ROLL_MASK, climbingHeight, climbingHeight, 0, STEPPER2_MASK, 2000);
+}
+
+/**
+ * Function to level out
+ * Runs when the segment is reached, so it levels out from wherever the chair actually is
+*/
+void levelOut() {
+  int currentHeight = getChairPosition(0);
+  int levelingHeight;
+
+  // Get the average speed to have a dynamic level out
+  uint32_t speed1 = stepper1 -> getSpeedInMilliHz() * 1000;
+  uint32_t speed2 = stepper2 -> getSpeedInMilliHz() * 1000;
+  uint32_t averageSpeed = (speed1 + speed2) / 2;
+
+  // The faster the speed, the smaller the leveling factor
+  float levelingFactor = max(0.01, 1.0 - (averageSpeed / 1000.0));
+
+  // The faster the speed, the longer the delay between each level out
+  int dynamicDelay = min(500, max(100, int(averageSpeed / 10)));
+
+  // Level out in 10 increments based on the levelingFactor and the dynamicDelay
+  for (int i = 9; i >= 0; i--) {
+    levelingHeight = int(currentHeight * levelingFactor * i / 9);
+    scheduleMoveTo(PITCH_ROLL_MASK, levelingHeight, levelingHeight, 0, STEPPER2_MASK, dynamicDelay);
+  }
+}
+
+/**
+ * Function to perform a fast fall
+*/
+void fastFall() {
+  scheduleSpeedAndAcceleration(PITCH_ROLL_MASK, PitchAxis::fromFullSteps(3000), PitchAxis::fromFullSteps(1500));
+
+  int fallingHeight = MAX_POS_PITCH_POSITION;
+
+  // The S-curve softens the start and end of the fall, so it can accelerate twice as hard as the trapezoid did
+  // Stay at the max fall angle for 2 seconds
+  scheduleCurveMoveTo(PITCH_ROLL_MASK, fallingHeight, fallingHeight, 0, PitchAxis::fromFullSteps(3000), PitchAxis::fromFullSteps(3000), STEPPER2_MASK, 2000);
+}
+
+/**
+ * Function to perform a gentle dip
+*/
+void gentleDip() {
+  // Dip is half the max angle possible
+  int midHeight = MAX_POS_PITCH_POSITION / 2;
+
+  // Stay on the dip for only half a second
+  scheduleMoveTo(PITCH_ROLL_MASK, midHeight, midHeight, 0, STEPPER2_MASK, 500);
+}
+
+/**
+ * Function to perform a small hill
+*/
+void smallHill() {
+  // Hill is half the max angle possible
+  int hillHeight = MAX_NEG_PITCH_POSITION / 2;
+
+  // Stay on the hill for only half a second
+  scheduleMoveTo(PITCH_ROLL_MASK, hillHeight, hillHeight, 0, STEPPER2_MASK, 500);
+}
+
+void sharpRightTurn() {
+  scheduleSpeedAndAcceleration(STEPPER3_MASK, YawAxis::fromFullSteps(2000), YawAxis::fromFullSteps(1000));
+
+  // Turn with a jerk-limited S-curve at twice the acceleration and let the sharp turn last 300ms
+  scheduleCurveMoveTo(STEPPER3_MASK, 0, 0, MAX_POS_YAW_POSITION, YawAxis::fromFullSteps(2000), YawAxis::fromFullSteps(2000), STEPPER3_MASK, 300);
+}
+
+void sharpLeftTurn() {
+  scheduleSpeedAndAcceleration(STEPPER3_MASK, YawAxis::fromFullSteps(2000), YawAxis::fromFullSteps(1000));
+
+  // Turn with a jerk-limited S-curve at twice the acceleration and let the sharp turn last 300ms
+  scheduleCurveMoveTo(STEPPER3_MASK, 0, 0, MAX_NEG_YAW_POSITION, YawAxis::fromFullSteps(2000), YawAxis::fromFullSteps(2000), STEPPER3_MASK, 300);
+}
+
+/**
+ * Function to bring the yaw back to the middle after the turns
+ */
+void centerYaw() {
+  scheduleMoveTo(STEPPER3_MASK, 0, 0, 0, STEPPER3_MASK, 0);
+}
+
+/**
+ * Function to perform a twist
+*/
+void suddenTwist() {
+  scheduleSpeedAndAcceleration(STEPPER1_MASK, RollAxis::fromFullSteps(2000), 0);
+
+  // Roll in one direction and stay there for 200ms
+  scheduleMoveTo(PITCH_ROLL_MASK, MAX_POS_ROLL_POSITION, MAX_NEG_ROLL_POSITION, 0, STEPPER2_MASK, 200);
+
+  // Roll in the other direction and stay there for 200ms
+  scheduleMoveTo(PITCH_ROLL_MASK, -MAX_POS_ROLL_POSITION, -MAX_NEG_ROLL_POSITION, 0, STEPPER2_MASK, 200);
+}
+
+/**
+ * Function to perform a rumble of the chair
+ * The rumble is road texture laid over wherever the chair is, so it can also run under other moves
+ * @param numberOfRumbles how long the rumble lasts in 50ms steps (Ex: 40 rumbles is equal to 2 seconds of rumbles (50ms * 40))
+*/
+void rumble(int numberOfRumbles) {
+  uint16_t duration = numberOfRumbles * 50;
+
+  // Coarse noise a few times a second, the effect trims it if the motors can't keep up
+  EffectSettings rumbleEffect = { 0, EFFECT_ROAD, { 120, 160, 200 }, { 500, 500, 500 }, duration };
+
+  // The steppers follow the shaking with their trapezoid ramps, which have to be quick enough for it
+  scheduleSpeedAndAcceleration(ALL_STEPPERS_MASK, PitchAxis::fromFullSteps(2000), PitchAxis::fromFullSteps(8000));
+  scheduleEffect(rumbleEffect);
+  scheduleWait(0, duration);
+
+  // The effect ends where it started, only the ramps have to be put back
+  scheduleSpeedAndAcceleration(ALL_STEPPERS_MASK, PitchAxis::fromFullSteps(1000), PitchAxis::fromFullSteps(1000));
+}
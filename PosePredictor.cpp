@@ -0,0 +1,148 @@
+#include "PosePredictor.h"
+#include "PoseStream.h"
+
+// Q15 gains of the fading-memory filter for the smoothing PREDICTOR_THETA (theta), worked out at compile time
+//   position:     1 - theta^3
+//   velocity:     1.5 (1 - theta)^2 (1 + theta)
+//   acceleration: (1 - theta)^3, already doubled for an update of one tick
+#define THETA_CUBED(t) ((int64_t)(t) * (t) * (t))
+static const int16_t POSITION_GAIN = (int16_t)(32768LL * (1000000000LL - THETA_CUBED(PREDICTOR_THETA)) / 1000000000LL);
+static const int16_t VELOCITY_GAIN = (int16_t)(32768LL * 3 * (1000 - PREDICTOR_THETA) * (1000 - PREDICTOR_THETA) *
+                                               (1000 + PREDICTOR_THETA) / 2000000000LL);
+static const int16_t ACCELERATION_GAIN = (int16_t)(32768LL * THETA_CUBED(1000 - PREDICTOR_THETA) / 1000000000LL);
+
+/**
+ * Function to multiply a Q8 value by a Q15 coefficient
+ * Split into two 32-bit multiplies so the ATmega2560 never needs 64-bit math
+ */
+static inline int32_t mulQ15(int32_t value, int16_t coefficient) {
+  int32_t high = value >> 16;
+  uint16_t low = (uint16_t)(value & 0xFFFF);
+  return high * coefficient * 2 + (((int32_t)low * coefficient) >> 15);
+}
+
+/**
+ * Function to multiply a Q8 value by an unsigned Q8 factor, split the same way
+ */
+static inline int32_t mulQ8(int32_t value, uint16_t factor) {
+  int32_t high = value >> 16;
+  uint16_t low = (uint16_t)(value & 0xFFFF);
+  return high * factor * 256 + (int32_t)(((uint32_t)low * factor) >> 8);
+}
+
+static inline int32_t clampQ8(int32_t value, int32_t limit) {
+  if (value > limit) {
+    return limit;
+  } else if (value < -limit) {
+    return -limit;
+  }
+  return value;
+}
+
+/**
+ * Function to run one axis of the filter for one tick and extrapolate it by the lead
+ * @param predictor the predictor, for the lead
+ * @param axis the axis
+ * @param measured the angle of the pose in centidegrees
+ * @return the predicted angle in centidegrees
+ */
+static int16_t predictAxis(PosePredictor &predictor, PredictorAxis &axis, int16_t measured) {
+  int32_t position = axis.position + axis.velocity + axis.acceleration / 2;
+  int32_t velocity = axis.velocity + axis.acceleration;
+  int32_t residual = ((int32_t)measured << 8) - position;
+
+  axis.position = position + mulQ15(residual, POSITION_GAIN);
+  axis.velocity = velocity + mulQ15(residual, VELOCITY_GAIN);
+  axis.acceleration += mulQ15(residual, ACCELERATION_GAIN);
+
+  // Without a lead the filter only keeps up, the pose is handed out as it came instead of lagging behind it
+  if (predictor.leadTicks == 0) {
+    return (int16_t)(clampQ8((int32_t)measured << 8, axis.limit) >> 8);
+  }
+
+  int32_t predicted = axis.position + mulQ8(axis.velocity, predictor.leadTicks) +
+                      mulQ8(axis.acceleration, predictor.leadSquareHalf);
+  return (int16_t)((clampQ8(predicted, axis.limit) + 128) >> 8);
+}
+
+static void startAxis(PredictorAxis &axis, int16_t measured) {
+  axis.position = (int32_t)measured << 8;
+  axis.velocity = 0;
+  axis.acceleration = 0;
+}
+
+/**
+ * Function to set up a predictor with no lead, it hands the poses out unchanged, within the limits, until
+ * setPredictorLead()
+ * @param predictor the predictor
+ * @param pitchLimit largest pitch in either direction in centidegrees
+ * @param rollLimit largest roll in either direction in centidegrees
+ * @param yawLimit largest yaw in either direction in centidegrees
+ */
+void initPosePredictor(PosePredictor &predictor, int16_t pitchLimit, int16_t rollLimit, int16_t yawLimit) {
+  predictor.pitch.limit = (int32_t)pitchLimit << 8;
+  predictor.roll.limit = (int32_t)rollLimit << 8;
+  predictor.yaw.limit = (int32_t)yawLimit << 8;
+  setPredictorLead(predictor, 0);
+  resetPosePredictor(predictor);
+}
+
+/**
+ * Function to forget the stream followed so far, the next pose starts the filter again from rest
+ * The lead is kept
+ */
+void resetPosePredictor(PosePredictor &predictor) {
+  predictor.started = false;
+}
+
+/**
+ * Function to set how far ahead poses are predicted
+ * @param predictor the predictor
+ * @param leadMicros the lead in microseconds, up to PREDICTOR_MAX_LEAD_MS, 0 hands the poses out as they come
+ */
+void setPredictorLead(PosePredictor &predictor, uint32_t leadMicros) {
+  if (leadMicros > PREDICTOR_MAX_LEAD_MS * 1000UL) {
+    leadMicros = PREDICTOR_MAX_LEAD_MS * 1000UL;
+  }
+  predictor.leadTicks = (uint16_t)(leadMicros * 256 / STREAM_TICK_MICROS);
+  predictor.leadSquareHalf = (uint16_t)(((uint32_t)predictor.leadTicks * predictor.leadTicks) >> 9);
+}
+
+/**
+ * Function to get the lead in microseconds
+ */
+uint32_t getPredictorLead(const PosePredictor &predictor) {
+  return (uint32_t)predictor.leadTicks * STREAM_TICK_MICROS / 256;
+}
+
+/**
+ * Function to work out the lead that hides the measured latency of a stream
+ * @param linkMicros time a pose takes from the host to the chair, half the round trip of MSG_PING
+ * @param bufferMicros time a pose waits in the jitter buffer of the chair, on average
+ * @return the lead in microseconds, up to PREDICTOR_MAX_LEAD_MS
+ */
+uint32_t tunePredictorLead(uint32_t linkMicros, uint32_t bufferMicros) {
+  uint32_t lead = linkMicros + bufferMicros + PREDICTOR_MOTOR_LAG_MS * 1000UL;
+  return lead < PREDICTOR_MAX_LEAD_MS * 1000UL ? lead : PREDICTOR_MAX_LEAD_MS * 1000UL;
+}
+
+/**
+ * Function to take the next pose of the stream and predict where it is heading, called once per stream tick
+ * @param predictor the predictor
+ * @param pose the pose from the stream
+ * @return the pose one lead ahead, within the limits
+ */
+Pose predictPose(PosePredictor &predictor, const Pose &pose) {
+  if (!predictor.started) {
+    startAxis(predictor.pitch, pose.pitch);
+    startAxis(predictor.roll, pose.roll);
+    startAxis(predictor.yaw, pose.yaw);
+    predictor.started = true;
+  }
+
+  Pose predicted;
+  predicted.pitch = predictAxis(predictor, predictor.pitch, pose.pitch);
+  predicted.roll = predictAxis(predictor, predictor.roll, pose.roll);
+  predicted.yaw = predictAxis(predictor, predictor.yaw, pose.yaw);
+  return predicted;
+}
@@ -0,0 +1,58 @@
+#ifndef POSE_PREDICTOR_H
+#define POSE_PREDICTOR_H
+
+#include <stdint.h>
+#include "SerialProtocol.h"
+
+// Latency hiding for streamed poses
+//
+// A pose from a game reaches the seat late: it crosses the link to the chair, waits in the jitter buffer and the
+// motors take a while to ramp to it. The predictor follows the stream with a fading-memory filter of position,
+// velocity and acceleration for every angle (the steady-state Kalman filter of a target moving at constant
+// acceleration) and hands out the pose the stream is expected to have one lead time ahead, so the chair gets there
+// about when the game does.
+//
+// The lead is tuned from what is measured rather than set by hand: the host times the round trip of MSG_PING, half
+// of it is the link, the chair knows how long poses wait in its jitter buffer, and the ramps of the motors add
+// PREDICTOR_MOTOR_LAG_MS. The predictor runs wherever the poses are made, in the sketch for MSG_PREDICTOR_CONFIG
+// or in host/chair_bridge.cpp, always on one update per stream tick.
+//
+// Integer math only, like MotionCueing.cpp: angles are centidegrees in Q8, velocities and accelerations are per
+// tick and per tick squared in Q8, the gains are Q15
+
+// How much the filter smooths, the share of the old estimate kept per update in thousandths
+// Closer to 1000 rides out noisier streams but notices turns later, which shows as overshoot
+#define PREDICTOR_THETA 600
+
+// Time the motors lag behind a moving target at the stream speed and acceleration, measured with
+// host/predictor_bench.cpp
+#define PREDICTOR_MOTOR_LAG_MS 10
+
+// Longest lead, extrapolating further ahead than this overshoots more than it hides
+#define PREDICTOR_MAX_LEAD_MS 100
+
+// One axis of the filter
+struct PredictorAxis {
+  int32_t position;     // Q8 centidegrees
+  int32_t velocity;     // Q8 centidegrees per tick
+  int32_t acceleration; // Q8 centidegrees per tick squared
+  int32_t limit;        // Q8 centidegrees, the prediction is clamped to it
+};
+
+struct PosePredictor {
+  PredictorAxis pitch;
+  PredictorAxis roll;
+  PredictorAxis yaw;
+  bool started;            // Whether a pose has been seen since the reset
+  uint16_t leadTicks;      // Lead in ticks, Q8
+  uint16_t leadSquareHalf; // Half its square in ticks squared, Q8
+};
+
+void initPosePredictor(PosePredictor &predictor, int16_t pitchLimit, int16_t rollLimit, int16_t yawLimit);
+void resetPosePredictor(PosePredictor &predictor);
+void setPredictorLead(PosePredictor &predictor, uint32_t leadMicros);
+uint32_t getPredictorLead(const PosePredictor &predictor);
+uint32_t tunePredictorLead(uint32_t linkMicros, uint32_t bufferMicros);
+Pose predictPose(PosePredictor &predictor, const Pose &pose);
+
+#endif
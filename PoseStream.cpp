@@ -0,0 +1,155 @@
+#include "Arduino.h"
+#include "PoseStream.h"
+
+// A pose waiting in the buffer together with when it arrived
+struct BufferedPose {
+  Pose pose;
+  uint32_t receivedAt;
+};
+
+// Ring buffer of received poses
+static BufferedPose buffer[POSE_BUFFER_SIZE];
+static uint8_t bufferHead = 0;
+static uint8_t bufferCount = 0;
+
+static bool streaming = false;
+static bool primed = false;
+static uint8_t depth = DEFAULT_JITTER_DEPTH;
+static uint32_t nextTickAt = 0;
+static StreamStats stats;
+
+/**
+ * Function to start tracking streamed poses
+ * Anything left in the buffer and the counters are cleared
+ * @param jitterDepth how many poses to collect before the first one is used, from 1 to POSE_BUFFER_SIZE
+ */
+void startPoseStream(uint8_t jitterDepth) {
+  if (jitterDepth < 1) {
+    jitterDepth = 1;
+  } else if (jitterDepth > POSE_BUFFER_SIZE) {
+    jitterDepth = POSE_BUFFER_SIZE;
+  }
+
+  depth = jitterDepth;
+  bufferHead = 0;
+  bufferCount = 0;
+  primed = false;
+  streaming = true;
+  nextTickAt = micros();
+
+  stats.underruns = 0;
+  stats.overruns = 0;
+  stats.lastLatency = 0;
+  stats.maxLatency = 0;
+  stats.averageLatency = 0;
+}
+
+/**
+ * Function to stop tracking streamed poses, poses that arrive afterwards are ignored
+ */
+void stopPoseStream() {
+  streaming = false;
+}
+
+bool isPoseStreaming() {
+  return streaming;
+}
+
+/**
+ * Function to get how many poses are waiting in the buffer
+ */
+uint8_t getStreamFill() {
+  return bufferCount;
+}
+
+/**
+ * Function to add a received pose to the buffer
+ * When the buffer is full the oldest pose is dropped, so the latency can't keep growing
+ * @param pose the received pose
+ * @param receivedAtMicros micros() when the frame arrived
+ */
+void pushStreamPose(const Pose &pose, uint32_t receivedAtMicros) {
+  if (!streaming) {
+    return;
+  }
+
+  if (bufferCount >= POSE_BUFFER_SIZE) {
+    bufferHead = (bufferHead + 1) % POSE_BUFFER_SIZE;
+    bufferCount--;
+    stats.overruns++;
+  }
+
+  BufferedPose &slot = buffer[(bufferHead + bufferCount) % POSE_BUFFER_SIZE];
+  slot.pose = pose;
+  slot.receivedAt = receivedAtMicros;
+  bufferCount++;
+}
+
+/**
+ * Function to run the control tick, called on every pass through loop()
+ * @param pose set to the pose the motors should be retargeted to
+ * @param receivedAtMicros set to when that pose arrived
+ * @return true if a tick is due and a pose was taken from the buffer
+ */
+bool nextStreamPose(Pose &pose, uint32_t &receivedAtMicros) {
+  if (!streaming || (int32_t)(micros() - nextTickAt) < 0) {
+    return false;
+  }
+  nextTickAt += STREAM_TICK_MICROS;
+
+  // Catch up instead of running a burst of ticks after a long pass through loop()
+  if ((int32_t)(micros() - nextTickAt) > STREAM_TICK_MICROS) {
+    nextTickAt = micros() + STREAM_TICK_MICROS;
+  }
+
+  // Wait for the buffer to fill up to the jitter depth, again after every underrun
+  if (!primed) {
+    if (bufferCount < depth) {
+      return false;
+    }
+    primed = true;
+  }
+
+  if (bufferCount == 0) {
+    stats.underruns++;
+    primed = false;
+    return false;
+  }
+
+  pose = buffer[bufferHead].pose;
+  receivedAtMicros = buffer[bufferHead].receivedAt;
+  bufferHead = (bufferHead + 1) % POSE_BUFFER_SIZE;
+  bufferCount--;
+  return true;
+}
+
+/**
+ * Function to record the time from a pose arriving to the motors being retargeted to it
+ * @param latency the time in microseconds
+ */
+void recordStreamLatency(uint32_t latency) {
+  stats.lastLatency = latency;
+  if (latency > stats.maxLatency) {
+    stats.maxLatency = latency;
+  }
+  if (stats.averageLatency == 0) {
+    stats.averageLatency = latency;
+  } else {
+    stats.averageLatency += ((int32_t)(latency - stats.averageLatency)) / 8;
+  }
+}
+
+const StreamStats &getStreamStats() {
+  return stats;
+}
+
+/**
+ * Function to put the streaming counters into a MSG_STREAM_STATS payload
+ */
+void encodeStreamStats(uint8_t *payload) {
+  writeUint16(payload, stats.underruns);
+  writeUint16(payload + 2, stats.overruns);
+  writeUint32(payload + 4, stats.lastLatency);
+  writeUint32(payload + 8, stats.maxLatency);
+  payload[12] = bufferCount;
+}
@@ -0,0 +1,35 @@
+#ifndef POSE_STREAM_H
+#define POSE_STREAM_H
+
+#include "SerialProtocol.h"
+
+// Room for this many received poses that have not been used yet
+#define POSE_BUFFER_SIZE 16
+
+// How many poses are collected before the control tick starts using them
+// A deeper buffer rides out more jitter in the arrival times at the cost of one tick of latency per pose
+#define DEFAULT_JITTER_DEPTH 2
+
+// The control tick runs at a fixed rate of 200 Hz
+#define STREAM_TICK_MICROS 5000
+
+// Counters kept while streaming
+struct StreamStats {
+  uint16_t underruns;      // Ticks that found the buffer empty and kept the previous target
+  uint16_t overruns;       // Poses thrown away because the buffer was full
+  uint32_t lastLatency;    // Microseconds from the last used pose arriving to the motors being retargeted
+  uint32_t maxLatency;     // Largest of those since streaming started
+  uint32_t averageLatency; // Running average of those, a new one counts for an eighth
+};
+
+void startPoseStream(uint8_t jitterDepth);
+void stopPoseStream();
+bool isPoseStreaming();
+uint8_t getStreamFill();
+void pushStreamPose(const Pose &pose, uint32_t receivedAtMicros);
+bool nextStreamPose(Pose &pose, uint32_t &receivedAtMicros);
+void recordStreamLatency(uint32_t latency);
+const StreamStats &getStreamStats();
+void encodeStreamStats(uint8_t *payload);
+
+#endif
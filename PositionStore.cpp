@@ -0,0 +1,195 @@
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "PositionStore.h"
+#include "SerialProtocol.h"
+#include "AxisConfig.h"
+#include "Homing.h"
+#include "MotionScheduler.h"
+
+// Positions are stored as int16, the limits and the home switches have to fit
+static_assert(Stepper1Axis::MAX_POSITION <= INT16_MAX && homeSwitchPosition<Stepper1Axis>() >= INT16_MIN, "Stepper1 positions don't fit in 16 bits");
+static_assert(Stepper2Axis::MAX_POSITION <= INT16_MAX && homeSwitchPosition<Stepper2Axis>() >= INT16_MIN, "Stepper2 positions don't fit in 16 bits");
+static_assert(Stepper3Axis::MAX_POSITION <= INT16_MAX && homeSwitchPosition<Stepper3Axis>() >= INT16_MIN, "Stepper3 positions don't fit in 16 bits");
+
+// Offsets within a record
+#define RECORD_POSITIONS 2
+#define RECORD_CRC 8
+#define RECORD_MARK 10
+
+// The steppers whose positions are kept (index 0 is stepper1)
+static FastAccelStepper *steppers[3] = { nullptr, nullptr, nullptr };
+
+// The newest record in the EEPROM
+static bool haveRecord = false;
+static uint8_t newestSlot = POSITION_STORE_SLOTS - 1;
+static uint16_t newestSequence = 0;
+static int16_t savedPositions[3] = { 0, 0, 0 };
+static bool marked = false;
+
+static bool started = false;
+static uint32_t stillSince = 0;
+
+// Bytes waiting to be written, in order
+struct EepromWrite {
+  uint16_t address;
+  uint8_t value;
+};
+static EepromWrite writes[POSITION_RECORD_SIZE + 1];
+static uint8_t writeCount = 0;
+static uint8_t nextWrite = 0;
+
+static uint16_t slotAddress(uint8_t slot) {
+  return POSITION_STORE_ADDRESS + slot * POSITION_RECORD_SIZE;
+}
+
+static void queueWrite(uint16_t address, uint8_t value) {
+  writes[writeCount].address = address;
+  writes[writeCount].value = value;
+  writeCount++;
+}
+
+/**
+ * Function to find the newest record and get the positions in it
+ * Called once at startup, before the steppers move
+ * @param positions filled with the positions of stepper1, stepper2 and stepper3 if the record is good
+ * @return whether the newest record is marked good, i.e. the chair was at rest when it was switched off
+ */
+bool loadPositions(int32_t *positions) {
+  uint8_t record[POSITION_RECORD_SIZE];
+
+  for (uint8_t slot = 0; slot < POSITION_STORE_SLOTS; slot++) {
+    for (uint8_t i = 0; i < POSITION_RECORD_SIZE; i++) {
+      record[i] = EEPROM.read(slotAddress(slot) + i);
+    }
+    uint16_t crc = 0xFFFF;
+    for (uint8_t i = 0; i < RECORD_CRC; i++) {
+      crc = updateCrc(crc, record[i]);
+    }
+    if (crc != readUint16(record + RECORD_CRC)) {
+      continue;
+    }
+
+    // Sequences wrap, the ring only ever holds a run of consecutive ones
+    uint16_t sequence = readUint16(record);
+    if (haveRecord && (int16_t)(sequence - newestSequence) <= 0) {
+      continue;
+    }
+    haveRecord = true;
+    newestSlot = slot;
+    newestSequence = sequence;
+    marked = record[RECORD_MARK] == POSITION_MARK_GOOD;
+    for (uint8_t i = 0; i < 3; i++) {
+      savedPositions[i] = readInt16(record + RECORD_POSITIONS + 2 * i);
+    }
+  }
+
+  if (!marked) {
+    return false;
+  }
+  for (uint8_t i = 0; i < 3; i++) {
+    positions[i] = savedPositions[i];
+  }
+  return true;
+}
+
+/**
+ * Function to remember the steppers whose positions are saved, once their positions are known
+ * Until then nothing is saved, so a record that isn't marked good stays that way
+ */
+void initPositionStore(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third) {
+  steppers[0] = first;
+  steppers[1] = second;
+  steppers[2] = third;
+  started = true;
+  stillSince = millis();
+}
+
+/**
+ * Function to queue a new record with the positions in the slot after the newest
+ * The slot's old mark is cleared before anything else is written, in case it was a good one
+ */
+static void queueRecord(const int16_t *positions) {
+  uint8_t slot = haveRecord ? (newestSlot + 1) % POSITION_STORE_SLOTS : 0;
+  uint16_t sequence = haveRecord ? newestSequence + 1 : 0;
+  uint16_t address = slotAddress(slot);
+
+  uint8_t record[POSITION_RECORD_SIZE];
+  writeUint16(record, sequence);
+  for (uint8_t i = 0; i < 3; i++) {
+    writeInt16(record + RECORD_POSITIONS + 2 * i, positions[i]);
+  }
+  uint16_t crc = 0xFFFF;
+  for (uint8_t i = 0; i < RECORD_CRC; i++) {
+    crc = updateCrc(crc, record[i]);
+  }
+  writeUint16(record + RECORD_CRC, crc);
+
+  queueWrite(address + RECORD_MARK, POSITION_MARK_CLEARED);
+  for (uint8_t i = 0; i < RECORD_MARK; i++) {
+    queueWrite(address + i, record[i]);
+  }
+  queueWrite(address + RECORD_MARK, POSITION_MARK_GOOD);
+
+  haveRecord = true;
+  newestSlot = slot;
+  newestSequence = sequence;
+  for (uint8_t i = 0; i < 3; i++) {
+    savedPositions[i] = positions[i];
+  }
+}
+
+/**
+ * Function to save the positions once the chair is at rest and to clear the mark once it moves,
+ * called on every pass through loop()
+ * @param idle whether nothing is left to run, so that the chair stays where it is
+ */
+void updatePositionStore(bool idle) {
+  if (!started) {
+    return;
+  }
+
+  bool running = false;
+  for (uint8_t i = 0; i < 3; i++) {
+    running = running || (steppers[i] && steppers[i] -> isRunning());
+  }
+  if (running || !idle) {
+    stillSince = millis();
+  }
+
+  // At most one byte per pass, and only when the EEPROM is done with the one before
+  if (nextWrite < writeCount) {
+    if (eeprom_is_ready()) {
+      EEPROM.update(writes[nextWrite].address, writes[nextWrite].value);
+      nextWrite++;
+    }
+    return;
+  }
+  writeCount = 0;
+  nextWrite = 0;
+
+  if (running) {
+    if (marked) {
+      queueWrite(slotAddress(newestSlot) + RECORD_MARK, POSITION_MARK_CLEARED);
+      marked = false;
+    }
+    return;
+  }
+  if (millis() - stillSince < POSITION_SETTLE_MS) {
+    return;
+  }
+
+  int16_t positions[3];
+  bool moved = false;
+  for (uint8_t i = 0; i < 3; i++) {
+    positions[i] = steppers[i] ? (int16_t)getChairPosition(i) : 0;
+    moved = moved || positions[i] != savedPositions[i];
+  }
+
+  if (marked && !moved) {
+    return;
+  }
+  // Also when the chair came back to where the newest record says, which it does after every ride. Marking that
+  // record good again would write its mark byte twice a ride and wear it out long before the rest of the ring.
+  queueRecord(positions);
+  marked = true;
+}
@@ -0,0 +1,39 @@
+#ifndef POSITION_STORE_H
+#define POSITION_STORE_H
+
+#include "FastAccelStepper.h"
+
+// The positions of the motors, kept in EEPROM so that the chair doesn't have to home at every startup
+//
+// Once the chair has been still for a moment with nothing left to run, the positions are saved with a mark
+// that they are good. The moment a motor moves again the mark is cleared. A chair that was switched off at
+// rest finds a marked record at the next startup and carries on from it, one that lost power while it was
+// moving finds the mark cleared and has to home, see Homing.h.
+// The positions are those of the chair side of the gears. Which way the gears were last driven is not kept, a
+// restored motor starts with its play taken to be in the middle (Backlash.h).
+//
+// A record is
+//   sequence (uint16) | stepper1 | stepper2 | stepper3 (int16 steps) | CRC low | CRC high | mark
+// with the CRC of SerialProtocol.h over everything before it. Every save goes to the next of a ring of slots,
+// which spreads the wear over the EEPROM (100000 writes per byte), and the newest record is the valid one with
+// the highest sequence. The mark is written last, so a save that was cut short never looks good.
+//
+// A byte takes 3.3 ms to write, so the writes are spread over the passes through loop() one byte at a time
+// instead of waiting for each. A save that is still being written when a motor starts holds up clearing the
+// mark by up to a record's worth of writes.
+
+#define POSITION_STORE_ADDRESS 0
+#define POSITION_STORE_SLOTS 64
+#define POSITION_RECORD_SIZE 11
+
+#define POSITION_MARK_GOOD 0xC5
+#define POSITION_MARK_CLEARED 0x00
+
+// Time the motors have to be still before their positions are saved
+#define POSITION_SETTLE_MS 500
+
+bool loadPositions(int32_t *positions);
+void initPositionStore(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third);
+void updatePositionStore(bool idle);
+
+#endif
@@ -0,0 +1,1414 @@
+// Generated by host/ride_compiler.cpp, edit the ride scripts instead and compile them again
+// Sources: rides/roller_coaster.csv rides/ocean_waves.csv rides/off_road.csv
+
+#include "RideLibrary.h"
+
+// Roller Coaster: 33 keyframes, 55.3 s, 232 bytes
+static const uint8_t RIDE_0[] PROGMEM = {
+  0x52, 0x44, 0x02, 0x21, 0x00, 0x0E, 0x52, 0x6F, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x43, 0x6F, 0x61,
+  0x73, 0x74, 0x65, 0x72, 0x19, 0x00, 0xD7, 0x04, 0xD8, 0x04, 0xAC, 0x02, 0x01, 0xB0, 0x09, 0xD7,
+  0x04, 0x01, 0xB0, 0x09, 0xD7, 0x04, 0x01, 0xB0, 0x09, 0xD7, 0x04, 0x01, 0xB0, 0x09, 0xD7, 0x04,
+  0x01, 0xB0, 0x09, 0xD7, 0x04, 0x01, 0xB0, 0x09, 0xD7, 0x04, 0x01, 0xB0, 0x09, 0xD7, 0x04, 0x01,
+  0xB0, 0x09, 0xD7, 0x04, 0x01, 0xB0, 0x09, 0xD7, 0x04, 0x19, 0x98, 0x11, 0xB8, 0x17, 0xE8, 0x07,
+  0xF4, 0x03, 0x01, 0x88, 0x0E, 0xB8, 0x17, 0x39, 0xA4, 0x0D, 0xF0, 0x2E, 0xB8, 0x17, 0xB8, 0x17,
+  0x59, 0xA0, 0x1F, 0xB7, 0x17, 0xE8, 0x07, 0xF4, 0x03, 0x03, 0x01, 0x88, 0x0E, 0xB7, 0x17, 0x19,
+  0xB0, 0x09, 0xB7, 0x17, 0xB8, 0x17, 0xDC, 0x0B, 0x01, 0xF8, 0x0A, 0xF0, 0x2E, 0x01, 0xF8, 0x0A,
+  0xEF, 0x2E, 0x01, 0xF8, 0x0A, 0xF0, 0x2E, 0x01, 0xF8, 0x0A, 0xEF, 0x2E, 0x01, 0xF8, 0x0A, 0xF0,
+  0x2E, 0x01, 0xF8, 0x0A, 0xEF, 0x2E, 0x01, 0xF8, 0x0A, 0xF0, 0x2E, 0x19, 0xF8, 0x0A, 0xB7, 0x17,
+  0xE8, 0x07, 0xF4, 0x03, 0x3C, 0x88, 0x0E, 0xA0, 0x1F, 0xD0, 0x0F, 0xD0, 0x0F, 0x24, 0xD0, 0x0F,
+  0xBF, 0x3E, 0x14, 0xC4, 0x13, 0xA0, 0x1F, 0xE8, 0x07, 0x19, 0xDC, 0x0B, 0xEF, 0x2E, 0xB8, 0x17,
+  0xDC, 0x0B, 0x19, 0xAC, 0x1B, 0xB8, 0x17, 0xE8, 0x07, 0xF4, 0x03, 0x01, 0x88, 0x0E, 0xB8, 0x17,
+  0x39, 0xA4, 0x0D, 0xF0, 0x2E, 0xB8, 0x17, 0xB8, 0x17, 0x59, 0xA0, 0x1F, 0xB7, 0x17, 0xE8, 0x07,
+  0xF4, 0x03, 0x03, 0x01, 0x88, 0x0E, 0xB7, 0x17,
+};
+
+// Roller Coaster as a step track: 1320 + 1328 + 220 steps, 15487 + 15503 + 15039 queue entries, 9816 bytes
+static const uint8_t TRACK_0[] PROGMEM = {
+  0x53, 0x54, 0x02, 0x01, 0x00, 0x61, 0x11, 0x81, 0x11, 0x6B, 0x03, 0x00, 0xD9, 0xE1, 0x3D, 0x01,
+  0xC0, 0x98, 0x4E, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04, 0x01,
+  0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80,
+  0x00, 0xEE, 0xD8, 0x92, 0x07, 0x01, 0xB9, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE,
+  0x09, 0x01, 0xCF, 0x96, 0x04, 0x01, 0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB,
+  0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80, 0x00, 0xEE, 0xD8, 0x92, 0x07, 0x01, 0xB9, 0xD5, 0x16, 0x01,
+  0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xC5, 0xF8, 0x05, 0x01, 0xC6, 0x7B, 0x01, 0x84,
+  0xC5, 0x06, 0x01, 0xD2, 0xAE, 0x0B, 0x01, 0xF0, 0xBB, 0x1D, 0x01, 0xCA, 0x83, 0x0D, 0x80, 0x00,
+  0xB6, 0xAC, 0xFF, 0x06, 0x01, 0xB7, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09,
+  0x01, 0xCF, 0x96, 0x04, 0x01, 0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D,
+  0x01, 0xCE, 0x83, 0x0D, 0x80, 0x00, 0xEE, 0xD8, 0x92, 0x07, 0x01, 0xB9, 0xD5, 0x16, 0x01, 0xAD,
+  0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04, 0x01, 0xD6, 0xDE, 0x05, 0x01, 0xD0,
+  0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80, 0x00, 0xEE, 0xD8, 0x92, 0x07,
+  0x01, 0xB9, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xC5, 0xF8, 0x05,
+  0x01, 0xC6, 0x7B, 0x01, 0x84, 0xC5, 0x06, 0x01, 0xD2, 0xAE, 0x0B, 0x01, 0xF0, 0xBB, 0x1D, 0x01,
+  0xCA, 0x83, 0x0D, 0x80, 0x00, 0xB6, 0xAC, 0xFF, 0x06, 0x01, 0xB7, 0xD5, 0x16, 0x01, 0xAD, 0xE2,
+  0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04, 0x01, 0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE,
+  0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80, 0x00, 0xEE, 0xD8, 0x92, 0x07, 0x01,
+  0xB9, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04, 0x01,
+  0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80,
+  0x00, 0xEE, 0xD8, 0x92, 0x07, 0x01, 0xB9, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE,
+  0x09, 0x01, 0xC5, 0xF8, 0x05, 0x01, 0xC6, 0x7B, 0x01, 0x84, 0xC5, 0x06, 0x01, 0xD2, 0xAE, 0x0B,
+  0x01, 0xF0, 0xBB, 0x1D, 0x01, 0xCA, 0x83, 0x0D, 0x80, 0x00, 0xB6, 0xAC, 0xFF, 0x06, 0x01, 0xB7,
+  0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04, 0x01, 0xD6,
+  0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80, 0x00,
+  0xF2, 0xAA, 0xD5, 0x0E, 0x81, 0xB3, 0xA5, 0x28, 0x81, 0xB7, 0xD1, 0x11, 0x81, 0x9B, 0xDE, 0x07,
+  0x81, 0x9D, 0xD1, 0x04, 0x81, 0xDD, 0x96, 0x03, 0x81, 0xA5, 0xAD, 0x02, 0x81, 0xE9, 0xEA, 0x01,
+  0x81, 0xD9, 0xBD, 0x01, 0x81, 0xB1, 0x9D, 0x01, 0x81, 0xAB, 0x85, 0x01, 0x81, 0xED, 0x72, 0x81,
+  0xA3, 0x64, 0x81, 0xC7, 0x58, 0x81, 0xF9, 0x4E, 0x81, 0xF9, 0x46, 0x81, 0x9D, 0x40, 0x81, 0xC1,
+  0x3A, 0x81, 0xC9, 0x35, 0x81, 0xAB, 0x31, 0x81, 0xC7, 0x2D, 0x81, 0xC5, 0x1B, 0x81, 0xB0, 0x24,
+  0x81, 0xA6, 0x2E, 0x81, 0x92, 0x32, 0x81, 0xC0, 0x36, 0x81, 0xCC, 0x3B, 0x81, 0xC0, 0x41, 0x81,
+  0xB8, 0x48, 0x81, 0xDC, 0x50, 0x81, 0xDE, 0x5A, 0x81, 0xF6, 0x66, 0x81, 0x9C, 0x76, 0x81, 0xD0,
+  0x89, 0x01, 0x81, 0x8E, 0xA3, 0x01, 0x81, 0xBE, 0xC5, 0x01, 0x81, 0x82, 0xF6, 0x01, 0x81, 0xBC,
+  0xBE, 0x02, 0x81, 0xB0, 0xB3, 0x03, 0x81, 0xB0, 0x88, 0x05, 0x81, 0xE0, 0xE6, 0x08, 0x81, 0xD8,
+  0xE9, 0x16, 0x81, 0xDA, 0x8B, 0x0A, 0x80, 0x00, 0xEB, 0xCA, 0xD7, 0x09, 0x81, 0xB9, 0xC7, 0x11,
+  0x81, 0xB7, 0xD1, 0x11, 0x81, 0x9B, 0xDE, 0x07, 0x81, 0x9D, 0xD1, 0x04, 0x81, 0xDD, 0x96, 0x03,
+  0x81, 0xA5, 0xAD, 0x02, 0x81, 0xE9, 0xEA, 0x01, 0x81, 0xD9, 0xBD, 0x01, 0x81, 0xB1, 0x9D, 0x01,
+  0x81, 0xAB, 0x85, 0x01, 0x81, 0xED, 0x72, 0x81, 0xA3, 0x64, 0x81, 0xC7, 0x58, 0x81, 0xF9, 0x4E,
+  0x81, 0xF9, 0x46, 0x81, 0x9D, 0x40, 0x81, 0xC1, 0x3A, 0x81, 0xC9, 0x35, 0x81, 0xAB, 0x31, 0x81,
+  0x91, 0x2D, 0x81, 0xB4, 0x08, 0x81, 0xA6, 0x2E, 0x81, 0x90, 0x32, 0x81, 0xC2, 0x36, 0x81, 0xCC,
+  0x3B, 0x81, 0xC0, 0x41, 0x81, 0xB8, 0x48, 0x81, 0xDE, 0x50, 0x81, 0xDA, 0x5A, 0x81, 0xF8, 0x66,
+  0x81, 0x9C, 0x76, 0x81, 0xD2, 0x89, 0x01, 0x81, 0x8A, 0xA3, 0x01, 0x81, 0xC0, 0xC5, 0x01, 0x81,
+  0x84, 0xF6, 0x01, 0x81, 0xB8, 0xBE, 0x02, 0x81, 0xB2, 0xB3, 0x03, 0x81, 0xB2, 0x88, 0x05, 0x81,
+  0xDE, 0xE6, 0x08, 0x81, 0xD6, 0xE9, 0x16, 0x81, 0xDC, 0x8B, 0x0A, 0x80, 0x00, 0xF3, 0xAA, 0xEB,
+  0x08, 0x81, 0xFF, 0xE3, 0x32, 0x81, 0xFF, 0xE7, 0x07, 0x81, 0x81, 0xF4, 0x03, 0x81, 0xFD, 0xF3,
+  0x03, 0x81, 0x00, 0x81, 0x02, 0x81, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81,
+  0x00, 0x81, 0x00, 0x81, 0x02, 0x81, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81,
+  0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x02, 0x81,
+  0xFE, 0xF3, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x83, 0xFF, 0xF3, 0x03, 0x81,
+  0xFE, 0xF3, 0x03, 0x84, 0xFD, 0xF3, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x87, 0x81, 0xF4, 0x03, 0x81,
+  0xFE, 0xF3, 0x03, 0x85, 0xFD, 0xF3, 0x03, 0x81, 0x02, 0x82, 0x01, 0x81, 0x80, 0xF4, 0x03, 0x84,
+  0xFF, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x83, 0xFD, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81,
+  0xFD, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x82, 0xFF, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x81,
+  0x02, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4,
+  0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x80, 0xF4,
+  0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81,
+  0x80, 0xE8, 0x07, 0x81, 0x80, 0xE8, 0x20, 0x80, 0x00, 0xFB, 0xFB, 0xB4, 0x1C, 0x01, 0xB5, 0x95,
+  0x2E, 0x01, 0x96, 0x1B, 0x01, 0xBF, 0x1A, 0x01, 0xC0, 0x5A, 0x01, 0xAE, 0x70, 0x01, 0xAA, 0x56,
+  0x01, 0xB8, 0xA6, 0x01, 0x01, 0xDA, 0xA0, 0x03, 0x01, 0xA8, 0xD1, 0x03, 0x01, 0xC8, 0xDF, 0x03,
+  0x01, 0xAC, 0xBD, 0x04, 0x01, 0x93, 0x42, 0x01, 0xC3, 0x91, 0x04, 0x01, 0xFF, 0xA5, 0x04, 0x01,
+  0xBD, 0xA0, 0x03, 0x01, 0x8B, 0xBA, 0x02, 0x01, 0x8B, 0x9A, 0x02, 0x01, 0x9D, 0x6C, 0x01, 0xC9,
+  0x63, 0x01, 0x83, 0xB1, 0x01, 0x01, 0xBC, 0x1D, 0x01, 0x8D, 0x0A, 0x01, 0xA2, 0x29, 0x01, 0xC2,
+  0x2C, 0x01, 0xEB, 0x3D, 0x01, 0xCA, 0x66, 0x01, 0xBC, 0x35, 0x01, 0xCA, 0x3A, 0x01, 0xC8, 0x40,
+  0x01, 0xB6, 0x88, 0x01, 0x01, 0x8E, 0x99, 0x01, 0x01, 0xA8, 0x67, 0x01, 0xCA, 0x8C, 0x02, 0x01,
+  0xC8, 0x9D, 0x01, 0x01, 0xC2, 0x93, 0x02, 0x01, 0x86, 0xFA, 0x01, 0x01, 0xB0, 0xAB, 0x03, 0x01,
+  0x9E, 0xD8, 0x03, 0x01, 0x92, 0xB0, 0x03, 0x01, 0xCA, 0x8A, 0x0A, 0x01, 0xAC, 0xDC, 0x15, 0x01,
+  0xDA, 0x8B, 0x0A, 0x80, 0x00, 0xEB, 0xCA, 0xD7, 0x09, 0x01, 0xB9, 0xC7, 0x11, 0x01, 0xB7, 0xD1,
+  0x11, 0x01, 0x9B, 0xDE, 0x07, 0x01, 0x9D, 0xD1, 0x04, 0x01, 0xDD, 0x96, 0x03, 0x01, 0xA5, 0xAD,
+  0x02, 0x01, 0xE9, 0xEA, 0x01, 0x01, 0xD9, 0xBD, 0x01, 0x01, 0xB1, 0x9D, 0x01, 0x01, 0xAB, 0x85,
+  0x01, 0x01, 0xED, 0x72, 0x01, 0xA3, 0x64, 0x01, 0xC7, 0x58, 0x01, 0xF9, 0x4E, 0x01, 0xF9, 0x46,
+  0x01, 0x9D, 0x40, 0x01, 0xC1, 0x3A, 0x01, 0xC9, 0x35, 0x01, 0xAB, 0x31, 0x01, 0x91, 0x2D, 0x01,
+  0xB4, 0x08, 0x01, 0xA6, 0x2E, 0x01, 0x90, 0x32, 0x01, 0xC2, 0x36, 0x01, 0xCC, 0x3B, 0x01, 0xC0,
+  0x41, 0x01, 0xB8, 0x48, 0x01, 0xDE, 0x50, 0x01, 0xDA, 0x5A, 0x01, 0xF8, 0x66, 0x01, 0x9C, 0x76,
+  0x01, 0xD2, 0x89, 0x01, 0x01, 0x8A, 0xA3, 0x01, 0x01, 0xC0, 0xC5, 0x01, 0x01, 0x84, 0xF6, 0x01,
+  0x01, 0xB8, 0xBE, 0x02, 0x01, 0xB2, 0xB3, 0x03, 0x01, 0xB2, 0x88, 0x05, 0x01, 0xDE, 0xE6, 0x08,
+  0x01, 0xD6, 0xE9, 0x16, 0x01, 0xDC, 0x8B, 0x0A, 0x80, 0x00, 0xB7, 0x9A, 0x80, 0x05, 0x01, 0x87,
+  0x94, 0x2B, 0x01, 0xAB, 0x97, 0x0A, 0x01, 0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02, 0x01, 0xE7,
+  0xEA, 0x01, 0x01, 0xFB, 0xAD, 0x01, 0x01, 0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01, 0xEF, 0x5A,
+  0x01, 0xFD, 0x4C, 0x01, 0xA9, 0x42, 0x01, 0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB, 0x2D, 0x01,
+  0xF9, 0x28, 0x01, 0x89, 0x25, 0x01, 0xE5, 0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C, 0x01, 0x89,
+  0x1A, 0x01, 0xEC, 0x04, 0x01, 0xE0, 0x1A, 0x01, 0xF8, 0x1C, 0x01, 0xBC, 0x1F, 0x01, 0xB4, 0x22,
+  0x01, 0xE8, 0x25, 0x01, 0xEA, 0x29, 0x01, 0xCE, 0x2E, 0x01, 0xB0, 0x34, 0x01, 0xB6, 0x3B, 0x01,
+  0xA0, 0x44, 0x01, 0xBC, 0x4F, 0x01, 0x96, 0x5E, 0x01, 0x80, 0x72, 0x01, 0x88, 0x8E, 0x01, 0x01,
+  0xEC, 0xB7, 0x01, 0x01, 0xB2, 0xFB, 0x01, 0x01, 0xA8, 0xF6, 0x02, 0x01, 0xC6, 0x8A, 0x05, 0x01,
+  0xEA, 0x96, 0x0D, 0x01, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xC6, 0xF3, 0xAF, 0x08, 0x81, 0xC7, 0x91,
+  0x0A, 0x81, 0xAB, 0x97, 0x0A, 0x81, 0xD7, 0xBB, 0x04, 0x81, 0xC1, 0xD6, 0x02, 0x81, 0xE7, 0xEA,
+  0x01, 0x81, 0xFB, 0xAD, 0x01, 0x81, 0xC9, 0x87, 0x01, 0x81, 0xC1, 0x6D, 0x81, 0xEF, 0x5A, 0x81,
+  0xFD, 0x4C, 0x81, 0xA9, 0x42, 0x81, 0xEF, 0x39, 0x81, 0x91, 0x33, 0x81, 0xCB, 0x2D, 0x81, 0xF9,
+  0x28, 0x81, 0x89, 0x25, 0x81, 0xE5, 0x21, 0x81, 0xF7, 0x1E, 0x81, 0xBB, 0x1C, 0x81, 0xA9, 0x1A,
+  0x81, 0xB5, 0x18, 0x81, 0xE1, 0x16, 0x81, 0x9D, 0x15, 0x81, 0xF5, 0x13, 0x81, 0xDB, 0x12, 0x81,
+  0xCF, 0x11, 0x81, 0xD1, 0x10, 0x81, 0xDF, 0x0F, 0x81, 0xF5, 0x0E, 0x81, 0x97, 0x0E, 0x81, 0xBD,
+  0x0D, 0x81, 0xEB, 0x0C, 0x81, 0xA1, 0x0C, 0x81, 0xDB, 0x0B, 0x81, 0x9B, 0x0B, 0x81, 0xDF, 0x0A,
+  0x81, 0xA7, 0x0A, 0x81, 0xF1, 0x09, 0x81, 0xC1, 0x09, 0x81, 0x95, 0x09, 0x81, 0xD7, 0x05, 0x81,
+  0xC0, 0x07, 0x81, 0x9C, 0x09, 0x81, 0xCC, 0x09, 0x81, 0x80, 0x0A, 0x81, 0xB0, 0x0A, 0x81, 0xEC,
+  0x0A, 0x81, 0xA8, 0x0B, 0x81, 0xEA, 0x0B, 0x81, 0xB0, 0x0C, 0x81, 0xFE, 0x0C, 0x81, 0xCE, 0x0D,
+  0x81, 0xAA, 0x0E, 0x81, 0x8C, 0x0F, 0x81, 0xF4, 0x0F, 0x81, 0xEA, 0x10, 0x81, 0xEC, 0x11, 0x81,
+  0xF8, 0x12, 0x81, 0x98, 0x14, 0x81, 0xC4, 0x15, 0x81, 0x88, 0x17, 0x81, 0xE6, 0x18, 0x81, 0xDE,
+  0x1A, 0x81, 0xF6, 0x1C, 0x81, 0xC0, 0x1F, 0x81, 0xB2, 0x22, 0x81, 0xE8, 0x25, 0x81, 0xEA, 0x29,
+  0x81, 0xCE, 0x2E, 0x81, 0xAE, 0x34, 0x81, 0xBA, 0x3B, 0x81, 0x9E, 0x44, 0x81, 0xBC, 0x4F, 0x81,
+  0x94, 0x5E, 0x81, 0x84, 0x72, 0x81, 0x86, 0x8E, 0x01, 0x81, 0xEC, 0xB7, 0x01, 0x81, 0xB0, 0xFB,
+  0x01, 0x81, 0xAC, 0xF6, 0x02, 0x81, 0xC4, 0x8A, 0x05, 0x81, 0xEA, 0x96, 0x0D, 0x81, 0xE2, 0xE9,
+  0x05, 0x80, 0x00, 0xA3, 0x93, 0xAA, 0x07, 0x01, 0xC7, 0x91, 0x0A, 0x01, 0xAB, 0x97, 0x0A, 0x01,
+  0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02, 0x01, 0xE7, 0xEA, 0x01, 0x01, 0xFB, 0xAD, 0x01, 0x01,
+  0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01, 0xEF, 0x5A, 0x01, 0xFD, 0x4C, 0x01, 0xA9, 0x42, 0x01,
+  0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB, 0x2D, 0x01, 0xF9, 0x28, 0x01, 0x89, 0x25, 0x01, 0xE5,
+  0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C, 0x01, 0xA9, 0x1A, 0x01, 0xB5, 0x18, 0x01, 0xE1, 0x16,
+  0x01, 0x9D, 0x15, 0x01, 0xF5, 0x13, 0x01, 0xDB, 0x12, 0x01, 0xCF, 0x11, 0x01, 0xD1, 0x10, 0x01,
+  0xDF, 0x0F, 0x01, 0xF5, 0x0E, 0x01, 0x97, 0x0E, 0x01, 0xBD, 0x0D, 0x01, 0xEB, 0x0C, 0x01, 0xA1,
+  0x0C, 0x01, 0xDB, 0x0B, 0x01, 0x9B, 0x0B, 0x01, 0xDF, 0x0A, 0x01, 0xA7, 0x0A, 0x01, 0xF1, 0x09,
+  0x01, 0xC1, 0x09, 0x01, 0x95, 0x09, 0x01, 0xD7, 0x05, 0x01, 0xC0, 0x07, 0x01, 0x9C, 0x09, 0x01,
+  0xCC, 0x09, 0x01, 0x80, 0x0A, 0x01, 0xB0, 0x0A, 0x01, 0xEC, 0x0A, 0x01, 0xA8, 0x0B, 0x01, 0xEA,
+  0x0B, 0x01, 0xB0, 0x0C, 0x01, 0xFE, 0x0C, 0x01, 0xCE, 0x0D, 0x01, 0xAA, 0x0E, 0x01, 0x8C, 0x0F,
+  0x01, 0xF4, 0x0F, 0x01, 0xEA, 0x10, 0x01, 0xEC, 0x11, 0x01, 0xF8, 0x12, 0x01, 0x98, 0x14, 0x01,
+  0xC4, 0x15, 0x01, 0x88, 0x17, 0x01, 0xE6, 0x18, 0x01, 0xDE, 0x1A, 0x01, 0xF6, 0x1C, 0x01, 0xC0,
+  0x1F, 0x01, 0xB2, 0x22, 0x01, 0xE8, 0x25, 0x01, 0xEA, 0x29, 0x01, 0xCE, 0x2E, 0x01, 0xAE, 0x34,
+  0x01, 0xBA, 0x3B, 0x01, 0x9E, 0x44, 0x01, 0xBC, 0x4F, 0x01, 0x94, 0x5E, 0x01, 0x84, 0x72, 0x01,
+  0x86, 0x8E, 0x01, 0x01, 0xEC, 0xB7, 0x01, 0x01, 0xB0, 0xFB, 0x01, 0x01, 0xAC, 0xF6, 0x02, 0x01,
+  0xC4, 0x8A, 0x05, 0x01, 0xEA, 0x96, 0x0D, 0x01, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xA3, 0x93, 0xAA,
+  0x07, 0x81, 0xC7, 0x91, 0x0A, 0x81, 0xAB, 0x97, 0x0A, 0x81, 0xD7, 0xBB, 0x04, 0x81, 0xC1, 0xD6,
+  0x02, 0x81, 0xE7, 0xEA, 0x01, 0x81, 0xFB, 0xAD, 0x01, 0x81, 0xC9, 0x87, 0x01, 0x81, 0xC1, 0x6D,
+  0x81, 0xEF, 0x5A, 0x81, 0xFD, 0x4C, 0x81, 0xA9, 0x42, 0x81, 0xEF, 0x39, 0x81, 0x91, 0x33, 0x81,
+  0xCB, 0x2D, 0x81, 0xF9, 0x28, 0x81, 0x89, 0x25, 0x81, 0xE5, 0x21, 0x81, 0xF7, 0x1E, 0x81, 0xBB,
+  0x1C, 0x81, 0xA9, 0x1A, 0x81, 0xB5, 0x18, 0x81, 0xE1, 0x16, 0x81, 0x9D, 0x15, 0x81, 0xF5, 0x13,
+  0x81, 0xDB, 0x12, 0x81, 0xCF, 0x11, 0x81, 0xD1, 0x10, 0x81, 0xDF, 0x0F, 0x81, 0xF5, 0x0E, 0x81,
+  0x97, 0x0E, 0x81, 0xBD, 0x0D, 0x81, 0xEB, 0x0C, 0x81, 0xA1, 0x0C, 0x81, 0xDB, 0x0B, 0x81, 0x9B,
+  0x0B, 0x81, 0xDF, 0x0A, 0x81, 0xA7, 0x0A, 0x81, 0xF1, 0x09, 0x81, 0xC1, 0x09, 0x81, 0x95, 0x09,
+  0x81, 0xD7, 0x05, 0x81, 0xC0, 0x07, 0x81, 0x9C, 0x09, 0x81, 0xCC, 0x09, 0x81, 0x80, 0x0A, 0x81,
+  0xB0, 0x0A, 0x81, 0xEC, 0x0A, 0x81, 0xA8, 0x0B, 0x81, 0xEA, 0x0B, 0x81, 0xB0, 0x0C, 0x81, 0xFE,
+  0x0C, 0x81, 0xCE, 0x0D, 0x81, 0xAA, 0x0E, 0x81, 0x8C, 0x0F, 0x81, 0xF4, 0x0F, 0x81, 0xEA, 0x10,
+  0x81, 0xEC, 0x11, 0x81, 0xF8, 0x12, 0x81, 0x98, 0x14, 0x81, 0xC4, 0x15, 0x81, 0x88, 0x17, 0x81,
+  0xE6, 0x18, 0x81, 0xDE, 0x1A, 0x81, 0xF6, 0x1C, 0x81, 0xC0, 0x1F, 0x81, 0xB2, 0x22, 0x81, 0xE8,
+  0x25, 0x81, 0xEA, 0x29, 0x81, 0xCE, 0x2E, 0x81, 0xAE, 0x34, 0x81, 0xBA, 0x3B, 0x81, 0x9E, 0x44,
+  0x81, 0xBC, 0x4F, 0x81, 0x94, 0x5E, 0x81, 0x84, 0x72, 0x81, 0x86, 0x8E, 0x01, 0x81, 0xEC, 0xB7,
+  0x01, 0x81, 0xB0, 0xFB, 0x01, 0x81, 0xAC, 0xF6, 0x02, 0x81, 0xC4, 0x8A, 0x05, 0x81, 0xEA, 0x96,
+  0x0D, 0x81, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xA3, 0x93, 0xAA, 0x07, 0x01, 0xC7, 0x91, 0x0A, 0x01,
+  0xAB, 0x97, 0x0A, 0x01, 0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02, 0x01, 0xE7, 0xEA, 0x01, 0x01,
+  0xFB, 0xAD, 0x01, 0x01, 0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01, 0xEF, 0x5A, 0x01, 0xFD, 0x4C,
+  0x01, 0xA9, 0x42, 0x01, 0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB, 0x2D, 0x01, 0xF9, 0x28, 0x01,
+  0x89, 0x25, 0x01, 0xE5, 0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C, 0x01, 0xA9, 0x1A, 0x01, 0xB5,
+  0x18, 0x01, 0xE1, 0x16, 0x01, 0x9D, 0x15, 0x01, 0xF5, 0x13, 0x01, 0xDB, 0x12, 0x01, 0xCF, 0x11,
+  0x01, 0xD1, 0x10, 0x01, 0xDF, 0x0F, 0x01, 0xF5, 0x0E, 0x01, 0x97, 0x0E, 0x01, 0xBD, 0x0D, 0x01,
+  0xEB, 0x0C, 0x01, 0xA1, 0x0C, 0x01, 0xDB, 0x0B, 0x01, 0x9B, 0x0B, 0x01, 0xDF, 0x0A, 0x01, 0xA7,
+  0x0A, 0x01, 0xF1, 0x09, 0x01, 0xC1, 0x09, 0x01, 0x95, 0x09, 0x01, 0xD7, 0x05, 0x01, 0xC0, 0x07,
+  0x01, 0x9C, 0x09, 0x01, 0xCC, 0x09, 0x01, 0x80, 0x0A, 0x01, 0xB0, 0x0A, 0x01, 0xEC, 0x0A, 0x01,
+  0xA8, 0x0B, 0x01, 0xEA, 0x0B, 0x01, 0xB0, 0x0C, 0x01, 0xFE, 0x0C, 0x01, 0xCE, 0x0D, 0x01, 0xAA,
+  0x0E, 0x01, 0x8C, 0x0F, 0x01, 0xF4, 0x0F, 0x01, 0xEA, 0x10, 0x01, 0xEC, 0x11, 0x01, 0xF8, 0x12,
+  0x01, 0x98, 0x14, 0x01, 0xC4, 0x15, 0x01, 0x88, 0x17, 0x01, 0xE6, 0x18, 0x01, 0xDE, 0x1A, 0x01,
+  0xF6, 0x1C, 0x01, 0xC0, 0x1F, 0x01, 0xB2, 0x22, 0x01, 0xE8, 0x25, 0x01, 0xEA, 0x29, 0x01, 0xCE,
+  0x2E, 0x01, 0xAE, 0x34, 0x01, 0xBA, 0x3B, 0x01, 0x9E, 0x44, 0x01, 0xBC, 0x4F, 0x01, 0x94, 0x5E,
+  0x01, 0x84, 0x72, 0x01, 0x86, 0x8E, 0x01, 0x01, 0xEC, 0xB7, 0x01, 0x01, 0xB0, 0xFB, 0x01, 0x01,
+  0xAC, 0xF6, 0x02, 0x01, 0xC4, 0x8A, 0x05, 0x01, 0xEA, 0x96, 0x0D, 0x01, 0xE2, 0xE9, 0x05, 0x80,
+  0x00, 0xA3, 0x93, 0xAA, 0x07, 0x81, 0xC7, 0x91, 0x0A, 0x81, 0xAB, 0x97, 0x0A, 0x81, 0xD7, 0xBB,
+  0x04, 0x81, 0xC1, 0xD6, 0x02, 0x81, 0xE7, 0xEA, 0x01, 0x81, 0xFB, 0xAD, 0x01, 0x81, 0xC9, 0x87,
+  0x01, 0x81, 0xC1, 0x6D, 0x81, 0xEF, 0x5A, 0x81, 0xFD, 0x4C, 0x81, 0xA9, 0x42, 0x81, 0xEF, 0x39,
+  0x81, 0x91, 0x33, 0x81, 0xCB, 0x2D, 0x81, 0xF9, 0x28, 0x81, 0x89, 0x25, 0x81, 0xE5, 0x21, 0x81,
+  0xF7, 0x1E, 0x81, 0xBB, 0x1C, 0x81, 0xA9, 0x1A, 0x81, 0xB5, 0x18, 0x81, 0xE1, 0x16, 0x81, 0x9D,
+  0x15, 0x81, 0xF5, 0x13, 0x81, 0xDB, 0x12, 0x81, 0xCF, 0x11, 0x81, 0xD1, 0x10, 0x81, 0xDF, 0x0F,
+  0x81, 0xF5, 0x0E, 0x81, 0x97, 0x0E, 0x81, 0xBD, 0x0D, 0x81, 0xEB, 0x0C, 0x81, 0xA1, 0x0C, 0x81,
+  0xDB, 0x0B, 0x81, 0x9B, 0x0B, 0x81, 0xDF, 0x0A, 0x81, 0xA7, 0x0A, 0x81, 0xF1, 0x09, 0x81, 0xC1,
+  0x09, 0x81, 0x95, 0x09, 0x81, 0xD7, 0x05, 0x81, 0xC0, 0x07, 0x81, 0x9C, 0x09, 0x81, 0xCC, 0x09,
+  0x81, 0x80, 0x0A, 0x81, 0xB0, 0x0A, 0x81, 0xEC, 0x0A, 0x81, 0xA8, 0x0B, 0x81, 0xEA, 0x0B, 0x81,
+  0xB0, 0x0C, 0x81, 0xFE, 0x0C, 0x81, 0xCE, 0x0D, 0x81, 0xAA, 0x0E, 0x81, 0x8C, 0x0F, 0x81, 0xF4,
+  0x0F, 0x81, 0xEA, 0x10, 0x81, 0xEC, 0x11, 0x81, 0xF8, 0x12, 0x81, 0x98, 0x14, 0x81, 0xC4, 0x15,
+  0x81, 0x88, 0x17, 0x81, 0xE6, 0x18, 0x81, 0xDE, 0x1A, 0x81, 0xF6, 0x1C, 0x81, 0xC0, 0x1F, 0x81,
+  0xB2, 0x22, 0x81, 0xE8, 0x25, 0x81, 0xEA, 0x29, 0x81, 0xCE, 0x2E, 0x81, 0xAE, 0x34, 0x81, 0xBA,
+  0x3B, 0x81, 0x9E, 0x44, 0x81, 0xBC, 0x4F, 0x81, 0x94, 0x5E, 0x81, 0x84, 0x72, 0x81, 0x86, 0x8E,
+  0x01, 0x81, 0xEC, 0xB7, 0x01, 0x81, 0xB0, 0xFB, 0x01, 0x81, 0xAC, 0xF6, 0x02, 0x81, 0xC4, 0x8A,
+  0x05, 0x81, 0xEA, 0x96, 0x0D, 0x81, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xA3, 0x93, 0xAA, 0x07, 0x01,
+  0xC7, 0x91, 0x0A, 0x01, 0xAB, 0x97, 0x0A, 0x01, 0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02, 0x01,
+  0xE7, 0xEA, 0x01, 0x01, 0xFB, 0xAD, 0x01, 0x01, 0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01, 0xEF,
+  0x5A, 0x01, 0xFD, 0x4C, 0x01, 0xA9, 0x42, 0x01, 0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB, 0x2D,
+  0x01, 0xF9, 0x28, 0x01, 0x89, 0x25, 0x01, 0xE5, 0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C, 0x01,
+  0xA9, 0x1A, 0x01, 0xB5, 0x18, 0x01, 0xE1, 0x16, 0x01, 0x9D, 0x15, 0x01, 0xF5, 0x13, 0x01, 0xDB,
+  0x12, 0x01, 0xCF, 0x11, 0x01, 0xD1, 0x10, 0x01, 0xDF, 0x0F, 0x01, 0xF5, 0x0E, 0x01, 0x97, 0x0E,
+  0x01, 0xBD, 0x0D, 0x01, 0xEB, 0x0C, 0x01, 0xA1, 0x0C, 0x01, 0xDB, 0x0B, 0x01, 0x9B, 0x0B, 0x01,
+  0xDF, 0x0A, 0x01, 0xA7, 0x0A, 0x01, 0xF1, 0x09, 0x01, 0xC1, 0x09, 0x01, 0x95, 0x09, 0x01, 0xD7,
+  0x05, 0x01, 0xC0, 0x07, 0x01, 0x9C, 0x09, 0x01, 0xCC, 0x09, 0x01, 0x80, 0x0A, 0x01, 0xB0, 0x0A,
+  0x01, 0xEC, 0x0A, 0x01, 0xA8, 0x0B, 0x01, 0xEA, 0x0B, 0x01, 0xB0, 0x0C, 0x01, 0xFE, 0x0C, 0x01,
+  0xCE, 0x0D, 0x01, 0xAA, 0x0E, 0x01, 0x8C, 0x0F, 0x01, 0xF4, 0x0F, 0x01, 0xEA, 0x10, 0x01, 0xEC,
+  0x11, 0x01, 0xF8, 0x12, 0x01, 0x98, 0x14, 0x01, 0xC4, 0x15, 0x01, 0x88, 0x17, 0x01, 0xE6, 0x18,
+  0x01, 0xDE, 0x1A, 0x01, 0xF6, 0x1C, 0x01, 0xC0, 0x1F, 0x01, 0xB2, 0x22, 0x01, 0xE8, 0x25, 0x01,
+  0xEA, 0x29, 0x01, 0xCE, 0x2E, 0x01, 0xAE, 0x34, 0x01, 0xBA, 0x3B, 0x01, 0x9E, 0x44, 0x01, 0xBC,
+  0x4F, 0x01, 0x94, 0x5E, 0x01, 0x84, 0x72, 0x01, 0x86, 0x8E, 0x01, 0x01, 0xEC, 0xB7, 0x01, 0x01,
+  0xB0, 0xFB, 0x01, 0x01, 0xAC, 0xF6, 0x02, 0x01, 0xC4, 0x8A, 0x05, 0x01, 0xEA, 0x96, 0x0D, 0x01,
+  0xE2, 0xE9, 0x05, 0x80, 0x00, 0xA3, 0x93, 0xAA, 0x07, 0x81, 0xC7, 0x91, 0x0A, 0x81, 0xAB, 0x97,
+  0x0A, 0x81, 0xD7, 0xBB, 0x04, 0x81, 0xC1, 0xD6, 0x02, 0x81, 0xE7, 0xEA, 0x01, 0x81, 0xFB, 0xAD,
+  0x01, 0x81, 0xC9, 0x87, 0x01, 0x81, 0xC1, 0x6D, 0x81, 0xEF, 0x5A, 0x81, 0xFD, 0x4C, 0x81, 0xA9,
+  0x42, 0x81, 0xEF, 0x39, 0x81, 0x91, 0x33, 0x81, 0xCB, 0x2D, 0x81, 0xF9, 0x28, 0x81, 0x89, 0x25,
+  0x81, 0xE5, 0x21, 0x81, 0xF7, 0x1E, 0x81, 0xBB, 0x1C, 0x81, 0xA9, 0x1A, 0x81, 0xB5, 0x18, 0x81,
+  0xE1, 0x16, 0x81, 0x9D, 0x15, 0x81, 0xF5, 0x13, 0x81, 0xDB, 0x12, 0x81, 0xCF, 0x11, 0x81, 0xD1,
+  0x10, 0x81, 0xDF, 0x0F, 0x81, 0xF5, 0x0E, 0x81, 0x97, 0x0E, 0x81, 0xBD, 0x0D, 0x81, 0xEB, 0x0C,
+  0x81, 0xA1, 0x0C, 0x81, 0xDB, 0x0B, 0x81, 0x9B, 0x0B, 0x81, 0xDF, 0x0A, 0x81, 0xA7, 0x0A, 0x81,
+  0xF1, 0x09, 0x81, 0xC1, 0x09, 0x81, 0x95, 0x09, 0x81, 0xD7, 0x05, 0x81, 0xC0, 0x07, 0x81, 0x9C,
+  0x09, 0x81, 0xCC, 0x09, 0x81, 0x80, 0x0A, 0x81, 0xB0, 0x0A, 0x81, 0xEC, 0x0A, 0x81, 0xA8, 0x0B,
+  0x81, 0xEA, 0x0B, 0x81, 0xB0, 0x0C, 0x81, 0xFE, 0x0C, 0x81, 0xCE, 0x0D, 0x81, 0xAA, 0x0E, 0x81,
+  0x8C, 0x0F, 0x81, 0xF4, 0x0F, 0x81, 0xEA, 0x10, 0x81, 0xEC, 0x11, 0x81, 0xF8, 0x12, 0x81, 0x98,
+  0x14, 0x81, 0xC4, 0x15, 0x81, 0x88, 0x17, 0x81, 0xE6, 0x18, 0x81, 0xDE, 0x1A, 0x81, 0xF6, 0x1C,
+  0x81, 0xC0, 0x1F, 0x81, 0xB2, 0x22, 0x81, 0xE8, 0x25, 0x81, 0xEA, 0x29, 0x81, 0xCE, 0x2E, 0x81,
+  0xAE, 0x34, 0x81, 0xBA, 0x3B, 0x81, 0x9E, 0x44, 0x81, 0xBC, 0x4F, 0x81, 0x94, 0x5E, 0x81, 0x84,
+  0x72, 0x81, 0x86, 0x8E, 0x01, 0x81, 0xEC, 0xB7, 0x01, 0x81, 0xB0, 0xFB, 0x01, 0x81, 0xAC, 0xF6,
+  0x02, 0x81, 0xC4, 0x8A, 0x05, 0x81, 0xEA, 0x96, 0x0D, 0x81, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xBB,
+  0xAF, 0xBE, 0x07, 0x01, 0x86, 0xBB, 0x0F, 0x01, 0xB7, 0xD1, 0x11, 0x01, 0x9B, 0xDE, 0x07, 0x01,
+  0x9D, 0xD1, 0x04, 0x01, 0xDD, 0x96, 0x03, 0x01, 0xA5, 0xAD, 0x02, 0x01, 0xE9, 0xEA, 0x01, 0x01,
+  0xD9, 0xBD, 0x01, 0x01, 0xB1, 0x9D, 0x01, 0x01, 0xAB, 0x85, 0x01, 0x01, 0xED, 0x72, 0x01, 0xA3,
+  0x64, 0x01, 0xC7, 0x58, 0x01, 0xF9, 0x4E, 0x01, 0xF9, 0x46, 0x01, 0x9D, 0x40, 0x01, 0xC1, 0x3A,
+  0x01, 0xC9, 0x35, 0x01, 0xAB, 0x31, 0x01, 0x91, 0x2D, 0x01, 0xB4, 0x08, 0x01, 0xA6, 0x2E, 0x01,
+  0x90, 0x32, 0x01, 0xC2, 0x36, 0x01, 0xCC, 0x3B, 0x01, 0xC0, 0x41, 0x01, 0xB8, 0x48, 0x01, 0xDE,
+  0x50, 0x01, 0xDA, 0x5A, 0x01, 0xF8, 0x66, 0x01, 0x9C, 0x76, 0x01, 0xD2, 0x89, 0x01, 0x01, 0x8A,
+  0xA3, 0x01, 0x01, 0xC0, 0xC5, 0x01, 0x01, 0x84, 0xF6, 0x01, 0x01, 0xB8, 0xBE, 0x02, 0x01, 0xB2,
+  0xB3, 0x03, 0x01, 0xB2, 0x88, 0x05, 0x01, 0xDE, 0xE6, 0x08, 0x01, 0xD6, 0xE9, 0x16, 0x01, 0xDC,
+  0x8B, 0x0A, 0x80, 0x00, 0xF2, 0xDA, 0x9D, 0x0C, 0x80, 0x00, 0x80, 0xF8, 0xA5, 0x10, 0x80, 0x00,
+  0x9A, 0xBA, 0xDF, 0x12, 0x80, 0x00, 0xAB, 0xB5, 0x8A, 0x08, 0x01, 0x87, 0x94, 0x2B, 0x01, 0xAB,
+  0x97, 0x0A, 0x01, 0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02, 0x01, 0xE7, 0xEA, 0x01, 0x01, 0xFB,
+  0xAD, 0x01, 0x01, 0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01, 0xEF, 0x5A, 0x01, 0xFD, 0x4C, 0x01,
+  0xA9, 0x42, 0x01, 0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB, 0x2D, 0x01, 0xF9, 0x28, 0x01, 0x89,
+  0x25, 0x01, 0xE5, 0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C, 0x01, 0xA9, 0x1A, 0x01, 0xB5, 0x18,
+  0x01, 0xE1, 0x16, 0x01, 0x9D, 0x15, 0x01, 0xF5, 0x13, 0x01, 0xDB, 0x12, 0x01, 0xCF, 0x11, 0x01,
+  0xD1, 0x10, 0x01, 0xDF, 0x0F, 0x01, 0xF5, 0x0E, 0x01, 0x97, 0x0E, 0x01, 0xBD, 0x0D, 0x01, 0xEB,
+  0x0C, 0x01, 0xA1, 0x0C, 0x01, 0xDB, 0x0B, 0x01, 0x9B, 0x0B, 0x01, 0xDF, 0x0A, 0x01, 0xA7, 0x0A,
+  0x01, 0xF1, 0x09, 0x01, 0xC1, 0x09, 0x01, 0x95, 0x09, 0x01, 0xDD, 0x08, 0x01, 0xD4, 0x01, 0x01,
+  0xF2, 0x08, 0x01, 0x9C, 0x09, 0x01, 0xCC, 0x09, 0x01, 0x80, 0x0A, 0x01, 0xB0, 0x0A, 0x01, 0xEC,
+  0x0A, 0x01, 0xA8, 0x0B, 0x01, 0xEA, 0x0B, 0x01, 0xB0, 0x0C, 0x01, 0xFE, 0x0C, 0x01, 0xCE, 0x0D,
+  0x01, 0xAA, 0x0E, 0x01, 0x8C, 0x0F, 0x01, 0xF4, 0x0F, 0x01, 0xEA, 0x10, 0x01, 0xEC, 0x11, 0x01,
+  0xF8, 0x12, 0x01, 0x98, 0x14, 0x01, 0xC4, 0x15, 0x01, 0x88, 0x17, 0x01, 0xE6, 0x18, 0x01, 0xDE,
+  0x1A, 0x01, 0xF6, 0x1C, 0x01, 0xC0, 0x1F, 0x01, 0xB2, 0x22, 0x01, 0xE8, 0x25, 0x01, 0xEA, 0x29,
+  0x01, 0xCE, 0x2E, 0x01, 0xAE, 0x34, 0x01, 0xBA, 0x3B, 0x01, 0x9E, 0x44, 0x01, 0xBC, 0x4F, 0x01,
+  0x94, 0x5E, 0x01, 0x84, 0x72, 0x01, 0x86, 0x8E, 0x01, 0x01, 0xEC, 0xB7, 0x01, 0x01, 0xB0, 0xFB,
+  0x01, 0x01, 0xAC, 0xF6, 0x02, 0x01, 0xC4, 0x8A, 0x05, 0x01, 0xEA, 0x96, 0x0D, 0x01, 0xE2, 0xE9,
+  0x05, 0x80, 0x00, 0x90, 0xB0, 0xBE, 0x17, 0x81, 0x86, 0xBB, 0x0F, 0x81, 0xB7, 0xD1, 0x11, 0x81,
+  0x9B, 0xDE, 0x07, 0x81, 0x9D, 0xD1, 0x04, 0x81, 0xDD, 0x96, 0x03, 0x81, 0xA5, 0xAD, 0x02, 0x81,
+  0xE9, 0xEA, 0x01, 0x81, 0xD9, 0xBD, 0x01, 0x81, 0xB1, 0x9D, 0x01, 0x81, 0xAB, 0x85, 0x01, 0x81,
+  0xED, 0x72, 0x81, 0xA3, 0x64, 0x81, 0xC7, 0x58, 0x81, 0xF9, 0x4E, 0x81, 0xF9, 0x46, 0x81, 0x9D,
+  0x40, 0x81, 0xC1, 0x3A, 0x81, 0xC9, 0x35, 0x81, 0xAB, 0x31, 0x81, 0xC7, 0x2D, 0x81, 0xC5, 0x1B,
+  0x81, 0xB0, 0x24, 0x81, 0xA6, 0x2E, 0x81, 0x92, 0x32, 0x81, 0xC0, 0x36, 0x81, 0xCC, 0x3B, 0x81,
+  0xC0, 0x41, 0x81, 0xB8, 0x48, 0x81, 0xDC, 0x50, 0x81, 0xDE, 0x5A, 0x81, 0xF6, 0x66, 0x81, 0x9C,
+  0x76, 0x81, 0xD0, 0x89, 0x01, 0x81, 0x8E, 0xA3, 0x01, 0x81, 0xBE, 0xC5, 0x01, 0x81, 0x82, 0xF6,
+  0x01, 0x81, 0xBC, 0xBE, 0x02, 0x81, 0xB0, 0xB3, 0x03, 0x81, 0xB0, 0x88, 0x05, 0x81, 0xE0, 0xE6,
+  0x08, 0x81, 0xD8, 0xE9, 0x16, 0x81, 0xDA, 0x8B, 0x0A, 0x80, 0x00, 0xEB, 0xCA, 0xD7, 0x09, 0x81,
+  0xB9, 0xC7, 0x11, 0x81, 0xB7, 0xD1, 0x11, 0x81, 0x9B, 0xDE, 0x07, 0x81, 0x9D, 0xD1, 0x04, 0x81,
+  0xDD, 0x96, 0x03, 0x81, 0xA5, 0xAD, 0x02, 0x81, 0xE9, 0xEA, 0x01, 0x81, 0xD9, 0xBD, 0x01, 0x81,
+  0xB1, 0x9D, 0x01, 0x81, 0xAB, 0x85, 0x01, 0x81, 0xED, 0x72, 0x81, 0xA3, 0x64, 0x81, 0xC7, 0x58,
+  0x81, 0xF9, 0x4E, 0x81, 0xF9, 0x46, 0x81, 0x9D, 0x40, 0x81, 0xC1, 0x3A, 0x81, 0xC9, 0x35, 0x81,
+  0xAB, 0x31, 0x81, 0x91, 0x2D, 0x81, 0xB4, 0x08, 0x81, 0xA6, 0x2E, 0x81, 0x90, 0x32, 0x81, 0xC2,
+  0x36, 0x81, 0xCC, 0x3B, 0x81, 0xC0, 0x41, 0x81, 0xB8, 0x48, 0x81, 0xDE, 0x50, 0x81, 0xDA, 0x5A,
+  0x81, 0xF8, 0x66, 0x81, 0x9C, 0x76, 0x81, 0xD2, 0x89, 0x01, 0x81, 0x8A, 0xA3, 0x01, 0x81, 0xC0,
+  0xC5, 0x01, 0x81, 0x84, 0xF6, 0x01, 0x81, 0xB8, 0xBE, 0x02, 0x81, 0xB2, 0xB3, 0x03, 0x81, 0xB2,
+  0x88, 0x05, 0x81, 0xDE, 0xE6, 0x08, 0x81, 0xD6, 0xE9, 0x16, 0x81, 0xDC, 0x8B, 0x0A, 0x80, 0x00,
+  0xF3, 0xAA, 0xEB, 0x08, 0x81, 0xFF, 0xE3, 0x32, 0x81, 0xFF, 0xE7, 0x07, 0x81, 0x81, 0xF4, 0x03,
+  0x81, 0xFD, 0xF3, 0x03, 0x81, 0x00, 0x81, 0x02, 0x81, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x00,
+  0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x02, 0x81, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x80,
+  0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0xFF, 0xF3, 0x03,
+  0x81, 0x02, 0x81, 0xFE, 0xF3, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x83, 0xFF,
+  0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x84, 0xFD, 0xF3, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x87, 0x81,
+  0xF4, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x85, 0xFD, 0xF3, 0x03, 0x81, 0x02, 0x82, 0x01, 0x81, 0x80,
+  0xF4, 0x03, 0x84, 0xFF, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x83, 0xFD, 0xF3, 0x03, 0x81, 0x80,
+  0xF4, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x82, 0xFF, 0xF3, 0x03, 0x81, 0xFE,
+  0xF3, 0x03, 0x81, 0x02, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03,
+  0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
+  0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x80,
+  0xF4, 0x03, 0x81, 0x80, 0xE8, 0x07, 0x81, 0x80, 0xE8, 0x20, 0x80, 0x00, 0xFB, 0xFB, 0xB4, 0x1C,
+  0x01, 0xB5, 0x95, 0x2E, 0x01, 0x96, 0x1B, 0x01, 0xBF, 0x1A, 0x01, 0xC0, 0x5A, 0x01, 0xAE, 0x70,
+  0x01, 0xAA, 0x56, 0x01, 0xB8, 0xA6, 0x01, 0x01, 0xDA, 0xA0, 0x03, 0x01, 0xA8, 0xD1, 0x03, 0x01,
+  0xC8, 0xDF, 0x03, 0x01, 0xAC, 0xBD, 0x04, 0x01, 0x93, 0x42, 0x01, 0xC3, 0x91, 0x04, 0x01, 0xFF,
+  0xA5, 0x04, 0x01, 0xBD, 0xA0, 0x03, 0x01, 0x8B, 0xBA, 0x02, 0x01, 0x8B, 0x9A, 0x02, 0x01, 0x9D,
+  0x6C, 0x01, 0xC9, 0x63, 0x01, 0x83, 0xB1, 0x01, 0x01, 0xBC, 0x1D, 0x01, 0x8D, 0x0A, 0x01, 0xA2,
+  0x29, 0x01, 0xC2, 0x2C, 0x01, 0xEB, 0x3D, 0x01, 0xCA, 0x66, 0x01, 0xBC, 0x35, 0x01, 0xCA, 0x3A,
+  0x01, 0xC8, 0x40, 0x01, 0xB6, 0x88, 0x01, 0x01, 0x8E, 0x99, 0x01, 0x01, 0xA8, 0x67, 0x01, 0xCA,
+  0x8C, 0x02, 0x01, 0xC8, 0x9D, 0x01, 0x01, 0xC2, 0x93, 0x02, 0x01, 0x86, 0xFA, 0x01, 0x01, 0xB0,
+  0xAB, 0x03, 0x01, 0x9E, 0xD8, 0x03, 0x01, 0x92, 0xB0, 0x03, 0x01, 0xCA, 0x8A, 0x0A, 0x01, 0xAC,
+  0xDC, 0x15, 0x01, 0xDA, 0x8B, 0x0A, 0x80, 0x00, 0xEB, 0xCA, 0xD7, 0x09, 0x01, 0xB9, 0xC7, 0x11,
+  0x01, 0xB7, 0xD1, 0x11, 0x01, 0x9B, 0xDE, 0x07, 0x01, 0x9D, 0xD1, 0x04, 0x01, 0xDD, 0x96, 0x03,
+  0x01, 0xA5, 0xAD, 0x02, 0x01, 0xE9, 0xEA, 0x01, 0x01, 0xD9, 0xBD, 0x01, 0x01, 0xB1, 0x9D, 0x01,
+  0x01, 0xAB, 0x85, 0x01, 0x01, 0xED, 0x72, 0x01, 0xA3, 0x64, 0x01, 0xC7, 0x58, 0x01, 0xF9, 0x4E,
+  0x01, 0xF9, 0x46, 0x01, 0x9D, 0x40, 0x01, 0xC1, 0x3A, 0x01, 0xC9, 0x35, 0x01, 0xAB, 0x31, 0x01,
+  0x91, 0x2D, 0x01, 0xB4, 0x08, 0x01, 0xA6, 0x2E, 0x01, 0x90, 0x32, 0x01, 0xC2, 0x36, 0x01, 0xCC,
+  0x3B, 0x01, 0xC0, 0x41, 0x01, 0xB8, 0x48, 0x01, 0xDE, 0x50, 0x01, 0xDA, 0x5A, 0x01, 0xF8, 0x66,
+  0x01, 0x9C, 0x76, 0x01, 0xD2, 0x89, 0x01, 0x01, 0x8A, 0xA3, 0x01, 0x01, 0xC0, 0xC5, 0x01, 0x01,
+  0x84, 0xF6, 0x01, 0x01, 0xB8, 0xBE, 0x02, 0x01, 0xB2, 0xB3, 0x03, 0x01, 0xB2, 0x88, 0x05, 0x01,
+  0xDE, 0xE6, 0x08, 0x01, 0xD6, 0xE9, 0x16, 0x01, 0xDC, 0x8B, 0x0A, 0x80, 0x00, 0xD9, 0xE1, 0x3D,
+  0x01, 0xC0, 0x98, 0x4E, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04,
+  0x01, 0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D,
+  0x80, 0x00, 0xEE, 0xD8, 0x92, 0x07, 0x01, 0xB9, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9,
+  0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04, 0x01, 0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE,
+  0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80, 0x00, 0xEE, 0xD8, 0x92, 0x07, 0x01, 0xB9, 0xD5, 0x16,
+  0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xC5, 0xF8, 0x05, 0x01, 0xC6, 0x7B, 0x01,
+  0x84, 0xC5, 0x06, 0x01, 0xD2, 0xAE, 0x0B, 0x01, 0xF0, 0xBB, 0x1D, 0x01, 0xCA, 0x83, 0x0D, 0x80,
+  0x00, 0xB6, 0xAC, 0xFF, 0x06, 0x01, 0xB7, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE,
+  0x09, 0x01, 0xCF, 0x96, 0x04, 0x01, 0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB,
+  0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80, 0x00, 0xEE, 0xD8, 0x92, 0x07, 0x01, 0xB9, 0xD5, 0x16, 0x01,
+  0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04, 0x01, 0xD6, 0xDE, 0x05, 0x01,
+  0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80, 0x00, 0xEE, 0xD8, 0x92,
+  0x07, 0x01, 0xB9, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xC5, 0xF8,
+  0x05, 0x01, 0xC6, 0x7B, 0x01, 0x84, 0xC5, 0x06, 0x01, 0xD2, 0xAE, 0x0B, 0x01, 0xF0, 0xBB, 0x1D,
+  0x01, 0xCA, 0x83, 0x0D, 0x80, 0x00, 0xB6, 0xAC, 0xFF, 0x06, 0x01, 0xB7, 0xD5, 0x16, 0x01, 0xAD,
+  0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04, 0x01, 0xD6, 0xDE, 0x05, 0x01, 0xD0,
+  0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80, 0x00, 0xEE, 0xD8, 0x92, 0x07,
+  0x01, 0xB9, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04,
+  0x01, 0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D,
+  0x80, 0x00, 0xEE, 0xD8, 0x92, 0x07, 0x01, 0xB9, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9,
+  0xFE, 0x09, 0x01, 0xC5, 0xF8, 0x05, 0x01, 0xC6, 0x7B, 0x01, 0x84, 0xC5, 0x06, 0x01, 0xD2, 0xAE,
+  0x0B, 0x01, 0xF0, 0xBB, 0x1D, 0x01, 0xCA, 0x83, 0x0D, 0x80, 0x00, 0xB6, 0xAC, 0xFF, 0x06, 0x01,
+  0xB7, 0xD5, 0x16, 0x01, 0xAD, 0xE2, 0x16, 0x01, 0xA9, 0xFE, 0x09, 0x01, 0xCF, 0x96, 0x04, 0x01,
+  0xD6, 0xDE, 0x05, 0x01, 0xD0, 0xAE, 0x0B, 0x01, 0xEE, 0xBB, 0x1D, 0x01, 0xCE, 0x83, 0x0D, 0x80,
+  0x00, 0xF2, 0xAA, 0xD5, 0x0E, 0x81, 0xB3, 0xA5, 0x28, 0x81, 0xB7, 0xD1, 0x11, 0x81, 0x9B, 0xDE,
+  0x07, 0x81, 0x9D, 0xD1, 0x04, 0x81, 0xDD, 0x96, 0x03, 0x81, 0xA5, 0xAD, 0x02, 0x81, 0xE9, 0xEA,
+  0x01, 0x81, 0xD9, 0xBD, 0x01, 0x81, 0xB1, 0x9D, 0x01, 0x81, 0xAB, 0x85, 0x01, 0x81, 0xED, 0x72,
+  0x81, 0xA3, 0x64, 0x81, 0xC7, 0x58, 0x81, 0xF9, 0x4E, 0x81, 0xF9, 0x46, 0x81, 0x9D, 0x40, 0x81,
+  0xC1, 0x3A, 0x81, 0xC9, 0x35, 0x81, 0xAB, 0x31, 0x81, 0xC7, 0x2D, 0x81, 0xC5, 0x1B, 0x81, 0xB0,
+  0x24, 0x81, 0xA6, 0x2E, 0x81, 0x92, 0x32, 0x81, 0xC0, 0x36, 0x81, 0xCC, 0x3B, 0x81, 0xC0, 0x41,
+  0x81, 0xB8, 0x48, 0x81, 0xDC, 0x50, 0x81, 0xDE, 0x5A, 0x81, 0xF6, 0x66, 0x81, 0x9C, 0x76, 0x81,
+  0xD0, 0x89, 0x01, 0x81, 0x8E, 0xA3, 0x01, 0x81, 0xBE, 0xC5, 0x01, 0x81, 0x82, 0xF6, 0x01, 0x81,
+  0xBC, 0xBE, 0x02, 0x81, 0xB0, 0xB3, 0x03, 0x81, 0xB0, 0x88, 0x05, 0x81, 0xE0, 0xE6, 0x08, 0x81,
+  0xD8, 0xE9, 0x16, 0x81, 0xDA, 0x8B, 0x0A, 0x80, 0x00, 0xEB, 0xCA, 0xD7, 0x09, 0x81, 0xB9, 0xC7,
+  0x11, 0x81, 0xB7, 0xD1, 0x11, 0x81, 0x9B, 0xDE, 0x07, 0x81, 0x9D, 0xD1, 0x04, 0x81, 0xDD, 0x96,
+  0x03, 0x81, 0xA5, 0xAD, 0x02, 0x81, 0xE9, 0xEA, 0x01, 0x81, 0xD9, 0xBD, 0x01, 0x81, 0xB1, 0x9D,
+  0x01, 0x81, 0xAB, 0x85, 0x01, 0x81, 0xED, 0x72, 0x81, 0xA3, 0x64, 0x81, 0xC7, 0x58, 0x81, 0xF9,
+  0x4E, 0x81, 0xF9, 0x46, 0x81, 0x9D, 0x40, 0x81, 0xC1, 0x3A, 0x81, 0xC9, 0x35, 0x81, 0xAB, 0x31,
+  0x81, 0x91, 0x2D, 0x81, 0xB4, 0x08, 0x81, 0xA6, 0x2E, 0x81, 0x90, 0x32, 0x81, 0xC2, 0x36, 0x81,
+  0xCC, 0x3B, 0x81, 0xC0, 0x41, 0x81, 0xB8, 0x48, 0x81, 0xDE, 0x50, 0x81, 0xDA, 0x5A, 0x81, 0xF8,
+  0x66, 0x81, 0x9C, 0x76, 0x81, 0xD2, 0x89, 0x01, 0x81, 0x8A, 0xA3, 0x01, 0x81, 0xC0, 0xC5, 0x01,
+  0x81, 0x84, 0xF6, 0x01, 0x81, 0xB8, 0xBE, 0x02, 0x81, 0xB2, 0xB3, 0x03, 0x81, 0xB2, 0x88, 0x05,
+  0x81, 0xDE, 0xE6, 0x08, 0x81, 0xD6, 0xE9, 0x16, 0x81, 0xDC, 0x8B, 0x0A, 0x80, 0x00, 0xF3, 0xAA,
+  0xEB, 0x08, 0x81, 0xFF, 0xE3, 0x32, 0x81, 0xFF, 0xE7, 0x07, 0x81, 0x81, 0xF4, 0x03, 0x81, 0xFD,
+  0xF3, 0x03, 0x81, 0x00, 0x81, 0x02, 0x81, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x00, 0x81, 0x00,
+  0x81, 0x00, 0x81, 0x00, 0x81, 0x02, 0x81, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03,
+  0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x02,
+  0x81, 0xFE, 0xF3, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x83, 0xFF, 0xF3, 0x03,
+  0x81, 0xFE, 0xF3, 0x03, 0x84, 0xFD, 0xF3, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x87, 0x81, 0xF4, 0x03,
+  0x81, 0xFE, 0xF3, 0x03, 0x85, 0xFD, 0xF3, 0x03, 0x81, 0x02, 0x82, 0x01, 0x81, 0x80, 0xF4, 0x03,
+  0x84, 0xFF, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x83, 0xFD, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03,
+  0x81, 0xFD, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x82, 0xFF, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03,
+  0x81, 0x02, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80,
+  0xF4, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x80,
+  0xF4, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x80, 0xF4, 0x03,
+  0x81, 0x80, 0xE8, 0x07, 0x81, 0x80, 0xE8, 0x20, 0x80, 0x00, 0x80, 0xF0, 0xDA, 0x1B, 0x01, 0xFF,
+  0x8E, 0x3C, 0x01, 0xA0, 0xD4, 0x08, 0x81, 0xA0, 0xB5, 0x06, 0x81, 0xE6, 0xCC, 0xAD, 0x01, 0x01,
+  0x8B, 0xFA, 0xAD, 0x01, 0x01, 0xF9, 0x18, 0x01, 0xDF, 0x3D, 0x01, 0xFB, 0x2D, 0x01, 0xEC, 0x08,
+  0x01, 0xBC, 0x4C, 0x01, 0xE2, 0x2F, 0x01, 0xA4, 0x7D, 0x01, 0xF8, 0x5F, 0x01, 0xDC, 0x87, 0x02,
+  0x01, 0xBA, 0xA8, 0x01, 0x01, 0xD4, 0x95, 0x02, 0x01, 0xAC, 0x6C, 0x01, 0xEE, 0xD3, 0x01, 0x01,
+  0xDF, 0x68, 0x01, 0xF7, 0xFC, 0x01, 0x01, 0xE1, 0xA8, 0x01, 0x01, 0xC9, 0xDF, 0x02, 0x01, 0xA3,
+  0x79, 0x01, 0xF1, 0x9C, 0x01, 0x01, 0xEB, 0x83, 0x01, 0x01, 0x94, 0x32, 0x01, 0xA2, 0x02, 0x01,
+  0x83, 0x69, 0x01, 0xEE, 0x6A, 0x01, 0xDA, 0x02, 0x01, 0xFC, 0x02, 0x01, 0xA2, 0x03, 0x01, 0xE2,
+  0x81, 0x01, 0x01, 0xBA, 0x0D, 0x01, 0xEC, 0x97, 0x01, 0x01, 0xF4, 0x64, 0x01, 0xD8, 0xBF, 0x01,
+  0x01, 0xD6, 0x90, 0x01, 0x01, 0x8A, 0x83, 0x02, 0x01, 0xC8, 0x9D, 0x03, 0x01, 0xF8, 0xE0, 0x01,
+  0x01, 0xAA, 0x93, 0x05, 0x01, 0x92, 0xB0, 0x03, 0x01, 0xCA, 0x8A, 0x0A, 0x01, 0xAC, 0xDC, 0x15,
+  0x01, 0xDA, 0x8B, 0x0A, 0x80, 0x00, 0xEB, 0xCA, 0xD7, 0x09, 0x01, 0xB9, 0xC7, 0x11, 0x01, 0xB7,
+  0xD1, 0x11, 0x01, 0x9B, 0xDE, 0x07, 0x01, 0x9D, 0xD1, 0x04, 0x01, 0xDD, 0x96, 0x03, 0x01, 0xA5,
+  0xAD, 0x02, 0x01, 0xE9, 0xEA, 0x01, 0x01, 0xD9, 0xBD, 0x01, 0x01, 0xB1, 0x9D, 0x01, 0x01, 0xAB,
+  0x85, 0x01, 0x01, 0xED, 0x72, 0x01, 0xA3, 0x64, 0x01, 0xC7, 0x58, 0x01, 0xF9, 0x4E, 0x01, 0xF9,
+  0x46, 0x01, 0x9D, 0x40, 0x01, 0xC1, 0x3A, 0x01, 0xC9, 0x35, 0x01, 0xAB, 0x31, 0x01, 0x91, 0x2D,
+  0x01, 0xB4, 0x08, 0x01, 0xA6, 0x2E, 0x01, 0x90, 0x32, 0x01, 0xC2, 0x36, 0x01, 0xCC, 0x3B, 0x01,
+  0xC0, 0x41, 0x01, 0xB8, 0x48, 0x01, 0xDE, 0x50, 0x01, 0xDA, 0x5A, 0x01, 0xF8, 0x66, 0x01, 0x9C,
+  0x76, 0x01, 0xD2, 0x89, 0x01, 0x01, 0x8A, 0xA3, 0x01, 0x01, 0xC0, 0xC5, 0x01, 0x01, 0x84, 0xF6,
+  0x01, 0x01, 0xB8, 0xBE, 0x02, 0x01, 0xB2, 0xB3, 0x03, 0x01, 0xB2, 0x88, 0x05, 0x01, 0xDE, 0xE6,
+  0x08, 0x01, 0xD6, 0xE9, 0x16, 0x01, 0xDC, 0x8B, 0x0A, 0x80, 0x00, 0xB7, 0x9A, 0x80, 0x05, 0x01,
+  0x87, 0x94, 0x2B, 0x01, 0xAB, 0x97, 0x0A, 0x01, 0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02, 0x01,
+  0xE7, 0xEA, 0x01, 0x01, 0xFB, 0xAD, 0x01, 0x01, 0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01, 0xEF,
+  0x5A, 0x01, 0xFD, 0x4C, 0x01, 0xA9, 0x42, 0x01, 0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB, 0x2D,
+  0x01, 0xF9, 0x28, 0x01, 0x89, 0x25, 0x01, 0xE5, 0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C, 0x01,
+  0x89, 0x1A, 0x01, 0xEC, 0x04, 0x01, 0xE0, 0x1A, 0x01, 0xF8, 0x1C, 0x01, 0xBC, 0x1F, 0x01, 0xB4,
+  0x22, 0x01, 0xE8, 0x25, 0x01, 0xEA, 0x29, 0x01, 0xCE, 0x2E, 0x01, 0xB0, 0x34, 0x01, 0xB6, 0x3B,
+  0x01, 0xA0, 0x44, 0x01, 0xBC, 0x4F, 0x01, 0x96, 0x5E, 0x01, 0x80, 0x72, 0x01, 0x88, 0x8E, 0x01,
+  0x01, 0xEC, 0xB7, 0x01, 0x01, 0xB2, 0xFB, 0x01, 0x01, 0xA8, 0xF6, 0x02, 0x01, 0xC6, 0x8A, 0x05,
+  0x01, 0xEA, 0x96, 0x0D, 0x01, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xC6, 0xF3, 0xAF, 0x08, 0x81, 0xC7,
+  0x91, 0x0A, 0x81, 0xAB, 0x97, 0x0A, 0x81, 0xD7, 0xBB, 0x04, 0x81, 0xC1, 0xD6, 0x02, 0x81, 0xE7,
+  0xEA, 0x01, 0x81, 0xFB, 0xAD, 0x01, 0x81, 0xC9, 0x87, 0x01, 0x81, 0xC1, 0x6D, 0x81, 0xEF, 0x5A,
+  0x81, 0xFD, 0x4C, 0x81, 0xA9, 0x42, 0x81, 0xEF, 0x39, 0x81, 0x91, 0x33, 0x81, 0xCB, 0x2D, 0x81,
+  0xF9, 0x28, 0x81, 0x89, 0x25, 0x81, 0xE5, 0x21, 0x81, 0xF7, 0x1E, 0x81, 0xBB, 0x1C, 0x81, 0xA9,
+  0x1A, 0x81, 0xB5, 0x18, 0x81, 0xE1, 0x16, 0x81, 0x9D, 0x15, 0x81, 0xF5, 0x13, 0x81, 0xDB, 0x12,
+  0x81, 0xCF, 0x11, 0x81, 0xD1, 0x10, 0x81, 0xDF, 0x0F, 0x81, 0xF5, 0x0E, 0x81, 0x97, 0x0E, 0x81,
+  0xBD, 0x0D, 0x81, 0xEB, 0x0C, 0x81, 0xA1, 0x0C, 0x81, 0xDB, 0x0B, 0x81, 0x9B, 0x0B, 0x81, 0xDF,
+  0x0A, 0x81, 0xA7, 0x0A, 0x81, 0xF1, 0x09, 0x81, 0xC1, 0x09, 0x81, 0x95, 0x09, 0x81, 0xD7, 0x05,
+  0x81, 0xC0, 0x07, 0x81, 0x9C, 0x09, 0x81, 0xCC, 0x09, 0x81, 0x80, 0x0A, 0x81, 0xB0, 0x0A, 0x81,
+  0xEC, 0x0A, 0x81, 0xA8, 0x0B, 0x81, 0xEA, 0x0B, 0x81, 0xB0, 0x0C, 0x81, 0xFE, 0x0C, 0x81, 0xCE,
+  0x0D, 0x81, 0xAA, 0x0E, 0x81, 0x8C, 0x0F, 0x81, 0xF4, 0x0F, 0x81, 0xEA, 0x10, 0x81, 0xEC, 0x11,
+  0x81, 0xF8, 0x12, 0x81, 0x98, 0x14, 0x81, 0xC4, 0x15, 0x81, 0x88, 0x17, 0x81, 0xE6, 0x18, 0x81,
+  0xDE, 0x1A, 0x81, 0xF6, 0x1C, 0x81, 0xC0, 0x1F, 0x81, 0xB2, 0x22, 0x81, 0xE8, 0x25, 0x81, 0xEA,
+  0x29, 0x81, 0xCE, 0x2E, 0x81, 0xAE, 0x34, 0x81, 0xBA, 0x3B, 0x81, 0x9E, 0x44, 0x81, 0xBC, 0x4F,
+  0x81, 0x94, 0x5E, 0x81, 0x84, 0x72, 0x81, 0x86, 0x8E, 0x01, 0x81, 0xEC, 0xB7, 0x01, 0x81, 0xB0,
+  0xFB, 0x01, 0x81, 0xAC, 0xF6, 0x02, 0x81, 0xC4, 0x8A, 0x05, 0x81, 0xEA, 0x96, 0x0D, 0x81, 0xE2,
+  0xE9, 0x05, 0x80, 0x00, 0xA3, 0x93, 0xAA, 0x07, 0x01, 0xC7, 0x91, 0x0A, 0x01, 0xAB, 0x97, 0x0A,
+  0x01, 0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02, 0x01, 0xE7, 0xEA, 0x01, 0x01, 0xFB, 0xAD, 0x01,
+  0x01, 0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01, 0xEF, 0x5A, 0x01, 0xFD, 0x4C, 0x01, 0xA9, 0x42,
+  0x01, 0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB, 0x2D, 0x01, 0xF9, 0x28, 0x01, 0x89, 0x25, 0x01,
+  0xE5, 0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C, 0x01, 0xA9, 0x1A, 0x01, 0xB5, 0x18, 0x01, 0xE1,
+  0x16, 0x01, 0x9D, 0x15, 0x01, 0xF5, 0x13, 0x01, 0xDB, 0x12, 0x01, 0xCF, 0x11, 0x01, 0xD1, 0x10,
+  0x01, 0xDF, 0x0F, 0x01, 0xF5, 0x0E, 0x01, 0x97, 0x0E, 0x01, 0xBD, 0x0D, 0x01, 0xEB, 0x0C, 0x01,
+  0xA1, 0x0C, 0x01, 0xDB, 0x0B, 0x01, 0x9B, 0x0B, 0x01, 0xDF, 0x0A, 0x01, 0xA7, 0x0A, 0x01, 0xF1,
+  0x09, 0x01, 0xC1, 0x09, 0x01, 0x95, 0x09, 0x01, 0xD7, 0x05, 0x01, 0xC0, 0x07, 0x01, 0x9C, 0x09,
+  0x01, 0xCC, 0x09, 0x01, 0x80, 0x0A, 0x01, 0xB0, 0x0A, 0x01, 0xEC, 0x0A, 0x01, 0xA8, 0x0B, 0x01,
+  0xEA, 0x0B, 0x01, 0xB0, 0x0C, 0x01, 0xFE, 0x0C, 0x01, 0xCE, 0x0D, 0x01, 0xAA, 0x0E, 0x01, 0x8C,
+  0x0F, 0x01, 0xF4, 0x0F, 0x01, 0xEA, 0x10, 0x01, 0xEC, 0x11, 0x01, 0xF8, 0x12, 0x01, 0x98, 0x14,
+  0x01, 0xC4, 0x15, 0x01, 0x88, 0x17, 0x01, 0xE6, 0x18, 0x01, 0xDE, 0x1A, 0x01, 0xF6, 0x1C, 0x01,
+  0xC0, 0x1F, 0x01, 0xB2, 0x22, 0x01, 0xE8, 0x25, 0x01, 0xEA, 0x29, 0x01, 0xCE, 0x2E, 0x01, 0xAE,
+  0x34, 0x01, 0xBA, 0x3B, 0x01, 0x9E, 0x44, 0x01, 0xBC, 0x4F, 0x01, 0x94, 0x5E, 0x01, 0x84, 0x72,
+  0x01, 0x86, 0x8E, 0x01, 0x01, 0xEC, 0xB7, 0x01, 0x01, 0xB0, 0xFB, 0x01, 0x01, 0xAC, 0xF6, 0x02,
+  0x01, 0xC4, 0x8A, 0x05, 0x01, 0xEA, 0x96, 0x0D, 0x01, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xA3, 0x93,
+  0xAA, 0x07, 0x81, 0xC7, 0x91, 0x0A, 0x81, 0xAB, 0x97, 0x0A, 0x81, 0xD7, 0xBB, 0x04, 0x81, 0xC1,
+  0xD6, 0x02, 0x81, 0xE7, 0xEA, 0x01, 0x81, 0xFB, 0xAD, 0x01, 0x81, 0xC9, 0x87, 0x01, 0x81, 0xC1,
+  0x6D, 0x81, 0xEF, 0x5A, 0x81, 0xFD, 0x4C, 0x81, 0xA9, 0x42, 0x81, 0xEF, 0x39, 0x81, 0x91, 0x33,
+  0x81, 0xCB, 0x2D, 0x81, 0xF9, 0x28, 0x81, 0x89, 0x25, 0x81, 0xE5, 0x21, 0x81, 0xF7, 0x1E, 0x81,
+  0xBB, 0x1C, 0x81, 0xA9, 0x1A, 0x81, 0xB5, 0x18, 0x81, 0xE1, 0x16, 0x81, 0x9D, 0x15, 0x81, 0xF5,
+  0x13, 0x81, 0xDB, 0x12, 0x81, 0xCF, 0x11, 0x81, 0xD1, 0x10, 0x81, 0xDF, 0x0F, 0x81, 0xF5, 0x0E,
+  0x81, 0x97, 0x0E, 0x81, 0xBD, 0x0D, 0x81, 0xEB, 0x0C, 0x81, 0xA1, 0x0C, 0x81, 0xDB, 0x0B, 0x81,
+  0x9B, 0x0B, 0x81, 0xDF, 0x0A, 0x81, 0xA7, 0x0A, 0x81, 0xF1, 0x09, 0x81, 0xC1, 0x09, 0x81, 0x95,
+  0x09, 0x81, 0xD7, 0x05, 0x81, 0xC0, 0x07, 0x81, 0x9C, 0x09, 0x81, 0xCC, 0x09, 0x81, 0x80, 0x0A,
+  0x81, 0xB0, 0x0A, 0x81, 0xEC, 0x0A, 0x81, 0xA8, 0x0B, 0x81, 0xEA, 0x0B, 0x81, 0xB0, 0x0C, 0x81,
+  0xFE, 0x0C, 0x81, 0xCE, 0x0D, 0x81, 0xAA, 0x0E, 0x81, 0x8C, 0x0F, 0x81, 0xF4, 0x0F, 0x81, 0xEA,
+  0x10, 0x81, 0xEC, 0x11, 0x81, 0xF8, 0x12, 0x81, 0x98, 0x14, 0x81, 0xC4, 0x15, 0x81, 0x88, 0x17,
+  0x81, 0xE6, 0x18, 0x81, 0xDE, 0x1A, 0x81, 0xF6, 0x1C, 0x81, 0xC0, 0x1F, 0x81, 0xB2, 0x22, 0x81,
+  0xE8, 0x25, 0x81, 0xEA, 0x29, 0x81, 0xCE, 0x2E, 0x81, 0xAE, 0x34, 0x81, 0xBA, 0x3B, 0x81, 0x9E,
+  0x44, 0x81, 0xBC, 0x4F, 0x81, 0x94, 0x5E, 0x81, 0x84, 0x72, 0x81, 0x86, 0x8E, 0x01, 0x81, 0xEC,
+  0xB7, 0x01, 0x81, 0xB0, 0xFB, 0x01, 0x81, 0xAC, 0xF6, 0x02, 0x81, 0xC4, 0x8A, 0x05, 0x81, 0xEA,
+  0x96, 0x0D, 0x81, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xA3, 0x93, 0xAA, 0x07, 0x01, 0xC7, 0x91, 0x0A,
+  0x01, 0xAB, 0x97, 0x0A, 0x01, 0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02, 0x01, 0xE7, 0xEA, 0x01,
+  0x01, 0xFB, 0xAD, 0x01, 0x01, 0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01, 0xEF, 0x5A, 0x01, 0xFD,
+  0x4C, 0x01, 0xA9, 0x42, 0x01, 0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB, 0x2D, 0x01, 0xF9, 0x28,
+  0x01, 0x89, 0x25, 0x01, 0xE5, 0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C, 0x01, 0xA9, 0x1A, 0x01,
+  0xB5, 0x18, 0x01, 0xE1, 0x16, 0x01, 0x9D, 0x15, 0x01, 0xF5, 0x13, 0x01, 0xDB, 0x12, 0x01, 0xCF,
+  0x11, 0x01, 0xD1, 0x10, 0x01, 0xDF, 0x0F, 0x01, 0xF5, 0x0E, 0x01, 0x97, 0x0E, 0x01, 0xBD, 0x0D,
+  0x01, 0xEB, 0x0C, 0x01, 0xA1, 0x0C, 0x01, 0xDB, 0x0B, 0x01, 0x9B, 0x0B, 0x01, 0xDF, 0x0A, 0x01,
+  0xA7, 0x0A, 0x01, 0xF1, 0x09, 0x01, 0xC1, 0x09, 0x01, 0x95, 0x09, 0x01, 0xD7, 0x05, 0x01, 0xC0,
+  0x07, 0x01, 0x9C, 0x09, 0x01, 0xCC, 0x09, 0x01, 0x80, 0x0A, 0x01, 0xB0, 0x0A, 0x01, 0xEC, 0x0A,
+  0x01, 0xA8, 0x0B, 0x01, 0xEA, 0x0B, 0x01, 0xB0, 0x0C, 0x01, 0xFE, 0x0C, 0x01, 0xCE, 0x0D, 0x01,
+  0xAA, 0x0E, 0x01, 0x8C, 0x0F, 0x01, 0xF4, 0x0F, 0x01, 0xEA, 0x10, 0x01, 0xEC, 0x11, 0x01, 0xF8,
+  0x12, 0x01, 0x98, 0x14, 0x01, 0xC4, 0x15, 0x01, 0x88, 0x17, 0x01, 0xE6, 0x18, 0x01, 0xDE, 0x1A,
+  0x01, 0xF6, 0x1C, 0x01, 0xC0, 0x1F, 0x01, 0xB2, 0x22, 0x01, 0xE8, 0x25, 0x01, 0xEA, 0x29, 0x01,
+  0xCE, 0x2E, 0x01, 0xAE, 0x34, 0x01, 0xBA, 0x3B, 0x01, 0x9E, 0x44, 0x01, 0xBC, 0x4F, 0x01, 0x94,
+  0x5E, 0x01, 0x84, 0x72, 0x01, 0x86, 0x8E, 0x01, 0x01, 0xEC, 0xB7, 0x01, 0x01, 0xB0, 0xFB, 0x01,
+  0x01, 0xAC, 0xF6, 0x02, 0x01, 0xC4, 0x8A, 0x05, 0x01, 0xEA, 0x96, 0x0D, 0x01, 0xE2, 0xE9, 0x05,
+  0x80, 0x00, 0xA3, 0x93, 0xAA, 0x07, 0x81, 0xC7, 0x91, 0x0A, 0x81, 0xAB, 0x97, 0x0A, 0x81, 0xD7,
+  0xBB, 0x04, 0x81, 0xC1, 0xD6, 0x02, 0x81, 0xE7, 0xEA, 0x01, 0x81, 0xFB, 0xAD, 0x01, 0x81, 0xC9,
+  0x87, 0x01, 0x81, 0xC1, 0x6D, 0x81, 0xEF, 0x5A, 0x81, 0xFD, 0x4C, 0x81, 0xA9, 0x42, 0x81, 0xEF,
+  0x39, 0x81, 0x91, 0x33, 0x81, 0xCB, 0x2D, 0x81, 0xF9, 0x28, 0x81, 0x89, 0x25, 0x81, 0xE5, 0x21,
+  0x81, 0xF7, 0x1E, 0x81, 0xBB, 0x1C, 0x81, 0xA9, 0x1A, 0x81, 0xB5, 0x18, 0x81, 0xE1, 0x16, 0x81,
+  0x9D, 0x15, 0x81, 0xF5, 0x13, 0x81, 0xDB, 0x12, 0x81, 0xCF, 0x11, 0x81, 0xD1, 0x10, 0x81, 0xDF,
+  0x0F, 0x81, 0xF5, 0x0E, 0x81, 0x97, 0x0E, 0x81, 0xBD, 0x0D, 0x81, 0xEB, 0x0C, 0x81, 0xA1, 0x0C,
+  0x81, 0xDB, 0x0B, 0x81, 0x9B, 0x0B, 0x81, 0xDF, 0x0A, 0x81, 0xA7, 0x0A, 0x81, 0xF1, 0x09, 0x81,
+  0xC1, 0x09, 0x81, 0x95, 0x09, 0x81, 0xD7, 0x05, 0x81, 0xC0, 0x07, 0x81, 0x9C, 0x09, 0x81, 0xCC,
+  0x09, 0x81, 0x80, 0x0A, 0x81, 0xB0, 0x0A, 0x81, 0xEC, 0x0A, 0x81, 0xA8, 0x0B, 0x81, 0xEA, 0x0B,
+  0x81, 0xB0, 0x0C, 0x81, 0xFE, 0x0C, 0x81, 0xCE, 0x0D, 0x81, 0xAA, 0x0E, 0x81, 0x8C, 0x0F, 0x81,
+  0xF4, 0x0F, 0x81, 0xEA, 0x10, 0x81, 0xEC, 0x11, 0x81, 0xF8, 0x12, 0x81, 0x98, 0x14, 0x81, 0xC4,
+  0x15, 0x81, 0x88, 0x17, 0x81, 0xE6, 0x18, 0x81, 0xDE, 0x1A, 0x81, 0xF6, 0x1C, 0x81, 0xC0, 0x1F,
+  0x81, 0xB2, 0x22, 0x81, 0xE8, 0x25, 0x81, 0xEA, 0x29, 0x81, 0xCE, 0x2E, 0x81, 0xAE, 0x34, 0x81,
+  0xBA, 0x3B, 0x81, 0x9E, 0x44, 0x81, 0xBC, 0x4F, 0x81, 0x94, 0x5E, 0x81, 0x84, 0x72, 0x81, 0x86,
+  0x8E, 0x01, 0x81, 0xEC, 0xB7, 0x01, 0x81, 0xB0, 0xFB, 0x01, 0x81, 0xAC, 0xF6, 0x02, 0x81, 0xC4,
+  0x8A, 0x05, 0x81, 0xEA, 0x96, 0x0D, 0x81, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xA3, 0x93, 0xAA, 0x07,
+  0x01, 0xC7, 0x91, 0x0A, 0x01, 0xAB, 0x97, 0x0A, 0x01, 0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02,
+  0x01, 0xE7, 0xEA, 0x01, 0x01, 0xFB, 0xAD, 0x01, 0x01, 0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01,
+  0xEF, 0x5A, 0x01, 0xFD, 0x4C, 0x01, 0xA9, 0x42, 0x01, 0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB,
+  0x2D, 0x01, 0xF9, 0x28, 0x01, 0x89, 0x25, 0x01, 0xE5, 0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C,
+  0x01, 0xA9, 0x1A, 0x01, 0xB5, 0x18, 0x01, 0xE1, 0x16, 0x01, 0x9D, 0x15, 0x01, 0xF5, 0x13, 0x01,
+  0xDB, 0x12, 0x01, 0xCF, 0x11, 0x01, 0xD1, 0x10, 0x01, 0xDF, 0x0F, 0x01, 0xF5, 0x0E, 0x01, 0x97,
+  0x0E, 0x01, 0xBD, 0x0D, 0x01, 0xEB, 0x0C, 0x01, 0xA1, 0x0C, 0x01, 0xDB, 0x0B, 0x01, 0x9B, 0x0B,
+  0x01, 0xDF, 0x0A, 0x01, 0xA7, 0x0A, 0x01, 0xF1, 0x09, 0x01, 0xC1, 0x09, 0x01, 0x95, 0x09, 0x01,
+  0xD7, 0x05, 0x01, 0xC0, 0x07, 0x01, 0x9C, 0x09, 0x01, 0xCC, 0x09, 0x01, 0x80, 0x0A, 0x01, 0xB0,
+  0x0A, 0x01, 0xEC, 0x0A, 0x01, 0xA8, 0x0B, 0x01, 0xEA, 0x0B, 0x01, 0xB0, 0x0C, 0x01, 0xFE, 0x0C,
+  0x01, 0xCE, 0x0D, 0x01, 0xAA, 0x0E, 0x01, 0x8C, 0x0F, 0x01, 0xF4, 0x0F, 0x01, 0xEA, 0x10, 0x01,
+  0xEC, 0x11, 0x01, 0xF8, 0x12, 0x01, 0x98, 0x14, 0x01, 0xC4, 0x15, 0x01, 0x88, 0x17, 0x01, 0xE6,
+  0x18, 0x01, 0xDE, 0x1A, 0x01, 0xF6, 0x1C, 0x01, 0xC0, 0x1F, 0x01, 0xB2, 0x22, 0x01, 0xE8, 0x25,
+  0x01, 0xEA, 0x29, 0x01, 0xCE, 0x2E, 0x01, 0xAE, 0x34, 0x01, 0xBA, 0x3B, 0x01, 0x9E, 0x44, 0x01,
+  0xBC, 0x4F, 0x01, 0x94, 0x5E, 0x01, 0x84, 0x72, 0x01, 0x86, 0x8E, 0x01, 0x01, 0xEC, 0xB7, 0x01,
+  0x01, 0xB0, 0xFB, 0x01, 0x01, 0xAC, 0xF6, 0x02, 0x01, 0xC4, 0x8A, 0x05, 0x01, 0xEA, 0x96, 0x0D,
+  0x01, 0xE2, 0xE9, 0x05, 0x80, 0x00, 0xA3, 0x93, 0xAA, 0x07, 0x81, 0xC7, 0x91, 0x0A, 0x81, 0xAB,
+  0x97, 0x0A, 0x81, 0xD7, 0xBB, 0x04, 0x81, 0xC1, 0xD6, 0x02, 0x81, 0xE7, 0xEA, 0x01, 0x81, 0xFB,
+  0xAD, 0x01, 0x81, 0xC9, 0x87, 0x01, 0x81, 0xC1, 0x6D, 0x81, 0xEF, 0x5A, 0x81, 0xFD, 0x4C, 0x81,
+  0xA9, 0x42, 0x81, 0xEF, 0x39, 0x81, 0x91, 0x33, 0x81, 0xCB, 0x2D, 0x81, 0xF9, 0x28, 0x81, 0x89,
+  0x25, 0x81, 0xE5, 0x21, 0x81, 0xF7, 0x1E, 0x81, 0xBB, 0x1C, 0x81, 0xA9, 0x1A, 0x81, 0xB5, 0x18,
+  0x81, 0xE1, 0x16, 0x81, 0x9D, 0x15, 0x81, 0xF5, 0x13, 0x81, 0xDB, 0x12, 0x81, 0xCF, 0x11, 0x81,
+  0xD1, 0x10, 0x81, 0xDF, 0x0F, 0x81, 0xF5, 0x0E, 0x81, 0x97, 0x0E, 0x81, 0xBD, 0x0D, 0x81, 0xEB,
+  0x0C, 0x81, 0xA1, 0x0C, 0x81, 0xDB, 0x0B, 0x81, 0x9B, 0x0B, 0x81, 0xDF, 0x0A, 0x81, 0xA7, 0x0A,
+  0x81, 0xF1, 0x09, 0x81, 0xC1, 0x09, 0x81, 0x95, 0x09, 0x81, 0xD7, 0x05, 0x81, 0xC0, 0x07, 0x81,
+  0x9C, 0x09, 0x81, 0xCC, 0x09, 0x81, 0x80, 0x0A, 0x81, 0xB0, 0x0A, 0x81, 0xEC, 0x0A, 0x81, 0xA8,
+  0x0B, 0x81, 0xEA, 0x0B, 0x81, 0xB0, 0x0C, 0x81, 0xFE, 0x0C, 0x81, 0xCE, 0x0D, 0x81, 0xAA, 0x0E,
+  0x81, 0x8C, 0x0F, 0x81, 0xF4, 0x0F, 0x81, 0xEA, 0x10, 0x81, 0xEC, 0x11, 0x81, 0xF8, 0x12, 0x81,
+  0x98, 0x14, 0x81, 0xC4, 0x15, 0x81, 0x88, 0x17, 0x81, 0xE6, 0x18, 0x81, 0xDE, 0x1A, 0x81, 0xF6,
+  0x1C, 0x81, 0xC0, 0x1F, 0x81, 0xB2, 0x22, 0x81, 0xE8, 0x25, 0x81, 0xEA, 0x29, 0x81, 0xCE, 0x2E,
+  0x81, 0xAE, 0x34, 0x81, 0xBA, 0x3B, 0x81, 0x9E, 0x44, 0x81, 0xBC, 0x4F, 0x81, 0x94, 0x5E, 0x81,
+  0x84, 0x72, 0x81, 0x86, 0x8E, 0x01, 0x81, 0xEC, 0xB7, 0x01, 0x81, 0xB0, 0xFB, 0x01, 0x81, 0xAC,
+  0xF6, 0x02, 0x81, 0xC4, 0x8A, 0x05, 0x81, 0xEA, 0x96, 0x0D, 0x81, 0xE2, 0xE9, 0x05, 0x80, 0x00,
+  0xBB, 0xAF, 0xBE, 0x07, 0x01, 0x86, 0xBB, 0x0F, 0x01, 0xB7, 0xD1, 0x11, 0x01, 0x9B, 0xDE, 0x07,
+  0x01, 0x9D, 0xD1, 0x04, 0x01, 0xDD, 0x96, 0x03, 0x01, 0xA5, 0xAD, 0x02, 0x01, 0xE9, 0xEA, 0x01,
+  0x01, 0xD9, 0xBD, 0x01, 0x01, 0xB1, 0x9D, 0x01, 0x01, 0xAB, 0x85, 0x01, 0x01, 0xED, 0x72, 0x01,
+  0xA3, 0x64, 0x01, 0xC7, 0x58, 0x01, 0xF9, 0x4E, 0x01, 0xF9, 0x46, 0x01, 0x9D, 0x40, 0x01, 0xC1,
+  0x3A, 0x01, 0xC9, 0x35, 0x01, 0xAB, 0x31, 0x01, 0x91, 0x2D, 0x01, 0xB4, 0x08, 0x01, 0xA6, 0x2E,
+  0x01, 0x90, 0x32, 0x01, 0xC2, 0x36, 0x01, 0xCC, 0x3B, 0x01, 0xC0, 0x41, 0x01, 0xB8, 0x48, 0x01,
+  0xDE, 0x50, 0x01, 0xDA, 0x5A, 0x01, 0xF8, 0x66, 0x01, 0x9C, 0x76, 0x01, 0xD2, 0x89, 0x01, 0x01,
+  0x8A, 0xA3, 0x01, 0x01, 0xC0, 0xC5, 0x01, 0x01, 0x84, 0xF6, 0x01, 0x01, 0xB8, 0xBE, 0x02, 0x01,
+  0xB2, 0xB3, 0x03, 0x01, 0xB2, 0x88, 0x05, 0x01, 0xDE, 0xE6, 0x08, 0x01, 0xD6, 0xE9, 0x16, 0x01,
+  0xDC, 0x8B, 0x0A, 0x80, 0x00, 0xF2, 0xDA, 0x9D, 0x0C, 0x80, 0x00, 0x80, 0xF8, 0xA5, 0x10, 0x80,
+  0x00, 0x9A, 0xBA, 0xDF, 0x12, 0x80, 0x00, 0xAB, 0xB5, 0x8A, 0x08, 0x01, 0x87, 0x94, 0x2B, 0x01,
+  0xAB, 0x97, 0x0A, 0x01, 0xD7, 0xBB, 0x04, 0x01, 0xC1, 0xD6, 0x02, 0x01, 0xE7, 0xEA, 0x01, 0x01,
+  0xFB, 0xAD, 0x01, 0x01, 0xC9, 0x87, 0x01, 0x01, 0xC1, 0x6D, 0x01, 0xEF, 0x5A, 0x01, 0xFD, 0x4C,
+  0x01, 0xA9, 0x42, 0x01, 0xEF, 0x39, 0x01, 0x91, 0x33, 0x01, 0xCB, 0x2D, 0x01, 0xF9, 0x28, 0x01,
+  0x89, 0x25, 0x01, 0xE5, 0x21, 0x01, 0xF7, 0x1E, 0x01, 0xBB, 0x1C, 0x01, 0xA9, 0x1A, 0x01, 0xB5,
+  0x18, 0x01, 0xE1, 0x16, 0x01, 0x9D, 0x15, 0x01, 0xF5, 0x13, 0x01, 0xDB, 0x12, 0x01, 0xCF, 0x11,
+  0x01, 0xD1, 0x10, 0x01, 0xDF, 0x0F, 0x01, 0xF5, 0x0E, 0x01, 0x97, 0x0E, 0x01, 0xBD, 0x0D, 0x01,
+  0xEB, 0x0C, 0x01, 0xA1, 0x0C, 0x01, 0xDB, 0x0B, 0x01, 0x9B, 0x0B, 0x01, 0xDF, 0x0A, 0x01, 0xA7,
+  0x0A, 0x01, 0xF1, 0x09, 0x01, 0xC1, 0x09, 0x01, 0x95, 0x09, 0x01, 0xDD, 0x08, 0x01, 0xD4, 0x01,
+  0x01, 0xF2, 0x08, 0x01, 0x9C, 0x09, 0x01, 0xCC, 0x09, 0x01, 0x80, 0x0A, 0x01, 0xB0, 0x0A, 0x01,
+  0xEC, 0x0A, 0x01, 0xA8, 0x0B, 0x01, 0xEA, 0x0B, 0x01, 0xB0, 0x0C, 0x01, 0xFE, 0x0C, 0x01, 0xCE,
+  0x0D, 0x01, 0xAA, 0x0E, 0x01, 0x8C, 0x0F, 0x01, 0xF4, 0x0F, 0x01, 0xEA, 0x10, 0x01, 0xEC, 0x11,
+  0x01, 0xF8, 0x12, 0x01, 0x98, 0x14, 0x01, 0xC4, 0x15, 0x01, 0x88, 0x17, 0x01, 0xE6, 0x18, 0x01,
+  0xDE, 0x1A, 0x01, 0xF6, 0x1C, 0x01, 0xC0, 0x1F, 0x01, 0xB2, 0x22, 0x01, 0xE8, 0x25, 0x01, 0xEA,
+  0x29, 0x01, 0xCE, 0x2E, 0x01, 0xAE, 0x34, 0x01, 0xBA, 0x3B, 0x01, 0x9E, 0x44, 0x01, 0xBC, 0x4F,
+  0x01, 0x94, 0x5E, 0x01, 0x84, 0x72, 0x01, 0x86, 0x8E, 0x01, 0x01, 0xEC, 0xB7, 0x01, 0x01, 0xB0,
+  0xFB, 0x01, 0x01, 0xAC, 0xF6, 0x02, 0x01, 0xC4, 0x8A, 0x05, 0x01, 0xEA, 0x96, 0x0D, 0x01, 0xE2,
+  0xE9, 0x05, 0x80, 0x00, 0x90, 0xB0, 0xBE, 0x17, 0x81, 0x86, 0xBB, 0x0F, 0x81, 0xB7, 0xD1, 0x11,
+  0x81, 0x9B, 0xDE, 0x07, 0x81, 0x9D, 0xD1, 0x04, 0x81, 0xDD, 0x96, 0x03, 0x81, 0xA5, 0xAD, 0x02,
+  0x81, 0xE9, 0xEA, 0x01, 0x81, 0xD9, 0xBD, 0x01, 0x81, 0xB1, 0x9D, 0x01, 0x81, 0xAB, 0x85, 0x01,
+  0x81, 0xED, 0x72, 0x81, 0xA3, 0x64, 0x81, 0xC7, 0x58, 0x81, 0xF9, 0x4E, 0x81, 0xF9, 0x46, 0x81,
+  0x9D, 0x40, 0x81, 0xC1, 0x3A, 0x81, 0xC9, 0x35, 0x81, 0xAB, 0x31, 0x81, 0xC7, 0x2D, 0x81, 0xC5,
+  0x1B, 0x81, 0xB0, 0x24, 0x81, 0xA6, 0x2E, 0x81, 0x92, 0x32, 0x81, 0xC0, 0x36, 0x81, 0xCC, 0x3B,
+  0x81, 0xC0, 0x41, 0x81, 0xB8, 0x48, 0x81, 0xDC, 0x50, 0x81, 0xDE, 0x5A, 0x81, 0xF6, 0x66, 0x81,
+  0x9C, 0x76, 0x81, 0xD0, 0x89, 0x01, 0x81, 0x8E, 0xA3, 0x01, 0x81, 0xBE, 0xC5, 0x01, 0x81, 0x82,
+  0xF6, 0x01, 0x81, 0xBC, 0xBE, 0x02, 0x81, 0xB0, 0xB3, 0x03, 0x81, 0xB0, 0x88, 0x05, 0x81, 0xE0,
+  0xE6, 0x08, 0x81, 0xD8, 0xE9, 0x16, 0x81, 0xDA, 0x8B, 0x0A, 0x80, 0x00, 0xEB, 0xCA, 0xD7, 0x09,
+  0x81, 0xB9, 0xC7, 0x11, 0x81, 0xB7, 0xD1, 0x11, 0x81, 0x9B, 0xDE, 0x07, 0x81, 0x9D, 0xD1, 0x04,
+  0x81, 0xDD, 0x96, 0x03, 0x81, 0xA5, 0xAD, 0x02, 0x81, 0xE9, 0xEA, 0x01, 0x81, 0xD9, 0xBD, 0x01,
+  0x81, 0xB1, 0x9D, 0x01, 0x81, 0xAB, 0x85, 0x01, 0x81, 0xED, 0x72, 0x81, 0xA3, 0x64, 0x81, 0xC7,
+  0x58, 0x81, 0xF9, 0x4E, 0x81, 0xF9, 0x46, 0x81, 0x9D, 0x40, 0x81, 0xC1, 0x3A, 0x81, 0xC9, 0x35,
+  0x81, 0xAB, 0x31, 0x81, 0x91, 0x2D, 0x81, 0xB4, 0x08, 0x81, 0xA6, 0x2E, 0x81, 0x90, 0x32, 0x81,
+  0xC2, 0x36, 0x81, 0xCC, 0x3B, 0x81, 0xC0, 0x41, 0x81, 0xB8, 0x48, 0x81, 0xDE, 0x50, 0x81, 0xDA,
+  0x5A, 0x81, 0xF8, 0x66, 0x81, 0x9C, 0x76, 0x81, 0xD2, 0x89, 0x01, 0x81, 0x8A, 0xA3, 0x01, 0x81,
+  0xC0, 0xC5, 0x01, 0x81, 0x84, 0xF6, 0x01, 0x81, 0xB8, 0xBE, 0x02, 0x81, 0xB2, 0xB3, 0x03, 0x81,
+  0xB2, 0x88, 0x05, 0x81, 0xDE, 0xE6, 0x08, 0x81, 0xD6, 0xE9, 0x16, 0x81, 0xDC, 0x8B, 0x0A, 0x80,
+  0x00, 0xF3, 0xAA, 0xEB, 0x08, 0x81, 0xFF, 0xE3, 0x32, 0x81, 0xFF, 0xE7, 0x07, 0x81, 0x81, 0xF4,
+  0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x00, 0x81, 0x02, 0x81, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81,
+  0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x02, 0x81, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81,
+  0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0xFF, 0xF3,
+  0x03, 0x81, 0x02, 0x81, 0xFE, 0xF3, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x83,
+  0xFF, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x84, 0xFD, 0xF3, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x87,
+  0x81, 0xF4, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x85, 0xFD, 0xF3, 0x03, 0x81, 0x02, 0x82, 0x01, 0x81,
+  0x80, 0xF4, 0x03, 0x84, 0xFF, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x83, 0xFD, 0xF3, 0x03, 0x81,
+  0x80, 0xF4, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x82, 0xFF, 0xF3, 0x03, 0x81,
+  0xFE, 0xF3, 0x03, 0x81, 0x02, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3,
+  0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+  0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81,
+  0x80, 0xF4, 0x03, 0x81, 0x80, 0xE8, 0x07, 0x81, 0x80, 0xE8, 0x20, 0x80, 0x00, 0x80, 0xF0, 0xDA,
+  0x1B, 0x01, 0xFF, 0x8E, 0x3C, 0x01, 0xA0, 0xD4, 0x08, 0x81, 0xA0, 0xB5, 0x06, 0x81, 0xE6, 0xCC,
+  0xAD, 0x01, 0x01, 0x8B, 0xFA, 0xAD, 0x01, 0x01, 0xF9, 0x18, 0x01, 0xDF, 0x3D, 0x01, 0xFB, 0x2D,
+  0x01, 0xEC, 0x08, 0x01, 0xBC, 0x4C, 0x01, 0xE2, 0x2F, 0x01, 0xA4, 0x7D, 0x01, 0xF8, 0x5F, 0x01,
+  0xDC, 0x87, 0x02, 0x01, 0xBA, 0xA8, 0x01, 0x01, 0xD4, 0x95, 0x02, 0x01, 0xAC, 0x6C, 0x01, 0xEE,
+  0xD3, 0x01, 0x01, 0xDF, 0x68, 0x01, 0xF7, 0xFC, 0x01, 0x01, 0xE1, 0xA8, 0x01, 0x01, 0xC9, 0xDF,
+  0x02, 0x01, 0xA3, 0x79, 0x01, 0xF1, 0x9C, 0x01, 0x01, 0xEB, 0x83, 0x01, 0x01, 0x94, 0x32, 0x01,
+  0xA2, 0x02, 0x01, 0x83, 0x69, 0x01, 0xEE, 0x6A, 0x01, 0xDA, 0x02, 0x01, 0xFC, 0x02, 0x01, 0xA2,
+  0x03, 0x01, 0xE2, 0x81, 0x01, 0x01, 0xBA, 0x0D, 0x01, 0xEC, 0x97, 0x01, 0x01, 0xF4, 0x64, 0x01,
+  0xD8, 0xBF, 0x01, 0x01, 0xD6, 0x90, 0x01, 0x01, 0x8A, 0x83, 0x02, 0x01, 0xC8, 0x9D, 0x03, 0x01,
+  0xF8, 0xE0, 0x01, 0x01, 0xAA, 0x93, 0x05, 0x01, 0x92, 0xB0, 0x03, 0x01, 0xCA, 0x8A, 0x0A, 0x01,
+  0xAC, 0xDC, 0x15, 0x01, 0xDA, 0x8B, 0x0A, 0x80, 0x00, 0xEB, 0xCA, 0xD7, 0x09, 0x01, 0xB9, 0xC7,
+  0x11, 0x01, 0xB7, 0xD1, 0x11, 0x01, 0x9B, 0xDE, 0x07, 0x01, 0x9D, 0xD1, 0x04, 0x01, 0xDD, 0x96,
+  0x03, 0x01, 0xA5, 0xAD, 0x02, 0x01, 0xE9, 0xEA, 0x01, 0x01, 0xD9, 0xBD, 0x01, 0x01, 0xB1, 0x9D,
+  0x01, 0x01, 0xAB, 0x85, 0x01, 0x01, 0xED, 0x72, 0x01, 0xA3, 0x64, 0x01, 0xC7, 0x58, 0x01, 0xF9,
+  0x4E, 0x01, 0xF9, 0x46, 0x01, 0x9D, 0x40, 0x01, 0xC1, 0x3A, 0x01, 0xC9, 0x35, 0x01, 0xAB, 0x31,
+  0x01, 0x91, 0x2D, 0x01, 0xB4, 0x08, 0x01, 0xA6, 0x2E, 0x01, 0x90, 0x32, 0x01, 0xC2, 0x36, 0x01,
+  0xCC, 0x3B, 0x01, 0xC0, 0x41, 0x01, 0xB8, 0x48, 0x01, 0xDE, 0x50, 0x01, 0xDA, 0x5A, 0x01, 0xF8,
+  0x66, 0x01, 0x9C, 0x76, 0x01, 0xD2, 0x89, 0x01, 0x01, 0x8A, 0xA3, 0x01, 0x01, 0xC0, 0xC5, 0x01,
+  0x01, 0x84, 0xF6, 0x01, 0x01, 0xB8, 0xBE, 0x02, 0x01, 0xB2, 0xB3, 0x03, 0x01, 0xB2, 0x88, 0x05,
+  0x01, 0xDE, 0xE6, 0x08, 0x01, 0xD6, 0xE9, 0x16, 0x01, 0xDC, 0x8B, 0x0A, 0x80, 0x00, 0xEB, 0xF8,
+  0xBE, 0x02, 0x80, 0x00, 0x80, 0xF0, 0x93, 0x09, 0x80, 0x00, 0xB8, 0x9C, 0xA7, 0x09, 0x80, 0x00,
+  0xC8, 0xC3, 0x80, 0x09, 0x80, 0x00, 0x80, 0xF0, 0x93, 0x09, 0x80, 0x00, 0xB8, 0x9C, 0xA7, 0x09,
+  0x80, 0x00, 0xC8, 0xC3, 0x80, 0x09, 0x80, 0x00, 0x80, 0xF0, 0x93, 0x09, 0x80, 0x00, 0xB8, 0x9C,
+  0xA7, 0x09, 0x80, 0x00, 0xC8, 0xC3, 0x80, 0x09, 0x80, 0x00, 0x87, 0xC8, 0xDB, 0x12, 0x80, 0x00,
+  0x9C, 0x84, 0xD7, 0x0D, 0x80, 0x00, 0xF2, 0x9E, 0xB4, 0x0B, 0x80, 0x00, 0xF2, 0xF8, 0x90, 0x20,
+  0x80, 0x00, 0x9C, 0x84, 0xD7, 0x0D, 0x80, 0x00, 0xF1, 0xBE, 0xA7, 0x07, 0x80, 0x00, 0xA3, 0xF8,
+  0xDC, 0x0B, 0x80, 0x00, 0x80, 0x98, 0xD7, 0x0A, 0x80, 0x00, 0x80, 0x98, 0xD7, 0x0A, 0x80, 0x00,
+  0x80, 0x98, 0xD7, 0x0A, 0x80, 0x00, 0x80, 0x98, 0xD7, 0x0A, 0x80, 0x00, 0x80, 0x98, 0xD7, 0x0A,
+  0x80, 0x00, 0x80, 0x98, 0xD7, 0x0A, 0x80, 0x00, 0xEC, 0xE8, 0xBD, 0x0B, 0x80, 0x00, 0xF3, 0xE6,
+  0xD4, 0x09, 0x81, 0xFE, 0x93, 0x23, 0x81, 0xFD, 0xDB, 0x0B, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0xFF,
+  0xF3, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x02,
+  0x81, 0x83, 0xF4, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x00, 0x81, 0x82,
+  0xF4, 0x03, 0x81, 0x81, 0xF4, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01, 0x81, 0x02,
+  0x81, 0xFF, 0xF3, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0x01, 0x81, 0x00, 0x81, 0xFF, 0xF3, 0x03,
+  0x81, 0x80, 0xF4, 0x03, 0x81, 0x01, 0x81, 0x02, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03,
+  0x81, 0x02, 0x81, 0x81, 0xF4, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0xFF,
+  0xF3, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x01, 0x81, 0x00,
+  0x81, 0x80, 0xF4, 0x03, 0x81, 0x81, 0xF4, 0x03, 0x81, 0x04, 0x81, 0xFE, 0xF3, 0x03, 0x81, 0xFF,
+  0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03,
+  0x81, 0xFE, 0xF3, 0x03, 0x81, 0x84, 0xF4, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x81, 0x80, 0xDC, 0x0B,
+  0x81, 0xFE, 0xCF, 0x28, 0x80, 0x00, 0x81, 0x9C, 0xD8, 0x0C, 0x01, 0xFF, 0xCF, 0x28, 0x01, 0xFD,
+  0xDB, 0x0B, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80,
+  0xF4, 0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0xFD, 0xF3, 0x03, 0x01, 0xFC, 0xF3, 0x03, 0x01, 0x02,
+  0x01, 0xFF, 0xF3, 0x03, 0x01, 0x00, 0x01, 0x02, 0x01, 0xFE, 0xF3, 0x03, 0x01, 0xFF, 0xF3, 0x03,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x81, 0xF4, 0x03, 0x01, 0x82, 0xF4, 0x03, 0x01, 0x00, 0x01, 0x02,
+  0x01, 0x81, 0xF4, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0x00, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80,
+  0xF4, 0x03, 0x01, 0x81, 0xF4, 0x03, 0x01, 0x82, 0xF4, 0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80,
+  0xF4, 0x03, 0x01, 0xFD, 0xF3, 0x03, 0x01, 0xFE, 0xF3, 0x03, 0x02, 0xFF, 0xF3, 0x03, 0x01, 0x80,
+  0xF4, 0x03, 0x02, 0xFF, 0xF3, 0x03, 0x01, 0xFE, 0xF3, 0x03, 0x03, 0xFD, 0xF3, 0x03, 0x01, 0x80,
+  0xF4, 0x03, 0x01, 0xFD, 0xF3, 0x03, 0x02, 0x01, 0x01, 0x80, 0xF4, 0x03, 0x04, 0xFF, 0xF3, 0x03,
+  0x01, 0x01, 0x01, 0x84, 0xF4, 0x03, 0x05, 0x81, 0xF4, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x05, 0xFF,
+  0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x03, 0xFF, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x02, 0xFF,
+  0xF3, 0x03, 0x01, 0x01, 0x01, 0x82, 0xF4, 0x03, 0x02, 0xFF, 0xF3, 0x03, 0x01, 0x82, 0xF4, 0x03,
+  0x02, 0x81, 0xF4, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03,
+  0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03,
+  0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0x00, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80,
+  0xF4, 0x03, 0x01, 0x00, 0x01, 0x01, 0x01, 0xFD, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0x00,
+  0x01, 0x02, 0x01, 0xFE, 0xF3, 0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80,
+  0xF4, 0x03, 0x01, 0x00, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xFE, 0xF3, 0x03,
+  0x01, 0xFD, 0xF3, 0x03, 0x01, 0x82, 0xF4, 0x03, 0x01, 0xFE, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03,
+  0x01, 0x80, 0xDC, 0x0B, 0x01, 0xFE, 0xCF, 0x28, 0x80, 0x00, 0x91, 0x9E, 0xB7, 0x0F, 0x81, 0x8D,
+  0xFA, 0x20, 0x81, 0x9F, 0xBC, 0x0C, 0x81, 0x95, 0xBC, 0x05, 0x81, 0xBF, 0xA3, 0x03, 0x81, 0xCD,
+  0x9F, 0x02, 0x81, 0x83, 0xD5, 0x01, 0x81, 0x87, 0xA6, 0x01, 0x81, 0x8F, 0x86, 0x01, 0x81, 0xA5,
+  0x6F, 0x81, 0xA5, 0x5E, 0x81, 0x9B, 0x51, 0x81, 0xF3, 0x46, 0x81, 0xCF, 0x3E, 0x81, 0xE7, 0x37,
+  0x81, 0x97, 0x32, 0x81, 0xB5, 0x2D, 0x81, 0xAD, 0x29, 0x81, 0xF3, 0x25, 0x81, 0xEF, 0x22, 0x81,
+  0x9D, 0x20, 0x81, 0xF5, 0x1D, 0x81, 0xED, 0x1B, 0x81, 0x83, 0x1A, 0x81, 0xB1, 0x18, 0x81, 0xF5,
+  0x16, 0x81, 0xC9, 0x15, 0x81, 0x99, 0x14, 0x81, 0xE6, 0x03, 0x81, 0xCE, 0x14, 0x81, 0xEC, 0x15,
+  0x81, 0x9A, 0x17, 0x81, 0xDC, 0x18, 0x81, 0xB0, 0x1A, 0x81, 0xA0, 0x1C, 0x81, 0xAE, 0x1E, 0x81,
+  0xE0, 0x20, 0x81, 0xB6, 0x23, 0x81, 0xC8, 0x26, 0x81, 0x92, 0x2A, 0x81, 0xA8, 0x2E, 0x81, 0x9C,
+  0x33, 0x81, 0x8A, 0x39, 0x81, 0x94, 0x40, 0x81, 0xE4, 0x48, 0x81, 0xCA, 0x53, 0x81, 0xAC, 0x61,
+  0x81, 0xA8, 0x73, 0x81, 0xD2, 0x8B, 0x01, 0x81, 0xFE, 0xAD, 0x01, 0x81, 0x96, 0xE1, 0x01, 0x81,
+  0xEE, 0xB3, 0x02, 0x81, 0xBC, 0xCA, 0x03, 0x81, 0xDE, 0x9C, 0x06, 0x81, 0xF8, 0x91, 0x10, 0x81,
+  0xB2, 0x91, 0x07, 0x80, 0x00, 0xB3, 0x9D, 0xBA, 0x0B, 0x80, 0x00, 0xA5, 0xCD, 0xC4, 0x1B, 0x80,
+  0x00, 0x9C, 0x84, 0xD7, 0x0D, 0x80, 0x00, 0xF2, 0x9E, 0xB4, 0x0B, 0x80, 0x00, 0xF2, 0xF8, 0x90,
+  0x20, 0x80, 0x00, 0x9C, 0x84, 0xD7, 0x0D, 0x80,
+};
+
+// Ocean Waves: 61 keyframes, 60.0 s, 541 bytes
+static const uint8_t RIDE_1[] PROGMEM = {
+  0x52, 0x44, 0x02, 0x3D, 0x00, 0x0B, 0x4F, 0x63, 0x65, 0x61, 0x6E, 0x20, 0x57, 0x61, 0x76, 0x65,
+  0x73, 0x3A, 0x00, 0x90, 0x0D, 0xD8, 0x04, 0x90, 0x03, 0x27, 0xE8, 0x07, 0xF4, 0x08, 0xC0, 0x02,
+  0xE8, 0x02, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xBF, 0x02, 0xC0, 0x02, 0x27, 0xE8, 0x07, 0xCB, 0x03,
+  0xC7, 0x06, 0xDC, 0x01, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0xDF, 0x08, 0x64, 0x27, 0xE8, 0x07, 0xF3,
+  0x08, 0x8F, 0x08, 0x27, 0x27, 0xE8, 0x07, 0xCB, 0x03, 0xD7, 0x04, 0x9F, 0x01, 0x25, 0xE8, 0x07,
+  0xCC, 0x03, 0x97, 0x02, 0x27, 0xE8, 0x07, 0xF4, 0x08, 0xEC, 0x04, 0xD3, 0x02, 0x27, 0xE8, 0x07,
+  0xF4, 0x08, 0xFC, 0x07, 0xE7, 0x02, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xE0, 0x08, 0xD3, 0x02, 0x27,
+  0xE8, 0x07, 0xCB, 0x03, 0xC8, 0x06, 0x97, 0x02, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0xC0, 0x02, 0x9F,
+  0x01, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0xBF, 0x02, 0x27, 0x27, 0xE8, 0x07, 0xCB, 0x03, 0xC7, 0x06,
+  0x64, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xDF, 0x08, 0xDC, 0x01, 0x27, 0xE8, 0x07, 0xF4, 0x08, 0x8F,
+  0x08, 0xC0, 0x02, 0x27, 0xE8, 0x07, 0xF4, 0x08, 0xD7, 0x04, 0xE8, 0x02, 0x25, 0xE8, 0x07, 0xCC,
+  0x03, 0xE8, 0x02, 0x27, 0xE8, 0x07, 0xCB, 0x03, 0xEC, 0x04, 0xC0, 0x02, 0x27, 0xE8, 0x07, 0xF3,
+  0x08, 0xFC, 0x07, 0xDC, 0x01, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0xE0, 0x08, 0x64, 0x27, 0xE8, 0x07,
+  0xCB, 0x03, 0xC8, 0x06, 0x27, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xC0, 0x02, 0x9F, 0x01, 0x27, 0xE8,
+  0x07, 0xF4, 0x08, 0xBF, 0x02, 0x97, 0x02, 0x27, 0xE8, 0x07, 0xF4, 0x08, 0xC7, 0x06, 0xD3, 0x02,
+  0x27, 0xE8, 0x07, 0xCC, 0x03, 0xDF, 0x08, 0xE7, 0x02, 0x27, 0xE8, 0x07, 0xCB, 0x03, 0x8F, 0x08,
+  0xD3, 0x02, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0xD7, 0x04, 0x97, 0x02, 0x25, 0xE8, 0x07, 0xF3, 0x08,
+  0x9F, 0x01, 0x27, 0xE8, 0x07, 0xCB, 0x03, 0xEC, 0x04, 0x27, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xFC,
+  0x07, 0x64, 0x27, 0xE8, 0x07, 0xF4, 0x08, 0xE0, 0x08, 0xDC, 0x01, 0x27, 0xE8, 0x07, 0xF4, 0x08,
+  0xC8, 0x06, 0xC0, 0x02, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xC0, 0x02, 0xE8, 0x02, 0x27, 0xE8, 0x07,
+  0xCB, 0x03, 0xBF, 0x02, 0xE8, 0x02, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0xC7, 0x06, 0xC0, 0x02, 0x27,
+  0xE8, 0x07, 0xF3, 0x08, 0xDF, 0x08, 0xDC, 0x01, 0x27, 0xE8, 0x07, 0xCB, 0x03, 0x8F, 0x08, 0x64,
+  0x27, 0xE8, 0x07, 0xCC, 0x03, 0xD7, 0x04, 0x27, 0x25, 0xE8, 0x07, 0xF4, 0x08, 0x9F, 0x01, 0x27,
+  0xE8, 0x07, 0xF4, 0x08, 0xEC, 0x04, 0x97, 0x02, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xFC, 0x07, 0xD3,
+  0x02, 0x27, 0xE8, 0x07, 0xCB, 0x03, 0xE0, 0x08, 0xE7, 0x02, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0xC8,
+  0x06, 0xD3, 0x02, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0xC0, 0x02, 0x97, 0x02, 0x27, 0xE8, 0x07, 0xCB,
+  0x03, 0xBF, 0x02, 0x9F, 0x01, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xC7, 0x06, 0x27, 0x27, 0xE8, 0x07,
+  0xF4, 0x08, 0xDF, 0x08, 0x64, 0x27, 0xE8, 0x07, 0xF4, 0x08, 0x8F, 0x08, 0xDC, 0x01, 0x27, 0xE8,
+  0x07, 0xCC, 0x03, 0xD7, 0x04, 0xC0, 0x02, 0x25, 0xE8, 0x07, 0xCB, 0x03, 0xE8, 0x02, 0x27, 0xE8,
+  0x07, 0xF3, 0x08, 0xEC, 0x04, 0xE8, 0x02, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0xFC, 0x07, 0xC0, 0x02,
+  0x27, 0xE8, 0x07, 0xCB, 0x03, 0xE0, 0x08, 0xDC, 0x01, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xC8, 0x06,
+  0x64, 0x27, 0xE8, 0x07, 0xF4, 0x08, 0xC0, 0x02, 0x27, 0x27, 0xE8, 0x07, 0xF4, 0x08, 0xBF, 0x02,
+  0x9F, 0x01, 0x27, 0xE8, 0x07, 0xCC, 0x03, 0xC7, 0x06, 0x97, 0x02, 0x27, 0xE8, 0x07, 0xCB, 0x03,
+  0xDF, 0x08, 0xD3, 0x02, 0x27, 0xE8, 0x07, 0xF3, 0x08, 0x98, 0x02, 0xB3, 0x01,
+};
+
+// Off-Road: 51 keyframes, 32.0 s, 535 bytes
+static const uint8_t RIDE_2[] PROGMEM = {
+  0x52, 0x44, 0x02, 0x33, 0x00, 0x08, 0x4F, 0x66, 0x66, 0x2D, 0x52, 0x6F, 0x61, 0x64, 0x7F, 0x00,
+  0x97, 0x02, 0xAF, 0x04, 0x78, 0xC4, 0x13, 0xA0, 0x1F, 0x01, 0x27, 0x90, 0x03, 0x8F, 0x03, 0xEC,
+  0x04, 0xDB, 0x01, 0x27, 0x90, 0x03, 0x13, 0x27, 0x97, 0x02, 0x27, 0x90, 0x03, 0xD8, 0x04, 0xBB,
+  0x05, 0x3C, 0x3F, 0x90, 0x03, 0x83, 0x02, 0xD0, 0x14, 0xEF, 0x06, 0xA0, 0x06, 0xD8, 0x04, 0x3F,
+  0xC0, 0x0C, 0x4F, 0xDF, 0x0D, 0x98, 0x0C, 0xC4, 0x13, 0xA0, 0x1F, 0x27, 0x90, 0x03, 0xB0, 0x04,
+  0xE7, 0x02, 0x14, 0x27, 0x90, 0x03, 0xC7, 0x06, 0xE4, 0x05, 0x9B, 0x04, 0x23, 0x90, 0x03, 0xA0,
+  0x01, 0xAF, 0x09, 0x3F, 0x90, 0x03, 0xA0, 0x10, 0x93, 0x0A, 0xA4, 0x03, 0xA0, 0x06, 0xD8, 0x04,
+  0x3F, 0xC0, 0x0C, 0x93, 0x0A, 0xB8, 0x0D, 0xDB, 0x01, 0xC4, 0x13, 0xA0, 0x1F, 0x27, 0x90, 0x03,
+  0x97, 0x07, 0xF3, 0x03, 0x97, 0x02, 0x27, 0x90, 0x03, 0xD4, 0x07, 0xC4, 0x04, 0x64, 0x27, 0x90,
+  0x03, 0x8B, 0x01, 0x28, 0x13, 0x3F, 0x90, 0x03, 0x80, 0x0A, 0x80, 0x0A, 0x93, 0x05, 0xA0, 0x06,
+  0xD8, 0x04, 0x3F, 0xC0, 0x0C, 0x93, 0x0A, 0x87, 0x09, 0xE0, 0x08, 0xC4, 0x13, 0xA0, 0x1F, 0x27,
+  0x90, 0x03, 0xF0, 0x01, 0xFB, 0x02, 0x50, 0x27, 0x90, 0x03, 0xD3, 0x07, 0xC8, 0x01, 0xB3, 0x01,
+  0x27, 0x90, 0x03, 0x3C, 0x78, 0xAF, 0x04, 0x3F, 0x90, 0x03, 0xD0, 0x0A, 0xC0, 0x0C, 0xD8, 0x04,
+  0xA0, 0x06, 0xD8, 0x04, 0x3F, 0xC0, 0x0C, 0xC7, 0x01, 0xD7, 0x0E, 0x4F, 0xC4, 0x13, 0xA0, 0x1F,
+  0x27, 0x90, 0x03, 0xB7, 0x03, 0xA4, 0x03, 0xC7, 0x01, 0x27, 0x90, 0x03, 0xFC, 0x02, 0xD8, 0x04,
+  0x14, 0x27, 0x90, 0x03, 0x97, 0x02, 0x8B, 0x0B, 0xB4, 0x01, 0x3F, 0x90, 0x03, 0xB8, 0x03, 0xCC,
+  0x1C, 0xF0, 0x06, 0xA0, 0x06, 0xD8, 0x04, 0x3F, 0xC0, 0x0C, 0x8F, 0x08, 0xC3, 0x18, 0x83, 0x07,
+  0xC4, 0x13, 0xA0, 0x1F, 0x27, 0x90, 0x03, 0xA3, 0x03, 0x78, 0x8F, 0x03, 0x27, 0x90, 0x03, 0x8C,
+  0x01, 0xFF, 0x04, 0xE0, 0x03, 0x27, 0x90, 0x03, 0x14, 0xAC, 0x02, 0xAB, 0x02, 0x3F, 0x90, 0x03,
+  0xCC, 0x12, 0xC7, 0x10, 0x4F, 0xA0, 0x06, 0xD8, 0x04, 0x3F, 0xC0, 0x0C, 0xA3, 0x0D, 0xC4, 0x18,
+  0xA4, 0x03, 0xC4, 0x13, 0xA0, 0x1F, 0x27, 0x90, 0x03, 0xF4, 0x03, 0xD3, 0x07, 0xBF, 0x02, 0x27,
+  0x90, 0x03, 0x9F, 0x06, 0xD4, 0x07, 0xA4, 0x03, 0x27, 0x90, 0x03, 0xD3, 0x02, 0xF3, 0x08, 0xC3,
+  0x04, 0x3F, 0x90, 0x03, 0xCF, 0x05, 0xA4, 0x03, 0xF4, 0x03, 0xA0, 0x06, 0xD8, 0x04, 0x3F, 0xC0,
+  0x0C, 0x84, 0x07, 0xBB, 0x05, 0xD3, 0x02, 0xC4, 0x13, 0xA0, 0x1F, 0x27, 0x90, 0x03, 0xB4, 0x01,
+  0x84, 0x07, 0xA4, 0x03, 0x27, 0x90, 0x03, 0xF4, 0x03, 0x4F, 0x83, 0x02, 0x27, 0x90, 0x03, 0x13,
+  0xE3, 0x05, 0xDC, 0x01, 0x3F, 0x90, 0x03, 0xA4, 0x08, 0x90, 0x17, 0x80, 0x05, 0xA0, 0x06, 0xD8,
+  0x04, 0x3F, 0xC0, 0x0C, 0xEF, 0x0B, 0xDF, 0x12, 0xFF, 0x09, 0xC4, 0x13, 0xA0, 0x1F, 0x27, 0x90,
+  0x03, 0x90, 0x03, 0x9B, 0x04, 0x13, 0x27, 0x90, 0x03, 0xA7, 0x05, 0xA0, 0x01, 0xDC, 0x01, 0x27,
+  0x90, 0x03, 0x83, 0x02, 0x83, 0x02, 0x9F, 0x01, 0x3F, 0x90, 0x03, 0xAF, 0x09, 0x13, 0xD7, 0x09,
+  0xA0, 0x06, 0xD8, 0x04, 0x3F, 0xC0, 0x0C, 0xD8, 0x13, 0xE8, 0x07, 0xD8, 0x09, 0xC4, 0x13, 0xA0,
+  0x1F, 0x27, 0x90, 0x03, 0xE7, 0x07, 0xA3, 0x03, 0xB4, 0x01, 0x27, 0x90, 0x03, 0xC7, 0x01, 0xA0,
+  0x06, 0xF4, 0x03, 0x27, 0x90, 0x03, 0x9C, 0x04, 0xC3, 0x04, 0xE3, 0x05, 0x3F, 0x90, 0x03, 0xAF,
+  0x0E, 0x97, 0x07, 0xA3, 0x03, 0xA0, 0x06, 0xD8, 0x04, 0x7F, 0xC0, 0x0C, 0xEC, 0x0E, 0xAC, 0x07,
+  0xF8, 0x05, 0xE8, 0x07, 0xE8, 0x07, 0x00,
+};
+
+// Off-Road as a step track: 1028 + 1022 + 454 steps, 9252 + 9234 + 8886 queue entries, 10428 bytes
+static const uint8_t TRACK_2[] PROGMEM = {
+  0x53, 0x54, 0x02, 0x01, 0x00, 0x3E, 0x10, 0x29, 0x10, 0x4A, 0x08, 0x00, 0x96, 0xA1, 0x20, 0x01,
+  0xAA, 0x82, 0x1B, 0x01, 0x8D, 0xDA, 0x07, 0x01, 0xEF, 0x81, 0x04, 0x01, 0xE2, 0x1B, 0x01, 0xF1,
+  0x81, 0x04, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xF1, 0x0D, 0x01, 0xF2, 0x81, 0x04, 0x01, 0x82, 0xE8,
+  0x07, 0x01, 0xE0, 0xF1, 0x26, 0x80, 0x00, 0xA0, 0xD2, 0x60, 0x81, 0xF0, 0x85, 0xE6, 0x01, 0x01,
+  0xDF, 0x92, 0xAE, 0x01, 0x01, 0xAD, 0xBF, 0x57, 0x81, 0xBC, 0x93, 0x7C, 0x80, 0x00, 0xD0, 0xA1,
+  0x92, 0x02, 0x81, 0xAD, 0xF6, 0x06, 0x01, 0xDD, 0xEC, 0x6D, 0x80, 0x00, 0x9F, 0xF5, 0xB7, 0x01,
+  0x01, 0xBE, 0xCC, 0x4B, 0x81, 0xE0, 0xAC, 0x75, 0x01, 0xBF, 0xBD, 0x67, 0x80, 0x00, 0x90, 0xF3,
+  0x7F, 0x81, 0xC0, 0xD5, 0x58, 0x01, 0xED, 0xFE, 0xA9, 0x01, 0x81, 0xCE, 0xAF, 0x39, 0x81, 0xE1,
+  0xC9, 0x44, 0x81, 0x8F, 0xDA, 0x07, 0x81, 0x9B, 0xD8, 0x03, 0x81, 0xE2, 0x1B, 0x81, 0xEF, 0x81,
+  0x04, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0xF2, 0x81, 0x04, 0x81, 0xF3, 0x81, 0x04, 0x81, 0xF4, 0x0D,
+  0x81, 0xF1, 0x81, 0x04, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xF3, 0x81, 0x04, 0x81, 0xEF, 0x0D, 0x81,
+  0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0xE1, 0x1B, 0x81, 0xFE, 0xF3, 0x03, 0x81, 0x8D,
+  0xE6, 0x03, 0x81, 0x9C, 0xD8, 0x03, 0x81, 0xEF, 0x0D, 0x81, 0xF0, 0x81, 0x04, 0x81, 0xFF, 0xF3,
+  0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0x89, 0xA9, 0x10, 0x81, 0xF4, 0x9D, 0x11, 0x81, 0x86, 0x8D,
+  0x03, 0x81, 0xF4, 0x81, 0x04, 0x81, 0xEE, 0xF5, 0x07, 0x81, 0x84, 0xF4, 0x03, 0x81, 0xFE, 0xB7,
+  0x17, 0x81, 0xFE, 0xF6, 0x1B, 0x80, 0x00, 0xB0, 0xD8, 0xB2, 0x01, 0x81, 0xFD, 0x80, 0x06, 0x81,
+  0xA0, 0x91, 0xAE, 0x01, 0x01, 0xDF, 0x82, 0xBB, 0x01, 0x01, 0xE0, 0xEF, 0xE6, 0x07, 0x81, 0xBF,
+  0xCD, 0x8E, 0x06, 0x01, 0xC9, 0xE9, 0x89, 0x02, 0x01, 0xA4, 0xF7, 0x04, 0x01, 0xAB, 0xB2, 0x0B,
+  0x01, 0xFF, 0xF3, 0x03, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0xFF, 0xF3, 0x03,
+  0x01, 0x80, 0xF4, 0x03, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xFF, 0xF3, 0x03,
+  0x01, 0x01, 0x01, 0xF4, 0x81, 0x04, 0x01, 0xF1, 0x81, 0x04, 0x01, 0x00, 0x01, 0xE4, 0x83, 0x08,
+  0x01, 0xF3, 0x81, 0x04, 0x01, 0xEF, 0x81, 0x04, 0x01, 0xE4, 0x8F, 0x04, 0x01, 0xF1, 0x0D, 0x01,
+  0x00, 0x01, 0xF0, 0x81, 0x04, 0x01, 0x82, 0xF4, 0x03, 0x01, 0xF0, 0xE9, 0x0B, 0x01, 0xC8, 0x8A,
+  0x28, 0x80, 0x00, 0xD0, 0xE7, 0x7C, 0x81, 0xC4, 0x9F, 0x5A, 0x81, 0xD1, 0xB5, 0x67, 0x81, 0x8D,
+  0xE6, 0x03, 0x81, 0xAA, 0x97, 0x2D, 0x80, 0x00, 0xD0, 0xF2, 0x36, 0x01, 0x84, 0xD4, 0x3E, 0x01,
+  0xDF, 0xBC, 0x4E, 0x01, 0xC0, 0xAD, 0x75, 0x81, 0xDF, 0x87, 0x9A, 0x01, 0x81, 0x9F, 0xAB, 0x01,
+  0x81, 0x8F, 0xA4, 0x28, 0x01, 0x80, 0xB0, 0x2F, 0x81, 0x90, 0xE9, 0x4F, 0x80, 0x00, 0xA0, 0xDA,
+  0x45, 0x01, 0xBF, 0xFF, 0x01, 0x01, 0x9F, 0xB9, 0x3B, 0x01, 0x80, 0x92, 0x11, 0x01, 0x89, 0x98,
+  0x2B, 0x01, 0xB1, 0x89, 0x0E, 0x01, 0xE2, 0x1B, 0x01, 0xEF, 0xDD, 0x0F, 0x01, 0xF1, 0x0D, 0x01,
+  0xF2, 0x0D, 0x01, 0xF3, 0x81, 0x04, 0x01, 0xF4, 0x81, 0x04, 0x01, 0x00, 0x01, 0xF0, 0x0D, 0x01,
+  0x90, 0xE6, 0x03, 0x01, 0x80, 0xDC, 0x0B, 0x01, 0x9A, 0xC3, 0x23, 0x80, 0x00, 0xE0, 0xEF, 0xB0,
+  0x01, 0x81, 0x98, 0xCE, 0xB2, 0x01, 0x81, 0x8F, 0x84, 0xA8, 0x01, 0x01, 0xE1, 0xBE, 0x1D, 0x81,
+  0x94, 0x9B, 0x51, 0x81, 0xB7, 0xE5, 0x65, 0x81, 0xC8, 0xC9, 0x1D, 0x81, 0xD5, 0x29, 0x81, 0x93,
+  0xF6, 0x2C, 0x81, 0x8A, 0xAA, 0x25, 0x81, 0xDE, 0xCE, 0x14, 0x81, 0xBA, 0x95, 0x10, 0x81, 0x8E,
+  0xFA, 0x26, 0x81, 0xFC, 0xBB, 0x13, 0x81, 0xDB, 0xE7, 0x6F, 0x80, 0x00, 0xA0, 0x9C, 0x25, 0x81,
+  0x80, 0xAE, 0xA8, 0x01, 0x01, 0x80, 0xD6, 0x3F, 0x81, 0xE0, 0x9A, 0x1D, 0x01, 0xDF, 0x8B, 0x82,
+  0x01, 0x01, 0xC0, 0xC8, 0xBA, 0x06, 0x81, 0x9F, 0xBF, 0x92, 0x07, 0x01, 0xD6, 0x8F, 0x0B, 0x81,
+  0x87, 0xCE, 0x18, 0x81, 0x8D, 0xB3, 0x14, 0x81, 0xB7, 0x45, 0x81, 0xAB, 0xE1, 0x25, 0x81, 0xBA,
+  0xD3, 0x25, 0x81, 0xAA, 0x9A, 0x13, 0x81, 0xE3, 0xED, 0x38, 0x81, 0xAA, 0xC5, 0x71, 0x80, 0x00,
+  0xC0, 0xDC, 0x19, 0x01, 0xDA, 0xBB, 0x23, 0x01, 0xFF, 0xF9, 0x1A, 0x01, 0xFB, 0xB7, 0x68, 0x01,
+  0xEA, 0xF6, 0x05, 0x01, 0x8D, 0xCE, 0x0B, 0x01, 0xF2, 0x0D, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0xF1,
+  0x81, 0x04, 0x01, 0x80, 0xDC, 0x0B, 0x01, 0xFF, 0xDB, 0x0B, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xF1,
+  0x81, 0x04, 0x01, 0xF0, 0x0D, 0x01, 0x90, 0xE6, 0x03, 0x01, 0xF2, 0x0D, 0x01, 0xFF, 0xF3, 0x03,
+  0x01, 0x8E, 0xE6, 0x03, 0x01, 0xF2, 0x81, 0x04, 0x01, 0x00, 0x01, 0x8E, 0xCE, 0x0B, 0x01, 0xB8,
+  0xAA, 0x22, 0x80, 0x00, 0x80, 0xFE, 0x5F, 0x81, 0xC8, 0xDD, 0xD0, 0x01, 0x01, 0xFF, 0xF8, 0xFA,
+  0x01, 0x81, 0x90, 0xE0, 0x08, 0x81, 0xBB, 0xA1, 0x0C, 0x81, 0xF4, 0x0D, 0x81, 0xE3, 0x8F, 0x04,
+  0x81, 0x01, 0x81, 0xEF, 0x81, 0x04, 0x81, 0xE4, 0x8F, 0x04, 0x81, 0x8F, 0xEB, 0x02, 0x81, 0xE6,
+  0x90, 0x05, 0x81, 0xB9, 0xB5, 0x06, 0x81, 0xF1, 0x0D, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xF1, 0x81,
+  0x04, 0x81, 0xF2, 0x81, 0x04, 0x81, 0xF1, 0xF5, 0x07, 0x81, 0x80, 0xE8, 0x07, 0x81, 0x8E, 0xE6,
+  0x03, 0x81, 0xEF, 0x0D, 0x81, 0x8C, 0xCE, 0x0B, 0x81, 0x80, 0xE8, 0x20, 0x80, 0x00, 0xF0, 0xF7,
+  0xD7, 0x01, 0x01, 0x97, 0xDB, 0x0B, 0x01, 0xD7, 0xCA, 0x05, 0x01, 0xF0, 0x99, 0x15, 0x80, 0x00,
+  0xD6, 0x96, 0xDC, 0x02, 0x81, 0xC5, 0xF9, 0x03, 0x81, 0xE3, 0xDF, 0x13, 0x81, 0xC7, 0x9F, 0x08,
+  0x81, 0xE6, 0xDF, 0x13, 0x81, 0xC7, 0xE3, 0x1B, 0x81, 0xC7, 0x37, 0x81, 0x8D, 0xE6, 0x03, 0x81,
+  0xFF, 0xCF, 0x0F, 0x81, 0x80, 0xD0, 0x0F, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0xE1, 0x1B, 0x81, 0xF0,
+  0x81, 0x04, 0x81, 0x9B, 0xD8, 0x03, 0x81, 0xE3, 0x1B, 0x81, 0x8D, 0xE6, 0x03, 0x81, 0x80, 0xF4,
+  0x03, 0x81, 0x00, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0xE4, 0x8F, 0x04, 0x81, 0xF1, 0x81, 0x04, 0x81,
+  0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0xF2, 0x81, 0x04, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0xF1, 0x0D,
+  0x81, 0x8E, 0xE6, 0x03, 0x81, 0xF1, 0x0D, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xF3, 0x0D, 0x81, 0x00,
+  0x81, 0x82, 0xE8, 0x07, 0x81, 0xF3, 0x0D, 0x81, 0xF2, 0xF5, 0x07, 0x81, 0xD6, 0xED, 0x13, 0x81,
+  0x8E, 0xE0, 0x1E, 0x80, 0x00, 0xB0, 0x8D, 0x77, 0x81, 0xB2, 0xAC, 0x25, 0x81, 0x9F, 0xC8, 0x09,
+  0x01, 0x9F, 0xAF, 0x30, 0x01, 0xDF, 0xA6, 0x09, 0x01, 0xA0, 0xBF, 0xD5, 0x01, 0x81, 0x9F, 0xAA,
+  0x4C, 0x81, 0xDF, 0x9E, 0x7D, 0x81, 0xA0, 0xFA, 0x14, 0x81, 0x80, 0xFA, 0x8D, 0x03, 0x01, 0xDF,
+  0xD9, 0x87, 0x03, 0x01, 0xA4, 0x9E, 0xA6, 0x02, 0x01, 0xBF, 0x9E, 0xEE, 0x02, 0x01, 0xAB, 0xD6,
+  0x07, 0x01, 0xEF, 0xC5, 0x07, 0x01, 0x8D, 0x0A, 0x01, 0xF0, 0x0D, 0x01, 0x9B, 0xCC, 0x07, 0x01,
+  0x80, 0xF4, 0x03, 0x01, 0xF1, 0x0D, 0x01, 0xF2, 0x0D, 0x01, 0xF2, 0x0D, 0x01, 0xF1, 0x0D, 0x01,
+  0xF4, 0x0D, 0x01, 0x03, 0x01, 0x8B, 0xE6, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0x00, 0x01, 0xF2,
+  0x0D, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0xE3, 0x8F, 0x04, 0x01, 0xE4, 0x8F, 0x04, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x00, 0x01, 0x00, 0x01, 0xF0, 0x81, 0x04, 0x01,
+  0x02, 0x01, 0xF1, 0x0D, 0x01, 0xE2, 0x83, 0x08, 0x01, 0xC8, 0xB9, 0x42, 0x80, 0x00, 0xC0, 0x99,
+  0xD2, 0x01, 0x01, 0x92, 0xC4, 0x06, 0x01, 0xC2, 0x8A, 0x03, 0x80, 0x00, 0xCE, 0xDD, 0x9D, 0x02,
+  0x01, 0x9B, 0xAC, 0x40, 0x01, 0x8B, 0xDA, 0x07, 0x01, 0x9D, 0xD8, 0x03, 0x01, 0xF1, 0x81, 0x04,
+  0x01, 0x90, 0xBF, 0x10, 0x01, 0xB9, 0xA1, 0x0C, 0x01, 0xC6, 0xAB, 0x04, 0x01, 0xC9, 0xA8, 0x07,
+  0x81, 0xD9, 0xFD, 0x05, 0x01, 0x9C, 0xE9, 0x39, 0x81, 0xFD, 0xF1, 0x41, 0x80, 0x00, 0xA0, 0xB8,
+  0x53, 0x01, 0x90, 0xC8, 0x82, 0x03, 0x81, 0xA5, 0xC6, 0xAB, 0x02, 0x81, 0x9C, 0xDB, 0x1B, 0x80,
+  0x00, 0xA0, 0x89, 0x02, 0x01, 0x9A, 0xFC, 0x0F, 0x81, 0xA0, 0xD2, 0x02, 0x81, 0xFF, 0xE3, 0x01,
+  0x01, 0xBF, 0x93, 0x2D, 0x01, 0xC9, 0x90, 0x34, 0x81, 0xF4, 0xCA, 0x07, 0x01, 0x99, 0xC0, 0x21,
+  0x81, 0xB0, 0x8D, 0x20, 0x81, 0xD5, 0x85, 0x0C, 0x81, 0xD3, 0x9D, 0x04, 0x81, 0xE3, 0x1B, 0x81,
+  0xE3, 0x8F, 0x04, 0x81, 0xF1, 0x81, 0x04, 0x81, 0x00, 0x81, 0xE1, 0x1B, 0x81, 0x01, 0x81, 0xFF,
+  0xF3, 0x03, 0x81, 0xEF, 0x0D, 0x81, 0xE2, 0x1B, 0x81, 0xE1, 0x1B, 0x81, 0xB9, 0xA4, 0x0B, 0x81,
+  0xAA, 0xB2, 0x0B, 0x81, 0xEF, 0x81, 0x04, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x81, 0xF4, 0x03, 0x81,
+  0x90, 0xE6, 0x03, 0x81, 0x8F, 0xE6, 0x03, 0x81, 0x02, 0x81, 0xB9, 0xB0, 0x07, 0x81, 0xD6, 0x88,
+  0x0B, 0x81, 0x9D, 0xD8, 0x03, 0x81, 0x90, 0xE6, 0x03, 0x81, 0x00, 0x81, 0xD4, 0x29, 0x81, 0xE1,
+  0x1B, 0x81, 0xC9, 0x7D, 0x81, 0xC3, 0x8D, 0x09, 0x81, 0xF0, 0x9A, 0x0E, 0x81, 0xF4, 0x0D, 0x81,
+  0xE0, 0x12, 0x81, 0xF4, 0x1F, 0x81, 0xE4, 0x86, 0x04, 0x81, 0x8E, 0x9B, 0x1C, 0x81, 0xAB, 0x97,
+  0x14, 0x81, 0xE6, 0xF7, 0x0B, 0x81, 0xA8, 0xA6, 0x0F, 0x81, 0xF2, 0x90, 0x18, 0x80, 0x00, 0x90,
+  0xF0, 0x60, 0x01, 0x88, 0xF0, 0xDE, 0x01, 0x81, 0xC0, 0xC1, 0x80, 0x04, 0x81, 0xBF, 0xF5, 0xB3,
+  0x04, 0x01, 0xFF, 0xDE, 0x79, 0x01, 0x8C, 0xB7, 0xED, 0x02, 0x01, 0xD9, 0xD6, 0xDE, 0x03, 0x01,
+  0xFF, 0xE7, 0x07, 0x01, 0x00, 0x01, 0x01, 0x01, 0x8B, 0xE6, 0x03, 0x01, 0xF1, 0x0D, 0x01, 0x80,
+  0xF4, 0x03, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0xF1, 0x0D, 0x01, 0xF0, 0x0D, 0x01, 0x02, 0x01, 0xF1,
+  0x0D, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xF1, 0x0D, 0x01, 0x01, 0x01, 0xF4,
+  0x0D, 0x01, 0x00, 0x01, 0xF2, 0xF5, 0x07, 0x01, 0xF1, 0xF5, 0x07, 0x01, 0xFE, 0xF3, 0x03, 0x01,
+  0x02, 0x01, 0xF1, 0x0D, 0x01, 0xE4, 0x83, 0x08, 0x01, 0xFE, 0xE7, 0x07, 0x01, 0xC8, 0x9F, 0x21,
+  0x80, 0x00, 0xC0, 0xCC, 0x1A, 0x01, 0xA4, 0xF7, 0x1C, 0x01, 0xC0, 0xF8, 0x68, 0x01, 0xAF, 0xE1,
+  0x0E, 0x01, 0xDF, 0x81, 0x1A, 0x80, 0x00, 0xC0, 0x80, 0x4C, 0x81, 0xCF, 0x91, 0x40, 0x81, 0xDF,
+  0x9D, 0x17, 0x81, 0xE0, 0xC6, 0x77, 0x01, 0x81, 0xBD, 0x96, 0x01, 0x81, 0xDB, 0xD3, 0x0D, 0x01,
+  0xE7, 0xFA, 0x12, 0x81, 0xEE, 0xEA, 0x11, 0x81, 0xAB, 0xBB, 0x08, 0x81, 0xB8, 0xA1, 0x0C, 0x81,
+  0xA7, 0xAF, 0x0C, 0x81, 0xD7, 0x29, 0x81, 0xF4, 0x0D, 0x81, 0xE3, 0x1B, 0x81, 0xFE, 0xF3, 0x03,
+  0x81, 0xDF, 0x8F, 0x04, 0x81, 0x8C, 0xDA, 0x07, 0x81, 0xAA, 0xBE, 0x07, 0x81, 0x80, 0xE5, 0x21,
+  0x80, 0x00, 0xF0, 0x9B, 0x0E, 0x81, 0xE8, 0x98, 0xFA, 0x01, 0x01, 0x9F, 0x97, 0x87, 0x01, 0x01,
+  0xB7, 0xAA, 0x83, 0x01, 0x01, 0xFF, 0x9C, 0x20, 0x01, 0xF0, 0x0D, 0x01, 0xEF, 0x0D, 0x01, 0xF3,
+  0x81, 0x04, 0x01, 0xF4, 0x81, 0x04, 0x01, 0xF3, 0x81, 0x04, 0x01, 0x02, 0x01, 0xF1, 0x0D, 0x01,
+  0xC6, 0x9F, 0x08, 0x01, 0xC5, 0x9F, 0x08, 0x01, 0x00, 0x01, 0x00, 0x01, 0xFE, 0xF3, 0x03, 0x01,
+  0xFD, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0x00, 0x01, 0xE3, 0x1B, 0x01, 0xF2, 0xF5, 0x07,
+  0x01, 0xF0, 0xF5, 0x07, 0x01, 0xAC, 0xBE, 0x20, 0x80, 0x00, 0xB0, 0x8F, 0x2D, 0x01, 0xE8, 0xCA,
+  0x81, 0x03, 0x81, 0xBB, 0x83, 0x96, 0x03, 0x81, 0xD7, 0x91, 0x08, 0x81, 0xD3, 0x29, 0x81, 0xAD,
+  0xF0, 0x07, 0x81, 0xF7, 0x18, 0x81, 0xBD, 0xEE, 0x03, 0x81, 0x9B, 0x28, 0x81, 0xC5, 0x8B, 0x0B,
+  0x81, 0xE2, 0xBF, 0x07, 0x81, 0x9E, 0xD8, 0x03, 0x81, 0x9D, 0xD8, 0x03, 0x81, 0x9E, 0xD8, 0x03,
+  0x81, 0xAB, 0xCA, 0x03, 0x81, 0xC3, 0xFB, 0x03, 0x81, 0x8A, 0x83, 0x04, 0x81, 0xB7, 0x15, 0x81,
+  0x9B, 0xD8, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x8D, 0xE6, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81,
+  0xF2, 0x81, 0x04, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0xF2, 0x0D, 0x81, 0xF3, 0x81, 0x04, 0x81, 0xF4,
+  0x81, 0x04, 0x81, 0x00, 0x81, 0xF2, 0x0D, 0x81, 0xF1, 0x0D, 0x81, 0xF0, 0x0D, 0x81, 0xEF, 0x81,
+  0x04, 0x81, 0xF2, 0x81, 0x04, 0x81, 0xF0, 0x0D, 0x81, 0xD6, 0x85, 0x0C, 0x81, 0xD3, 0x85, 0x0C,
+  0x81, 0xF1, 0x0D, 0x81, 0xF0, 0x81, 0x04, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x8C, 0xE6, 0x03, 0x81,
+  0xF4, 0x0D, 0x81, 0xE3, 0x8F, 0x04, 0x81, 0xF0, 0x81, 0x04, 0x81, 0x90, 0xE6, 0x03, 0x81, 0xFF,
+  0xF3, 0x03, 0x81, 0x9C, 0xD8, 0x03, 0x81, 0xF1, 0x81, 0x04, 0x81, 0x8E, 0xDA, 0x07, 0x81, 0xEF,
+  0x81, 0x04, 0x81, 0xA8, 0xCA, 0x03, 0x81, 0xEF, 0x0D, 0x81, 0x9C, 0xCC, 0x07, 0x81, 0xC7, 0xA7,
+  0x08, 0x81, 0xC5, 0x89, 0x0A, 0x81, 0xD6, 0xD3, 0x19, 0x81, 0x9C, 0x9C, 0x17, 0x81, 0xE1, 0xEF,
+  0x2F, 0x81, 0xDE, 0xFD, 0x3B, 0x80, 0x00, 0xE0, 0xF2, 0xAD, 0x01, 0x01, 0x80, 0xC4, 0x46, 0x01,
+  0xE0, 0xCC, 0x3C, 0x81, 0x80, 0xB2, 0xDE, 0x01, 0x01, 0xDF, 0xC7, 0x83, 0x02, 0x01, 0xA0, 0xB3,
+  0x20, 0x81, 0xC0, 0xD0, 0x48, 0x01, 0xFF, 0xD8, 0xA2, 0x01, 0x01, 0x96, 0xEA, 0x17, 0x01, 0xD5,
+  0xBE, 0x70, 0x01, 0xE3, 0x83, 0x08, 0x01, 0xD6, 0x91, 0x08, 0x01, 0xB7, 0xA1, 0x0C, 0x01, 0x01,
+  0x01, 0xEF, 0x0D, 0x01, 0xF0, 0x0D, 0x01, 0xE1, 0x1B, 0x01, 0xF0, 0x0D, 0x01, 0xEF, 0x81, 0x04,
+  0x01, 0x80, 0xF4, 0x03, 0x01, 0xF0, 0x0D, 0x01, 0xE1, 0x8F, 0x04, 0x01, 0xE4, 0x8F, 0x04, 0x01,
+  0xD7, 0x9D, 0x04, 0x01, 0xE6, 0x8F, 0x04, 0x01, 0xFF, 0xF3, 0x03, 0x02, 0xE3, 0x1B, 0x01, 0xE2,
+  0x8F, 0x04, 0x01, 0xE1, 0x8F, 0x04, 0x01, 0xF1, 0x0D, 0x01, 0xE4, 0x8F, 0x04, 0x01, 0xFF, 0xF3,
+  0x03, 0x01, 0xF1, 0x0D, 0x01, 0xF1, 0x0D, 0x01, 0xF2, 0x81, 0x04, 0x01, 0x81, 0xF4, 0x03, 0x01,
+  0xEF, 0x0D, 0x01, 0xF2, 0x81, 0x04, 0x02, 0xF1, 0x81, 0x04, 0x01, 0xF2, 0x0D, 0x01, 0x80, 0xF4,
+  0x03, 0x01, 0xF1, 0x81, 0x04, 0x01, 0x8E, 0xE6, 0x03, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0x80, 0xF4,
+  0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xF1, 0x81, 0x04, 0x01, 0x80, 0xF4,
+  0x03, 0x01, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x01, 0xF1, 0x0D, 0x01, 0x8E, 0xE6, 0x03,
+  0x01, 0xF4, 0x0D, 0x01, 0xF3, 0x0D, 0x01, 0xAC, 0xBE, 0x07, 0x01, 0x8C, 0xDA, 0x07, 0x01, 0xF3,
+  0xFB, 0x0E, 0x01, 0xB4, 0xE2, 0x26, 0x80, 0x00, 0xBF, 0x8F, 0x22, 0x01, 0xFE, 0xC9, 0x87, 0x01,
+  0x81, 0x93, 0xBE, 0x84, 0x01, 0x01, 0xF7, 0x8C, 0x12, 0x81, 0xA7, 0xDE, 0x1D, 0x01, 0xB0, 0xA0,
+  0x1F, 0x01, 0x9E, 0xAA, 0x55, 0x80, 0x00, 0xCF, 0x96, 0x51, 0x01, 0x86, 0xA7, 0x52, 0x01, 0xBF,
+  0xAD, 0x66, 0x01, 0xA0, 0x3A, 0x01, 0x9D, 0xBC, 0x43, 0x01, 0xBB, 0xB0, 0x07, 0x01, 0xB7, 0xBC,
+  0x03, 0x01, 0x9B, 0xD8, 0x03, 0x01, 0xD9, 0xAD, 0x02, 0x81, 0xD9, 0xE3, 0x0B, 0x01, 0x88, 0x88,
+  0x1F, 0x01, 0x89, 0x91, 0x15, 0x81, 0xA4, 0xEE, 0x25, 0x80, 0x00, 0xB0, 0xAA, 0x06, 0x81, 0xE0,
+  0x9B, 0xF1, 0x01, 0x01, 0xBF, 0x86, 0x4D, 0x01, 0x9F, 0xE4, 0xC4, 0x01, 0x81, 0xA0, 0xA5, 0x16,
+  0x81, 0xC5, 0x9F, 0x08, 0x81, 0xC6, 0xA2, 0x07, 0x81, 0xC8, 0x96, 0x24, 0x80, 0x00, 0xBF, 0xDD,
+  0x0E, 0x81, 0x87, 0xE2, 0x08, 0x81, 0xA0, 0x8E, 0x0C, 0x81, 0xC0, 0xBD, 0x20, 0x01, 0xBF, 0x95,
+  0x1F, 0x01, 0xA0, 0xF4, 0xBD, 0x01, 0x81, 0xDF, 0x83, 0x3F, 0x01, 0xC1, 0xED, 0x7B, 0x81, 0xE4,
+  0xE5, 0x16, 0x01, 0xBE, 0xEF, 0x13, 0x01, 0x84, 0x7C, 0x81, 0xA7, 0xEB, 0x56, 0x81, 0x84, 0xD4,
+  0x1F, 0x81, 0xC0, 0x86, 0x10, 0x81, 0x80, 0xDE, 0x78, 0x81, 0xFF, 0xE8, 0xB6, 0x01, 0x80, 0x00,
+  0xC0, 0xB7, 0x9C, 0x01, 0x01, 0x80, 0xF5, 0xF4, 0x02, 0x01, 0xA0, 0xE4, 0xC8, 0x01, 0x81, 0xFF,
+  0x94, 0x04, 0x01, 0x97, 0xA8, 0xBC, 0x04, 0x81, 0xAE, 0xE7, 0x11, 0x81, 0x81, 0xCD, 0x10, 0x81,
+  0xEF, 0x81, 0x04, 0x81, 0xE3, 0x8F, 0x04, 0x81, 0xE3, 0x1B, 0x81, 0x8D, 0xE6, 0x03, 0x81, 0xE1,
+  0x1B, 0x81, 0xF0, 0x0D, 0x81, 0x00, 0x81, 0xEF, 0x81, 0x04, 0x81, 0xF0, 0x81, 0x04, 0x81, 0xF2,
+  0x0D, 0x81, 0x00, 0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xF2, 0x0D, 0x81, 0xE4, 0x8F, 0x04,
+  0x81, 0xF2, 0x81, 0x04, 0x81, 0xF0, 0xDA, 0x10, 0x81, 0xA9, 0xDC, 0x11, 0x01, 0xE4, 0xF2, 0x24,
+  0x80, 0x00, 0x90, 0x82, 0x09, 0x01, 0xE0, 0xB1, 0x54, 0x81, 0xBF, 0xEC, 0x56, 0x81, 0xDE, 0x87,
+  0x2B, 0x01, 0xB7, 0x93, 0x2C, 0x01, 0xB7, 0xFA, 0x18, 0x01, 0xE0, 0x89, 0x01, 0x01, 0x85, 0x83,
+  0x1A, 0x01, 0xD0, 0xF2, 0x4F, 0x80, 0x00, 0xD0, 0x85, 0x8B, 0x01, 0x81, 0xD4, 0x8B, 0xA6, 0x02,
+  0x81, 0x97, 0xFF, 0x81, 0x02, 0x01, 0x93, 0xD6, 0x6D, 0x80, 0x00, 0xD0, 0x8B, 0x21, 0x01, 0xC0,
+  0xDB, 0xE2, 0x02, 0x81, 0xB3, 0x98, 0xE6, 0x02, 0x01, 0xDA, 0xEA, 0x0E, 0x01, 0xE1, 0xF7, 0x0B,
+  0x01, 0xE3, 0x1B, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0xF1, 0x81, 0x04, 0x01, 0x8E, 0xE6, 0x03, 0x01,
+  0xF2, 0x0D, 0x01, 0xF1, 0x81, 0x04, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xFD, 0xF3, 0x03, 0x01, 0xF3,
+  0x0D, 0x01, 0xE4, 0x8F, 0x04, 0x01, 0xE3, 0x1B, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0x80, 0xF4, 0x03,
+  0x01, 0x80, 0xF4, 0x03, 0x01, 0x00, 0x01, 0xF2, 0xE9, 0x0B, 0x01, 0x8E, 0xD4, 0x22, 0x80, 0x00,
+  0x90, 0xFA, 0xC5, 0x01, 0x01, 0xA8, 0xF1, 0xF7, 0x01, 0x01, 0x8B, 0xDD, 0xB0, 0x01, 0x01, 0xC5,
+  0xB5, 0x3A, 0x01, 0xB8, 0xD8, 0x59, 0x80, 0x00, 0x90, 0x91, 0x59, 0x81, 0xDB, 0x98, 0x0C, 0x01,
+  0xDF, 0xCB, 0x40, 0x01, 0xC0, 0xD6, 0x13, 0x01, 0xC0, 0xDF, 0x10, 0x81, 0xA0, 0x87, 0xB4, 0x02,
+  0x81, 0xE0, 0x8F, 0x02, 0x81, 0xFF, 0x9D, 0xA6, 0x01, 0x01, 0xDF, 0xC3, 0xBF, 0x01, 0x01, 0xE4,
+  0x81, 0xA4, 0x05, 0x81, 0xB7, 0x92, 0x90, 0x05, 0x81, 0xC4, 0xF8, 0x2D, 0x80, 0x00, 0xD0, 0xCF,
+  0x01, 0x81, 0xEF, 0xD3, 0x31, 0x81, 0xFE, 0xD3, 0x8D, 0x02, 0x81, 0x8B, 0xEC, 0xCE, 0x02, 0x81,
+  0x8F, 0xDA, 0x07, 0x81, 0xFD, 0xE7, 0x07, 0x81, 0xF2, 0x81, 0x04, 0x81, 0x8F, 0xE6, 0x03, 0x81,
+  0x02, 0x81, 0xF0, 0x0D, 0x81, 0xEF, 0x81, 0x04, 0x81, 0xAA, 0xAF, 0x0C, 0x81, 0xFF, 0xF3, 0x03,
+  0x81, 0xE3, 0x8F, 0x04, 0x81, 0xE4, 0xB5, 0x21, 0x81, 0x90, 0x1B, 0x01, 0xA1, 0x88, 0x20, 0x80,
+  0x00, 0xE0, 0xCF, 0x45, 0x81, 0xE0, 0xED, 0x2F, 0x81, 0xA0, 0xA0, 0x01, 0x81, 0xC0, 0x9C, 0xA3,
+  0x01, 0x01, 0xAD, 0xBE, 0xC4, 0x01, 0x81, 0xBA, 0xE7, 0x05, 0x81, 0xD7, 0x9D, 0x04, 0x81, 0xB5,
+  0xB9, 0x04, 0x81, 0x8C, 0xDA, 0x07, 0x81, 0x9E, 0xB1, 0x29, 0x80, 0x00, 0xDF, 0xB4, 0x15, 0x81,
+  0x98, 0xBC, 0x1D, 0x01, 0x80, 0x82, 0x9E, 0x01, 0x81, 0x9F, 0x8A, 0xB9, 0x01, 0x01, 0xB7, 0x90,
+  0x06, 0x01, 0x8F, 0xA1, 0x3B, 0x01, 0xE6, 0x93, 0x03, 0x01, 0xA2, 0x95, 0x02, 0x01, 0x9B, 0xD8,
+  0x03, 0x01, 0xF0, 0x0D, 0x01, 0xB6, 0x0F, 0x01, 0x89, 0x9C, 0x09, 0x01, 0xF6, 0xB6, 0x03, 0x01,
+  0xA6, 0x8D, 0x06, 0x01, 0x02, 0x01, 0xD4, 0x9D, 0x04, 0x01, 0xD4, 0x91, 0x08, 0x01, 0xF2, 0xB6,
+  0x1C, 0x81, 0xB7, 0xE1, 0x31, 0x80, 0x00, 0x90, 0xD1, 0x96, 0x01, 0x01, 0xA8, 0xEC, 0xF5, 0x01,
+  0x81, 0xB5, 0xD4, 0xBE, 0x01, 0x81, 0xAB, 0x8E, 0x17, 0x81, 0x8B, 0xDA, 0x07, 0x81, 0xF0, 0x0D,
+  0x81, 0xFD, 0xE7, 0x07, 0x81, 0x9B, 0x7A, 0x81, 0xF5, 0xA5, 0x11, 0x81, 0x9E, 0x9E, 0x0E, 0x81,
+  0x9E, 0xD8, 0x03, 0x81, 0x9B, 0xCC, 0x07, 0x81, 0x9A, 0xD8, 0x03, 0x81, 0x8B, 0xE6, 0x03, 0x81,
+  0x9C, 0xD8, 0x03, 0x81, 0x85, 0x8C, 0x08, 0x81, 0xF5, 0xAE, 0x02, 0x81, 0xD0, 0xFC, 0x02, 0x81,
+  0x90, 0xE6, 0x03, 0x81, 0xB0, 0x13, 0x81, 0x99, 0xE3, 0x03, 0x81, 0xCC, 0xEB, 0x03, 0x81, 0x8D,
+  0xE6, 0x03, 0x81, 0xF2, 0x0D, 0x81, 0x02, 0x81, 0xE0, 0x8F, 0x04, 0x81, 0xEF, 0x81, 0x04, 0x81,
+  0xE4, 0x1B, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xF0, 0x0D, 0x81, 0x02, 0x81,
+  0xF2, 0x0D, 0x81, 0xF3, 0x0D, 0x81, 0xD8, 0x9D, 0x04, 0x81, 0xD7, 0x9D, 0x04, 0x81, 0xF4, 0x81,
+  0x04, 0x81, 0x81, 0xF4, 0x03, 0x81, 0xEF, 0x0D, 0x81, 0xF1, 0x0D, 0x81, 0xF2, 0x81, 0x04, 0x81,
+  0xE5, 0x8F, 0x04, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xF1, 0x0D, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x8E,
+  0xE6, 0x03, 0x81, 0x9E, 0xD8, 0x03, 0x81, 0x81, 0xF4, 0x03, 0x81, 0x9E, 0xD8, 0x03, 0x81, 0x9D,
+  0xD8, 0x03, 0x81, 0x8E, 0xDA, 0x07, 0x81, 0x8B, 0xE6, 0x03, 0x81, 0x89, 0x9A, 0x07, 0x81, 0xD8,
+  0x8F, 0x03, 0x81, 0x86, 0xA8, 0x08, 0x81, 0xB8, 0xD9, 0x23, 0x81, 0x8B, 0xB6, 0x13, 0x81, 0xA8,
+  0x8B, 0x18, 0x81, 0xBA, 0xD7, 0x13, 0x80, 0x00, 0xA0, 0x94, 0x1B, 0x81, 0x92, 0x8E, 0x0D, 0x81,
+  0x80, 0x97, 0xB4, 0x02, 0x01, 0xFF, 0xD3, 0xD2, 0x02, 0x01, 0xC0, 0xD4, 0x17, 0x01, 0xC0, 0xF2,
+  0x90, 0x08, 0x81, 0xDB, 0xDE, 0xE4, 0x07, 0x01, 0xD1, 0xBD, 0x6A, 0x01, 0xF1, 0xE9, 0x0B, 0x01,
+  0xE3, 0x1B, 0x01, 0x9B, 0xD8, 0x03, 0x01, 0xF1, 0x81, 0x04, 0x01, 0x90, 0xE6, 0x03, 0x01, 0x8F,
+  0xE6, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0xF1, 0x81, 0x04, 0x01, 0xF2, 0x81, 0x04,
+  0x01, 0x02, 0x01, 0x8F, 0xE6, 0x03, 0x01, 0x9C, 0xD8, 0x03, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0xF2,
+  0x0D, 0x01, 0x9C, 0xD8, 0x03, 0x01, 0x9B, 0xD8, 0x03, 0x01, 0x9C, 0xD8, 0x03, 0x01, 0x9B, 0xD8,
+  0x03, 0x01, 0xF1, 0x0D, 0x01, 0x90, 0xE6, 0x03, 0x01, 0x9D, 0xD8, 0x03, 0x01, 0xF1, 0x0D, 0x01,
+  0x8E, 0xE6, 0x03, 0x01, 0x9B, 0xD8, 0x03, 0x01, 0xF1, 0x0D, 0x01, 0xF2, 0x0D, 0x01, 0x9C, 0xD8,
+  0x03, 0x01, 0x9B, 0xD8, 0x03, 0x01, 0xEF, 0x0D, 0x01, 0x8C, 0xE6, 0x03, 0x01, 0x9B, 0xD8, 0x03,
+  0x01, 0x82, 0xAB, 0x01, 0x01, 0xA6, 0x74, 0x01, 0x8F, 0xA6, 0x02, 0x01, 0x21, 0x01, 0xA6, 0xDF,
+  0x03, 0x01, 0x9B, 0xD8, 0x03, 0x01, 0x9E, 0xD8, 0x03, 0x01, 0xF0, 0x0D, 0x01, 0x8D, 0xE6, 0x03,
+  0x01, 0x8E, 0xE6, 0x03, 0x01, 0x00, 0x01, 0xF1, 0x0D, 0x01, 0xF2, 0x0D, 0x01, 0x80, 0xF4, 0x03,
+  0x01, 0xFD, 0xF3, 0x03, 0x01, 0xFE, 0xF3, 0x03, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xF1, 0x0D, 0x01,
+  0xE4, 0xF7, 0x0B, 0x01, 0xFE, 0xE7, 0x20, 0x80, 0x00, 0xF0, 0xE5, 0x14, 0x81, 0xF0, 0xEE, 0x1F,
+  0x81, 0xD2, 0x8F, 0xD5, 0x01, 0x01, 0xA3, 0xC5, 0xBD, 0x01, 0x80, 0x00, 0xD0, 0xC9, 0x35, 0x01,
+  0xED, 0xE6, 0x05, 0x01, 0xC0, 0xCB, 0x41, 0x81, 0xBF, 0xAF, 0x3B, 0x81, 0xCF, 0xBE, 0x54, 0x01,
+  0xBE, 0xB4, 0x03, 0x01, 0xD5, 0x91, 0x08, 0x01, 0xEF, 0x81, 0x04, 0x01, 0x85, 0xFD, 0x10, 0x01,
+  0xD0, 0xF9, 0x0A, 0x01, 0xEE, 0xBF, 0x09, 0x01, 0x9E, 0xCC, 0x07, 0x01, 0xB2, 0xEA, 0x20, 0x01,
+  0xAF, 0xD0, 0x3C, 0x80, 0x00, 0xD0, 0xDD, 0x39, 0x81, 0xA0, 0xE5, 0xF0, 0x02, 0x81, 0xE5, 0x9B,
+  0xCC, 0x02, 0x01, 0x83, 0x89, 0x0F, 0x01, 0xE5, 0x8F, 0x04, 0x01, 0xEF, 0xF5, 0x07, 0x01, 0x80,
+  0xF4, 0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0xF2, 0xF5, 0x07, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xC8,
+  0x96, 0x24, 0x80, 0x00, 0x8F, 0xE0, 0xA2, 0x01, 0x01, 0xFC, 0xAA, 0xCD, 0x01, 0x01, 0xEF, 0xB4,
+  0xE7, 0x01, 0x01, 0xC5, 0x9B, 0x0A, 0x01, 0xD6, 0xFD, 0x0E, 0x01, 0xAB, 0xBE, 0x07, 0x01, 0xB7,
+  0xBC, 0x03, 0x01, 0x9B, 0xD8, 0x03, 0x01, 0x8F, 0xE6, 0x03, 0x01, 0xAC, 0xA3, 0x10, 0x01, 0xD5,
+  0xF9, 0x0F, 0x01, 0x00, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xF9, 0xF5, 0x01, 0x81, 0xFD, 0xCA, 0x18,
+  0x01, 0xC0, 0xE3, 0x21, 0x01, 0xC6, 0xA2, 0x07, 0x01, 0xB4, 0xEF, 0x03, 0x01, 0x9F, 0xE5, 0x1C,
+  0x01, 0xFC, 0x9A, 0x36, 0x01, 0xBD, 0xFB, 0x31, 0x80, 0x00, 0xE0, 0xDF, 0x2F, 0x01, 0xA0, 0xA2,
+  0xD3, 0x01, 0x81, 0x80, 0xDE, 0x7B, 0x81, 0xDF, 0xB8, 0xF6, 0x01, 0x81, 0xA0, 0xFF, 0x53, 0x01,
+  0xE0, 0xC0, 0x94, 0x01, 0x01, 0xA0, 0xA0, 0x2A, 0x81, 0xFF, 0xE6, 0x85, 0x02, 0x81, 0xA0, 0xE4,
+  0xEA, 0x01, 0x01, 0xDF, 0xE9, 0x89, 0x01, 0x01, 0xBB, 0xDF, 0xA2, 0x01, 0x81, 0x97, 0xF1, 0x1E,
+  0x81, 0x8F, 0xDA, 0x07, 0x81, 0xA7, 0xB1, 0x0D, 0x81, 0xA6, 0xD4, 0x03, 0x81, 0xE6, 0x90, 0x02,
+  0x81, 0xE4, 0x8F, 0x04, 0x81, 0xE3, 0x83, 0x08, 0x81, 0xF2, 0x0D, 0x81, 0xF0, 0x0D, 0x81, 0x02,
+  0x81, 0xF1, 0x0D, 0x81, 0xF9, 0xF0, 0x03, 0x81, 0xD8, 0x89, 0x04, 0x81, 0xCF, 0x9A, 0x04, 0x81,
+  0xE2, 0x8F, 0x04, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xF1, 0x81, 0x04, 0x81,
+  0xF2, 0x81, 0x04, 0x81, 0x81, 0xF4, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81,
+  0x80, 0xF4, 0x03, 0x81, 0xF1, 0x81, 0x04, 0x81, 0xF0, 0x0D, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xFF,
+  0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x00, 0x81, 0x81, 0xF4, 0x03, 0x81, 0x82, 0xF4, 0x03,
+  0x81, 0xE3, 0x8F, 0x04, 0x81, 0xD6, 0x9D, 0x04, 0x81, 0xE3, 0x8F, 0x04, 0x81, 0xF0, 0x81, 0x04,
+  0x81, 0xEF, 0x0D, 0x81, 0xF2, 0x0D, 0x81, 0xF1, 0x0D, 0x81, 0xF1, 0x0D, 0x81, 0xE4, 0x1B, 0x81,
+  0x9C, 0xD8, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0xAA, 0xBE, 0x07, 0x81, 0xBA, 0xB0, 0x07, 0x81,
+  0xD0, 0xC2, 0x01, 0x81, 0xEC, 0x9F, 0x05, 0x80, 0x00, 0xB0, 0xBD, 0x1C, 0x81, 0xAC, 0xF6, 0xEB,
+  0x01, 0x01, 0xD9, 0xE9, 0xF1, 0x01, 0x01, 0xF1, 0xF5, 0x07, 0x01, 0x8D, 0xDA, 0x07, 0x01, 0xF0,
+  0x0D, 0x01, 0xEF, 0x0D, 0x01, 0xF2, 0x0D, 0x01, 0x00, 0x01, 0xF1, 0x81, 0x04, 0x01, 0x8E, 0xE6,
+  0x03, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0xF0, 0x81, 0x04, 0x01, 0xEF, 0x0D, 0x01, 0xF1, 0x0D, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x80, 0xE8, 0x07, 0x01, 0xAC, 0xBE, 0x07, 0x01, 0xC4, 0xA2, 0x20, 0x80,
+  0x00, 0xF0, 0xC6, 0x3E, 0x01, 0xD0, 0xB7, 0x96, 0x01, 0x81, 0xED, 0xFA, 0x2F, 0x81, 0xC3, 0xE3,
+  0x8C, 0x01, 0x81, 0xB7, 0xD5, 0x03, 0x81, 0xD4, 0xD9, 0x09, 0x81, 0x99, 0xD8, 0x03, 0x81, 0x81,
+  0xF4, 0x03, 0x81, 0xD4, 0x91, 0x08, 0x81, 0xE6, 0x83, 0x08, 0x81, 0x90, 0xFD, 0x18, 0x01, 0xF7,
+  0xE1, 0x2E, 0x80, 0x00, 0xA0, 0xC4, 0xC3, 0x01, 0x01, 0xA0, 0x81, 0x82, 0x01, 0x81, 0x9F, 0xE9,
+  0x2C, 0x81, 0x8D, 0xE7, 0x58, 0x81, 0xBC, 0x89, 0xA6, 0x01, 0x80, 0x00, 0xD0, 0xB1, 0x71, 0x01,
+  0xED, 0xFC, 0x4D, 0x01, 0xF6, 0xA0, 0x52, 0x01, 0xB1, 0xE3, 0x77, 0x01, 0xFD, 0xE9, 0x28, 0x81,
+  0xD0, 0x76, 0x01, 0xAE, 0xCA, 0x0B, 0x01, 0xD5, 0x9D, 0x04, 0x01, 0xF2, 0xD1, 0x13, 0x01, 0x8D,
+  0x9B, 0x1C, 0x01, 0xF1, 0x0D, 0x01, 0xE3, 0x1B, 0x01, 0xD3, 0x29, 0x01, 0xC5, 0x95, 0x0C, 0x01,
+  0xD0, 0x9E, 0x05, 0x01, 0xF6, 0x82, 0x03, 0x01, 0xF1, 0x0D, 0x01, 0x01, 0x01, 0xEF, 0x0D, 0x01,
+  0x9B, 0xD8, 0x03, 0x01, 0xD7, 0x89, 0x06, 0x01, 0x92, 0xBB, 0x08, 0x01, 0xAD, 0xBF, 0x02, 0x01,
+  0x82, 0xF4, 0x03, 0x01, 0x9D, 0xD8, 0x03, 0x01, 0x02, 0x01, 0x8C, 0xE6, 0x03, 0x01, 0x99, 0xD8,
+  0x03, 0x01, 0xA4, 0x6E, 0x01, 0xE7, 0xB4, 0x05, 0x01, 0xB4, 0xC8, 0x08, 0x01, 0xD6, 0x29, 0x01,
+  0x00, 0x01, 0xAA, 0xA3, 0x10, 0x01, 0x8D, 0xCE, 0x0B, 0x01, 0xE4, 0x1B, 0x01, 0xF2, 0x0D, 0x01,
+  0xCB, 0xA7, 0x06, 0x81, 0xD9, 0xFF, 0x07, 0x01, 0xD0, 0xE2, 0x16, 0x01, 0xE4, 0xC4, 0x1C, 0x01,
+  0xB9, 0x9E, 0x0D, 0x01, 0xF2, 0x99, 0x58, 0x01, 0xA9, 0xBF, 0x7C, 0x80, 0x00, 0xC0, 0xCB, 0x7F,
+  0x01, 0x80, 0xF7, 0x3A, 0x01, 0xA0, 0xD0, 0x04, 0x01, 0xE0, 0x9A, 0x7C, 0x81, 0xDF, 0x9D, 0x68,
+  0x81, 0xE0, 0xC4, 0xDE, 0x02, 0x81, 0x80, 0x8C, 0x0D, 0x01, 0xBF, 0xB2, 0x47, 0x81, 0xFF, 0xF4,
+  0x83, 0x02, 0x81, 0xBD, 0xAC, 0x5E, 0x01, 0x81, 0xD5, 0x1D, 0x01, 0xC0, 0xD6, 0x48, 0x81, 0xBF,
+  0xEB, 0x19, 0x81, 0x81, 0xD0, 0x0F, 0x81, 0xFD, 0xE7, 0x07, 0x81, 0x00, 0x81, 0xFD, 0xF3, 0x03,
+  0x81, 0x83, 0xF4, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x81, 0xF4, 0x03,
+  0x81, 0x80, 0xF4, 0x03, 0x81, 0x81, 0xF4, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xFD, 0xF3, 0x03,
+  0x81, 0x01, 0x81, 0x00, 0x81, 0x81, 0xF4, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0x02, 0x81, 0x01,
+  0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x01, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x82,
+  0xF4, 0x03, 0x81, 0x01, 0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80,
+  0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x81,
+  0xF4, 0x03, 0x81, 0x84, 0xF4, 0x03, 0x81, 0xFE, 0xF3, 0x03, 0x81, 0x00, 0x81, 0x80, 0xE8, 0x07,
+  0x81, 0x80, 0xD0, 0x0F, 0x81, 0x80, 0x80, 0x19, 0x80, 0x00, 0xF9, 0x9E, 0x2A, 0x81, 0x9E, 0xDA,
+  0x2C, 0x81, 0x8D, 0xC0, 0x26, 0x81, 0xE0, 0xD9, 0x18, 0x81, 0x9E, 0xF4, 0x0D, 0x81, 0xF1, 0x8F,
+  0x29, 0x81, 0xAA, 0xB1, 0x4E, 0x80, 0x00, 0x90, 0xD0, 0x42, 0x01, 0xDA, 0xE8, 0xC3, 0x01, 0x01,
+  0xDF, 0xC4, 0xAB, 0x01, 0x01, 0x85, 0x80, 0x4E, 0x01, 0xC7, 0xF0, 0x01, 0x01, 0xAB, 0xBE, 0x07,
+  0x01, 0xA7, 0xCA, 0x03, 0x01, 0xF3, 0x81, 0x04, 0x01, 0xF2, 0x0D, 0x01, 0xF2, 0x81, 0x04, 0x01,
+  0xFF, 0xF3, 0x03, 0x01, 0xF2, 0x0D, 0x01, 0x00, 0x01, 0xF2, 0x81, 0x04, 0x01, 0x8E, 0xE6, 0x03,
+  0x01, 0xD6, 0x91, 0x08, 0x01, 0xF0, 0xF2, 0x21, 0x80, 0x00, 0xD0, 0x86, 0x52, 0x81, 0x9A, 0xF0,
+  0xB5, 0x01, 0x01, 0xA2, 0x99, 0x5B, 0x80, 0x00, 0xFF, 0xFA, 0x08, 0x81, 0xF0, 0xEF, 0xE9, 0x01,
+  0x81, 0xFF, 0xEF, 0xA4, 0x04, 0x81, 0xF1, 0xF5, 0x07, 0x81, 0xF2, 0x0D, 0x81, 0xF1, 0x0D, 0x81,
+  0x00, 0x81, 0x00, 0x81, 0xE3, 0x1B, 0x81, 0x9B, 0xD8, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xE1,
+  0x1B, 0x81, 0xE2, 0x1B, 0x81, 0xF1, 0x0D, 0x81, 0x8B, 0xE1, 0x03, 0x81, 0xD9, 0x33, 0x81, 0xF4,
+  0xEE, 0x0B, 0x81, 0x82, 0xE8, 0x07, 0x81, 0xE0, 0x86, 0x20, 0x80, 0x00, 0xB0, 0xD4, 0x63, 0x01,
+  0x82, 0xAF, 0x3B, 0x01, 0xBE, 0x83, 0x88, 0x01, 0x01, 0xBD, 0xD0, 0xD2, 0x01, 0x01, 0xC7, 0x93,
+  0x0C, 0x01, 0xE4, 0xDF, 0x13, 0x01, 0xEF, 0xB9, 0x1B, 0x01, 0xF3, 0x81, 0x04, 0x01, 0xF4, 0x0D,
+  0x01, 0x01, 0x01, 0xF1, 0x0D, 0x01, 0xE6, 0x83, 0x08, 0x01, 0xD7, 0x85, 0x0C, 0x01, 0xEF, 0x0D,
+  0x01, 0x01, 0x01, 0xE1, 0x1B, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xF1, 0x81,
+  0x04, 0x01, 0xF1, 0x0D, 0x01, 0x00, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xFD, 0xF3, 0x03, 0x01, 0x8C,
+  0xE6, 0x03, 0x01, 0xF1, 0x0D, 0x01, 0xEE, 0x06, 0x01, 0x18, 0x01, 0xBF, 0x6E, 0x01, 0xB5, 0xE3,
+  0x09, 0x01, 0xFE, 0xBC, 0x0A, 0x01, 0xF4, 0x81, 0x04, 0x01, 0x01, 0x01, 0xF1, 0x0D, 0x01, 0xE6,
+  0x1B, 0x01, 0xFE, 0xF3, 0x03, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xF2, 0x0D, 0x01, 0x80, 0xF4, 0x03,
+  0x01, 0xE4, 0xF7, 0x0B, 0x01, 0xE2, 0xEB, 0x0F, 0x01, 0xC8, 0xBA, 0x18, 0x80, 0x00, 0xD0, 0xD8,
+  0x49, 0x81, 0xD2, 0xC1, 0x17, 0x81, 0xE0, 0xBE, 0x4B, 0x01, 0xBF, 0x97, 0x6E, 0x01, 0xE0, 0xA6,
+  0x93, 0x01, 0x81, 0xBF, 0xB7, 0x8B, 0x01, 0x81, 0xC0, 0xC5, 0xB1, 0x02, 0x01, 0xBF, 0xAF, 0x8F,
+  0x02, 0x01, 0xBE, 0xD1, 0xEE, 0x05, 0x81, 0xA5, 0xA1, 0xBE, 0x06, 0x81, 0xA9, 0xA6, 0x0F, 0x81,
+  0xFF, 0xF3, 0x03, 0x81, 0x8D, 0xE6, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0xF2, 0x0D,
+  0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03,
+  0x81, 0x8D, 0xE6, 0x03, 0x81, 0x8C, 0xE6, 0x03, 0x81, 0x8B, 0xE6, 0x03, 0x81, 0x80, 0xF4, 0x03,
+  0x81, 0x00, 0x81, 0x00, 0x81, 0x01, 0x81, 0xF4, 0x0D, 0x81, 0xE4, 0xDF, 0x13, 0x81, 0xFE, 0xF3,
+  0x03, 0x81, 0x8E, 0xCB, 0x25, 0x80, 0x00, 0xD0, 0xAA, 0x77, 0x81, 0xC6, 0x8B, 0x40, 0x81, 0xEF,
+  0x9F, 0x6E, 0x81, 0xF1, 0xF5, 0x07, 0x81, 0xA9, 0xCA, 0x03, 0x81, 0xF1, 0x0D, 0x81, 0xF4, 0x0D,
+  0x81, 0x83, 0xF4, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xEF, 0x0D, 0x81, 0xF0, 0x81, 0x04, 0x81,
+  0x80, 0xE8, 0x07, 0x81, 0xCF, 0x9B, 0x04, 0x81, 0x90, 0xEF, 0x13, 0x80, 0x00, 0x90, 0x9D, 0xFC,
+  0x01, 0x01, 0xDD, 0xE4, 0x10, 0x01, 0x8E, 0x22, 0x01, 0xA7, 0xB2, 0x0B, 0x01, 0x00, 0x01, 0x8F,
+  0xE6, 0x03, 0x01, 0x00, 0x01, 0x99, 0xD8, 0x03, 0x01, 0x8D, 0x85, 0x02, 0x01, 0xB4, 0xEE, 0x03,
+  0x01, 0xA7, 0xE9, 0x01, 0x01, 0x02, 0x01, 0x9A, 0xD8, 0x03, 0x01, 0x9B, 0xD8, 0x03, 0x01, 0x02,
+  0x01, 0xF0, 0x0D, 0x01, 0x9C, 0xD8, 0x03, 0x01, 0xD1, 0xD4, 0x03, 0x01, 0xEC, 0xEC, 0x03, 0x01,
+  0xBC, 0x11, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xF2, 0x0D, 0x01, 0x80, 0xDC, 0x0B, 0x01, 0xC6, 0x9F,
+  0x21, 0x80, 0x00, 0xA0, 0xF1, 0x38, 0x01, 0xA8, 0x8E, 0x64, 0x81, 0xDF, 0xAD, 0x5D, 0x81, 0xA0,
+  0xA3, 0x15, 0x81, 0xED, 0x9B, 0x33, 0x81, 0xBF, 0x87, 0x0A, 0x81, 0x8D, 0xCE, 0x0B, 0x81, 0xF2,
+  0xF5, 0x07, 0x81, 0xE3, 0xEB, 0x0F, 0x81, 0xF0, 0x81, 0x04, 0x81, 0x02, 0x81, 0xF1, 0x81, 0x04,
+  0x81, 0xF2, 0x81, 0x04, 0x81, 0xF1, 0x81, 0x04, 0x81, 0xF0, 0x0D, 0x81, 0x82, 0xF4, 0x03, 0x81,
+  0x00, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x8E, 0xE6, 0x03, 0x81, 0xF0, 0x81, 0x04, 0x81, 0x02, 0x81,
+  0x80, 0xDC, 0x0B, 0x81, 0xD4, 0x94, 0x20, 0x80, 0x00, 0xA0, 0xAC, 0x5E, 0x81, 0xFA, 0xF5, 0x82,
+  0x02, 0x81, 0xA3, 0x8F, 0xDC, 0x01, 0x81, 0x9B, 0x95, 0x43, 0x81, 0xF1, 0x81, 0x04, 0x81, 0x00,
+  0x81, 0xFF, 0xF3, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x00, 0x81, 0xEF, 0x0D, 0x81, 0xE0, 0x1B,
+  0x81, 0xEF, 0x81, 0x04, 0x81, 0x00, 0x81, 0x00, 0x81, 0xF2, 0x0D, 0x81, 0xF1, 0x0D, 0x81, 0x8D,
+  0xE6, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFF,
+  0xF3, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0xF1, 0x0D, 0x81, 0xF0, 0x0D, 0x81, 0x02, 0x81, 0x00,
+  0x81, 0x80, 0xF4, 0x03, 0x81, 0xF1, 0x81, 0x04, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xF1, 0x81, 0x04,
+  0x81, 0xF2, 0x81, 0x04, 0x81, 0x00, 0x81, 0xF1, 0x0D, 0x81, 0xF2, 0x0D, 0x81, 0x00, 0x81, 0x9E,
+  0xD8, 0x03, 0x81, 0xE2, 0x1B, 0x81, 0xF1, 0x0D, 0x81, 0xF1, 0x0D, 0x81, 0xE4, 0x8F, 0x04, 0x81,
+  0x9C, 0xD8, 0x03, 0x81, 0x00, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xF0, 0xE9, 0x0B, 0x81, 0xAA, 0xA3,
+  0x10, 0x81, 0x80, 0xFD, 0x19, 0x80, 0x00, 0xD0, 0xD9, 0x1A, 0x01, 0x88, 0xB0, 0x41, 0x81, 0xFF,
+  0xAE, 0x14, 0x81, 0xE0, 0x82, 0x88, 0x01, 0x01, 0xDF, 0x9B, 0x32, 0x81, 0xA0, 0xF0, 0x10, 0x01,
+  0xBF, 0xC0, 0xAD, 0x01, 0x01, 0xA0, 0xAA, 0x02, 0x01, 0x80, 0xE6, 0x8C, 0x01, 0x81, 0xFF, 0xEC,
+  0x6B, 0x81, 0xE0, 0xC5, 0x55, 0x81, 0x9F, 0xA4, 0x46, 0x81, 0xC0, 0xF6, 0x40, 0x01, 0xFF, 0xE0,
+  0x62, 0x01, 0x8C, 0xB0, 0x06, 0x01, 0xBD, 0xCA, 0x4E, 0x01, 0xF2, 0xC8, 0x16, 0x01, 0xA9, 0xBE,
+  0x07, 0x01, 0x9D, 0xCC, 0x07, 0x01, 0xF2, 0x0D, 0x01, 0xEF, 0x0D, 0x01, 0x8F, 0xE6, 0x03, 0x01,
+  0x02, 0x01, 0xE2, 0x1B, 0x01, 0xF1, 0x0D, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0x8E, 0xE6, 0x03, 0x01,
+  0x00, 0x01, 0x9B, 0xD8, 0x03, 0x01, 0x9E, 0xD8, 0x03, 0x01, 0xF0, 0x0D, 0x01, 0x8D, 0xE6, 0x03,
+  0x01, 0x8E, 0xE6, 0x03, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xF1, 0x81, 0x04,
+  0x01, 0xF2, 0x81, 0x04, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xF1, 0x81, 0x04,
+  0x01, 0x80, 0xF4, 0x03, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xF1, 0x81, 0x04,
+  0x01, 0xD4, 0x9D, 0x04, 0x01, 0xE1, 0x1B, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0xE4, 0x83, 0x08, 0x01,
+  0x81, 0xF4, 0x03, 0x01, 0xE1, 0x1B, 0x01, 0xD6, 0x29, 0x01, 0xF1, 0x0D, 0x01, 0xE2, 0x8F, 0x04,
+  0x01, 0x00, 0x01, 0xF4, 0x0D, 0x01, 0x8C, 0x8C, 0x21, 0x01, 0xF2, 0xC7, 0x0F, 0x80, 0x81, 0xD6,
+  0xF4, 0xC3, 0x02, 0x01, 0xD3, 0xB4, 0xD1, 0x02, 0x01, 0xA8, 0x88, 0x19, 0x01, 0xA7, 0x8B, 0x18,
+  0x01, 0x88, 0xD6, 0x08, 0x81, 0x93, 0xD8, 0x13, 0x80, 0x00, 0xA0, 0xFE, 0x30, 0x01, 0xA0, 0xC5,
+  0x1D, 0x01, 0x9F, 0xB9, 0x05, 0x01, 0xB2, 0xDA, 0xEE, 0x01, 0x81, 0x89, 0xA1, 0xF1, 0x01, 0x81,
+  0xE2, 0xA0, 0x28, 0x81, 0xF2, 0xCC, 0x04, 0x80, 0x00, 0xEB, 0xD1, 0xEE, 0x01, 0x01, 0xA9, 0xE7,
+  0x3C, 0x01, 0xC6, 0xC0, 0x16, 0x80, 0x00, 0x80, 0xC5, 0x44, 0x81, 0x88, 0xCC, 0x27, 0x81, 0x80,
+  0xB1, 0xC2, 0x04, 0x01, 0xBF, 0x87, 0x27, 0x80, 0x00, 0xC0, 0xEB, 0xD1, 0x01, 0x01, 0xBF, 0xD7,
+  0xB4, 0x04, 0x81, 0x80, 0xDC, 0x07, 0x81, 0xA0, 0x83, 0x06, 0x81, 0x80, 0xDC, 0x5A, 0x81, 0xA0,
+  0xD4, 0x1E, 0x01, 0xBF, 0x82, 0x92, 0x01, 0x01, 0xC0, 0xB7, 0x09, 0x01, 0xE0, 0xDD, 0x6D, 0x81,
+  0xA0, 0x86, 0xB6, 0x01, 0x01, 0xFF, 0xDF, 0x91, 0x02, 0x01, 0x80, 0x80, 0xE8, 0x01, 0x81, 0x9F,
+  0xEB, 0xE7, 0x01, 0x81, 0xBB, 0xB8, 0x49, 0x01, 0x98, 0xAF, 0x50, 0x81, 0xCB, 0x96, 0x56, 0x01,
+  0x80, 0xC8, 0x67, 0x81, 0xEF, 0x80, 0x4B, 0x80, 0x00, 0x90, 0x99, 0x68, 0x01, 0xD2, 0xED, 0x89,
+  0x01, 0x81, 0xB3, 0xCA, 0x9C, 0x01, 0x81, 0x8F, 0xE6, 0x03, 0x81, 0xFF, 0xE7, 0x07, 0x81, 0x80,
+  0xF4, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xE8, 0x07, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x90,
+  0xC8, 0x26, 0x80, 0x00, 0xAF, 0xB7, 0xC7, 0x01, 0x01, 0xD8, 0xCC, 0x60, 0x01, 0xC9, 0xB0, 0x87,
+  0x01, 0x01, 0xC9, 0x9F, 0x08, 0x01, 0xB5, 0xB0, 0x07, 0x01, 0xA8, 0xCA, 0x03, 0x01, 0x99, 0xD8,
+  0x03, 0x01, 0xD7, 0x94, 0x07, 0x01, 0x82, 0xF7, 0x02, 0x01, 0xE4, 0x8F, 0x04, 0x01, 0x01, 0x01,
+  0x02, 0x01, 0x9D, 0xD8, 0x03, 0x01, 0x9E, 0xD8, 0x03, 0x01, 0xFE, 0xF3, 0x03, 0x01, 0x8B, 0xE6,
+  0x03, 0x01, 0xAB, 0xBE, 0x07, 0x01, 0xAA, 0xA6, 0x0F, 0x01, 0xE6, 0x83, 0x08, 0x01, 0xD2, 0x94,
+  0x20, 0x80, 0x00, 0xA0, 0xC6, 0x04, 0x81, 0xD0, 0xBA, 0x09, 0x81, 0xDF, 0xE0, 0x06, 0x81, 0xE0,
+  0xC5, 0xF7, 0x03, 0x81, 0xDF, 0xA3, 0xF9, 0x03, 0x80, 0x00, 0xA0, 0xE9, 0x4C, 0x01, 0x9F, 0xEA,
+  0x02, 0x01, 0xA0, 0x7B, 0x01, 0xFA, 0x93, 0xA4, 0x03, 0x01, 0x93, 0xAE, 0xFC, 0x02, 0x81, 0x90,
+  0xA7, 0x10, 0x01, 0x94, 0x9B, 0x14, 0x01, 0xB7, 0xC5, 0x40, 0x01, 0xBC, 0x8B, 0x14, 0x01, 0xD2,
+  0xA0, 0x70, 0x81, 0xDF, 0xED, 0xC7, 0x01, 0x80, 0x00, 0x80, 0x93, 0x29, 0x81, 0x80, 0xB4, 0x38,
+  0x81, 0xA0, 0xF1, 0x0E, 0x81, 0x80, 0xD4, 0x3A, 0x01, 0xBF, 0xC0, 0x28, 0x01, 0xA0, 0xD5, 0xF5,
+  0x08, 0x01, 0xBF, 0xCD, 0xCF, 0x08, 0x01, 0xDE, 0xD8, 0xFB, 0x01, 0x81, 0xFD, 0xBF, 0xE2, 0x02,
+  0x81, 0xF1, 0xF5, 0x07, 0x81, 0xF1, 0x81, 0x04, 0x81, 0x8D, 0xE6, 0x03, 0x81, 0xF2, 0x0D, 0x81,
+  0xE3, 0x1B, 0x81, 0xF2, 0x0D, 0x81, 0x8D, 0xE6, 0x03, 0x81, 0x9E, 0xD8, 0x03, 0x81, 0x9D, 0xD8,
+  0x03, 0x81, 0x9C, 0xD8, 0x03, 0x81, 0x9B, 0xD8, 0x03, 0x81, 0x9C, 0xD8, 0x03, 0x81, 0x9B, 0xD8,
+  0x03, 0x81, 0x9C, 0xD8, 0x03, 0x81, 0xE4, 0x1B, 0x81, 0xEF, 0x0D, 0x81, 0xF3, 0x0D, 0x81, 0xE4,
+  0x8F, 0x04, 0x81, 0x9D, 0xCC, 0x06, 0x81, 0xD8, 0x94, 0x05, 0x81, 0xD4, 0x85, 0x0D, 0x81, 0xAA,
+  0xA9, 0x27, 0x80, 0x00, 0xE0, 0x88, 0x3B, 0x81, 0xC8, 0xAA, 0x8F, 0x01, 0x81, 0x85, 0xE2, 0x57,
+  0x01, 0xDD, 0xEA, 0x65, 0x01, 0xC5, 0xAB, 0x04, 0x01, 0xF0, 0x0D, 0x01, 0xE1, 0x1B, 0x01, 0xFF,
+  0xF3, 0x03, 0x01, 0x9C, 0xD8, 0x03, 0x01, 0xF2, 0x0D, 0x01, 0x80, 0xF4, 0x03, 0x01, 0x8E, 0xDA,
+  0x07, 0x01, 0xE2, 0xFA, 0x23, 0x80, 0x00, 0xC0, 0xE5, 0x7B, 0x01, 0xBE, 0xC4, 0x01, 0x01, 0xE0,
+  0xAC, 0x0F, 0x01, 0xC0, 0xB1, 0x0F, 0x81, 0xE0, 0xF7, 0x1C, 0x01, 0xDF, 0xD6, 0x5F, 0x81, 0xE1,
+  0xEE, 0x10, 0x01, 0xA2, 0xF1, 0x23, 0x01, 0xE2, 0xD6, 0x2F, 0x80, 0x00, 0xF2, 0xFF, 0x86, 0x02,
+  0x81, 0x99, 0xEC, 0x3F, 0x81, 0xF3, 0xE9, 0x0B, 0x81, 0xE1, 0x8F, 0x04, 0x81, 0xE4, 0x1B, 0x81,
+  0xC2, 0xF3, 0x01, 0x81, 0x98, 0xE5, 0x03, 0x81, 0xBF, 0xE8, 0x09, 0x81, 0xF4, 0x0D, 0x81, 0x9C,
+  0xD8, 0x03, 0x81, 0xF2, 0x0D, 0x81, 0xF1, 0x0D, 0x81, 0x8E, 0xE6, 0x03, 0x81, 0xF2, 0xE9, 0x0B,
+  0x81, 0x9C, 0xAE, 0x2A, 0x80, 0x00, 0xE0, 0xBC, 0x21, 0x01, 0xE4, 0xA2, 0x12, 0x01, 0xA4, 0xA2,
+  0xEA, 0x01, 0x01, 0xE9, 0x99, 0x83, 0x02, 0x01, 0xF3, 0xD1, 0x13, 0x01, 0x99, 0xC0, 0x0B, 0x01,
+  0x8F, 0xE6, 0x03, 0x01, 0xF2, 0x0D, 0x01, 0xBA, 0x95, 0x10, 0x01, 0x81, 0xA9, 0x1C, 0x01, 0xE4,
+  0x8F, 0x04, 0x01, 0xFD, 0xF3, 0x03, 0x01, 0xE5, 0x1B, 0x01, 0xE6, 0xF7, 0x0B, 0x01, 0xD7, 0x85,
+  0x0C, 0x01, 0xE1, 0x8F, 0x04, 0x01, 0x00, 0x01, 0xE3, 0x1B, 0x01, 0x00, 0x01, 0x00, 0x01, 0xFF,
+  0xF3, 0x03, 0x01, 0x9E, 0xD8, 0x03, 0x01, 0x9D, 0xC0, 0x0B, 0x01, 0x8E, 0xDA, 0x07, 0x01, 0x90,
+  0xE6, 0x03, 0x01, 0x81, 0xF4, 0x03, 0x01, 0x8E, 0xE6, 0x03, 0x01, 0xF4, 0x0D, 0x01, 0xF3, 0x0D,
+  0x01, 0x00, 0x01, 0xF4, 0x0D, 0x01, 0xFE, 0xF3, 0x03, 0x01, 0xEF, 0x81, 0x04, 0x01, 0xA9, 0xDE,
+  0x02, 0x01, 0xE7, 0xF3, 0x01, 0x01, 0x82, 0xD4, 0x08, 0x01, 0xE6, 0x1B, 0x01, 0x8C, 0xE6, 0x03,
+  0x01, 0xA9, 0xCA, 0x03, 0x01, 0xF0, 0xF5, 0x07, 0x01, 0xFD, 0xF3, 0x03, 0x01, 0xB8, 0xD9, 0x23,
+  0x01, 0xD3, 0xE1, 0x17, 0x01, 0xF0, 0xE9, 0x0B, 0x01, 0xF4, 0xD1, 0x13, 0x01, 0xB6, 0xBC, 0x1C,
+  0x80, 0x00, 0x80, 0xA3, 0x9F, 0x01, 0x81, 0xBE, 0xED, 0xA8, 0x01, 0x01, 0xDF, 0xD8, 0x17, 0x81,
+  0xC0, 0x92, 0x86, 0x03, 0x01, 0x9F, 0xB0, 0x86, 0x04, 0x01, 0xE0, 0xDD, 0x46, 0x81, 0xEC, 0x85,
+  0x37, 0x81, 0xD7, 0xCA, 0xE7, 0x01, 0x81, 0x9E, 0x9B, 0x19, 0x81, 0xD3, 0xC6, 0x0C, 0x81, 0x8D,
+  0x1A, 0x81, 0xCB, 0xDB, 0x03, 0x81, 0xA7, 0xF2, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xF3, 0x81,
+  0x04, 0x81, 0xA9, 0xCA, 0x03, 0x81, 0xAA, 0xCA, 0x03, 0x81, 0xF4, 0x0D, 0x81, 0x8F, 0xE6, 0x03,
+  0x81, 0x8E, 0xE6, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x00, 0x81, 0xF4, 0x81, 0x04, 0x81, 0x81,
+  0xF4, 0x03, 0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x8D, 0xE6, 0x03, 0x81, 0xF1, 0x81, 0x04,
+  0x81, 0xD6, 0xF9, 0x0F, 0x81, 0xF1, 0xE9, 0x0B, 0x81, 0xF0, 0x81, 0x04, 0x81, 0xF4, 0x81, 0x04,
+  0x81, 0x8D, 0xE6, 0x03, 0x81, 0xF0, 0x81, 0x04, 0x81, 0xD6, 0x9D, 0x04, 0x81, 0xF1, 0x0D, 0x81,
+  0xD2, 0x9E, 0x06, 0x01, 0xAF, 0x97, 0x14, 0x81, 0xA6, 0xD0, 0x46, 0x80, 0x00, 0xAF, 0xE6, 0x04,
+  0x01, 0xBC, 0xDB, 0x30, 0x81, 0xBF, 0x9E, 0x2F, 0x81, 0xA4, 0xE6, 0x19, 0x01, 0xBB, 0xB0, 0x50,
+  0x01, 0xD5, 0x91, 0x08, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xE3, 0x8F, 0x04, 0x01, 0xAA, 0xBE, 0x07,
+  0x01, 0xAC, 0xCA, 0x03, 0x01, 0xE2, 0x85, 0x08, 0x01, 0xC3, 0xE4, 0x03, 0x80, 0x00, 0xAF, 0xD6,
+  0xF0, 0x01, 0x01, 0x90, 0xE7, 0x32, 0x81, 0xF3, 0xC2, 0x36, 0x81, 0x81, 0xE8, 0x07, 0x81, 0xE7,
+  0xD9, 0x0D, 0x81, 0xA6, 0x99, 0x08, 0x81, 0xA6, 0xE8, 0x01, 0x81, 0x00, 0x81, 0xF9, 0xD1, 0x01,
+  0x81, 0xCA, 0xB5, 0x0B, 0x81, 0xFB, 0xC5, 0x05, 0x81, 0xE6, 0x83, 0x08, 0x81, 0xA8, 0xAF, 0x25,
+  0x80, 0x00, 0xA0, 0xA2, 0x5B, 0x01, 0xD0, 0xC4, 0xAD, 0x02, 0x01, 0xDB, 0xBF, 0xC3, 0x02, 0x01,
+  0xBD, 0x98, 0x08, 0x01, 0x98, 0xB0, 0x07, 0x01, 0xC2, 0xA8, 0x25, 0x80, 0x00, 0xDF, 0xFC, 0x69,
+  0x81, 0xB1, 0xC9, 0x0C, 0x81, 0xC0, 0xDF, 0xBF, 0x01, 0x01, 0xFF, 0xE0, 0xD3, 0x01, 0x81, 0x9F,
+  0xB0, 0x13, 0x01, 0xEC, 0xC3, 0x05, 0x81, 0xB4, 0xD6, 0x06, 0x81, 0x8D, 0xD7, 0x08, 0x81, 0xC7,
+  0x37, 0x81, 0xE1, 0x83, 0x08, 0x81, 0xF3, 0x0D, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x90, 0xD5, 0x01,
+  0x81, 0xBD, 0xEA, 0x0E, 0x81, 0xAE, 0xA1, 0x09, 0x81, 0x8C, 0xE6, 0x03, 0x81, 0x8B, 0xE6, 0x03,
+  0x81, 0x80, 0xF4, 0x03, 0x81, 0x8F, 0xE6, 0x03, 0x81, 0x8B, 0xE6, 0x03, 0x81, 0xA5, 0xA1, 0x07,
+  0x81, 0x90, 0x86, 0x0B, 0x81, 0xFA, 0x2A, 0x81, 0x8F, 0xE6, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81,
+  0x9B, 0xD8, 0x03, 0x81, 0xF1, 0x0D, 0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xF1, 0x81, 0x04,
+  0x81, 0xF2, 0x0D, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x8E, 0xE6, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81,
+  0xF1, 0x0D, 0x81, 0x9B, 0xD8, 0x03, 0x81, 0x8E, 0xE6, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0xFE,
+  0xF3, 0x03, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03,
+  0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0xE0, 0x1B, 0x81, 0xDF, 0x1B,
+  0x81, 0xE0, 0x8F, 0x04, 0x81, 0xEF, 0x81, 0x04, 0x81, 0xD6, 0x9D, 0x04, 0x81, 0x00, 0x81, 0x81,
+  0xF4, 0x03, 0x81, 0xE6, 0x8F, 0x04, 0x81, 0xE2, 0x8F, 0x04, 0x81, 0xD6, 0x85, 0x0C, 0x81, 0xC7,
+  0x87, 0x10, 0x81, 0xE4, 0x83, 0x08, 0x81, 0xEF, 0x81, 0x04, 0x81, 0x8C, 0xE6, 0x03, 0x81, 0x8E,
+  0x9E, 0x1B, 0x81, 0xB7, 0x89, 0x14, 0x81, 0xE4, 0x83, 0x08, 0x81, 0x8E, 0xAA, 0x17, 0x81, 0xC6,
+  0xC0, 0x16, 0x80, 0x00, 0xD0, 0xC7, 0x0D, 0x81, 0xA8, 0xDE, 0xD7, 0x01, 0x01, 0xA0, 0xAF, 0x89,
+  0x03, 0x01, 0x9F, 0xF8, 0x78, 0x81, 0xFF, 0xB1, 0xE1, 0x02, 0x81, 0xC9, 0xB5, 0x7A, 0x01, 0xBF,
+  0xE6, 0x45, 0x01, 0xF1, 0xE9, 0x0B, 0x01, 0xF1, 0x0D, 0x01, 0xF3, 0x81, 0x04, 0x01, 0xFD, 0xF3,
+  0x03, 0x01, 0x00, 0x01, 0x90, 0xE6, 0x03, 0x01, 0x9F, 0xE8, 0x03, 0x01, 0xD1, 0xFD, 0x03, 0x01,
+  0xE2, 0xFF, 0x03, 0x01, 0xF1, 0x0D, 0x01, 0x00, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0xF2, 0x81, 0x04,
+  0x01, 0xE3, 0x8F, 0x04, 0x01, 0xF2, 0x81, 0x04, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0xF1, 0x0D, 0x01,
+  0x90, 0xE6, 0x03, 0x01, 0x9D, 0xD8, 0x03, 0x01, 0xF1, 0x0D, 0x01, 0xF2, 0x0D, 0x01, 0x9C, 0xD8,
+  0x03, 0x01, 0x9B, 0xD8, 0x03, 0x02, 0xF1, 0x0D, 0x01, 0xF2, 0x0D, 0x01, 0xF1, 0x0D, 0x01, 0x90,
+  0xE6, 0x03, 0x01, 0x9D, 0xD8, 0x03, 0x01, 0xE3, 0x1B, 0x02, 0xF2, 0x0D, 0x01, 0xAA, 0x0B, 0x01,
+  0xE1, 0x08, 0x01, 0xB9, 0x10, 0x01, 0x82, 0xF4, 0x03, 0x03, 0x8F, 0xE6, 0x03, 0x01, 0xF1, 0x0D,
+  0x01, 0xE4, 0x1B, 0x01, 0xF1, 0x0D, 0x01, 0x9E, 0xD8, 0x03, 0x02, 0x9D, 0xD8, 0x03, 0x01, 0xF1,
+  0x0D, 0x01, 0x80, 0xF4, 0x03, 0x02, 0x8D, 0xE6, 0x03, 0x01, 0x9E, 0xD8, 0x03, 0x01, 0xAB, 0xCA,
+  0x03, 0x01, 0x9C, 0xD8, 0x03, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x82, 0xF4, 0x03, 0x01, 0x01, 0x01,
+  0xF2, 0x0D, 0x01, 0xF1, 0x81, 0x04, 0x01, 0xF2, 0x81, 0x04, 0x01, 0x9C, 0xD8, 0x03, 0x01, 0x99,
+  0xD8, 0x03, 0x01, 0x01, 0x01, 0x80, 0xF4, 0x03, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xE4, 0x1B, 0x01,
+  0xD4, 0x85, 0x0C, 0x01, 0x80, 0xE5, 0x21, 0x80, 0x00, 0xC0, 0x81, 0x0F, 0x81, 0xA8, 0xDD, 0x03,
+  0x81, 0xFA, 0x80, 0x5E, 0x81, 0xAF, 0xB5, 0x83, 0x01, 0x81, 0xE1, 0xF7, 0x0B, 0x81, 0xE2, 0x1B,
+  0x81, 0xE1, 0x8F, 0x04, 0x81, 0xF0, 0x0D, 0x81, 0xD3, 0x9D, 0x04, 0x81, 0xC6, 0x9F, 0x08, 0x81,
+  0xC5, 0x9F, 0x08, 0x81, 0xF2, 0x81, 0x04, 0x81, 0x81, 0xF4, 0x03, 0x81, 0xE1, 0x1B, 0x81, 0xE4,
+  0x8F, 0x04, 0x81, 0xD5, 0x9D, 0x04, 0x81, 0xE4, 0x8F, 0x04, 0x81, 0xF1, 0x0D, 0x81, 0xF0, 0x81,
+  0x04, 0x81, 0x02, 0x81, 0xD6, 0x85, 0x0C, 0x81, 0xB6, 0xB3, 0x1F, 0x80, 0x00, 0xE0, 0x8F, 0x1B,
+  0x01, 0xF0, 0xE6, 0x4B, 0x81, 0x90, 0xB8, 0x97, 0x01, 0x01, 0xA9, 0xDD, 0x83, 0x02, 0x01, 0xA9,
+  0xB2, 0x0B, 0x01, 0xE1, 0x1B, 0x01, 0x9D, 0xD8, 0x03, 0x01, 0xF1, 0x81, 0x04, 0x01, 0xF4, 0x81,
+  0x04, 0x01, 0x81, 0xF4, 0x03, 0x01, 0xF2, 0x0D, 0x01, 0xE3, 0x1B, 0x01, 0xE4, 0x1B, 0x01, 0xEF,
+  0x0D, 0x01, 0xFE, 0xF3, 0x03, 0x01, 0xFF, 0xE7, 0x07, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xF1, 0x0D,
+  0x01, 0xF2, 0x0D, 0x01, 0xEF, 0x0D, 0x01, 0xF0, 0x0D, 0x01, 0x9C, 0xD8, 0x03, 0x01, 0x9B, 0xD8,
+  0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0x90, 0xE6, 0x03, 0x01, 0xD2, 0x29, 0x01, 0xD8, 0x85, 0x0C,
+  0x01, 0xF0, 0xF8, 0x1F, 0x80, 0x00, 0xF0, 0xEE, 0x06, 0x81, 0xBE, 0x96, 0x85, 0x03, 0x81, 0xF5,
+  0xDB, 0x9E, 0x03, 0x81, 0xB7, 0x98, 0x0F, 0x81, 0xE5, 0xFC, 0x0A, 0x81, 0x82, 0xEF, 0x06, 0x81,
+  0xD6, 0x27, 0x81, 0xF0, 0x81, 0x04, 0x81, 0xF1, 0x81, 0x04, 0x81, 0xE6, 0x1B, 0x81, 0x8C, 0xE6,
+  0x03, 0x81, 0xE1, 0x1B, 0x81, 0x9A, 0xB4, 0x0F, 0x81, 0xD3, 0xEA, 0x07, 0x81, 0xF2, 0xCB, 0x14,
+  0x80, 0x00, 0x90, 0xF2, 0x98, 0x01, 0x01, 0x8C, 0xF8, 0x9A, 0x01, 0x01, 0x99, 0xB2, 0x8F, 0x01,
+  0x01, 0xE3, 0xDF, 0x13, 0x01, 0xFF, 0x93, 0x23, 0x01, 0x80, 0xA0, 0x1F, 0x01, 0xFF, 0xE7, 0x07,
+  0x01, 0xF1, 0x81, 0x04, 0x01, 0xF4, 0x0D, 0x01, 0xF3, 0x0D, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0xF2,
+  0x81, 0x04, 0x01, 0xF1, 0x0D, 0x01, 0xF2, 0x0D, 0x01, 0xF2, 0x81, 0x04, 0x01, 0xF2, 0xF5, 0x07,
+  0x01, 0xF0, 0x81, 0x04, 0x01, 0x82, 0xC4, 0x13, 0x01, 0xF0, 0x87, 0x1B, 0x80, 0x00, 0xF0, 0x82,
+  0x56, 0x01, 0xBA, 0x9B, 0x16, 0x01, 0xFF, 0xEC, 0x18, 0x81, 0xDF, 0xA6, 0x06, 0x81, 0xFF, 0x93,
+  0x0B, 0x81, 0x80, 0xB5, 0xB5, 0x01, 0x81, 0xFF, 0xBC, 0x1D, 0x01, 0xA0, 0xDA, 0x38, 0x01, 0xDF,
+  0xC5, 0x26, 0x01, 0x9F, 0xBC, 0x7B, 0x01, 0xC0, 0xBF, 0x3A, 0x81, 0x9F, 0x98, 0x71, 0x81, 0xDF,
+  0xEA, 0x01, 0x81, 0xA0, 0xBB, 0x8D, 0x03, 0x81, 0xB3, 0x82, 0x80, 0x02, 0x81, 0x87, 0xEF, 0xA9,
+  0x01, 0x81, 0xF3, 0xF5, 0x07, 0x81, 0x8B, 0xDA, 0x07, 0x81, 0xF1, 0x0D, 0x81, 0x00, 0x81, 0xFF,
+  0xF3, 0x03, 0x81, 0xF2, 0xF5, 0x07, 0x81, 0x81, 0xE8, 0x07, 0x81, 0xEF, 0x0D, 0x81, 0xF2, 0x81,
+  0x04, 0x81, 0xF1, 0x81, 0x04, 0x81, 0xF1, 0x0D, 0x81, 0xF2, 0x0D, 0x81, 0x80, 0xF4, 0x03, 0x81,
+  0xFF, 0xF3, 0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xF1, 0x0D, 0x81, 0xF2, 0x0D, 0x81, 0xFE, 0xE7,
+  0x07, 0x81, 0x9E, 0xCC, 0x07, 0x81, 0xF2, 0xF2, 0x21, 0x80, 0x00, 0xB0, 0xC5, 0x32, 0x01, 0xBE,
+  0xD7, 0xB3, 0x02, 0x01, 0xAF, 0xE2, 0xCD, 0x02, 0x01, 0xE3, 0xF7, 0x0B, 0x01, 0xA9, 0xCA, 0x03,
+  0x01, 0x00, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0xE4, 0x8F, 0x04, 0x01, 0xFE, 0xF3, 0x03, 0x01, 0xD8,
+  0x85, 0x0C, 0x01, 0xB6, 0xA4, 0x24, 0x80, 0x00, 0x80, 0xEC, 0x67, 0x01, 0xFE, 0xA5, 0xAC, 0x01,
+  0x81, 0xA1, 0xCC, 0xB7, 0x01, 0x81, 0x9B, 0x97, 0x21, 0x81, 0x99, 0xAF, 0x15, 0x81, 0xCE, 0xD1,
+  0x0C, 0x81, 0xFE, 0xF3, 0x03, 0x81, 0xA7, 0xCA, 0x03, 0x81, 0xF0, 0x0D, 0x81, 0xE4, 0xF7, 0x0B,
+  0x81, 0xC8, 0x93, 0x25, 0x80, 0x00, 0xEF, 0xE6, 0x1A, 0x01, 0xD8, 0xA6, 0x2C, 0x01, 0x80, 0x85,
+  0x1B, 0x01, 0xE0, 0xCD, 0x66, 0x81, 0xF3, 0xAD, 0xDD, 0x01, 0x81, 0xBA, 0xDE, 0x08, 0x81, 0xC5,
+  0x96, 0x0B, 0x81, 0xB1, 0xE5, 0x07, 0x81, 0xE4, 0x77, 0x81, 0xC0, 0xFB, 0x06, 0x81, 0x9B, 0xD8,
+  0x03, 0x81, 0x80, 0xF4, 0x03, 0x81, 0xF0, 0x0D, 0x81, 0x82, 0xDC, 0x0B, 0x81, 0xA5, 0xC3, 0x14,
+  0x81, 0x9E, 0xE3, 0x31, 0x80, 0x00, 0xC0, 0xC3, 0xD0, 0x01, 0x01, 0xA0, 0xB6, 0x5B, 0x81, 0xA1,
+  0xE9, 0x80, 0x01, 0x01, 0xD0, 0x9C, 0x41, 0x01, 0xC6, 0x98, 0x10, 0x01, 0x8B, 0xE8, 0x61, 0x01,
+  0xE2, 0xCC, 0x1F, 0x01, 0xA9, 0x53, 0x01, 0xF1, 0x9C, 0x1E, 0x01, 0x90, 0x82, 0x17, 0x01, 0x9D,
+  0x4D, 0x01, 0xE3, 0xCD, 0x19, 0x01, 0x9C, 0x9F, 0x16, 0x01, 0x02, 0x01, 0xB8, 0x45, 0x01, 0xAF,
+  0xB0, 0x13, 0x01, 0xB4, 0xDB, 0x0C, 0x01, 0x8A, 0xC4, 0x07, 0x01, 0xB5, 0xA0, 0x07, 0x01, 0x88,
+  0xFB, 0x1B, 0x01, 0xFB, 0xB3, 0x13, 0x01, 0xAA, 0x88, 0x19, 0x01, 0xFF, 0xC0, 0x14, 0x01, 0xA7,
+  0x88, 0x0D, 0x81, 0xE7, 0xCE, 0x07, 0x01, 0xD6, 0xF9, 0x1B, 0x01, 0xD3, 0x29, 0x01, 0xD9, 0x5A,
+  0x81, 0xAF, 0x83, 0x1F, 0x01, 0xC2, 0xEA, 0x32, 0x01, 0xAC, 0x85, 0x1A, 0x01, 0xFD, 0xE1, 0x2A,
+  0x01, 0x88, 0x91, 0x27, 0x80, 0x00, 0xD0, 0x69, 0x01, 0xDF, 0xB8, 0x0C, 0x01, 0xE0, 0xDA, 0x8D,
+  0x01, 0x81, 0xC0, 0xC3, 0xCA, 0x06, 0x01, 0x9F, 0xC1, 0x81, 0x05, 0x81, 0xFF, 0xCE, 0x8F, 0x02,
+  0x81, 0xFF, 0xDB, 0x1B, 0x81, 0xBB, 0xB7, 0x61, 0x81, 0x92, 0x87, 0x1F, 0x81, 0xD5, 0xFC, 0x0E,
+  0x81, 0x9B, 0xD8, 0x03, 0x81, 0x8F, 0xE6, 0x03, 0x81, 0x8B, 0xE6, 0x03, 0x81, 0xB8, 0x89, 0x14,
+  0x81, 0xB9, 0x89, 0x14, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xD4, 0x9D, 0x04, 0x81, 0xAC, 0xCA, 0x03,
+  0x81, 0xF0, 0xDD, 0x0F, 0x81, 0xE4, 0xCD, 0x32, 0x80, 0x00, 0xC8, 0x82, 0x97, 0x01, 0x81, 0xC7,
+  0xAD, 0x46, 0x81, 0xEF, 0xF5, 0x07, 0x81, 0xF1, 0x81, 0x04, 0x81, 0x8D, 0xE6, 0x03, 0x81, 0xFE,
+  0xF3, 0x03, 0x81, 0xE1, 0x8F, 0x04, 0x81, 0xE4, 0x8F, 0x04, 0x81, 0xF1, 0x81, 0x04, 0x81, 0x80,
+  0xF4, 0x03, 0x81, 0xF2, 0x81, 0x04, 0x81, 0x80, 0xE8, 0x07, 0x81, 0x8C, 0xDD, 0x1F, 0x80, 0x00,
+  0xC0, 0xAD, 0x4D, 0x01, 0xB0, 0x9D, 0x58, 0x01, 0xC0, 0xEF, 0x52, 0x01, 0xC1, 0xA4, 0xCA, 0x01,
+  0x01, 0xE5, 0x83, 0x08, 0x01, 0x8B, 0xE6, 0x03, 0x01, 0xB6, 0xA1, 0x0C, 0x01, 0x99, 0xB1, 0x10,
+  0x01, 0xE2, 0x8F, 0x04, 0x01, 0x00, 0x01, 0xF4, 0x81, 0x04, 0x01, 0xC4, 0xAD, 0x46, 0x80, 0x00,
+  0xB0, 0xEF, 0xDC, 0x01, 0x01, 0xBE, 0xBE, 0x40, 0x01, 0x9D, 0x81, 0x02, 0x80, 0x00, 0x9F, 0xAA,
+  0x97, 0x01, 0x81, 0xEA, 0x80, 0x8B, 0x01, 0x01, 0xEB, 0xCD, 0xE6, 0x01, 0x01, 0xF1, 0xDC, 0x39,
+  0x01, 0xB8, 0xD0, 0x26, 0x01, 0x8B, 0xDA, 0x07, 0x01, 0x9D, 0xD8, 0x03, 0x01, 0x9B, 0xD8, 0x03,
+  0x01, 0x8D, 0xE6, 0x03, 0x01, 0xD6, 0x29, 0x01, 0xF3, 0x81, 0x04, 0x01, 0x9E, 0x99, 0x18, 0x01,
+  0xE3, 0xEB, 0x0F, 0x01, 0xE4, 0x8F, 0x04, 0x01, 0xD6, 0x9F, 0x2D, 0x01, 0x9A, 0xB9, 0x50, 0x80,
+  0x00, 0xD0, 0x93, 0x07, 0x01, 0xA1, 0x85, 0x3F, 0x01, 0x80, 0xD5, 0xE5, 0x04, 0x81, 0xBF, 0x8C,
+  0xAB, 0x04, 0x01, 0x80, 0xD2, 0xF5, 0x01, 0x01, 0xFF, 0xA0, 0xE2, 0x01, 0x81, 0xDF, 0xA9, 0x57,
+  0x81, 0xA0, 0xC0, 0x05, 0x81, 0xC0, 0x89, 0x90, 0x01, 0x01, 0xE0, 0xBF, 0x4C, 0x01, 0xFF, 0xE4,
+  0xE2, 0x01, 0x01, 0xFF, 0xB8, 0x03, 0x01, 0x8D, 0xCA, 0x0C, 0x81, 0xC1, 0xF5, 0x1D, 0x81, 0xD1,
+  0xFD, 0x0F, 0x81, 0xFB, 0xF9, 0x03, 0x81, 0xED, 0x85, 0x04, 0x81, 0x02, 0x81, 0xAB, 0xB2, 0x0B,
+  0x81, 0xAC, 0xB2, 0x0B, 0x81, 0xF1, 0x81, 0x04, 0x81, 0xE2, 0x1B, 0x81, 0xEF, 0x0D, 0x81, 0x9C,
+  0xD8, 0x03, 0x81, 0xD5, 0x88, 0x0B, 0x81, 0xBA, 0xB0, 0x07, 0x81, 0x01, 0x81, 0xF4, 0x0D, 0x81,
+  0xF3, 0x0D, 0x81, 0x82, 0xF4, 0x03, 0x81, 0xF2, 0x0D, 0x81, 0x85, 0xE6, 0x0A, 0x81, 0xD0, 0xA7,
+  0x0A, 0x81, 0xA8, 0xC0, 0x04, 0x81, 0xC6, 0xAB, 0x04, 0x81, 0x9C, 0xB1, 0x10, 0x81, 0xA3, 0xEF,
+  0x0E, 0x01, 0xC8, 0xAF, 0x1C, 0x80, 0x00, 0xC0, 0x9D, 0x09, 0x01, 0xC0, 0xD9, 0x14, 0x01, 0xC0,
+  0xB4, 0x7F, 0x81, 0xA9, 0xF7, 0x94, 0x01, 0x01, 0xDC, 0x87, 0x0C, 0x01, 0xA9, 0xD8, 0x28, 0x01,
+  0x81, 0xF4, 0x03, 0x01, 0x9E, 0xD8, 0x03, 0x01, 0xF2, 0x81, 0x04, 0x01, 0x8C, 0xCE, 0x0B, 0x01,
+  0xAC, 0xA6, 0x28, 0x80, 0x00, 0x90, 0xE0, 0x4A, 0x01, 0xB2, 0xCF, 0xA9, 0x01, 0x81, 0x8F, 0x96,
+  0xA6, 0x01, 0x01, 0x93, 0xF3, 0x37, 0x01, 0x8D, 0xDA, 0x07, 0x01, 0x8D, 0xE6, 0x03, 0x01, 0xE3,
+  0x8F, 0x04, 0x01, 0xF2, 0x0D, 0x01, 0x90, 0xE6, 0x03, 0x01, 0x8F, 0xE6, 0x03, 0x01, 0xF1, 0x0D,
+  0x01, 0xA7, 0x9F, 0x06, 0x01, 0xA6, 0x80, 0x05, 0x01, 0x90, 0x85, 0x05, 0x01, 0xF2, 0x81, 0x04,
+  0x01, 0x9E, 0xCC, 0x07, 0x01, 0x8C, 0xDA, 0x20, 0x80, 0x00, 0xF0, 0xF3, 0xDE, 0x01, 0x81, 0xDA,
+  0xD3, 0x31, 0x81, 0xC9, 0xB4, 0x59, 0x81, 0xD5, 0x9D, 0x04, 0x81, 0x9B, 0xD8, 0x03, 0x81, 0xF1,
+  0x0D, 0x81, 0x00, 0x81, 0x8E, 0xE6, 0x03, 0x81, 0x8D, 0xE6, 0x03, 0x81, 0x01, 0x81, 0xEF, 0x0D,
+  0x81, 0x00, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x82, 0xF4, 0x03, 0x81, 0x9A, 0xC0, 0x0B, 0x81, 0xC6,
+  0x9C, 0x22, 0x80, 0x00, 0xD0, 0xA8, 0x40, 0x01, 0xBE, 0x95, 0x83, 0x01, 0x81, 0xDF, 0xE3, 0x7D,
+  0x81, 0x96, 0xE6, 0x63, 0x01, 0x8D, 0xAD, 0x48, 0x01, 0xA5, 0x9C, 0x5C, 0x01, 0xD8, 0xA7, 0x3C,
+  0x01, 0xDD, 0xE6, 0x07, 0x01, 0x9B, 0xC3, 0x0A, 0x01, 0xD6, 0xB7, 0x25, 0x01, 0x9D, 0xDA, 0x2C,
+  0x01, 0x9B, 0x97, 0x05, 0x81, 0xD3, 0xC5, 0x1E, 0x01, 0xF2, 0xC7, 0x2A, 0x01, 0xC6, 0x99, 0x0A,
+  0x01, 0xC1, 0xD4, 0x2C, 0x01, 0xE6, 0xCB, 0x2D, 0x01, 0xC7, 0xCD, 0x17, 0x01, 0xBA, 0xE4, 0x1F,
+  0x01, 0x94, 0xF5, 0x43, 0x81, 0xA9, 0xB9, 0x7E, 0x80, 0x00, 0x90, 0xB4, 0x29, 0x81, 0xE0, 0xD6,
+  0x90, 0x02, 0x01, 0xA0, 0xB9, 0x52, 0x81, 0x80, 0xB8, 0x53, 0x01, 0xC0, 0xBE, 0x51, 0x01, 0x9F,
+  0xE8, 0xCA, 0x02, 0x81, 0x9F, 0x9A, 0x22, 0x81, 0x9D, 0xE7, 0x6C, 0x01, 0xDE, 0x9A, 0x41, 0x81,
+  0xC1, 0xC0, 0x29, 0x81, 0xFD, 0xB7, 0x17, 0x81, 0xFD, 0xDB, 0x0B, 0x81, 0x81, 0xF4, 0x03, 0x81,
+  0x81, 0xE8, 0x07, 0x81, 0x84, 0xF4, 0x03, 0x81, 0x83, 0xF4, 0x03, 0x81, 0x04, 0x81, 0xFE, 0xE7,
+  0x07, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x80, 0xDC, 0x0B, 0x81, 0x80, 0xB8, 0x17, 0x81, 0x80, 0xD0,
+  0x28, 0x80, 0x81, 0x80, 0x05, 0x81, 0xC0, 0xE4, 0x4C, 0x01, 0xD3, 0xA0, 0x02, 0x81, 0xB7, 0x99,
+  0x1B, 0x01, 0xEC, 0xD9, 0x32, 0x80, 0x00, 0x90, 0xA5, 0x0E, 0x01, 0xC0, 0xAA, 0xAD, 0x04, 0x01,
+  0xDF, 0xD9, 0x96, 0x04, 0x80, 0x00, 0xD0, 0xB8, 0x50, 0x01, 0xF0, 0xDD, 0x82, 0x02, 0x01, 0x9B,
+  0x95, 0xCF, 0x02, 0x01, 0xAC, 0xF0, 0x20, 0x01, 0x9E, 0xA6, 0x03, 0x80, 0x00, 0x9F, 0xD8, 0x02,
+  0x81, 0xA2, 0xFB, 0xBF, 0x01, 0x01, 0xA0, 0xA4, 0x08, 0x01, 0x93, 0xAD, 0xA2, 0x01, 0x81, 0x88,
+  0xB3, 0x38, 0x80, 0x00, 0xB0, 0xE8, 0x87, 0x01, 0x81, 0x8C, 0x95, 0x62, 0x01, 0xE5, 0xB6, 0xEC,
+  0x01, 0x01, 0xCC, 0xB7, 0x3F, 0x01, 0xEF, 0xD7, 0x59, 0x01, 0xF2, 0xBC, 0x3E, 0x01, 0x8F, 0xC5,
+  0x0E, 0x01, 0xFD, 0xEA, 0x06, 0x01, 0xD7, 0xA0, 0x03, 0x01, 0xF3, 0xF5, 0x0C, 0x81, 0x93, 0xE9,
+  0x1D, 0x01, 0x98, 0xCE, 0x2B, 0x01, 0x9D, 0xA8, 0x07, 0x81, 0xA7, 0xB5, 0x22, 0x01, 0xB8, 0xC7,
+  0x35, 0x01, 0xAA, 0xE2, 0x78, 0x01, 0xAB, 0xAB, 0x1E, 0x80, 0x00, 0xE0, 0xB6, 0xAC, 0x02, 0x81,
+  0xDE, 0xC4, 0xFC, 0x04, 0x01, 0xDF, 0x9D, 0xC0, 0x05, 0x01, 0xBF, 0xB8, 0x10, 0x01, 0xE0, 0x93,
+  0x07, 0x01, 0xA0, 0xA4, 0x8F, 0x01, 0x81, 0xBF, 0xDF, 0x8D, 0x01, 0x81, 0xA0, 0x06, 0x81, 0xF2,
+  0x88, 0x77, 0x81, 0xC5, 0x87, 0x9F, 0x01, 0x81, 0xE5, 0xEB, 0x0F, 0x81, 0xF4, 0x0D, 0x81, 0xE5,
+  0x83, 0x08, 0x81, 0xF4, 0x81, 0x04, 0x81, 0xF0, 0x81, 0x04, 0x81, 0xE1, 0x83, 0x08, 0x81, 0x00,
+  0x81, 0x01, 0x81, 0xE1, 0x8F, 0x04, 0x81, 0xE4, 0x8F, 0x04, 0x81, 0x00, 0x81, 0xF3, 0x0D, 0x81,
+  0xF4, 0x0D, 0x81, 0x8E, 0xE6, 0x03, 0x81, 0xFF, 0xF3, 0x03, 0x81, 0xF0, 0xF5, 0x07, 0x81, 0xEF,
+  0x0D, 0x81, 0x8E, 0xC2, 0x0F, 0x81, 0xD4, 0xFF, 0x26, 0x80, 0x00, 0xC0, 0xB5, 0x36, 0x81, 0xDA,
+  0xC1, 0x47, 0x81, 0xC0, 0xCE, 0xE0, 0x01, 0x80, 0x00, 0xC0, 0xD9, 0x8B, 0x02, 0x01, 0xFB, 0xC7,
+  0xDB, 0x02, 0x01, 0x80, 0xB1, 0x13, 0x01, 0x8D, 0xCE, 0x0B, 0x01, 0x8F, 0xE6, 0x03, 0x01, 0xFD,
+  0xF3, 0x03, 0x01, 0x8C, 0xDA, 0x07, 0x01, 0xB3, 0x82, 0x0C, 0x01, 0xB2, 0xEC, 0x08, 0x01, 0xBC,
+  0xFE, 0x3A, 0x80, 0x00, 0x90, 0xC0, 0x93, 0x01, 0x01, 0xB2, 0xC1, 0x70, 0x81, 0xDF, 0xEB, 0x5B,
+  0x81, 0xBF, 0x5F, 0x81, 0xFF, 0x87, 0x30, 0x80, 0x00, 0xE0, 0xE2, 0xF4, 0x01, 0x01, 0xE8, 0xF3,
+  0x7B, 0x81, 0xCF, 0xF7, 0x7A, 0x01, 0xC8, 0xF3, 0x36, 0x81, 0x9E, 0xCE, 0x0B, 0x81, 0x9D, 0xD8,
+  0x03, 0x81, 0x8E, 0xCD, 0x35, 0x81, 0xB9, 0xD1, 0x32, 0x81, 0xD3, 0x88, 0x03, 0x80, 0x00, 0xF0,
+  0xE5, 0x43, 0x81, 0x80, 0xC1, 0xDF, 0x02, 0x01, 0x9F, 0x81, 0xE5, 0x02, 0x01, 0xE0, 0x9B, 0xE0,
+  0x06, 0x01, 0xBD, 0xB2, 0xBC, 0x02, 0x01, 0x83, 0xAE, 0xFF, 0x03, 0x80, 0x00, 0xD6, 0xD8, 0xC9,
+  0x01, 0x01, 0xEF, 0xD0, 0x56, 0x01, 0xF1, 0x81, 0x04, 0x01, 0x8E, 0x98, 0x36, 0x80, 0x00, 0xD0,
+  0x86, 0x2B, 0x01, 0xB6, 0xBB, 0x0C, 0x01, 0xFF, 0xA7, 0x0F, 0x01, 0xFA, 0xA7, 0x72, 0x81, 0xAF,
+  0xCD, 0x82, 0x01, 0x81, 0xF2, 0xE6, 0x25, 0x80, 0x00, 0xB0, 0xCD, 0xDC, 0x01, 0x81, 0xCF, 0xA9,
+  0x4A, 0x01, 0x88, 0xA8, 0x0D, 0x81, 0xD3, 0xA9, 0x40, 0x80, 0x00, 0xB0, 0xF9, 0x2A, 0x81, 0x80,
+  0x86, 0x9C, 0x02, 0x01, 0xFF, 0xF0, 0xBD, 0x01, 0x01, 0xBE, 0xFC, 0xB8, 0x01, 0x01, 0x9B, 0x96,
+  0xBC, 0x01, 0x81, 0xA7, 0xC0, 0x56, 0x01, 0x94, 0xD2, 0x44, 0x01, 0x9B, 0xA5, 0x14, 0x01, 0x9B,
+  0xD8, 0x03, 0x01, 0x8F, 0xE6, 0x03, 0x01, 0xF4, 0xF5, 0x07, 0x01, 0xA8, 0xBB, 0x85, 0x01, 0x01,
+  0xD3, 0xF8, 0x20, 0x80, 0x00, 0xA0, 0xAE, 0x7C, 0x01, 0xF2, 0xEA, 0x28, 0x01, 0xC0, 0xC0, 0x88,
+  0x04, 0x81, 0xDF, 0xB1, 0xED, 0x01, 0x01, 0xFF, 0xC7, 0xE0, 0x01, 0x81, 0xC4, 0xAD, 0x33, 0x81,
+  0xBF, 0x83, 0x93, 0x02, 0x81, 0xF1, 0xDD, 0x0F, 0x81, 0xF1, 0x81, 0x04, 0x81, 0xF2, 0x0D, 0x81,
+  0xFF, 0xF3, 0x03, 0x81, 0x00, 0x81, 0xF1, 0x0D, 0x81, 0x8F, 0xE6, 0x03, 0x81, 0x82, 0xF4, 0x03,
+  0x81, 0xF1, 0x0D, 0x81, 0xF2, 0x81, 0x04, 0x81, 0x00, 0x81, 0x8E, 0xE6, 0x03, 0x81, 0xF2, 0xDD,
+  0x0F, 0x81, 0xC6, 0x87, 0x29, 0x80, 0x00, 0xE0, 0xA7, 0x43, 0x81, 0xFA, 0xA9, 0x81, 0x02, 0x81,
+  0xE3, 0x9A, 0x84, 0x02, 0x01, 0x8B, 0xC0, 0x11, 0x80, 0x00, 0xEF, 0xF0, 0x9A, 0x01, 0x81, 0xB4,
+  0xC6, 0xED, 0x01, 0x01, 0xAB, 0xCC, 0xEA, 0x01, 0x01, 0xA1, 0x91, 0x39, 0x01, 0xBC, 0x8C, 0x37,
+  0x01, 0xD0, 0xAB, 0x15, 0x01, 0x93, 0xED, 0x38, 0x80, 0x00, 0x9D, 0xE8, 0x80, 0x02, 0x01, 0xB6,
+  0x8E, 0x0F, 0x01, 0xAA, 0xBB, 0x08, 0x01, 0x8D, 0xA7, 0x18, 0x01, 0x01, 0x01, 0xBE, 0xC7, 0x04,
+  0x81, 0xA1, 0xBE, 0x15, 0x01, 0xC8, 0xBE, 0x45, 0x80, 0x00, 0x88, 0xC3, 0xBD, 0x02, 0x81, 0x9C,
+  0xFD, 0x31, 0x81, 0xCF, 0xA1, 0x54, 0x81, 0x88, 0xCE, 0x07, 0x81, 0xF4, 0x91, 0x54, 0x81, 0xD3,
+  0xE9, 0x3E, 0x81, 0x9C, 0xA5, 0x91, 0x01, 0x81, 0xF3, 0xAC, 0x7F, 0x81, 0x90, 0x81, 0x03, 0x80,
+  0x00, 0x90, 0xFD, 0x76, 0x81, 0xE0, 0xF8, 0xA7, 0x08, 0x01, 0xDF, 0xFC, 0x96, 0x08, 0x01, 0xFF,
+  0xB2, 0x14, 0x01, 0x80, 0xB7, 0x90, 0x03, 0x81, 0xA9, 0x80, 0xF2, 0x01, 0x01, 0xAB, 0xB3, 0x27,
+  0x80, 0x00, 0xA0, 0xFF, 0x2B, 0x81, 0x88, 0xF3, 0xB0, 0x01, 0x01, 0xE3, 0xCD, 0xF4, 0x02, 0x01,
+  0xB2, 0xF6, 0x38, 0x01, 0xDF, 0xDF, 0x3A, 0x01, 0xA0, 0xF9, 0x49, 0x01, 0xDF, 0xB6, 0x3F, 0x80,
+  0x00, 0x90, 0xF1, 0x5F, 0x81, 0xA0, 0xE0, 0x35, 0x81, 0x9F, 0xC6, 0x02, 0x81, 0xA0, 0xF4, 0xDC,
+  0x01, 0x01, 0x9F, 0xB7, 0xCF, 0x01, 0x01, 0xBF, 0xCC, 0x07, 0x80, 0x00, 0xDD, 0xA8, 0xAA, 0x02,
+  0x81, 0xA6, 0xCE, 0x19, 0x81, 0xBA, 0x9B, 0x27, 0x80, 0x00, 0xC0, 0xBD, 0x39, 0x81, 0xC8, 0x84,
+  0xB8, 0x02, 0x81, 0xD5, 0x96, 0xF3, 0x01, 0x81, 0xE3, 0xE8, 0x8D, 0x01, 0x81, 0xE3, 0x83, 0x08,
+  0x81, 0xFD, 0xE7, 0x07, 0x81, 0xA9, 0x97, 0x26, 0x81, 0xB4, 0xF2, 0x15, 0x81, 0xF6, 0xA4, 0x10,
+  0x81, 0xF0, 0xF5, 0x07, 0x81, 0xD6, 0x91, 0x08, 0x81, 0xFE, 0xF2, 0xC0, 0x02, 0x80, 0x00, 0xE0,
+  0xE4, 0x62, 0x81, 0xAF, 0x80, 0x6D, 0x81, 0x9F, 0xEB, 0xBF, 0x01, 0x81, 0xE0, 0xC1, 0x0F, 0x81,
+  0x80, 0xC6, 0xED, 0x03, 0x01, 0xBF, 0xA2, 0xBC, 0x03, 0x01, 0xA0, 0xAF, 0x4B, 0x81, 0xBF, 0xEB,
+  0x32, 0x81, 0xD3, 0xD2, 0x08, 0x01, 0xA1, 0xD9, 0x78, 0x01, 0x8D, 0xB6, 0x13, 0x01, 0xFD, 0xF3,
+  0x03, 0x01, 0x8F, 0xE6, 0x03, 0x01, 0xAB, 0xE6, 0x03, 0x01, 0xA7, 0xF7, 0x0B, 0x01, 0xD4, 0xDD,
+  0x0F, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x80, 0xF4, 0x03, 0x01, 0x00, 0x01, 0x80, 0xF4, 0x03, 0x01,
+  0xF4, 0x81, 0x04, 0x01, 0xEE, 0xD4, 0x12, 0x01, 0xBE, 0xBC, 0x14, 0x01, 0xCB, 0xD4, 0x29, 0x80,
+  0x00, 0xCF, 0xA7, 0x1C, 0x01, 0xDE, 0xFC, 0x46, 0x01, 0xF0, 0xF0, 0x33, 0x01, 0xE9, 0x96, 0x6C,
+  0x01, 0xAC, 0xF3, 0x1F, 0x01, 0xC8, 0xF3, 0x05, 0x80, 0x00, 0xEA, 0xB2, 0xA2, 0x02, 0x81, 0x9D,
+  0xA2, 0x2E, 0x81, 0x8D, 0xDA, 0x07, 0x81, 0xEF, 0x0D, 0x81, 0xF0, 0x0D, 0x81, 0x9C, 0xC0, 0x0B,
+  0x81, 0x80, 0xD9, 0x25, 0x80, 0x00, 0x90, 0xE5, 0xA5, 0x01, 0x01, 0x9A, 0xB6, 0x8D, 0x01, 0x01,
+  0xD1, 0xE3, 0xAE, 0x01, 0x01, 0xFF, 0xE7, 0x07, 0x01, 0x80, 0xE8, 0x07, 0x01, 0xD6, 0x88, 0x24,
+  0x80, 0x00, 0xAF, 0x8E, 0xA0, 0x02, 0x81, 0x98, 0xCC, 0x0C, 0x81, 0xDF, 0xE7, 0x0D, 0x81, 0x80,
+  0xF4, 0x22, 0x81, 0xE0, 0xB5, 0x12, 0x01, 0x82, 0xEF, 0x0F, 0x01, 0xE3, 0xBF, 0x80, 0x01, 0x01,
+  0xE2, 0xCC, 0x91, 0x02, 0x81, 0xC0, 0xA0, 0x21, 0x80, 0x00, 0xD0, 0xA9, 0xFA, 0x02, 0x01, 0xA0,
+  0xBB, 0x66, 0x01, 0xA8, 0x9F, 0x86, 0x03, 0x81, 0xBD, 0xC0, 0xDF, 0x05, 0x81, 0xE1, 0xDF, 0x13,
+  0x81, 0xBE, 0xCE, 0x44, 0x81, 0xFD, 0xC9, 0x7A, 0x81, 0xF0, 0xA2, 0x78, 0x81, 0xB7, 0xF2, 0x6D,
+  0x80, 0x00, 0xB0, 0xFA, 0x2C, 0x81, 0xC4, 0xF8, 0xC7, 0x01, 0x01, 0xA7, 0x9A, 0xC9, 0x01, 0x01,
+  0x90, 0xC7, 0x23, 0x01, 0xD7, 0xB4, 0x01, 0x01, 0xD3, 0xDF, 0x24, 0x01, 0xC0, 0xB1, 0x62, 0x80,
+  0x00, 0xA0, 0xB3, 0x90, 0x01, 0x81, 0xC0, 0x8D, 0xA5, 0x01, 0x81, 0xF7, 0xCB, 0xEA, 0x01, 0x81,
+  0xE2, 0x94, 0x2C, 0x81, 0xE4, 0xB9, 0x0F, 0x80, 0x00, 0x90, 0xEC, 0x3F, 0x81, 0xED, 0xC4, 0x10,
+  0x81, 0xE0, 0xE9, 0x0A, 0x81, 0xA4, 0xCD, 0x3B, 0x01, 0xE9, 0xA3, 0x76, 0x01, 0xF3, 0xE9, 0x0B,
+  0x01, 0xE6, 0xF7, 0x0B, 0x01, 0xE5, 0xEB, 0x0F, 0x01, 0xF4, 0x81, 0x04, 0x01, 0xF0, 0xE9, 0x0B,
+  0x01, 0x9C, 0xB4, 0x28, 0x80, 0x00, 0xC0, 0x97, 0x66, 0x01, 0xBA, 0xE2, 0x6A, 0x01, 0xEF, 0xAB,
+  0x10, 0x81, 0xFF, 0x98, 0x77, 0x01, 0x83, 0x93, 0x0A, 0x81, 0x90, 0xF8, 0x1A, 0x81, 0xC3, 0xBA,
+  0x0E, 0x01, 0xAF, 0xDA, 0x33, 0x81, 0xD8, 0xB6, 0x40, 0x81, 0xC7, 0xC2, 0x03, 0x81, 0xA7, 0xD1,
+  0x1D, 0x81, 0x80, 0x82, 0x60, 0x81, 0xAF, 0x8F, 0x79, 0x80, 0x00, 0x90, 0x87, 0x87, 0x01, 0x81,
+  0xA0, 0xE6, 0x9C, 0x01, 0x81, 0x80, 0xC2, 0x0C, 0x01, 0xFF, 0xA9, 0x45, 0x01, 0xE0, 0xF6, 0x07,
+  0x01, 0xC0, 0xA6, 0xF0, 0x03, 0x81, 0xDF, 0x82, 0x8F, 0x04, 0x81, 0x80, 0xA8, 0x21, 0x81, 0xA0,
+  0x90, 0x19, 0x01, 0xC0, 0xBB, 0x35, 0x01, 0xB2, 0x87, 0x8D, 0x03, 0x01, 0x83, 0xD2, 0x8C, 0x04,
+  0x01, 0xC5, 0xE6, 0x3F, 0x01, 0xB2, 0x88, 0x3E, 0x01, 0xDB, 0xC8, 0x16, 0x01, 0xC2, 0x81, 0x1D,
+  0x80, 0x00, 0x80, 0xD7, 0x57, 0x81, 0xD2, 0x92, 0xEB, 0x01, 0x81, 0xB7, 0x89, 0x87, 0x02, 0x81,
+  0xAB, 0xD2, 0x2A, 0x81, 0xAA, 0xF6, 0x1E, 0x81, 0xFD, 0xF3, 0x03, 0x81, 0x8C, 0xC2, 0x0F, 0x81,
+  0xC8, 0x87, 0x29, 0x80, 0x00, 0xE0, 0xEE, 0xC0, 0x01, 0x81, 0xEC, 0x9F, 0x33, 0x01, 0xF9, 0xD5,
+  0x5F, 0x01, 0x8D, 0xDA, 0x07, 0x01, 0x8E, 0xDA, 0x07, 0x01, 0xD6, 0x82, 0x26, 0x80, 0x00, 0xC7,
+  0xBA, 0xAB, 0x02, 0x81, 0xAB, 0xE2, 0x14, 0x81, 0x9C, 0x92, 0x5D, 0x80, 0x00, 0x80, 0xEC, 0x94,
+  0x01, 0x81, 0xAC, 0xA6, 0xDE, 0x01, 0x81, 0x9B, 0xF3, 0xE2, 0x01, 0x81, 0xFF, 0xE3, 0x32, 0x81,
+  0xC7, 0x8A, 0x0F, 0x81, 0xF2, 0xD6, 0x3B, 0x81, 0xD5, 0xF2, 0x3B, 0x81, 0xE4, 0xEB, 0x0F, 0x81,
+  0x91, 0xEE, 0x16, 0x01, 0xDB, 0x90, 0x02, 0x81, 0xBF, 0xCB, 0x1E, 0x01, 0xC0, 0xE9, 0x75, 0x80,
+  0x00, 0xA0, 0xE3, 0xC5, 0x01, 0x81, 0x9F, 0x98, 0x39, 0x81, 0xBF, 0x93, 0x1D, 0x81, 0xA0, 0x86,
+  0x0A, 0x81, 0x80, 0xD2, 0x70, 0x01, 0xBF, 0xBF, 0x6F, 0x01, 0xE0, 0x51, 0x01, 0xE0, 0xB0, 0xB3,
+  0x01, 0x81, 0xFF, 0xE1, 0x8E, 0x01, 0x81, 0x80, 0x90, 0x84, 0x01, 0x01, 0xDF, 0x92, 0x76, 0x01,
+  0xD6, 0xB6, 0x64, 0x01, 0x8D, 0xCF, 0xCC, 0x01, 0x01, 0xD4, 0x9D, 0x04, 0x01, 0x8D, 0xBF, 0x10,
+  0x01, 0xF1, 0x81, 0x04, 0x01, 0x00, 0x01, 0xBA, 0x95, 0x10, 0x01, 0x9B, 0xB1, 0x10, 0x01, 0x01,
+  0x01, 0x82, 0xF4, 0x03, 0x01, 0xE5, 0x1B, 0x01, 0xEF, 0x0D, 0x01, 0x9C, 0xC0, 0x0B, 0x01, 0xF2,
+  0xEC, 0x0A, 0x01, 0x82, 0x98, 0x07, 0x01, 0x93, 0xE0, 0x0A, 0x80, 0x00, 0xB0, 0xD5, 0x0F, 0x01,
+  0xE0, 0xC3, 0x1A, 0x01, 0x80, 0x9D, 0x11, 0x01, 0xE0, 0xD4, 0x55, 0x81, 0x9F, 0x85, 0x48, 0x81,
+  0xE0, 0x81, 0x02, 0x81, 0xBF, 0xDD, 0x53, 0x80, 0x00, 0xF0, 0xA4, 0x90, 0x02, 0x01, 0x80, 0x80,
+  0x09, 0x81, 0xF0, 0x9E, 0x25, 0x81, 0xBF, 0xBA, 0x12, 0x01, 0x91, 0xAB, 0x1F, 0x81, 0xA4, 0xE2,
+  0x59, 0x80, 0x00, 0x90, 0xBB, 0x0A, 0x01, 0xFE, 0xF6, 0x25, 0x81, 0x9F, 0xC3, 0x2B, 0x81, 0xFF,
+  0xBA, 0x0B, 0x81, 0xFA, 0xB0, 0x99, 0x01, 0x01, 0xF3, 0x87, 0xA3, 0x01, 0x01, 0xBC, 0xBC, 0x1C,
+  0x80, 0x00, 0xDF, 0xCA, 0x73, 0x01, 0xA1, 0x1F, 0x01, 0xE0, 0xCB, 0x1F, 0x01, 0xC4, 0xFD, 0x30,
+  0x01, 0xBB, 0xFD, 0x8E, 0x01, 0x01, 0xF3, 0x81, 0x04, 0x01, 0xEF, 0xF5, 0x07, 0x01, 0xFF, 0xF3,
+  0x03, 0x01, 0x00, 0x01, 0xF1, 0x0D, 0x01, 0xFF, 0xF3, 0x03, 0x01, 0x01, 0x01, 0xEF, 0x0D, 0x01,
+  0xF2, 0x81, 0x04, 0x01, 0xF2, 0x0D, 0x01, 0xE4, 0x1B, 0x01, 0xAA, 0xE4, 0x24, 0x01, 0xD5, 0xED,
+  0x13, 0x01, 0xC7, 0xBD, 0x03, 0x81, 0xFD, 0xAB, 0x11, 0x01, 0xB4, 0xCC, 0x33, 0x81, 0xE9, 0x8A,
+  0x33, 0x80, 0x00, 0xB0, 0xAC, 0x9E, 0x01, 0x01, 0x80, 0x9E, 0xF4, 0x02, 0x81, 0xBF, 0xDB, 0x94,
+  0x01, 0x01, 0xFF, 0xD5, 0x9E, 0x01, 0x01, 0xBF, 0xDB, 0x07, 0x01, 0xC0, 0x91, 0xC7, 0x02, 0x81,
+  0xBF, 0x98, 0x59, 0x81, 0xC0, 0x89, 0x2C, 0x81, 0xE5, 0x96, 0x31, 0x81, 0xF9, 0x80, 0xF6, 0x01,
+  0x81, 0xD5, 0xA2, 0x2C, 0x81, 0xF4, 0x0D, 0x81, 0xF3, 0x81, 0x04, 0x81, 0xF1, 0x0D, 0x81, 0xC8,
+  0x93, 0x0C, 0x81, 0xB7, 0x95, 0x10, 0x81, 0xF0, 0x81, 0x04, 0x81, 0xEF, 0x0D, 0x81, 0x01, 0x81,
+  0xEF, 0x0D, 0x81, 0x80, 0xF4, 0x03, 0x81, 0x01, 0x81, 0x9E, 0xCC, 0x07, 0x81, 0x9C, 0xC0, 0x0B,
+  0x81, 0x80, 0xC7, 0x2B, 0x80, 0x00, 0xD0, 0x82, 0xA5, 0x01, 0x81, 0xBB, 0xCB, 0x0E, 0x81, 0xA0,
+  0xEF, 0x1C, 0x81, 0xAA, 0xBB, 0x21, 0x80, 0x00, 0x80, 0x92, 0x62, 0x01, 0xC4, 0xEB, 0x08, 0x01,
+  0xB2, 0x81, 0x1B, 0x81, 0xD7, 0xBC, 0x7F, 0x81, 0x8F, 0xCE, 0x0B, 0x81, 0x00, 0x81, 0xC9, 0x37,
+  0x81, 0x85, 0xAD, 0x16, 0x81, 0xEC, 0xA4, 0x22, 0x81, 0xBA, 0x98, 0x28, 0x80, 0x00, 0xEB, 0xF1,
+  0x8D, 0x02, 0x01, 0xD5, 0xF3, 0x2A, 0x01, 0xFD, 0xDB, 0x0B, 0x01, 0xE5, 0x8F, 0x04, 0x01, 0xE6,
+  0x8F, 0x04, 0x01, 0xF3, 0x81, 0x04, 0x01, 0xBA, 0x89, 0x14, 0x01, 0xD5, 0x9D, 0x04, 0x01, 0x80,
+  0xC4, 0x2C, 0x80, 0x00, 0x80, 0x8A, 0x4F, 0x01, 0xA4, 0x87, 0x03, 0x01, 0xC0, 0xA9, 0x06, 0x01,
+  0xA0, 0xF7, 0x9B, 0x01, 0x81, 0xFF, 0xE0, 0xBF, 0x01, 0x01, 0xC0, 0xC2, 0x25, 0x81, 0xE9, 0xA0,
+  0x23, 0x01, 0xC4, 0xEE, 0x2C, 0x01, 0xA9, 0xD7, 0x2C, 0x01, 0x83, 0xA8, 0x15, 0x01, 0xF4, 0xBF,
+  0x3F, 0x01, 0xF1, 0xEA, 0x5E, 0x01, 0x80, 0xCA, 0x8E, 0x01, 0x01, 0x8A, 0xC7, 0x0E, 0x81, 0xF7,
+  0xDC, 0x70, 0x80, 0x00, 0xE0, 0xC1, 0x52, 0x81, 0xA0, 0xA6, 0xA4, 0x01, 0x81, 0xE0, 0x89, 0x71,
+  0x01, 0xBF, 0xB0, 0xF0, 0x01, 0x01, 0xE0, 0xFE, 0x19, 0x01, 0xE0, 0x95, 0x06, 0x81, 0x9F, 0x86,
+  0x22, 0x81, 0xDF, 0x86, 0x10, 0x81, 0xA0, 0xD2, 0x07, 0x81, 0xC0, 0xEB, 0xB3, 0x02, 0x01, 0x82,
+  0xA2, 0x6D, 0x01, 0xC3, 0xD4, 0xE8, 0x02, 0x81, 0xBB, 0xC0, 0x29, 0x81, 0x81, 0xAC, 0x1B, 0x81,
+  0xFF, 0xDB, 0x0B, 0x81, 0x81, 0xE8, 0x07, 0x81, 0x04, 0x81, 0x01, 0x81, 0x80, 0xE8, 0x07, 0x81,
+  0xFE, 0xDB, 0x0B, 0x81, 0x84, 0xAC, 0x1B, 0x81, 0xFE, 0xCF, 0x28, 0x80,
+};
+
+static const uint8_t *const RIDES[] PROGMEM = {
+  RIDE_0,
+  RIDE_1,
+  RIDE_2,
+};
+
+static const uint8_t *const TRACKS[] PROGMEM = {
+  TRACK_0,
+  nullptr,
+  TRACK_2,
+};
+
+uint8_t getRideCount() {
+  return sizeof(RIDES) / sizeof(RIDES[0]);
+}
+
+/**
+ * Function to get a ride script in flash
+ * @param index 0 to getRideCount() - 1
+ */
+const uint8_t *getRide(uint8_t index) {
+#ifdef __AVR__
+  return (const uint8_t *)pgm_read_word(&RIDES[index]);
+#else
+  return RIDES[index];
+#endif
+}
+
+/**
+ * Function to get the step track a ride was precompiled into
+ * @param index 0 to getRideCount() - 1
+ * @return the track in flash, or nullptr if the ride is only a script
+ */
+const uint8_t *getRideTrack(uint8_t index) {
+#ifdef __AVR__
+  return (const uint8_t *)pgm_read_word(&TRACKS[index]);
+#else
+  return TRACKS[index];
+#endif
+}
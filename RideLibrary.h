@@ -0,0 +1,14 @@
+#ifndef RIDE_LIBRARY_H
+#define RIDE_LIBRARY_H
+
+#include "RideScript.h"
+
+// The rides built into the sketch
+// RideLibrary.cpp is generated by host/ride_compiler.cpp from the scripts in host/rides, see the README
+// Rides marked for it are also there as step tracks, see StepTrack.h
+
+uint8_t getRideCount();
+const uint8_t *getRide(uint8_t index);
+const uint8_t *getRideTrack(uint8_t index);
+
+#endif
@@ -0,0 +1,158 @@
+#include "RideScript.h"
+
+#if !defined(__AVR__) && !defined(pgm_read_byte)
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#endif
+
+/**
+ * Function to read the next byte of the script out of flash
+ */
+static uint8_t readScriptByte(RideDecoder &decoder) {
+  return pgm_read_byte(decoder.script + decoder.offset++);
+}
+
+/**
+ * Function to read an unsigned varint, see RideScript.h for the encoding
+ */
+static uint32_t readVarint(RideDecoder &decoder) {
+  uint32_t value = 0;
+
+  // A uint32_t takes 5 bytes at most
+  for (uint8_t shift = 0; shift < 35; shift += 7) {
+    uint8_t next = readScriptByte(decoder);
+    value |= (uint32_t)(next & 0x7F) << shift;
+    if (!(next & 0x80)) {
+      break;
+    }
+  }
+  return value;
+}
+
+/**
+ * Function to start decoding a ride
+ * @param decoder the decoder to set up
+ * @param script the script in flash
+ * @return false if the script is not a ride of this version
+ */
+bool openRide(RideDecoder &decoder, const uint8_t *script) {
+  decoder.script = script;
+  decoder.offset = 0;
+  decoder.keyframesLeft = 0;
+
+  if (readScriptByte(decoder) != RIDE_MAGIC_0 || readScriptByte(decoder) != RIDE_MAGIC_1 ||
+      readScriptByte(decoder) != RIDE_VERSION) {
+    return false;
+  }
+
+  decoder.keyframesLeft = readScriptByte(decoder);
+  decoder.keyframesLeft |= (uint16_t)readScriptByte(decoder) << 8;
+  decoder.offset += readScriptByte(decoder); // Skip the name
+
+  // Every ride starts from level at standstill
+  decoder.keyframe.timeMs = 0;
+  decoder.keyframe.pitch = 0;
+  decoder.keyframe.roll = 0;
+  decoder.keyframe.yaw = 0;
+  decoder.keyframe.speed = 0;
+  decoder.keyframe.acceleration = 0;
+  decoder.keyframe.curve = false;
+  decoder.keyframe.effect = RIDE_NO_EFFECT;
+  return true;
+}
+
+/**
+ * Function to decode the next keyframe into decoder.keyframe
+ * @return false once every keyframe has been read
+ */
+bool nextKeyframe(RideDecoder &decoder) {
+  if (decoder.keyframesLeft == 0) {
+    return false;
+  }
+  decoder.keyframesLeft--;
+
+  RideKeyframe &keyframe = decoder.keyframe;
+  uint8_t flags = readScriptByte(decoder);
+
+  keyframe.timeMs += readVarint(decoder);
+  if (flags & KEYFRAME_PITCH) {
+    keyframe.pitch += zigzagDecode(readVarint(decoder));
+  }
+  if (flags & KEYFRAME_ROLL) {
+    keyframe.roll += zigzagDecode(readVarint(decoder));
+  }
+  if (flags & KEYFRAME_YAW) {
+    keyframe.yaw += zigzagDecode(readVarint(decoder));
+  }
+  if (flags & KEYFRAME_SPEED) {
+    keyframe.speed = readVarint(decoder);
+  }
+  if (flags & KEYFRAME_ACCELERATION) {
+    keyframe.acceleration = readVarint(decoder);
+  }
+  keyframe.effect = (flags & KEYFRAME_EFFECT) ? readVarint(decoder) : RIDE_NO_EFFECT;
+  keyframe.curve = flags & KEYFRAME_CURVE;
+  return true;
+}
+
+/**
+ * Function to get the number of keyframes of a ride without decoding it
+ * @return the count, or 0 if the script is not a ride of this version
+ */
+uint16_t getRideKeyframeCount(const uint8_t *script) {
+  RideDecoder decoder;
+  if (!openRide(decoder, script)) {
+    return 0;
+  }
+  return decoder.keyframesLeft;
+}
+
+/**
+ * Function to copy the name of a ride out of flash
+ * @param script the script in flash
+ * @param name where to put the name, always null terminated
+ * @param size the room in name, including the terminator
+ */
+void getRideName(const uint8_t *script, char *name, uint8_t size) {
+  uint8_t length = 0;
+
+  if (size == 0) {
+    return;
+  }
+
+  RideDecoder decoder;
+  if (openRide(decoder, script)) {
+    decoder.offset = RIDE_HEADER_SIZE - 1;
+    uint8_t nameLength = readScriptByte(decoder);
+    while (length < nameLength && length < size - 1) {
+      name[length++] = readScriptByte(decoder);
+    }
+  }
+  name[length] = '\0';
+}
+
+/**
+ * Function to write an unsigned varint
+ * @param buffer room for at least 5 bytes
+ * @return the number of bytes written
+ */
+uint8_t writeVarint(uint8_t *buffer, uint32_t value) {
+  uint8_t length = 0;
+  while (value >= 0x80) {
+    buffer[length++] = (value & 0x7F) | 0x80;
+    value >>= 7;
+  }
+  buffer[length++] = value;
+  return length;
+}
+
+/**
+ * Function to map signed values to unsigned ones so that small changes either way stay small
+ * 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+ */
+uint32_t zigzagEncode(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+int32_t zigzagDecode(uint32_t value) {
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
@@ -0,0 +1,78 @@
+#ifndef RIDE_SCRIPT_H
+#define RIDE_SCRIPT_H
+
+#include <stdint.h>
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+#define PROGMEM
+#endif
+
+// Compact ride scripts that are read straight out of flash
+//
+// A ride is a list of keyframes. Each keyframe says when the move to it starts, the pose to move to and
+// the speed and acceleration caps of that move. Everything is stored as the change from the keyframe
+// before it, so a script only costs a few bytes per keyframe and the decoder only keeps the current one in SRAM.
+//
+// Script layout:
+//   'R' | 'D' | version | keyframe count (uint16) | name length | name ... | keyframes ...
+// Keyframe layout:
+//   flags | time since the previous keyframe in ms | [pitch change] | [roll change] | [yaw change] | [speed] | [acceleration]
+//   | [effect]
+// The fields in brackets are only there when their flag is set. Times, speeds and accelerations are unsigned
+// varints (7 bits per byte, low bits first, high bit set on all but the last byte), angle changes are zigzag
+// encoded into the same varints. Angles are centidegrees, speeds and accelerations are full steps so a script
+// does not depend on the microstep setting. The effect is the number of an EffectPreset (see Effects.h) that
+// starts together with the move.
+//
+// Scripts are written as CSV and turned into RideLibrary.cpp by host/ride_compiler.cpp.
+
+#define RIDE_MAGIC_0 'R'
+#define RIDE_MAGIC_1 'D'
+#define RIDE_VERSION 2
+#define RIDE_HEADER_SIZE 6
+#define RIDE_NAME_LENGTH 24
+
+// Flags of a keyframe
+#define KEYFRAME_PITCH 0x01
+#define KEYFRAME_ROLL 0x02
+#define KEYFRAME_YAW 0x04
+#define KEYFRAME_SPEED 0x08
+#define KEYFRAME_ACCELERATION 0x10
+#define KEYFRAME_CURVE 0x20 // Move with a jerk-limited S-curve instead of a trapezoid
+#define KEYFRAME_EFFECT 0x40
+
+// Value of RideKeyframe::effect for a keyframe that leaves the effects alone
+#define RIDE_NO_EFFECT 0xFF
+
+// One decoded keyframe, with every field worked out to its absolute value
+struct RideKeyframe {
+  uint32_t timeMs;       // When the move starts, from the start of the ride
+  int16_t pitch;         // Centidegrees
+  int16_t roll;
+  int16_t yaw;
+  uint16_t speed;        // Full steps/sec of the motor with the longest move
+  uint16_t acceleration; // Full steps/sec^2 of the motor with the longest move
+  bool curve;
+  uint8_t effect;        // EffectPreset started with the move, RIDE_NO_EFFECT if none
+};
+
+// Where the decoder is in a script
+struct RideDecoder {
+  const uint8_t *script;
+  uint16_t offset;
+  uint16_t keyframesLeft;
+  RideKeyframe keyframe; // The keyframe returned by the last call to nextKeyframe()
+};
+
+bool openRide(RideDecoder &decoder, const uint8_t *script);
+bool nextKeyframe(RideDecoder &decoder);
+uint16_t getRideKeyframeCount(const uint8_t *script);
+void getRideName(const uint8_t *script, char *name, uint8_t size);
+
+uint8_t writeVarint(uint8_t *buffer, uint32_t value);
+uint32_t zigzagEncode(int32_t value);
+int32_t zigzagDecode(uint32_t value);
+
+#endif
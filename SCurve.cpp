@@ -0,0 +1,210 @@
+#include <math.h>
+#include "SCurve.h"
+
+// Number of phases in a move, see the drawing in SCurve.h
+#define SCURVE_PHASES 7
+
+// Direction of the jerk in each phase
+static const int8_t PHASE_JERK[SCURVE_PHASES] = { 1, 0, -1, 0, -1, 0, 1 };
+
+/**
+ * Function to get the number of slices of a phase
+ * @param plan the plan of the move
+ * @param phase 0 to 6
+ */
+static uint16_t phaseSlices(const SCurvePlan &plan, uint8_t phase) {
+  switch (phase) {
+    case 1:
+    case 5:
+      return plan.accelSlices;
+    case 3:
+      return plan.cruiseSlices;
+    default:
+      return plan.jerkSlices;
+  }
+}
+
+/**
+ * Function to round a phase time up to whole slices
+ * @param seconds the length of the phase
+ */
+static uint16_t toSlices(float seconds) {
+  float slices = ceilf(seconds * (1000000.0f / SCURVE_SLICE_MICROS));
+  if (slices <= 0) {
+    return 0;
+  }
+  return slices > 65535.0f ? 65535 : (uint16_t)slices;
+}
+
+/**
+ * Function to work out the phases of a move that starts and ends at rest
+ * The phase times are worked out once per move in floating point and rounded up to whole slices.
+ * startSCurve() then picks the jerk that covers the distance exactly in those slices, which can only
+ * lower the speed, acceleration and jerk that are reached, never raise them.
+ * @param distance the length of the move in steps
+ * @param speed the largest speed in steps/sec
+ * @param acceleration the largest acceleration in steps/sec^2
+ * @param jerk the largest jerk in steps/sec^3
+ */
+SCurvePlan planSCurve(uint32_t distance, uint32_t speed, uint32_t acceleration, uint32_t jerk) {
+  SCurvePlan plan = { 0, 0, 0 };
+  if (distance == 0) {
+    return plan;
+  }
+
+  float d = distance;
+  float v = speed > 0 ? speed : 1;
+  float a = acceleration > 0 ? acceleration : 1;
+  float j = jerk > 0 ? jerk : 1;
+
+  // Ramp times to reach the full speed
+  float jerkTime = a / j;
+  float accelTime;
+  if (v * j < a * a) {
+    // Full speed is reached before the acceleration gets to its limit
+    jerkTime = sqrtf(v / j);
+    accelTime = 0;
+  } else {
+    accelTime = v / a - jerkTime;
+  }
+
+  // Speeding up and slowing down together cover the full speed times the ramp time
+  float rampDistance = v * (2 * jerkTime + accelTime);
+  float cruiseTime = 0;
+
+  if (d >= rampDistance) {
+    cruiseTime = (d - rampDistance) / v;
+  } else {
+    // Too short to get to the full speed
+    jerkTime = cbrtf(d / (2 * j));
+    accelTime = 0;
+
+    if (j * jerkTime > a) {
+      // The acceleration still reaches its limit, solve d = peak * (peak / a + a / j) for the peak speed
+      jerkTime = a / j;
+      float peak = (sqrtf(jerkTime * jerkTime * a * a + 4 * a * d) - jerkTime * a) / 2;
+      accelTime = peak / a - jerkTime;
+      if (accelTime < 0) {
+        accelTime = 0;
+      }
+    }
+  }
+
+  plan.jerkSlices = toSlices(jerkTime);
+  if (plan.jerkSlices == 0) {
+    plan.jerkSlices = 1;
+  }
+  plan.accelSlices = toSlices(accelTime);
+  plan.cruiseSlices = toSlices(cruiseTime);
+  return plan;
+}
+
+/**
+ * Function to get how many slices a move takes, multiply by SCURVE_SLICE_MICROS for its duration
+ */
+uint32_t getSCurveSlices(const SCurvePlan &plan) {
+  return 4UL * plan.jerkSlices + 2UL * plan.accelSlices + plan.cruiseSlices;
+}
+
+/**
+ * Function to start turning a plan into step commands
+ * Motors that share a plan arrive together, so one plan worked out for the longest move keeps a
+ * coordinated move in sync
+ * @param generator the generator of the motor
+ * @param plan the phases of the move
+ * @param steps the relative move in steps
+ */
+void startSCurve(SCurveGenerator &generator, const SCurvePlan &plan, int32_t steps) {
+  generator.plan = plan;
+  generator.distance = steps < 0 ? -steps : steps;
+  generator.countUp = steps >= 0;
+  generator.emitted = 0;
+  generator.ticksCarry = 0;
+  generator.acceleration = 0;
+  generator.velocity = 0;
+  generator.position = 0;
+
+  // distance = jerk * Tj * (Tj + Ta) * (2 Tj + Ta + Tc), with all times in slices
+  uint64_t slices = (uint64_t)plan.jerkSlices * (plan.jerkSlices + plan.accelSlices) *
+                    (2UL * plan.jerkSlices + plan.accelSlices + plan.cruiseSlices);
+
+  if (generator.distance == 0 || slices == 0) {
+    generator.phase = SCURVE_PHASES;
+    generator.slicesLeft = 0;
+    generator.jerk = 0;
+    generator.jerkHalf = 0;
+    generator.jerkSixth = 0;
+    return;
+  }
+
+  // Only worked out once per move, so 64-bit division is fine here
+  generator.jerk = (int64_t)(((uint64_t)generator.distance << 32) / slices);
+  generator.jerkHalf = generator.jerk / 2;
+  generator.jerkSixth = generator.jerk / 6;
+  generator.phase = 0;
+  generator.slicesLeft = plan.jerkSlices;
+}
+
+bool isSCurveDone(const SCurveGenerator &generator) {
+  return generator.phase >= SCURVE_PHASES && generator.emitted >= generator.distance;
+}
+
+/**
+ * Function to get the step command for the next slice of a move
+ * Only additions are needed per slice, so this is cheap enough to keep the stepper queue topped up from loop()
+ * @param generator the generator of the motor
+ * @param command set to the command of the slice
+ * @return false once the move has been handed out completely
+ */
+bool nextSCurveCommand(SCurveGenerator &generator, SCurveCommand &command) {
+  while (generator.phase < SCURVE_PHASES && generator.slicesLeft == 0) {
+    generator.phase++;
+    if (generator.phase < SCURVE_PHASES) {
+      generator.slicesLeft = phaseSlices(generator.plan, generator.phase);
+    }
+  }
+
+  uint32_t target;
+  if (generator.phase < SCURVE_PHASES) {
+    int8_t direction = PHASE_JERK[generator.phase];
+
+    // Forward differences of the position with constant jerk over one slice
+    generator.position += generator.velocity + generator.acceleration / 2 + direction * generator.jerkSixth;
+    generator.velocity += generator.acceleration + direction * generator.jerkHalf;
+    generator.acceleration += direction * generator.jerk;
+    generator.slicesLeft--;
+
+    if (generator.phase == SCURVE_PHASES - 1 && generator.slicesLeft == 0) {
+      // Whatever the rounding left over goes into the last slice
+      target = generator.distance;
+    } else if (generator.position <= 0) {
+      target = 0;
+    } else {
+      target = (uint32_t)((generator.position + 0x80000000LL) >> 32);
+    }
+  } else if (generator.emitted < generator.distance) {
+    // More steps than fit into one command were due in the last slice
+    target = generator.distance;
+  } else {
+    return false;
+  }
+
+  uint32_t steps = target > generator.emitted ? target - generator.emitted : 0;
+  if (steps > 255) {
+    steps = 255;
+  }
+
+  // Spread the steps evenly over the slice and carry the remainder so the slices keep their length
+  uint32_t budget = SCURVE_SLICE_TICKS + generator.ticksCarry;
+  if (steps == 0) {
+    command.ticks = budget;
+    generator.ticksCarry = 0;
+  } else {
+    command.ticks = budget / steps;
+    generator.ticksCarry = budget - (uint32_t)command.ticks * steps;
+  }
+  command.steps = steps;
+  command.countUp = generator.countUp;
+  generator.emitted += steps;
+  return true;
+}
@@ -0,0 +1,66 @@
+#ifndef S_CURVE_H
+#define S_CURVE_H
+
+#include <stdint.h>
+
+// Jerk-limited (S-curve) motion profiles
+//
+// A trapezoid ramp switches the acceleration on and off at once, which is felt as a clunk at the start
+// and end of every ramp. An S-curve ramps the acceleration up and down at a limited jerk instead:
+//
+//   jerk:  +J  0  -J    0    -J  0  +J
+//          |--|----|--|------|--|----|--|
+//          Tj  Ta  Tj    Tc   Tj  Ta  Tj
+//
+// The move is cut into time slices of SCURVE_SLICE_MICROS and each slice becomes one timed step command
+// for the queue of FastAccelStepper. The phase lengths are whole slices, so the position at the end of
+// every slice is exact and can be worked out with forward differences in fixed point (Q32 steps).
+// Moves start and end at rest.
+
+// Length of one slice, a full queue of FastAccelStepper (16 commands on the ATmega2560) holds 32 ms of motion
+#define SCURVE_SLICE_MICROS 2000
+
+// The step timer of FastAccelStepper on the ATmega2560 runs at 16 MHz
+#define SCURVE_TICKS_PER_SECOND 16000000UL
+#define SCURVE_SLICE_TICKS (SCURVE_TICKS_PER_SECOND / (1000000UL / SCURVE_SLICE_MICROS))
+
+// Number of slices in each kind of phase
+struct SCurvePlan {
+  uint16_t jerkSlices;   // Ramping the acceleration up or down, 4 of these
+  uint16_t accelSlices;  // Constant acceleration, 2 of these
+  uint16_t cruiseSlices; // Constant speed, 1 of these
+};
+
+// One timed step command, the same fields as stepper_command_s of FastAccelStepper
+struct SCurveCommand {
+  uint16_t ticks; // Ticks between the steps, or the length of a pause when steps is 0
+  uint8_t steps;
+  bool countUp;
+};
+
+// Everything needed to turn a plan into step commands for one motor
+struct SCurveGenerator {
+  SCurvePlan plan;
+  uint32_t distance;  // Steps to make
+  uint32_t emitted;   // Steps already handed out
+  bool countUp;
+  uint8_t phase;      // 0 to 6, 7 once every slice is done
+  uint16_t slicesLeft;
+  uint16_t ticksCarry; // Ticks left over from dividing the earlier slices into whole steps
+
+  // Kinematics of the slice grid in Q32 steps per slice^n
+  int64_t jerk;
+  int64_t jerkHalf;
+  int64_t jerkSixth;
+  int64_t acceleration;
+  int64_t velocity;
+  int64_t position;
+};
+
+SCurvePlan planSCurve(uint32_t distance, uint32_t speed, uint32_t acceleration, uint32_t jerk);
+uint32_t getSCurveSlices(const SCurvePlan &plan);
+void startSCurve(SCurveGenerator &generator, const SCurvePlan &plan, int32_t steps);
+bool nextSCurveCommand(SCurveGenerator &generator, SCurveCommand &command);
+bool isSCurveDone(const SCurveGenerator &generator);
+
+#endif
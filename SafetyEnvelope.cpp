@@ -0,0 +1,171 @@
+#include "Arduino.h"
+#include "SafetyEnvelope.h"
+#include "AxisConfig.h"
+#include "MotionScheduler.h"
+#include "Backlash.h"
+
+// The steppers that are watched (index 0 is stepper1)
+static FastAccelStepper *steppers[3] = { nullptr, nullptr, nullptr };
+
+static const int32_t MIN_POSITION[3] = { Stepper1Axis::MIN_POSITION, Stepper2Axis::MIN_POSITION, Stepper3Axis::MIN_POSITION };
+static const int32_t MAX_POSITION[3] = { Stepper1Axis::MAX_POSITION, Stepper2Axis::MAX_POSITION, Stepper3Axis::MAX_POSITION };
+static const uint32_t BRAKE_ACCELERATION[3] = { Stepper1Axis::BRAKE_ACCELERATION, Stepper2Axis::BRAKE_ACCELERATION, Stepper3Axis::BRAKE_ACCELERATION };
+
+// While the envelope brakes a stepper it remembers the acceleration it took over from
+static bool braking[3] = { false, false, false };
+static uint32_t ownAcceleration[3] = { 0, 0, 0 };
+static uint32_t brakeAcceleration[3] = { 0, 0, 0 };
+
+// A breach is counted once per move, not on every check while it lasts
+static bool breached[3] = { false, false, false };
+
+static uint32_t nextCheckAt = 0;
+static EnvelopeStats stats = { 0, 0 };
+
+/**
+ * Function to remember the steppers the envelope watches
+ */
+void initSafetyEnvelope(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third) {
+  steppers[0] = first;
+  steppers[1] = second;
+  steppers[2] = third;
+  nextCheckAt = micros();
+}
+
+/**
+ * Function to check whether a stepper can stop within a distance
+ * Compares v^2 against 2*a*d so no division is needed on every check
+ * @param velocity the speed in steps/sec
+ * @param acceleration the deceleration in steps/sec^2
+ * @param room the distance in steps
+ */
+static bool canStopWithin(uint32_t velocity, uint32_t acceleration, int32_t room) {
+  return room >= 0 && (uint64_t)velocity * velocity <= 2ULL * acceleration * (uint32_t)room;
+}
+
+/**
+ * Function to note that a stepper could not be kept inside its limits
+ */
+static void recordBreach(uint8_t index) {
+  if (!breached[index]) {
+    breached[index] = true;
+    stats.breaches++;
+  }
+}
+
+/**
+ * Function to hand the acceleration back to whoever set it before the envelope stepped in
+ * If it was changed since, the new value is left alone
+ */
+static void releaseBrake(uint8_t index) {
+  if ((uint32_t)steppers[index] -> getAcceleration() == brakeAcceleration[index]) {
+    steppers[index] -> setAcceleration(ownAcceleration[index]);
+    steppers[index] -> applySpeedAcceleration();
+  }
+  braking[index] = false;
+}
+
+/**
+ * Function to check one stepper and step in if it would not stop inside its limits
+ * @param index the stepper, 0 is stepper1
+ */
+static void checkStepper(uint8_t index) {
+  FastAccelStepper *stepper = steppers[index];
+
+  // The limits are those of the chair, the motor is ahead of it by the play it has taken up
+  int32_t minPosition = MIN_POSITION[index] + getTakeUpSteps(index);
+  int32_t maxPosition = MAX_POSITION[index] + getTakeUpSteps(index);
+
+  if (!stepper -> isRunning()) {
+    if (braking[index]) {
+      releaseBrake(index);
+    }
+    breached[index] = false;
+    return;
+  }
+
+  // A stepper on the step queue runs out its commands, only where they end can be checked
+  if (!stepper -> isRampGeneratorActive()) {
+    int32_t end = stepper -> getPositionAfterCommandsCompleted();
+    if (end < minPosition || end > maxPosition) {
+      recordBreach(index);
+    }
+    return;
+  }
+
+  // The ramp brakes towards its target, which has to be inside the limits in the first place
+  int32_t target = stepper -> targetPos();
+  if (target < minPosition || target > maxPosition) {
+    stepper -> moveTo(constrain(target, minPosition, maxPosition));
+    stats.interventions++;
+  }
+
+  int32_t speed = stepper -> getCurrentSpeedInMilliHz() / 1000;
+  uint32_t velocity = speed < 0 ? -speed : speed; // steps/sec
+  int32_t position = stepper -> getCurrentPosition();
+  int32_t room = speed >= 0 ? maxPosition - position : position - minPosition;
+
+  uint32_t acceleration = stepper -> getAcceleration();
+  if (braking[index] && acceleration != brakeAcceleration[index]) {
+    // Someone else set a new acceleration, it becomes the one to hand back
+    braking[index] = false;
+  }
+
+  // The ramp brakes at its own acceleration as soon as it can't stop at its target any more, so that is where it
+  // stops at the latest. The extra step allows for the ramp and the speed being rounded to whole steps.
+  if (braking[index]) {
+    if (canStopWithin(velocity, ownAcceleration[index], room + 1)) {
+      releaseBrake(index);
+      return;
+    }
+  } else if (canStopWithin(velocity, acceleration, room + 1)) {
+    return;
+  }
+
+  // Just enough to stop at the limit with the same extra step, rounded up
+  uint32_t needed = BRAKE_ACCELERATION[index];
+  if (room >= 0) {
+    uint32_t distance = room + 1;
+    needed = ((uint64_t)velocity * velocity + 2 * distance - 1) / (2 * distance);
+  }
+  if (room < 0 || needed > BRAKE_ACCELERATION[index]) {
+    needed = BRAKE_ACCELERATION[index];
+    recordBreach(index);
+  }
+  if (needed <= acceleration) {
+    return;
+  }
+
+  if (!braking[index]) {
+    braking[index] = true;
+    ownAcceleration[index] = acceleration;
+    stats.interventions++;
+  }
+  brakeAcceleration[index] = needed;
+  stepper -> setAcceleration(needed);
+  stepper -> applySpeedAcceleration();
+}
+
+/**
+ * Function to check every stepper when a check is due, called on every pass through loop()
+ */
+void updateSafetyEnvelope() {
+  uint32_t now = micros();
+  if ((int32_t)(now - nextCheckAt) < 0) {
+    return;
+  }
+  nextCheckAt = now + ENVELOPE_TICK_MICROS;
+
+  for (uint8_t i = 0; i < 3; i++) {
+    if (steppers[i]) {
+      checkStepper(i);
+    }
+  }
+}
+
+/**
+ * Function to get how often the envelope had to step in since startup
+ */
+const EnvelopeStats &getEnvelopeStats() {
+  return stats;
+}
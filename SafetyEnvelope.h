@@ -0,0 +1,36 @@
+#ifndef SAFETY_ENVELOPE_H
+#define SAFETY_ENVELOPE_H
+
+#include "FastAccelStepper.h"
+
+// Runtime check that every motor can still stop inside its limits
+//
+// Targets are clamped to the limits, but that alone doesn't keep a motor inside them: when a target changes
+// mid-move (a stream, a cueing update, effects or a blended move) the new target can be closer than the
+// distance the motor needs to stop at the acceleration of its ramp, and the ramp then runs past it.
+//
+// At a fixed rate the envelope predicts where each motor would stop if it braked at the acceleration of its
+// ramp, from its position and speed. The limits are those of the motors, so moves that mix pitch and roll
+// onto the seat motors are covered as well. Only when that point is past a limit does the envelope step in:
+// it raises the acceleration of the motor just enough to stop at the limit, up to the braking limit in
+// AxisConfig.h, and puts the acceleration back once the ramp can stop in time on its own.
+// The limits move with the play a motor has taken up in its gears (Backlash.h), they hold for the chair side.
+//
+// Motors driven from the step queue (S-curves) can't be braked that way. Their moves are kept inside the
+// limits when they are planned, the envelope only counts it if one of them isn't.
+
+// Time between checks
+// A target that changes between two checks is caught at the next one, the braking reserve covers the distance
+// the motor moves in between
+#define ENVELOPE_TICK_MICROS 1000
+
+struct EnvelopeStats {
+  uint16_t interventions; // Times the acceleration of a motor had to be raised
+  uint16_t breaches;      // Times a motor could not be kept inside its limits even at the braking limit
+};
+
+void initSafetyEnvelope(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third);
+void updateSafetyEnvelope();
+const EnvelopeStats &getEnvelopeStats();
+
+#endif
@@ -0,0 +1,256 @@
+#include "SerialProtocol.h"
+
+// Where the parser is inside a frame
+enum ParserState : uint8_t {
+  PARSE_SYNC,
+  PARSE_TYPE,
+  PARSE_SEQUENCE,
+  PARSE_LENGTH,
+  PARSE_PAYLOAD,
+  PARSE_CRC_LOW,
+  PARSE_CRC_HIGH
+};
+
+/**
+ * Function to add one byte to a CRC-16/CCITT, the same calculation as _crc_ccitt_update() in avr-libc
+ * A handful of shifts per byte and no lookup table, so it costs no flash or SRAM
+ * @param crc the CRC so far, start with 0xFFFF
+ * @param data the next byte
+ */
+uint16_t updateCrc(uint16_t crc, uint8_t data) {
+  data ^= (uint8_t)(crc & 0xFF);
+  data ^= (uint8_t)(data << 4);
+  return ((((uint16_t)data << 8) | (crc >> 8)) ^ (uint8_t)(data >> 4) ^ ((uint16_t)data << 3));
+}
+
+/**
+ * Function to check whether a byte is one of the CONTROL_ bytes
+ */
+bool isControlByte(uint8_t data) {
+  return data == CONTROL_STOP || data == CONTROL_PAUSE || data == CONTROL_RESUME;
+}
+
+/**
+ * Function to check whether a byte has to be escaped inside a frame
+ */
+static bool isReservedByte(uint8_t data) {
+  return data == FRAME_ESCAPE || isControlByte(data);
+}
+
+/**
+ * Function to reset a parser and its counters
+ */
+void initFrameParser(FrameParser &parser) {
+  parser.state = PARSE_SYNC;
+  parser.escaped = false;
+  parser.synced = false;
+  parser.expectedSequence = 0;
+  parser.stats.frames = 0;
+  parser.stats.corrupt = 0;
+  parser.stats.dropped = 0;
+  parser.stats.parseMicros = 0;
+}
+
+/**
+ * Function to check whether the parser is in the middle of a frame, so the next byte belongs to it
+ */
+bool isParsingFrame(const FrameParser &parser) {
+  return parser.state != PARSE_SYNC;
+}
+
+/**
+ * Function to feed one received byte to the parser
+ * Nothing is allocated: the payload is collected in the parser itself
+ * Control bytes are not part of any frame and are passed over, the caller acts on them
+ * @param parser the parser to feed
+ * @param data the received byte
+ * @return true when a complete frame with a good CRC is in parser.type and parser.payload
+ */
+bool parseFrameByte(FrameParser &parser, uint8_t data) {
+  if (parser.state != PARSE_SYNC) {
+    if (isControlByte(data)) {
+      return false;
+    }
+    if (data == FRAME_ESCAPE) {
+      parser.escaped = true;
+      return false;
+    }
+    if (parser.escaped) {
+      data ^= FRAME_ESCAPE_XOR;
+      parser.escaped = false;
+    }
+  }
+
+  switch (parser.state) {
+    case PARSE_SYNC:
+      if (data == FRAME_SYNC) {
+        parser.crc = 0xFFFF;
+        parser.escaped = false;
+        parser.state = PARSE_TYPE;
+      }
+      return false;
+
+    case PARSE_TYPE:
+      parser.type = data;
+      parser.crc = updateCrc(parser.crc, data);
+      parser.state = PARSE_SEQUENCE;
+      return false;
+
+    case PARSE_SEQUENCE:
+      parser.sequence = data;
+      parser.crc = updateCrc(parser.crc, data);
+      parser.state = PARSE_LENGTH;
+      return false;
+
+    case PARSE_LENGTH:
+      if (data > FRAME_MAX_PAYLOAD) {
+        parser.stats.corrupt++;
+        parser.state = PARSE_SYNC;
+        return false;
+      }
+      parser.length = data;
+      parser.index = 0;
+      parser.crc = updateCrc(parser.crc, data);
+      parser.state = data > 0 ? PARSE_PAYLOAD : PARSE_CRC_LOW;
+      return false;
+
+    case PARSE_PAYLOAD:
+      parser.payload[parser.index++] = data;
+      parser.crc = updateCrc(parser.crc, data);
+      if (parser.index >= parser.length) {
+        parser.state = PARSE_CRC_LOW;
+      }
+      return false;
+
+    case PARSE_CRC_LOW:
+      parser.crcLow = data;
+      parser.state = PARSE_CRC_HIGH;
+      return false;
+
+    case PARSE_CRC_HIGH:
+      parser.state = PARSE_SYNC;
+
+      if ((((uint16_t)data << 8) | parser.crcLow) != parser.crc) {
+        parser.stats.corrupt++;
+        return false;
+      }
+
+      // Every frame the sequence number skipped was lost somewhere on the way
+      if (parser.synced && parser.sequence != parser.expectedSequence) {
+        parser.stats.dropped += (uint8_t)(parser.sequence - parser.expectedSequence);
+      }
+      parser.synced = true;
+      parser.expectedSequence = parser.sequence + 1;
+      parser.stats.frames++;
+      return true;
+  }
+
+  parser.state = PARSE_SYNC;
+  return false;
+}
+
+/**
+ * Function to add a byte to a frame, escaped if it is reserved, and to its CRC
+ * @param frame the frame
+ * @param size the size of the frame so far, moved past the byte
+ * @param crc the CRC so far
+ * @param data the byte
+ */
+static void putFrameByte(uint8_t *frame, uint8_t &size, uint16_t &crc, uint8_t data) {
+  crc = updateCrc(crc, data);
+  if (isReservedByte(data)) {
+    frame[size++] = FRAME_ESCAPE;
+    data ^= FRAME_ESCAPE_XOR;
+  }
+  frame[size++] = data;
+}
+
+/**
+ * Function to build a complete frame
+ * @param frame buffer of at least FRAME_MAX_SIZE bytes
+ * @param type the message type
+ * @param sequence the sequence number of the frame
+ * @param payload the payload bytes
+ * @param length the number of payload bytes, at most FRAME_MAX_PAYLOAD
+ * @return the size of the frame in bytes, escapes included
+ */
+uint8_t encodeFrame(uint8_t *frame, uint8_t type, uint8_t sequence, const uint8_t *payload, uint8_t length) {
+  uint8_t size = 0;
+  uint16_t crc = 0xFFFF;
+
+  if (length > FRAME_MAX_PAYLOAD) {
+    length = FRAME_MAX_PAYLOAD;
+  }
+
+  frame[size++] = FRAME_SYNC;
+  putFrameByte(frame, size, crc, type);
+  putFrameByte(frame, size, crc, sequence);
+  putFrameByte(frame, size, crc, length);
+  for (uint8_t i = 0; i < length; i++) {
+    putFrameByte(frame, size, crc, payload[i]);
+  }
+
+  // The CRC is over the bytes before they were escaped, its own bytes don't go into it
+  uint16_t frameCrc = crc;
+  putFrameByte(frame, size, crc, frameCrc & 0xFF);
+  putFrameByte(frame, size, crc, frameCrc >> 8);
+  return size;
+}
+
+// Multi-byte values are sent little-endian
+
+void writeInt16(uint8_t *buffer, int16_t value) {
+  writeUint16(buffer, (uint16_t)value);
+}
+
+int16_t readInt16(const uint8_t *buffer) {
+  return (int16_t)readUint16(buffer);
+}
+
+void writeUint16(uint8_t *buffer, uint16_t value) {
+  buffer[0] = value & 0xFF;
+  buffer[1] = value >> 8;
+}
+
+uint16_t readUint16(const uint8_t *buffer) {
+  return buffer[0] | ((uint16_t)buffer[1] << 8);
+}
+
+void writeUint32(uint8_t *buffer, uint32_t value) {
+  writeUint16(buffer, value & 0xFFFF);
+  writeUint16(buffer + 2, value >> 16);
+}
+
+uint32_t readUint32(const uint8_t *buffer) {
+  return readUint16(buffer) | ((uint32_t)readUint16(buffer + 2) << 16);
+}
+
+/**
+ * Function to put a pose into a MSG_POSE payload
+ */
+void encodePose(uint8_t *payload, const Pose &pose) {
+  writeInt16(payload, pose.pitch);
+  writeInt16(payload + 2, pose.roll);
+  writeInt16(payload + 4, pose.yaw);
+}
+
+/**
+ * Function to read a pose out of a MSG_POSE payload
+ */
+Pose decodePose(const uint8_t *payload) {
+  Pose pose;
+  pose.pitch = readInt16(payload);
+  pose.roll = readInt16(payload + 2);
+  pose.yaw = readInt16(payload + 4);
+  return pose;
+}
+
+/**
+ * Function to put the parser counters into a MSG_STATS payload
+ */
+void encodeStats(uint8_t *payload, const ProtocolStats &stats) {
+  writeUint32(payload, stats.frames);
+  writeUint16(payload + 4, stats.corrupt);
+  writeUint16(payload + 6, stats.dropped);
+  writeUint32(payload + 8, stats.parseMicros);
+}
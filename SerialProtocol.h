@@ -0,0 +1,124 @@
+#ifndef SERIAL_PROTOCOL_H
+#define SERIAL_PROTOCOL_H
+
+#include <stdint.h>
+
+// Binary frames share the serial port with the line commands
+// Every frame starts with a sync byte that never appears in text, so the two can be told apart byte by byte
+//
+// Frame layout:
+//   SYNC | type | sequence | payload length | payload ... | CRC low | CRC high
+// The CRC is CRC-16/CCITT (reflected, start 0xFFFF) over type, sequence, length and payload
+//
+// The control bytes below and FRAME_ESCAPE never appear inside a frame either: after the sync byte each of them
+// is sent as FRAME_ESCAPE followed by the byte XORed with FRAME_ESCAPE_XOR. The CRC is over the bytes before
+// they are escaped.
+#define FRAME_SYNC 0xA5
+#define FRAME_ESCAPE 0x1B
+#define FRAME_ESCAPE_XOR 0x20
+#define FRAME_HEADER_SIZE 4
+#define FRAME_CRC_SIZE 2
+#define FRAME_MAX_PAYLOAD 16
+
+// Largest frame on the wire, with every byte after the sync escaped
+#define FRAME_MAX_SIZE (1 + 2 * (FRAME_HEADER_SIZE - 1 + FRAME_MAX_PAYLOAD + FRAME_CRC_SIZE))
+
+// Control bytes from a host, single bytes outside of text and frames
+// They may be sent at any time, also in the middle of a line or a frame, and the chair acts on them as soon as it
+// reads them, ahead of everything that is queued. See haltScheduler() in MotionScheduler.h.
+#define CONTROL_STOP 0x18   // Brake every motor to a stop and drop everything queued
+#define CONTROL_PAUSE 0x1C  // Brake every motor to a stop and hold everything where it is
+#define CONTROL_RESUME 0x1D // Carry on after CONTROL_PAUSE
+
+// Message types, replies from the chair have the high bit set
+#define MSG_POSE 0x01          // int16 pitch, roll, yaw in centidegrees
+#define MSG_STATS_REQUEST 0x02 // no payload, answered with MSG_STATS
+#define MSG_STREAM_CONFIG 0x03 // uint8 jitter buffer depth used the next time streaming starts
+#define MSG_STREAM_STATS_REQUEST 0x04 // no payload, answered with MSG_STREAM_STATS
+#define MSG_VEHICLE_STATE 0x05 // int16 surge, sway in mg and roll, pitch, yaw rates in centidegrees/s, see MotionCueing.h
+#define MSG_CUEING_BENCHMARK_REQUEST 0x06 // no payload, answered with MSG_CUEING_BENCHMARK
+#define MSG_TRACE_REQUEST 0x07 // no payload, answered with MSG_TRACE frames
+#define MSG_TELEMETRY_CONFIG 0x08 // uint16 sample period in ms (0 stops telemetry), uint8 samples per frame
+#define MSG_EFFECT 0x0A        // uint8 slot, uint8 type, int16 amplitudes, uint16 frequencies, uint16 duration, see Effects.h
+#define MSG_PREDICTOR_CONFIG 0x0B // uint8 on, uint32 link latency in microseconds, see PosePredictor.h
+#define MSG_PING 0x0C          // uint32 any value, answered with MSG_PONG right away
+#define MSG_SYNC 0x0D          // uint32 shared timeline in microseconds, see ClockSync.h
+#define MSG_RIDE_AT 0x0E       // uint8 ride number counted from 1, uint32 start on the shared timeline in microseconds
+#define MSG_SYNC_STATS_REQUEST 0x0F // no payload, answered with MSG_SYNC_STATS
+#define MSG_STATS 0x82         // uint32 frames, uint16 corrupt, uint16 dropped, uint32 parse micros
+#define MSG_STREAM_STATS 0x84  // uint16 underruns, uint16 overruns, uint32 last latency, uint32 max latency, uint8 fill
+#define MSG_CUEING_BENCHMARK 0x86 // uint16 updates timed, uint32 total micros, uint16 CPU cycles per update
+#define MSG_TRACE 0x87         // uint8 count, count x (uint32 micros, uint8 event, uint8 arg), see Trace.h
+                               // The last frame has a count of 0 followed by uint32 events recorded, uint16 missed
+#define MSG_TELEMETRY 0x88     // uint16 first sample index, delta-encoded samples, see Telemetry.h
+#define MSG_TELEMETRY_KEY 0x89 // uint16 sample index, uint16 period ms, int16 positions and speeds, see Telemetry.h
+#define MSG_PONG 0x8C          // uint32 the value of the MSG_PING, uint32 average jitter buffer wait in microseconds
+#define MSG_SYNC_STATS 0x8F    // uint16 syncs, uint8 fixes, int32 drift in parts per billion, int32 last correction micros
+
+#define POSE_PAYLOAD_SIZE 6
+#define STATS_PAYLOAD_SIZE 12
+#define STREAM_CONFIG_PAYLOAD_SIZE 1
+#define STREAM_STATS_PAYLOAD_SIZE 13
+#define CUEING_BENCHMARK_PAYLOAD_SIZE 8
+#define TRACE_EVENT_SIZE 6
+#define TRACE_END_PAYLOAD_SIZE 7
+#define TELEMETRY_CONFIG_PAYLOAD_SIZE 3
+#define PREDICTOR_CONFIG_PAYLOAD_SIZE 5
+#define PING_PAYLOAD_SIZE 4
+#define PONG_PAYLOAD_SIZE 8
+#define SYNC_PAYLOAD_SIZE 4
+#define RIDE_AT_PAYLOAD_SIZE 5
+#define SYNC_STATS_PAYLOAD_SIZE 11
+
+// A target pose in hundredths of a degree
+struct Pose {
+  int16_t pitch;
+  int16_t roll;
+  int16_t yaw;
+};
+
+// Counters kept by the frame parser
+struct ProtocolStats {
+  uint32_t frames;      // Frames that passed the CRC check
+  uint16_t corrupt;     // Frames thrown away for a bad CRC or length
+  uint16_t dropped;     // Frames missing according to the sequence numbers
+  uint32_t parseMicros; // Total time spent parsing, divide by frames for the cost per frame
+};
+
+// Incremental parser state, fed one received byte at a time
+struct FrameParser {
+  uint8_t state;
+  uint8_t type;
+  uint8_t sequence;
+  uint8_t length;
+  uint8_t index;
+  uint16_t crc;
+  uint8_t crcLow;
+  bool escaped;             // Whether the last byte was FRAME_ESCAPE
+  bool synced;              // Whether a sequence number has been seen yet
+  uint8_t expectedSequence;
+  uint8_t payload[FRAME_MAX_PAYLOAD];
+  ProtocolStats stats;
+};
+
+uint16_t updateCrc(uint16_t crc, uint8_t data);
+bool isControlByte(uint8_t data);
+
+void initFrameParser(FrameParser &parser);
+bool isParsingFrame(const FrameParser &parser);
+bool parseFrameByte(FrameParser &parser, uint8_t data);
+
+uint8_t encodeFrame(uint8_t *frame, uint8_t type, uint8_t sequence, const uint8_t *payload, uint8_t length);
+
+void writeInt16(uint8_t *buffer, int16_t value);
+int16_t readInt16(const uint8_t *buffer);
+void writeUint16(uint8_t *buffer, uint16_t value);
+uint16_t readUint16(const uint8_t *buffer);
+void writeUint32(uint8_t *buffer, uint32_t value);
+uint32_t readUint32(const uint8_t *buffer);
+
+void encodePose(uint8_t *payload, const Pose &pose);
+Pose decodePose(const uint8_t *payload);
+void encodeStats(uint8_t *payload, const ProtocolStats &stats);
+
+#endif
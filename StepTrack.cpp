@@ -0,0 +1,156 @@
+#include "StepTrack.h"
+#include "RideScript.h"
+#include "AxisConfig.h"
+
+#if !defined(__AVR__) && !defined(pgm_read_byte)
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#endif
+
+/**
+ * Function to read the next byte of a track out of flash
+ */
+static uint8_t readTrackByte(TrackReader &reader) {
+  return pgm_read_byte(reader.track + reader.offset++);
+}
+
+/**
+ * Function to read an unsigned varint, see RideScript.h for the encoding
+ */
+static uint32_t readVarint(TrackReader &reader) {
+  uint32_t value = 0;
+
+  // A uint32_t takes 5 bytes at most
+  for (uint8_t shift = 0; shift < 35; shift += 7) {
+    uint8_t next = readTrackByte(reader);
+    value |= (uint32_t)(next & 0x7F) << shift;
+    if (!(next & 0x80)) {
+      break;
+    }
+  }
+  return value;
+}
+
+/**
+ * Function to start reading a track for all three steppers
+ * @param readers the readers of stepper1, stepper2 and stepper3
+ * @param track the track in flash
+ * @return false if it is not a track of this version or was compiled for another MICROSTEPS
+ */
+bool openStepTrack(TrackReader *readers, const uint8_t *track) {
+  TrackReader header = { track, 0, TRACK_HEADER_SIZE, 0, 0, 0, TRACK_ALL_MOVES, 0 };
+  bool valid = readTrackByte(header) == TRACK_MAGIC_0 && readTrackByte(header) == TRACK_MAGIC_1 &&
+               readTrackByte(header) == TRACK_VERSION;
+  if (valid) {
+    uint16_t microsteps = readTrackByte(header);
+    microsteps |= (uint16_t)readTrackByte(header) << 8;
+    valid = microsteps == MICROSTEPS;
+  }
+
+  uint16_t start = TRACK_HEADER_SIZE;
+  for (uint8_t i = 0; i < 3; i++) {
+    uint16_t length = 0;
+    if (valid) {
+      length = readTrackByte(header);
+      length |= (uint16_t)readTrackByte(header) << 8;
+    }
+    readers[i] = header;
+    readers[i].offset = start;
+    readers[i].end = start + length;
+    start += length;
+  }
+  return valid;
+}
+
+/**
+ * Function to take the next queue entry off a wait
+ * A wait longer than one entry is split up, and the last two entries share what is left so neither gets too short
+ * @param left the ticks still to wait, lowered by the ticks taken
+ */
+static uint16_t takeWait(uint32_t &left) {
+  uint32_t ticks = left;
+  if (ticks > TRACK_MAX_WAIT_TICKS) {
+    ticks = ticks > 2UL * TRACK_MAX_WAIT_TICKS ? TRACK_MAX_WAIT_TICKS : ticks / 2;
+  }
+  left -= ticks;
+  return ticks;
+}
+
+/**
+ * Function to get the next command of one stepper
+ * Nothing but reading varints and adding, so the queues can be topped up from loop() at any step rate
+ * @param reader the reader of the stepper
+ * @param command set to the command
+ * @return false once the track of the stepper, or the part of it up to lastMove, has been read
+ */
+bool nextTrackCommand(TrackReader &reader, TrackCommand &command) {
+  if (reader.pauseLeft == 0) {
+    uint8_t head;
+    while (true) {
+      if (reader.offset >= reader.end || reader.movesEnded >= reader.lastMove) {
+        return false;
+      }
+      head = readTrackByte(reader);
+      if (head != TRACK_MOVE_END) {
+        break;
+      }
+      reader.movesEnded++;
+    }
+
+    if (head != TRACK_PAUSE) {
+      reader.ticks += zigzagDecode(readVarint(reader));
+      command.steps = head & TRACK_MAX_STEPS;
+      command.countUp = head & TRACK_COUNT_UP;
+
+      // The rest of a long wait after a single step goes on as a pause
+      reader.pauseLeft = reader.ticks;
+      command.ticks = takeWait(reader.pauseLeft);
+      reader.ticksRead += (uint32_t)command.ticks * command.steps;
+      return true;
+    }
+    reader.pauseLeft = readVarint(reader);
+  }
+
+  command.ticks = takeWait(reader.pauseLeft);
+  command.steps = 0;
+  command.countUp = true;
+  reader.ticksRead += command.ticks;
+  return true;
+}
+
+/**
+ * Function to make the readers of a track stop at the end of the move that every stepper can still finish
+ * Commands already handed out can't be taken back, so that is the end of the move the furthest reader is in
+ */
+void stopTrackAtMoveEnd(TrackReader *readers) {
+  uint16_t furthest = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    if (readers[i].movesEnded > furthest) {
+      furthest = readers[i].movesEnded;
+    }
+  }
+  for (uint8_t i = 0; i < 3; i++) {
+    readers[i].lastMove = furthest + 1;
+  }
+}
+
+/**
+ * Function to read past the commands of one stepper up to the end of a move without handing them out
+ * Used to carry on with a track after it was paused, from the end of a move where every stepper is at rest on it
+ * @param reader the reader of the stepper, it goes on after the move end afterwards
+ * @param move the move end to stop at, counted like TrackReader::movesEnded
+ * @return the steps that were passed over, negative when counting down
+ */
+int32_t skipToMoveEnd(TrackReader &reader, uint16_t move) {
+  uint16_t lastMove = reader.lastMove;
+  if (move < lastMove) {
+    reader.lastMove = move;
+  }
+
+  int32_t steps = 0;
+  TrackCommand command;
+  while (nextTrackCommand(reader, command)) {
+    steps += command.countUp ? command.steps : -(int32_t)command.steps;
+  }
+  reader.lastMove = lastMove;
+  return steps;
+}
@@ -0,0 +1,73 @@
+#ifndef STEP_TRACK_H
+#define STEP_TRACK_H
+
+#include <stdint.h>
+
+// Rides compiled ahead of time into the step commands of every motor
+//
+// A ride script leaves the ramps to the sketch: while the ride runs, every keyframe becomes a move whose steps
+// the ramp generator of FastAccelStepper or the S-curve generator work out one by one. A step track is the same
+// ride worked out by host/ride_compiler.cpp down to the commands of the step queue, with the effects of the ride
+// already laid over the moves. Playing it only copies commands into the queues, so a dense ride leaves the
+// processor to the serial port and everything else in loop().
+//
+// Track layout:
+//   'S' | 'T' | version | MICROSTEPS (uint16) | length of the commands of stepper1, stepper2 and stepper3
+//   (3 x uint16) | commands ...
+// The steps of a track are those of the microstep setting it was compiled for. A track of another setting would play
+// at the wrong scale, so it doesn't open.
+// The commands of each stepper follow each other, one command is:
+//   steps | ticks change   1 to 127 steps, 0x80 set when counting up, then the ticks between the steps as the change
+//                          from the command with steps before it, a zigzag varint (see RideScript.h)
+//   0x00 | ticks           a pause, the ticks as a varint
+//   0x80                   the move to a keyframe ends here
+// Waits longer than a queue entry are split up by the reader, a single step may have one after it as well.
+// Ticks are those of the 16 MHz step timer. A track starts with the chair level and at rest, and the moves of all
+// steppers end together, so a track can be stopped at the end of any move and the chair stays in one piece.
+
+#define TRACK_MAGIC_0 'S'
+#define TRACK_MAGIC_1 'T'
+#define TRACK_VERSION 2
+#define TRACK_HEADER_SIZE 11
+
+#define TRACK_PAUSE 0x00
+#define TRACK_MOVE_END 0x80
+#define TRACK_COUNT_UP 0x80
+#define TRACK_MAX_STEPS 127
+
+// Limits of a queue entry of FastAccelStepper on the ATmega2560
+#define TRACK_MAX_TICKS 65535
+#define TRACK_MIN_STEP_TICKS 320   // 50000 steps/sec
+#define TRACK_MIN_PAUSE_TICKS 3200 // 200 us
+
+// Waits are handed to the queue in entries of at most this, leaving room to stretch them (see setTrackStretch())
+#define TRACK_MAX_WAIT_TICKS 60000
+
+// Value of TrackReader::lastMove while the whole track is to be played
+#define TRACK_ALL_MOVES 0xFFFF
+
+// One command for the step queue, the same fields as stepper_command_s of FastAccelStepper
+struct TrackCommand {
+  uint16_t ticks; // Ticks between the steps, or the length of a pause when steps is 0
+  uint8_t steps;
+  bool countUp;
+};
+
+// Where one stepper is in a track
+struct TrackReader {
+  const uint8_t *track;
+  uint16_t offset;
+  uint16_t end;        // Offset just past the commands of the stepper
+  uint32_t ticks;      // Ticks of the last command with steps
+  uint32_t pauseLeft;  // Ticks of a pause that are still to be handed out
+  uint16_t movesEnded; // Move ends read so far
+  uint16_t lastMove;   // The reader stops at this move end
+  uint32_t ticksRead;  // Length of the commands read so far, which holds tracks of up to 268 seconds
+};
+
+bool openStepTrack(TrackReader *readers, const uint8_t *track);
+bool nextTrackCommand(TrackReader &reader, TrackCommand &command);
+void stopTrackAtMoveEnd(TrackReader *readers);
+int32_t skipToMoveEnd(TrackReader &reader, uint16_t move);
+
+#endif
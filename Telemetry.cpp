@@ -0,0 +1,216 @@
+#include "Arduino.h"
+#include "Telemetry.h"
+#include "SerialProtocol.h"
+#include "RideScript.h"
+#include "MotionScheduler.h"
+
+// Largest encoding of one sample: the mask and six changes of up to 3 varint bytes each
+#define MAX_SAMPLE_SIZE (1 + TELEMETRY_VALUES * 3)
+
+// A frame that is waiting for loop() to send it
+struct TelemetryFrame {
+  uint8_t type;
+  uint8_t length;
+  uint8_t payload[FRAME_MAX_PAYLOAD];
+};
+
+// The steppers that are sampled (index 0 is stepper1)
+static FastAccelStepper *steppers[3] = { nullptr, nullptr, nullptr };
+
+static bool on = false;
+static uint32_t periodMicros = TELEMETRY_DEFAULT_PERIOD_MS * 1000UL;
+static uint8_t samplesPerFrame = 1;
+static uint32_t nextSampleAt = 0;
+static uint16_t sampleIndex = 0;
+static uint16_t samplesSinceKey = 0;
+static bool keyNeeded = true;
+
+// The last sample that was encoded, the next one is sent as the changes from it
+static int16_t previous[TELEMETRY_VALUES];
+
+// The frame samples are being added to
+static TelemetryFrame pending;
+static uint8_t pendingSamples = 0;
+
+// Frames that are complete, one sample can finish the pending frame and start a key frame
+static TelemetryFrame ready[2];
+static uint8_t readyCount = 0;
+
+/**
+ * Function to remember the steppers telemetry samples
+ */
+void initTelemetry(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third) {
+  steppers[0] = first;
+  steppers[1] = second;
+  steppers[2] = third;
+}
+
+/**
+ * Function to start sampling, the first sample goes out as a key frame
+ * @param periodMs time between samples in milliseconds, at least 1
+ * @param batch samples packed into one frame, from 1 to TELEMETRY_MAX_BATCH
+ */
+void startTelemetry(uint16_t periodMs, uint8_t batch) {
+  periodMicros = (periodMs > 0 ? periodMs : 1) * 1000UL;
+  samplesPerFrame = constrain(batch, 1, TELEMETRY_MAX_BATCH);
+  nextSampleAt = micros();
+  sampleIndex = 0;
+  keyNeeded = true;
+  pendingSamples = 0;
+  readyCount = 0;
+  on = true;
+}
+
+/**
+ * Function to stop sampling, frames that were not sent yet are dropped
+ */
+void stopTelemetry() {
+  on = false;
+  pendingSamples = 0;
+  readyCount = 0;
+}
+
+bool isTelemetryOn() {
+  return on;
+}
+
+/**
+ * Function to move the pending frame to the frames that are ready to be sent
+ */
+static void finishPendingFrame() {
+  if (pendingSamples == 0) {
+    return;
+  }
+  pendingSamples = 0;
+
+  // loop() takes the ready frames after every sample, so this only happens if it stopped doing so
+  if (readyCount >= 2) {
+    telemetryFrameDropped();
+    return;
+  }
+  ready[readyCount++] = pending;
+}
+
+/**
+ * Function to queue a key frame with the full values of a sample
+ */
+static void addKeyFrame(const int16_t *values) {
+  finishPendingFrame();
+  if (readyCount >= 2) {
+    return;
+  }
+
+  TelemetryFrame &frame = ready[readyCount++];
+  frame.type = MSG_TELEMETRY_KEY;
+  frame.length = TELEMETRY_KEY_PAYLOAD_SIZE;
+  writeUint16(frame.payload, sampleIndex);
+  writeUint16(frame.payload + 2, periodMicros / 1000);
+  for (uint8_t i = 0; i < TELEMETRY_VALUES; i++) {
+    writeInt16(frame.payload + 4 + 2 * i, values[i]);
+  }
+
+  keyNeeded = false;
+  samplesSinceKey = 0;
+}
+
+/**
+ * Function to encode a sample as the changes from the one before
+ * @return the number of bytes written
+ */
+static uint8_t encodeSample(uint8_t *buffer, const int16_t *values) {
+  uint8_t mask = 0;
+  uint8_t length = 1;
+
+  for (uint8_t i = 0; i < TELEMETRY_VALUES; i++) {
+    int32_t change = (int32_t)values[i] - previous[i];
+    if (change != 0) {
+      mask |= 1 << i;
+      length += writeVarint(buffer + length, zigzagEncode(change));
+    }
+  }
+  buffer[0] = mask;
+  return length;
+}
+
+/**
+ * Function to take a sample when one is due, called on every pass through loop()
+ * Samples that were due while loop() was busy are skipped, they show up as a gap in the sample index
+ */
+void updateTelemetry() {
+  uint32_t now = micros();
+  if (!on || (int32_t)(now - nextSampleAt) < 0) {
+    return;
+  }
+
+  // The samples of a frame have consecutive indexes, so a gap ends the frame
+  uint32_t skipped = (now - nextSampleAt) / periodMicros;
+  if (skipped > 0) {
+    finishPendingFrame();
+    sampleIndex += skipped;
+  }
+  nextSampleAt += (skipped + 1) * periodMicros;
+
+  int16_t values[TELEMETRY_VALUES];
+  for (uint8_t i = 0; i < 3; i++) {
+    int32_t position = steppers[i] ? getChairPosition(i) : 0;
+    int32_t speed = steppers[i] ? steppers[i] -> getCurrentSpeedInMilliHz() / 1000 : 0;
+    values[i] = constrain(position, -32768L, 32767L);
+    values[3 + i] = constrain(speed, -32768L, 32767L);
+  }
+
+  uint8_t sample[MAX_SAMPLE_SIZE];
+  uint8_t size = encodeSample(sample, values);
+
+  if (keyNeeded || samplesSinceKey >= TELEMETRY_KEYFRAME_INTERVAL || 2 + size > FRAME_MAX_PAYLOAD) {
+    addKeyFrame(values);
+  } else {
+    if (pendingSamples > 0 && pending.length + size > FRAME_MAX_PAYLOAD) {
+      finishPendingFrame();
+    }
+    if (pendingSamples == 0) {
+      pending.type = MSG_TELEMETRY;
+      writeUint16(pending.payload, sampleIndex);
+      pending.length = 2;
+    }
+    memcpy(pending.payload + pending.length, sample, size);
+    pending.length += size;
+    samplesSinceKey++;
+
+    if (++pendingSamples >= samplesPerFrame) {
+      finishPendingFrame();
+    }
+  }
+
+  memcpy(previous, values, sizeof(previous));
+  sampleIndex++;
+}
+
+/**
+ * Function to take the next frame that is ready to be sent
+ * @param type set to MSG_TELEMETRY or MSG_TELEMETRY_KEY
+ * @param payload room for FRAME_MAX_PAYLOAD bytes
+ * @return the payload length, 0 if no frame is ready
+ */
+uint8_t nextTelemetryFrame(uint8_t &type, uint8_t *payload) {
+  if (readyCount == 0) {
+    return 0;
+  }
+
+  uint8_t length = ready[0].length;
+  type = ready[0].type;
+  memcpy(payload, ready[0].payload, length);
+
+  ready[0] = ready[1];
+  readyCount--;
+  return length;
+}
+
+/**
+ * Function to note that the last frame handed out could not be sent
+ * The frames after it build on it, so they are dropped too and the stream starts again from a key frame
+ */
+void telemetryFrameDropped() {
+  readyCount = 0;
+  pendingSamples = 0;
+  keyNeeded = true;
+}
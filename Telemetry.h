@@ -0,0 +1,42 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "FastAccelStepper.h"
+
+// Optional stream of what the motors are actually doing
+//
+// While telemetry is on, the position and speed of every stepper are sampled at a fixed rate and packed
+// into frames as changes from the sample before. The positions are those of the chair side of the gears, without
+// the play the motors have taken up (Backlash.h).
+//
+//   MSG_TELEMETRY:     uint16 index of the first sample, then per sample a mask byte with bit i set when
+//                      value i changed (positions of stepper1..3, then speeds of stepper1..3), followed by
+//                      the changes of those values as zigzag varints (see RideScript.h)
+//   MSG_TELEMETRY_KEY: uint16 sample index, uint16 sample period in ms, int16 positions (steps) and
+//                      int16 speeds (steps/sec) of stepper1..3
+//
+// A motor at rest costs one byte per sample. Frames are only sent when they fit into the serial transmit
+// buffer, a frame that doesn't fit is dropped and the next sample goes out as a key frame, so a busy port
+// never holds up loop(). The host sees dropped samples as gaps in the sample index.
+
+// Sampling at 100 Hz unless the host asks for something else
+#define TELEMETRY_DEFAULT_PERIOD_MS 10
+
+// A key frame is sent at least this often, so a host that starts listening late can pick up the stream
+#define TELEMETRY_KEYFRAME_INTERVAL 100
+
+// Most samples packed into one frame, more samples per frame save bytes but add latency
+#define TELEMETRY_MAX_BATCH 8
+
+#define TELEMETRY_KEY_PAYLOAD_SIZE 16
+#define TELEMETRY_VALUES 6
+
+void initTelemetry(FastAccelStepper *first, FastAccelStepper *second, FastAccelStepper *third);
+void startTelemetry(uint16_t periodMs, uint8_t batch);
+void stopTelemetry();
+bool isTelemetryOn();
+void updateTelemetry();
+uint8_t nextTelemetryFrame(uint8_t &type, uint8_t *payload);
+void telemetryFrameDropped();
+
+#endif
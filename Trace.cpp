@@ -0,0 +1,61 @@
+#include "Trace.h"
+#include "SerialProtocol.h"
+
+TraceBuffer traceBuffer;
+
+// Events still to be sent, counted from startup like traceBuffer.recorded
+static uint32_t dumpNext = 0;
+static bool dumping = false;
+
+/**
+ * Function to start sending the buffer to the host
+ * Recording pauses until the last frame has been handed out, so the events being sent can't be overwritten
+ */
+void startTraceDump() {
+  traceBuffer.paused = true;
+  dumpNext = traceBuffer.recorded > TRACE_SIZE ? traceBuffer.recorded - TRACE_SIZE : 0;
+  dumping = true;
+}
+
+/**
+ * Function to check whether there are MSG_TRACE frames left to send
+ */
+bool isTraceDumping() {
+  return dumping;
+}
+
+/**
+ * Function to fill in the payload of the next MSG_TRACE frame, oldest events first
+ * The frame after the last events carries the counters and ends the dump
+ * @param payload room for FRAME_MAX_PAYLOAD bytes
+ * @return the payload length, 0 if there is nothing left to send
+ */
+uint8_t nextTraceFrame(uint8_t *payload) {
+  if (!dumping) {
+    return 0;
+  }
+
+  uint8_t count = 0;
+  uint8_t *cursor = payload + 1;
+  while (count < TRACE_EVENTS_PER_FRAME && dumpNext < traceBuffer.recorded) {
+    const TraceEvent &event = traceBuffer.events[(uint8_t)dumpNext & (TRACE_SIZE - 1)];
+    writeUint32(cursor, event.micros);
+    cursor[4] = event.type;
+    cursor[5] = event.arg;
+    cursor += TRACE_EVENT_SIZE;
+    dumpNext++;
+    count++;
+  }
+  payload[0] = count;
+
+  if (count > 0) {
+    return cursor - payload;
+  }
+
+  writeUint32(payload + 1, traceBuffer.recorded);
+  writeUint16(payload + 5, traceBuffer.missed);
+  traceBuffer.missed = 0;
+  traceBuffer.paused = false;
+  dumping = false;
+  return TRACE_END_PAYLOAD_SIZE;
+}
@@ -0,0 +1,79 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "Arduino.h"
+
+// Binary event trace kept in a ring buffer in SRAM
+//
+// Recording an event stores a timestamp and two bytes, it never prints or waits, so rides can be
+// traced without changing their timing. The buffer keeps the last TRACE_SIZE events and is sent to
+// the host on request as MSG_TRACE frames, see SerialProtocol.h. host/trace_decoder turns a capture
+// of those frames into a timeline.
+//
+// Events are only recorded from loop(), never from an interrupt, so the buffer needs no locking.
+
+// Set to 0 to compile every traceEvent() call away
+#define TRACE_ENABLED 1
+
+// Number of events kept, a power of two so that wrapping around is a single AND
+#define TRACE_SIZE 128
+
+// Events in a MSG_TRACE frame
+#define TRACE_EVENTS_PER_FRAME 2
+
+enum TraceEventType : uint8_t {
+  TRACE_COMMAND_RECEIVED = 1, // arg: first character of a text line, the type of a binary frame or a control byte
+  TRACE_STATE_CHANGED,        // arg: the new state of loop()
+  TRACE_TASK_QUEUED,          // arg: MotionTaskType of the task
+  TRACE_TASK_STARTED,         // arg: MotionTaskType of the task
+  TRACE_MOVE_STARTED,         // arg: mask of the steppers that were sent moving
+  TRACE_HOLD_STARTED,         // arg: MotionTaskType, the steppers arrived and the hold time starts
+  TRACE_TASK_FINISHED,        // arg: MotionTaskType of the task
+  TRACE_QUEUE_FULL,           // arg: MotionTaskType of the task that did not fit
+  TRACE_HALTED,               // arg: HaltMode, every motor was sent braking
+  TRACE_HALT_AT_REST,         // arg: HaltMode, every motor has come to rest
+  TRACE_RESUMED               // arg: 0, the paused tasks carry on
+};
+
+struct TraceEvent {
+  uint32_t micros;
+  uint8_t type;
+  uint8_t arg;
+};
+
+struct TraceBuffer {
+  TraceEvent events[TRACE_SIZE];
+  uint32_t recorded; // Events recorded since startup, the oldest ones have been overwritten
+  uint16_t missed;   // Events dropped while the buffer was being sent
+  bool paused;       // The buffer is left alone while it is being sent
+};
+
+extern TraceBuffer traceBuffer;
+
+/**
+ * Function to record one event
+ * @param type what happened
+ * @param arg one byte of detail, see TraceEventType
+ */
+inline void traceEvent(uint8_t type, uint8_t arg) {
+#if TRACE_ENABLED
+  if (traceBuffer.paused) {
+    traceBuffer.missed++;
+    return;
+  }
+  TraceEvent &event = traceBuffer.events[(uint8_t)traceBuffer.recorded & (TRACE_SIZE - 1)];
+  event.micros = micros();
+  event.type = type;
+  event.arg = arg;
+  traceBuffer.recorded++;
+#else
+  (void)type;
+  (void)arg;
+#endif
+}
+
+void startTraceDump();
+bool isTraceDumping();
+uint8_t nextTraceFrame(uint8_t *payload);
+
+#endif
@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <string.h>
+
+#include "LatencyProbe.h"
+#include "../SerialProtocol.h"
+
+void initLatencyProbe(LatencyProbe &probe) {
+  memset(&probe, 0, sizeof(probe));
+}
+
+/**
+ * Function to fill the payload of a MSG_PING
+ * @param nowMicros the host clock in microseconds
+ */
+void encodePing(uint8_t *payload, uint64_t nowMicros) {
+  writeUint32(payload, (uint32_t)nowMicros);
+}
+
+/**
+ * Function to measure a round trip from the MSG_PONG that answers a ping
+ * @param nowMicros the host clock when the answer arrived, the same clock the ping was sent by
+ * @return false if the payload is not that of a MSG_PONG
+ */
+bool takePong(LatencyProbe &probe, const uint8_t *payload, uint8_t length, uint64_t nowMicros) {
+  if (length != PONG_PAYLOAD_SIZE) {
+    return false;
+  }
+  probe.roundTrips[probe.next] = (uint32_t)nowMicros - readUint32(payload);
+  if (probe.count == 0 || probe.roundTrips[probe.next] < probe.fastest) {
+    probe.fastest = probe.roundTrips[probe.next];
+  }
+  probe.next = (probe.next + 1) % PROBE_WINDOW;
+  if (probe.count < PROBE_WINDOW) {
+    probe.count++;
+  }
+  probe.bufferMicros = readUint32(payload + PING_PAYLOAD_SIZE);
+  return true;
+}
+
+/**
+ * Function to get the time a frame takes from the host to the chair
+ * @return half the median round trip in microseconds, 0 before the first answer
+ */
+uint32_t getLinkLatency(const LatencyProbe &probe) {
+  if (probe.count == 0) {
+    return 0;
+  }
+  uint32_t sorted[PROBE_WINDOW];
+  std::copy(probe.roundTrips, probe.roundTrips + probe.count, sorted);
+  std::nth_element(sorted, sorted + probe.count / 2, sorted + probe.count);
+  return sorted[probe.count / 2] / 2;
+}
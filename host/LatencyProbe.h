@@ -0,0 +1,30 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <stdint.h>
+
+// Measures the latency between a host and the chair with MSG_PING, for the lead of the predictor (PosePredictor.h)
+//
+// A ping carries the low 32 bits of the host clock in microseconds and the chair echoes them in MSG_PONG, together
+// with how long poses wait in its jitter buffer. The link latency is half the median of the last PROBE_WINDOW round
+// trips, so one slow answer doesn't throw the lead off.
+
+#define PROBE_WINDOW 8
+
+// The bridge pings this often while it streams
+#define PROBE_INTERVAL_MS 500
+
+struct LatencyProbe {
+  uint32_t roundTrips[PROBE_WINDOW];
+  uint8_t count;         // Round trips measured, up to PROBE_WINDOW
+  uint8_t next;          // Slot the next one goes into
+  uint32_t bufferMicros; // Jitter buffer wait the chair reported last
+  uint32_t fastest;      // Shortest round trip so far, 0 before the first
+};
+
+void initLatencyProbe(LatencyProbe &probe);
+void encodePing(uint8_t *payload, uint64_t nowMicros);
+bool takePong(LatencyProbe &probe, const uint8_t *payload, uint8_t length, uint64_t nowMicros);
+uint32_t getLinkLatency(const LatencyProbe &probe);
+
+#endif
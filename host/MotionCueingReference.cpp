@@ -0,0 +1,94 @@
+#include "MotionCueingReference.h"
+
+#include <algorithm>
+#include <cmath>
+
+static const double PERIOD = 1.0 / CUEING_RATE_HZ;
+
+// Same corner frequencies as the fixed-point filters
+static double highPassCoefficient(double rcMs) {
+  return rcMs / (rcMs + 1000.0 * PERIOD);
+}
+
+static double lowPassCoefficient(double rcMs) {
+  return 1000.0 * PERIOD / (rcMs + 1000.0 * PERIOD);
+}
+
+// Centidegrees per thousandth of g, asin(a) taken as a like the fixed-point version
+static const double TILT_PER_MG = 0.001 * 18000.0 / M_PI;
+
+static double highPass(ReferenceFilter &filter, double input, double coefficient) {
+  filter.output = coefficient * (filter.output + input - filter.previousInput);
+  filter.previousInput = input;
+  return filter.output;
+}
+
+static double lowPass(ReferenceFilter &filter, double input, double coefficient) {
+  filter.output += coefficient * (input - filter.output);
+  return filter.output;
+}
+
+static double clamp(double value, double limit) {
+  return std::max(-limit, std::min(limit, value));
+}
+
+static void resetFilter(ReferenceFilter &filter) {
+  filter.output = 0;
+  filter.previousInput = 0;
+}
+
+void initMotionCueingReference(MotionCueingReference &cueing, double pitchLimit, double rollLimit, double yawLimit) {
+  resetFilter(cueing.rollRateHighPass);
+  resetFilter(cueing.pitchRateHighPass);
+  resetFilter(cueing.yawRateHighPass);
+  resetFilter(cueing.surgeHighPass);
+  resetFilter(cueing.swayHighPass);
+  resetFilter(cueing.surgeLowPass);
+  resetFilter(cueing.swayLowPass);
+
+  cueing.rollAngle = 0;
+  cueing.pitchAngle = 0;
+  cueing.yawAngle = 0;
+  cueing.pitchTilt = 0;
+  cueing.rollTilt = 0;
+
+  cueing.pitchLimit = pitchLimit;
+  cueing.rollLimit = rollLimit;
+  cueing.yawLimit = yawLimit;
+}
+
+ReferencePose updateMotionCueingReference(MotionCueingReference &cueing, const VehicleState &vehicle) {
+  const double rotationHighPass = highPassCoefficient(CUEING_ROTATION_HIGH_PASS_MS);
+  const double rotationReturn = highPassCoefficient(CUEING_ROTATION_RETURN_MS);
+  const double translationHighPass = highPassCoefficient(CUEING_TRANSLATION_HIGH_PASS_MS);
+  const double tiltLowPass = lowPassCoefficient(CUEING_TILT_LOW_PASS_MS);
+  const double onsetFactor = CUEING_ONSET_GAIN / (18000.0 / M_PI);
+  const double tiltStepLimit = (double)CUEING_TILT_RATE_LIMIT * PERIOD;
+
+  // Rotational channel
+  double rollRate = highPass(cueing.rollRateHighPass, vehicle.rollRate, rotationHighPass);
+  double pitchRate = highPass(cueing.pitchRateHighPass, vehicle.pitchRate, rotationHighPass);
+  double yawRate = highPass(cueing.yawRateHighPass, vehicle.yawRate, rotationHighPass);
+  cueing.rollAngle = clamp(cueing.rollAngle * rotationReturn + rollRate * PERIOD, cueing.rollLimit);
+  cueing.pitchAngle = clamp(cueing.pitchAngle * rotationReturn + pitchRate * PERIOD, cueing.pitchLimit);
+  cueing.yawAngle = clamp(cueing.yawAngle * rotationReturn + yawRate * PERIOD, cueing.yawLimit);
+
+  double surgeTilt = vehicle.surge * TILT_PER_MG;
+  double swayTilt = -vehicle.sway * TILT_PER_MG;
+
+  // Translational channel
+  double surgeOnset = highPass(cueing.surgeHighPass, surgeTilt, translationHighPass) * onsetFactor;
+  double swayOnset = highPass(cueing.swayHighPass, swayTilt, translationHighPass) * onsetFactor;
+
+  // Tilt coordination
+  double pitchTarget = clamp(lowPass(cueing.surgeLowPass, surgeTilt, tiltLowPass), cueing.pitchLimit);
+  double rollTarget = clamp(lowPass(cueing.swayLowPass, swayTilt, tiltLowPass), cueing.rollLimit);
+  cueing.pitchTilt += clamp(pitchTarget - cueing.pitchTilt, tiltStepLimit);
+  cueing.rollTilt += clamp(rollTarget - cueing.rollTilt, tiltStepLimit);
+
+  ReferencePose pose;
+  pose.pitch = clamp(cueing.pitchAngle + surgeOnset + cueing.pitchTilt, cueing.pitchLimit);
+  pose.roll = clamp(cueing.rollAngle + swayOnset + cueing.rollTilt, cueing.rollLimit);
+  pose.yaw = clamp(cueing.yawAngle, cueing.yawLimit);
+  return pose;
+}
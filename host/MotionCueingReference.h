@@ -0,0 +1,44 @@
+#ifndef MOTION_CUEING_REFERENCE_H
+#define MOTION_CUEING_REFERENCE_H
+
+#include "../MotionCueing.h"
+
+// Floating point version of the washout in MotionCueing.cpp, used on the host to check the fixed-point one
+// It runs the same filters with exact coefficients and no rounding, so any difference is quantization error
+
+struct ReferenceFilter {
+  double output;
+  double previousInput;
+};
+
+struct MotionCueingReference {
+  ReferenceFilter rollRateHighPass;
+  ReferenceFilter pitchRateHighPass;
+  ReferenceFilter yawRateHighPass;
+  double rollAngle;
+  double pitchAngle;
+  double yawAngle;
+
+  ReferenceFilter surgeHighPass;
+  ReferenceFilter swayHighPass;
+  ReferenceFilter surgeLowPass;
+  ReferenceFilter swayLowPass;
+  double pitchTilt;
+  double rollTilt;
+
+  double pitchLimit; // Centidegrees
+  double rollLimit;
+  double yawLimit;
+};
+
+// Chair angles in centidegrees, not rounded
+struct ReferencePose {
+  double pitch;
+  double roll;
+  double yaw;
+};
+
+void initMotionCueingReference(MotionCueingReference &cueing, double pitchLimit, double rollLimit, double yawLimit);
+ReferencePose updateMotionCueingReference(MotionCueingReference &cueing, const VehicleState &vehicle);
+
+#endif
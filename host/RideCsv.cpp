@@ -0,0 +1,280 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "RideCsv.h"
+#include "../AxisConfig.h"
+#include "../Effects.h"
+
+// In the order of EffectPreset
+static const char *EFFECT_NAMES[EFFECT_PRESETS] = { "stop", "gravel", "engine", "bump" };
+
+// Columns of a keyframe
+#define FIELD_TIME 0
+#define FIELD_SPEED 4
+#define FIELD_ACCELERATION 5
+#define FIELD_COUNT 8
+
+static void fail(const std::string &where, const std::string &message) {
+  fprintf(stderr, "%s: %s\n", where.c_str(), message.c_str());
+  exit(EXIT_FAILURE);
+}
+
+static std::string trim(const std::string &text) {
+  size_t first = text.find_first_not_of(" \t\r");
+  if (first == std::string::npos) {
+    return "";
+  }
+  size_t last = text.find_last_not_of(" \t\r");
+  return text.substr(first, last - first + 1);
+}
+
+/**
+ * Function to cut a line into its fields as they are written, spaces included
+ */
+static std::vector<std::string> splitFields(const std::string &line) {
+  std::vector<std::string> fields;
+  std::stringstream stream(line);
+  std::string field;
+  while (std::getline(stream, field, ',')) {
+    fields.push_back(field);
+  }
+  return fields;
+}
+
+/**
+ * Function to read a number field
+ * @return false if the field is empty
+ */
+static bool parseNumber(const std::string &field, double &value, const std::string &where) {
+  if (field.empty()) {
+    return false;
+  }
+  char *end = nullptr;
+  value = strtod(field.c_str(), &end);
+  if (*end != '\0') {
+    fail(where, "\"" + field + "\" is not a number");
+  }
+  return true;
+}
+
+/**
+ * Function to read an angle in degrees, checking it against the limit of the axis
+ */
+static int16_t parseAngle(const std::string &field, int16_t limit, const char *axis, const std::string &where) {
+  double degrees = 0;
+  parseNumber(field, degrees, where);
+  long centidegrees = lround(degrees * 100);
+  if (centidegrees > limit || centidegrees < -limit) {
+    fail(where, std::string(axis) + " is outside of +-" + std::to_string(limit / 100) + " degrees");
+  }
+  return centidegrees;
+}
+
+/**
+ * Function to read a speed or acceleration cap in full steps
+ * @param previous the cap of the keyframe before, kept when the field is empty
+ */
+static uint16_t parseCap(const std::string &field, uint16_t previous, uint32_t limit, const char *what, const std::string &where) {
+  double value = 0;
+  if (!parseNumber(field, value, where)) {
+    if (previous == 0) {
+      fail(where, std::string("the first keyframe needs a ") + what);
+    }
+    return previous;
+  }
+  if (value < 1 || value > limit) {
+    fail(where, std::string(what) + " has to be between 1 and " + std::to_string(limit));
+  }
+  return (uint16_t)lround(value);
+}
+
+/**
+ * Function to read the name of an effect
+ * @return RIDE_NO_EFFECT if the field is empty
+ */
+static uint8_t parseEffect(const std::string &field, const std::string &where) {
+  if (field.empty()) {
+    return RIDE_NO_EFFECT;
+  }
+  for (uint8_t i = 0; i < EFFECT_PRESETS; i++) {
+    if (field == EFFECT_NAMES[i]) {
+      return i;
+    }
+  }
+  fail(where, "\"" + field + "\" is not an effect");
+  return RIDE_NO_EFFECT;
+}
+
+/**
+ * Function to read a ride script
+ * The ride is named after the file unless a "# name:" comment names it
+ */
+RideCsv readRideCsv(const std::string &path) {
+  std::ifstream file(path);
+  if (!file) {
+    fail(path, "can't be opened");
+  }
+
+  RideCsv ride;
+  ride.source = path;
+  size_t slash = path.find_last_of('/');
+  ride.name = path.substr(slash == std::string::npos ? 0 : slash + 1);
+  ride.name = ride.name.substr(0, ride.name.find_last_of('.'));
+
+  RideKeyframe previous = { 0, 0, 0, 0, 0, 0, false, RIDE_NO_EFFECT };
+  std::string line;
+
+  while (std::getline(file, line)) {
+    ride.lines.push_back(line);
+    std::string where = path + ":" + std::to_string(ride.lines.size());
+    line = trim(line);
+
+    if (line.empty()) {
+      continue;
+    }
+    if (line[0] == '#') {
+      std::string comment = trim(line.substr(1));
+      if (comment.compare(0, 5, "name:") == 0) {
+        ride.name = trim(comment.substr(5));
+      } else if (comment == "precompile") {
+        ride.precompile = true;
+      }
+      continue;
+    }
+
+    std::vector<std::string> fields = splitFields(line);
+    for (std::string &field : fields) {
+      field = trim(field);
+    }
+
+    // Skip the column names
+    if (!fields.empty() && !fields[0].empty() && !isdigit((unsigned char)fields[0][0]) && fields[0][0] != '.' && fields[0][0] != '-') {
+      continue;
+    }
+    if (fields.size() < 4 || fields.size() > FIELD_COUNT) {
+      fail(where, "expected time, pitch, roll, yaw and optionally speed, accel, curve and effect");
+    }
+    fields.resize(FIELD_COUNT);
+
+    double seconds = 0;
+    if (!parseNumber(fields[FIELD_TIME], seconds, where) || seconds < 0) {
+      fail(where, "the time is missing or negative");
+    }
+
+    RideKeyframe keyframe;
+    keyframe.timeMs = lround(seconds * 1000);
+    keyframe.pitch = parseAngle(fields[1], PitchAxis::LIMIT_CENTIDEGREES, "pitch", where);
+    keyframe.roll = parseAngle(fields[2], RollAxis::LIMIT_CENTIDEGREES, "roll", where);
+    keyframe.yaw = parseAngle(fields[3], YawAxis::LIMIT_CENTIDEGREES, "yaw", where);
+    keyframe.speed = parseCap(fields[FIELD_SPEED], previous.speed, PitchAxis::MAX_SPEED / MICROSTEPS, "speed", where);
+    keyframe.acceleration = parseCap(fields[FIELD_ACCELERATION], previous.acceleration, PitchAxis::MAX_ACCELERATION / MICROSTEPS, "accel", where);
+    keyframe.curve = fields[6] == "1";
+    if (!fields[6].empty() && fields[6] != "0" && fields[6] != "1") {
+      fail(where, "curve has to be 0 or 1");
+    }
+    keyframe.effect = parseEffect(fields[7], where);
+
+    if (keyframe.timeMs < previous.timeMs) {
+      fail(where, "the keyframes have to be in order of time");
+    }
+
+    // The sketch waits for the next keyframe with a 16-bit hold time
+    if (keyframe.timeMs - previous.timeMs > 65535) {
+      fail(where, "more than 65 seconds after the keyframe before");
+    }
+
+    ride.keyframes.push_back(keyframe);
+    ride.keyframeLines.push_back(ride.lines.size() - 1);
+    previous = keyframe;
+  }
+
+  if (ride.keyframes.empty()) {
+    fail(path, "has no keyframes");
+  }
+  if (ride.keyframes.size() > 65535) {
+    fail(path, "has too many keyframes");
+  }
+  if (ride.name.size() > RIDE_NAME_LENGTH) {
+    fail(path, "the name is longer than " + std::to_string(RIDE_NAME_LENGTH) + " characters");
+  }
+  return ride;
+}
+
+/**
+ * Function to write a time in seconds with as few decimals as it needs, but at least one
+ */
+static std::string formatSeconds(uint32_t timeMs) {
+  char text[16];
+  const char *format = timeMs % 100 == 0 ? "%.1f" : (timeMs % 10 == 0 ? "%.2f" : "%.3f");
+  snprintf(text, sizeof(text), format, timeMs / 1000.0);
+  return text;
+}
+
+/**
+ * Function to put a new value into a field, right-aligned in the width it had so the columns stay lined up
+ * @param fields the fields of the line as they are written, extended if the field is past the end
+ * @param index the field
+ */
+static void replaceField(std::vector<std::string> &fields, size_t index, const std::string &value) {
+  while (fields.size() <= index) {
+    fields.push_back(" ");
+  }
+  size_t width = trim(fields[index]).empty() ? 0 : fields[index].size();
+  std::string text = index == 0 || value.empty() ? value : " " + value;
+  if (text.size() < width) {
+    text.insert(0, width - text.size(), ' ');
+  }
+  fields[index] = value.empty() ? " " : text;
+}
+
+/**
+ * Function to write a ride script back with new times, speeds and accelerations
+ * A speed or acceleration that was left empty stays empty as long as it is still the one of the keyframe before.
+ * The poses, curves and effects are written as they were read.
+ * @param path where to write it, can be the file it was read from
+ * @param ride the ride as it was read
+ * @param keyframes the new keyframes, one for every keyframe of the ride
+ */
+void writeRideCsv(const std::string &path, const RideCsv &ride, const std::vector<RideKeyframe> &keyframes) {
+  if (keyframes.size() != ride.keyframes.size()) {
+    fail(path, "has to be written with as many keyframes as it was read with");
+  }
+
+  std::vector<std::string> lines = ride.lines;
+  for (size_t i = 0; i < keyframes.size(); i++) {
+    std::string &line = lines[ride.keyframeLines[i]];
+    std::vector<std::string> fields = splitFields(line.substr(0, line.find_last_not_of(" \t\r") + 1));
+    fields.resize(std::max(fields.size(), (size_t)(FIELD_ACCELERATION + 1)));
+
+    const RideKeyframe &keyframe = keyframes[i];
+    bool carrySpeed = i > 0 && trim(fields[FIELD_SPEED]).empty() && keyframe.speed == keyframes[i - 1].speed;
+    bool carryAcceleration = i > 0 && trim(fields[FIELD_ACCELERATION]).empty() && keyframe.acceleration == keyframes[i - 1].acceleration;
+
+    replaceField(fields, FIELD_TIME, formatSeconds(keyframe.timeMs));
+    replaceField(fields, FIELD_SPEED, carrySpeed ? "" : std::to_string(keyframe.speed));
+    replaceField(fields, FIELD_ACCELERATION, carryAcceleration ? "" : std::to_string(keyframe.acceleration));
+
+    // Fields added at the end that are still empty are left out again
+    size_t count = fields.size();
+    while (count > 4 && trim(fields[count - 1]).empty()) {
+      count--;
+    }
+
+    line.clear();
+    for (size_t j = 0; j < count; j++) {
+      line += (j > 0 ? "," : "") + fields[j];
+    }
+  }
+
+  std::ofstream file(path);
+  for (const std::string &line : lines) {
+    file << line << '\n';
+  }
+  if (!file) {
+    fail(path, "can't be written");
+  }
+}
@@ -0,0 +1,27 @@
+#ifndef RIDE_CSV_H
+#define RIDE_CSV_H
+
+#include <string>
+#include <vector>
+
+#include "../RideScript.h"
+
+// Reading and writing the ride scripts written as CSV, see ride_compiler.cpp for the format
+//
+// The lines of the file are kept as they were read, so a tool can write the ride back with new times, speeds and
+// accelerations and every comment, blank line and field it didn't change stays where it was. A mistake in the file
+// is printed with its line number and ends the program.
+
+struct RideCsv {
+  std::string name;
+  std::string source;
+  bool precompile = false;
+  std::vector<RideKeyframe> keyframes; // Empty speeds and accelerations already filled in from the keyframe before
+  std::vector<std::string> lines;      // The whole file as it was read
+  std::vector<size_t> keyframeLines;   // Index into lines of every keyframe
+};
+
+RideCsv readRideCsv(const std::string &path);
+void writeRideCsv(const std::string &path, const RideCsv &ride, const std::vector<RideKeyframe> &keyframes);
+
+#endif
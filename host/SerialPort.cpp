@@ -0,0 +1,61 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "SerialPort.h"
+#include "../SerialProtocol.h"
+
+#define SERIAL_BAUD_RATE B115200
+
+/**
+ * Function to open the serial port raw at the baud rate of the sketch
+ * @return the file descriptor, or -1 after printing why it failed
+ */
+int openSerialPort(const char *path) {
+  int port = open(path, O_RDWR | O_NOCTTY);
+  termios settings;
+  if (port < 0 || tcgetattr(port, &settings) != 0) {
+    perror(path);
+    return -1;
+  }
+  cfmakeraw(&settings);
+  cfsetspeed(&settings, SERIAL_BAUD_RATE);
+  settings.c_cc[VMIN] = 0;
+  settings.c_cc[VTIME] = 1;
+  tcsetattr(port, TCSANOW, &settings);
+  return port;
+}
+
+bool writeSerialPort(int port, const uint8_t *bytes, size_t size) {
+  while (size > 0) {
+    ssize_t written = write(port, bytes, size);
+    if (written <= 0) {
+      return false;
+    }
+    bytes += written;
+    size -= written;
+  }
+  return true;
+}
+
+/**
+ * Function to type a line into the menu of the chair
+ */
+bool writeSerialText(int port, const char *text) {
+  return writeSerialPort(port, (const uint8_t *)text, strlen(text)) && writeSerialPort(port, (const uint8_t *)"\n", 1);
+}
+
+bool writeSerialFrame(int port, uint8_t type, uint8_t sequence, const uint8_t *payload, uint8_t length) {
+  uint8_t frame[FRAME_MAX_SIZE];
+  uint8_t size = encodeFrame(frame, type, sequence, payload, length);
+  return writeSerialPort(port, frame, size);
+}
+
+/**
+ * Function to send one of the CONTROL_ bytes, the chair acts on it ahead of anything sent before it
+ */
+bool writeSerialControl(int port, uint8_t control) {
+  return writeSerialPort(port, &control, 1);
+}
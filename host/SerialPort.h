@@ -0,0 +1,16 @@
+#ifndef SERIAL_PORT_H
+#define SERIAL_PORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The serial port of the chair as the host tools open it: raw, at the baud rate of the sketch, with reads that
+// come back after 100 ms without data so that a reading thread notices when it should stop
+
+int openSerialPort(const char *path);
+bool writeSerialPort(int port, const uint8_t *bytes, size_t size);
+bool writeSerialText(int port, const char *text);
+bool writeSerialFrame(int port, uint8_t type, uint8_t sequence, const uint8_t *payload, uint8_t length);
+bool writeSerialControl(int port, uint8_t control);
+
+#endif
@@ -0,0 +1,390 @@
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "SessionLog.h"
+#include "../SerialProtocol.h"
+#include "../RideScript.h"
+
+// The file grows in steps, doubling each time
+#define INITIAL_CAPACITY (1 << 20)
+
+// Largest record: type, a 5-byte varint and the payload
+#define MAX_RECORD_SIZE (1 + 5 + 2 * LOG_MAX_VALUES)
+
+static const char HEADER_MAGIC[4] = { 'S', 'L', 'O', 'G' };
+static const char TRAILER_MAGIC[4] = { 'S', 'I', 'D', 'X' };
+
+/**
+ * Function to get how many int16 values follow a record of a type
+ * @return -1 for a type that isn't known
+ */
+static int valueCount(uint8_t type) {
+  switch (type) {
+    case LOG_POSE:
+      return 3;
+    case LOG_TELEMETRY:
+      return 6;
+    default:
+      return -1;
+  }
+}
+
+static void writeUint64(uint8_t *buffer, uint64_t value) {
+  writeUint32(buffer, (uint32_t)value);
+  writeUint32(buffer + 4, (uint32_t)(value >> 32));
+}
+
+static uint64_t readUint64(const uint8_t *buffer) {
+  return readUint32(buffer) | (uint64_t)readUint32(buffer + 4) << 32;
+}
+
+/**
+ * Function to make room for more bytes at the end of the log, growing the file and its mapping if needed
+ */
+static bool reserve(SessionLogWriter &log, size_t bytes) {
+  if (log.size + bytes <= log.capacity) {
+    return true;
+  }
+  size_t capacity = log.capacity;
+  while (log.size + bytes > capacity) {
+    capacity *= 2;
+  }
+  munmap(log.map, log.capacity);
+  log.map = nullptr;
+  if (ftruncate(log.file, capacity) != 0) {
+    return false;
+  }
+  void *map = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, log.file, 0);
+  if (map == MAP_FAILED) {
+    return false;
+  }
+  log.map = (uint8_t *)map;
+  log.capacity = capacity;
+  return true;
+}
+
+/**
+ * Function to create a log, replacing any file at the path
+ * @param indexIntervalMs time between checkpoints, the finest step seeking has to skip forward from
+ */
+bool openSessionLog(SessionLogWriter &log, const char *path, uint32_t indexIntervalMs) {
+  memset(&log, 0, sizeof(log));
+  log.file = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (log.file < 0 || ftruncate(log.file, INITIAL_CAPACITY) != 0) {
+    return false;
+  }
+  void *map = mmap(nullptr, INITIAL_CAPACITY, PROT_READ | PROT_WRITE, MAP_SHARED, log.file, 0);
+  if (map == MAP_FAILED) {
+    close(log.file);
+    return false;
+  }
+  log.map = (uint8_t *)map;
+  log.capacity = INITIAL_CAPACITY;
+  log.indexIntervalMs = indexIntervalMs > 0 ? indexIntervalMs : SESSION_LOG_DEFAULT_INDEX_MS;
+
+  memset(log.map, 0, SESSION_LOG_HEADER_SIZE);
+  memcpy(log.map, HEADER_MAGIC, sizeof(HEADER_MAGIC));
+  writeUint16(log.map + 4, SESSION_LOG_VERSION);
+  writeUint32(log.map + 8, log.indexIntervalMs);
+  log.size = SESSION_LOG_HEADER_SIZE;
+  return true;
+}
+
+/**
+ * Function to write the type and time of a record
+ */
+static void writeRecordStart(SessionLogWriter &log, uint8_t type, uint64_t micros) {
+  uint64_t delta = micros - log.lastMicros;
+  log.map[log.size++] = type;
+  log.size += writeVarint(log.map + log.size, delta > UINT32_MAX ? UINT32_MAX : (uint32_t)delta);
+  log.lastMicros = micros;
+}
+
+/**
+ * Function to add a checkpoint at the end of the log and to the index
+ */
+static bool appendCheckpoint(SessionLogWriter &log, uint64_t micros) {
+  if (log.indexCount == log.indexCapacity) {
+    size_t capacity = log.indexCapacity ? log.indexCapacity * 2 : 256;
+    LogIndexEntry *index = (LogIndexEntry *)realloc(log.index, capacity * sizeof(LogIndexEntry));
+    if (!index) {
+      return false;
+    }
+    log.index = index;
+    log.indexCapacity = capacity;
+  }
+  log.index[log.indexCount].micros = micros;
+  log.index[log.indexCount].offset = log.size;
+  log.indexCount++;
+
+  writeRecordStart(log, LOG_CHECKPOINT, micros);
+  writeUint64(log.map + log.size, micros);
+  log.size += 8;
+
+  uint64_t interval = (uint64_t)log.indexIntervalMs * 1000;
+  log.nextCheckpointAt = (micros / interval + 1) * interval;
+  return true;
+}
+
+/**
+ * Function to add a record at the end of the log
+ * Times that go backwards, from sources that are merged a little out of order, are taken as the time before
+ * @param micros time since the start of the session
+ * @param values as many as the type has
+ */
+bool appendSessionRecord(SessionLogWriter &log, uint8_t type, uint64_t micros, const int16_t *values) {
+  int count = valueCount(type);
+  if (count < 0 || !log.map || !reserve(log, 2 * MAX_RECORD_SIZE)) {
+    return false;
+  }
+  micros = micros < log.lastMicros ? log.lastMicros : micros;
+
+  if (log.indexCount == 0 || micros >= log.nextCheckpointAt) {
+    if (!appendCheckpoint(log, micros)) {
+      return false;
+    }
+  }
+
+  writeRecordStart(log, type, micros);
+  for (int i = 0; i < count; i++) {
+    writeInt16(log.map + log.size, values[i]);
+    log.size += 2;
+  }
+
+  uint16_t flags = readUint16(log.map + 6);
+  flags |= type == LOG_POSE ? LOG_HAS_POSES : LOG_HAS_TELEMETRY;
+  writeUint16(log.map + 6, flags);
+  return true;
+}
+
+/**
+ * Function to write the index and the trailer and cut the file to its length
+ */
+bool closeSessionLog(SessionLogWriter &log) {
+  bool written = log.map && reserve(log, 1 + log.indexCount * SESSION_LOG_INDEX_ENTRY_SIZE + SESSION_LOG_TRAILER_SIZE);
+  if (written) {
+    // An end record first, so that a reader that doesn't trust the trailer stops before the index
+    log.map[log.size++] = LOG_END;
+    uint64_t indexOffset = log.size;
+    for (size_t i = 0; i < log.indexCount; i++) {
+      writeUint64(log.map + log.size, log.index[i].micros);
+      writeUint64(log.map + log.size + 8, log.index[i].offset);
+      log.size += SESSION_LOG_INDEX_ENTRY_SIZE;
+    }
+    writeUint64(log.map + log.size, indexOffset);
+    writeUint32(log.map + log.size + 8, log.indexCount);
+    memcpy(log.map + log.size + 12, TRAILER_MAGIC, sizeof(TRAILER_MAGIC));
+    log.size += SESSION_LOG_TRAILER_SIZE;
+    munmap(log.map, log.capacity);
+    written = ftruncate(log.file, log.size) == 0;
+  }
+  close(log.file);
+  free(log.index);
+  log.map = nullptr;
+  log.index = nullptr;
+  return written;
+}
+
+/**
+ * Function to read an unsigned varint, without reading past the end of the records
+ * @return false if the records end in the middle of it
+ */
+static bool readVarint(const SessionLogReader &log, size_t &offset, uint32_t &value) {
+  value = 0;
+  for (uint8_t shift = 0; offset < log.end && shift < 35; shift += 7) {
+    uint8_t byte = log.map[offset++];
+    value |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to read the record at an offset
+ * @param micros the time of the record before, replaced by the time of this one
+ * @return false at the end of the records, or at a record that is cut short or not known
+ */
+static bool readRecord(const SessionLogReader &log, size_t &offset, uint64_t &micros, LogRecord &record) {
+  if (offset >= log.end || log.map[offset] == LOG_END) {
+    return false;
+  }
+  size_t at = offset + 1;
+  uint32_t delta;
+  record.type = log.map[offset];
+  if (!readVarint(log, at, delta)) {
+    return false;
+  }
+
+  if (record.type == LOG_CHECKPOINT) {
+    if (at + 8 > log.end) {
+      return false;
+    }
+    record.micros = readUint64(log.map + at);
+    at += 8;
+  } else {
+    int count = valueCount(record.type);
+    if (count < 0 || at + 2 * count > log.end) {
+      return false;
+    }
+    record.micros = micros + delta;
+    for (int i = 0; i < count; i++) {
+      record.values[i] = readInt16(log.map + at + 2 * i);
+    }
+    at += 2 * count;
+  }
+  micros = record.micros;
+  offset = at;
+  return true;
+}
+
+/**
+ * Function to find the checkpoints of a log that was not closed, with one pass over its records
+ */
+static bool rebuildIndex(SessionLogReader &log) {
+  size_t capacity = 256;
+  log.index = (LogIndexEntry *)malloc(capacity * sizeof(LogIndexEntry));
+  log.indexCount = 0;
+  log.end = log.size;
+
+  size_t offset = SESSION_LOG_HEADER_SIZE;
+  uint64_t micros = 0;
+  LogRecord record;
+  for (size_t at = offset; log.index && readRecord(log, offset, micros, record); at = offset) {
+    if (record.type != LOG_CHECKPOINT) {
+      continue;
+    }
+    if (log.indexCount == capacity) {
+      capacity *= 2;
+      LogIndexEntry *index = (LogIndexEntry *)realloc(log.index, capacity * sizeof(LogIndexEntry));
+      if (!index) {
+        return false;
+      }
+      log.index = index;
+    }
+    log.index[log.indexCount].micros = record.micros;
+    log.index[log.indexCount].offset = at;
+    log.indexCount++;
+  }
+  log.end = offset;
+  log.rebuilt = true;
+  return log.index != nullptr;
+}
+
+/**
+ * Function to open a log for reading, positioned at its start
+ */
+bool openSessionReader(SessionLogReader &log, const char *path) {
+  memset(&log, 0, sizeof(log));
+  log.file = open(path, O_RDONLY);
+  struct stat status;
+  if (log.file < 0 || fstat(log.file, &status) != 0 || (size_t)status.st_size < SESSION_LOG_HEADER_SIZE) {
+    return false;
+  }
+  log.size = status.st_size;
+  void *map = mmap(nullptr, log.size, PROT_READ, MAP_SHARED, log.file, 0);
+  if (map == MAP_FAILED) {
+    close(log.file);
+    return false;
+  }
+  log.map = (const uint8_t *)map;
+  if (memcmp(log.map, HEADER_MAGIC, sizeof(HEADER_MAGIC)) != 0 || readUint16(log.map + 4) != SESSION_LOG_VERSION) {
+    closeSessionReader(log);
+    return false;
+  }
+  log.flags = readUint16(log.map + 6);
+
+  // The index of a closed log is at its end
+  const uint8_t *trailer = log.map + log.size - SESSION_LOG_TRAILER_SIZE;
+  bool closed = log.size >= SESSION_LOG_HEADER_SIZE + SESSION_LOG_TRAILER_SIZE &&
+                memcmp(trailer + 12, TRAILER_MAGIC, sizeof(TRAILER_MAGIC)) == 0;
+  uint64_t indexOffset = closed ? readUint64(trailer) : 0;
+  uint32_t count = closed ? readUint32(trailer + 8) : 0;
+  closed = closed && indexOffset + (uint64_t)count * SESSION_LOG_INDEX_ENTRY_SIZE + SESSION_LOG_TRAILER_SIZE == log.size;
+
+  if (closed) {
+    log.index = (LogIndexEntry *)malloc((count > 0 ? count : 1) * sizeof(LogIndexEntry));
+    log.indexCount = count;
+    for (uint32_t i = 0; log.index && i < count; i++) {
+      log.index[i].micros = readUint64(log.map + indexOffset + i * SESSION_LOG_INDEX_ENTRY_SIZE);
+      log.index[i].offset = readUint64(log.map + indexOffset + i * SESSION_LOG_INDEX_ENTRY_SIZE + 8);
+    }
+    log.end = indexOffset;
+  } else if (!rebuildIndex(log)) {
+    closeSessionReader(log);
+    return false;
+  }
+
+  log.offset = SESSION_LOG_HEADER_SIZE;
+  log.micros = 0;
+  return log.index != nullptr;
+}
+
+/**
+ * Function to move to the first record at or after a time
+ * Only the records between the checkpoint before the time and the time itself are read
+ */
+void seekSessionLog(SessionLogReader &log, uint64_t micros) {
+  size_t low = 0;
+  size_t high = log.indexCount;
+  while (low < high) {
+    size_t middle = (low + high) / 2;
+    if (log.index[middle].micros <= micros) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  log.offset = low > 0 ? log.index[low - 1].offset : SESSION_LOG_HEADER_SIZE;
+  log.micros = low > 0 ? log.index[low - 1].micros : 0;
+
+  size_t offset = log.offset;
+  uint64_t time = log.micros;
+  LogRecord record;
+  while (readRecord(log, offset, time, record) && record.micros < micros) {
+    log.offset = offset;
+    log.micros = time;
+  }
+}
+
+/**
+ * Function to read the next pose or telemetry record
+ * @return false at the end of the log
+ */
+bool nextSessionRecord(SessionLogReader &log, LogRecord &record) {
+  while (readRecord(log, log.offset, log.micros, record)) {
+    if (record.type != LOG_CHECKPOINT) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to get the time of the last record, reading on from the last checkpoint
+ */
+uint64_t getSessionDuration(const SessionLogReader &log) {
+  size_t offset = log.indexCount > 0 ? log.index[log.indexCount - 1].offset : SESSION_LOG_HEADER_SIZE;
+  uint64_t micros = log.indexCount > 0 ? log.index[log.indexCount - 1].micros : 0;
+  LogRecord record;
+  while (readRecord(log, offset, micros, record)) {
+  }
+  return micros;
+}
+
+void closeSessionReader(SessionLogReader &log) {
+  if (log.map) {
+    munmap((void *)log.map, log.size);
+  }
+  if (log.file >= 0) {
+    close(log.file);
+  }
+  free(log.index);
+  log.map = nullptr;
+  log.index = nullptr;
+}
@@ -0,0 +1,91 @@
+#ifndef SESSION_LOG_H
+#define SESSION_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Append-only log of a session with the chair: the poses sent to it and the telemetry it sent back
+//
+// The file is written and read through mmap(), so appending a record is a copy into memory and scrubbing through a
+// long session only touches the pages around the place looked at.
+//
+// Layout:
+//   header | records ... | index | trailer
+// header:  "SLOG" | uint16 version | uint16 flags | uint32 index interval in ms | 20 reserved bytes
+// record:  uint8 type | varint microseconds since the record before | payload, its size set by the type
+// index:   per entry uint64 microseconds | uint64 file offset of a checkpoint record
+// trailer: uint64 file offset of the index | uint32 entries | "SIDX"
+// Multi-byte values are little-endian like on the serial port, varints are those of RideScript.h.
+//
+// Every index interval a checkpoint with the absolute time goes in front of the next record, so reading can start
+// at any checkpoint. The index of checkpoints is only written when the log is closed. A log that was never closed,
+// because the program was killed, has no trailer and is zero-filled past the last record. Opening it rebuilds the
+// index with one pass over the records.
+
+#define SESSION_LOG_VERSION 1
+#define SESSION_LOG_HEADER_SIZE 32
+#define SESSION_LOG_TRAILER_SIZE 16
+#define SESSION_LOG_INDEX_ENTRY_SIZE 16
+#define SESSION_LOG_DEFAULT_INDEX_MS 1000
+
+// Record types, 0 marks the end of a log that was not closed
+#define LOG_END 0x00
+#define LOG_POSE 0x01       // int16 pitch, roll, yaw in centidegrees, a pose sent to the chair
+#define LOG_TELEMETRY 0x02  // int16 positions (steps) and speeds (steps/sec) of stepper1..3, see Telemetry.h
+#define LOG_CHECKPOINT 0x03 // uint64 microseconds since the start of the session
+
+// Header flags, set as records are appended
+#define LOG_HAS_POSES 0x01
+#define LOG_HAS_TELEMETRY 0x02
+
+#define LOG_MAX_VALUES 6
+
+// One record as it is read back
+struct LogRecord {
+  uint8_t type;
+  uint64_t micros; // Since the start of the session
+  int16_t values[LOG_MAX_VALUES];
+};
+
+struct LogIndexEntry {
+  uint64_t micros;
+  uint64_t offset;
+};
+
+struct SessionLogWriter {
+  int file;
+  uint8_t *map;
+  size_t capacity;
+  size_t size;
+  uint64_t lastMicros;
+  uint64_t nextCheckpointAt;
+  uint32_t indexIntervalMs;
+  LogIndexEntry *index;
+  size_t indexCount;
+  size_t indexCapacity;
+};
+
+struct SessionLogReader {
+  int file;
+  const uint8_t *map;
+  size_t size;
+  uint16_t flags;
+  size_t end;   // Offset just past the last record
+  LogIndexEntry *index;
+  size_t indexCount;
+  bool rebuilt; // The log was not closed and its index had to be worked out
+  size_t offset;
+  uint64_t micros;
+};
+
+bool openSessionLog(SessionLogWriter &log, const char *path, uint32_t indexIntervalMs);
+bool appendSessionRecord(SessionLogWriter &log, uint8_t type, uint64_t micros, const int16_t *values);
+bool closeSessionLog(SessionLogWriter &log);
+
+bool openSessionReader(SessionLogReader &log, const char *path);
+void seekSessionLog(SessionLogReader &log, uint64_t micros);
+bool nextSessionRecord(SessionLogReader &log, LogRecord &record);
+uint64_t getSessionDuration(const SessionLogReader &log);
+void closeSessionReader(SessionLogReader &log);
+
+#endif
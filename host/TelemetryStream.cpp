@@ -0,0 +1,100 @@
+#include <string.h>
+
+#include "TelemetryStream.h"
+#include "../SerialProtocol.h"
+#include "../RideScript.h"
+
+/**
+ * Function to read an unsigned varint from a payload
+ * @return false if the payload ends in the middle of it
+ */
+static bool readVarint(const uint8_t *payload, uint8_t length, uint8_t &offset, uint32_t &value) {
+  value = 0;
+  for (uint8_t shift = 0; offset < length && shift < 32; shift += 7) {
+    uint8_t byte = payload[offset++];
+    value |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void initTelemetryDecoder(TelemetryDecoder &decoder) {
+  memset(&decoder, 0, sizeof(decoder));
+}
+
+static void takeSample(TelemetryDecoder &decoder, TelemetrySample *samples, uint8_t &count) {
+  TelemetrySample &sample = samples[count++];
+  sample.index = decoder.sample;
+  sample.periodMs = decoder.periodMs;
+  memcpy(sample.values, decoder.values, sizeof(sample.values));
+  decoder.counters.samples++;
+}
+
+/**
+ * Function to decode the samples of one telemetry frame
+ * Delta frames before the first key frame, or after a gap, can't be decoded and are counted as skipped
+ * @param type MSG_TELEMETRY or MSG_TELEMETRY_KEY, any other frame is ignored
+ * @param samples room for at least TELEMETRY_MAX_BATCH samples
+ * @return the number of samples decoded
+ */
+uint8_t decodeTelemetryFrame(TelemetryDecoder &decoder, uint8_t type, const uint8_t *payload, uint8_t length,
+                             TelemetrySample *samples) {
+  uint8_t count = 0;
+  if ((type != MSG_TELEMETRY && type != MSG_TELEMETRY_KEY) || length < 2) {
+    return 0;
+  }
+
+  // Samples missing in front of this frame
+  uint16_t index = readUint16(payload);
+  uint16_t gap = index - decoder.nextIndex;
+  if (decoder.started) {
+    decoder.counters.lost += gap;
+    decoder.sample += gap;
+  }
+  decoder.nextIndex = index;
+
+  if (type == MSG_TELEMETRY_KEY) {
+    if (length != TELEMETRY_KEY_PAYLOAD_SIZE) {
+      return 0;
+    }
+    decoder.counters.keyFrames++;
+    decoder.periodMs = readUint16(payload + 2);
+    for (uint8_t i = 0; i < TELEMETRY_VALUES; i++) {
+      decoder.values[i] = readInt16(payload + 4 + 2 * i);
+    }
+    decoder.started = true;
+    decoder.synced = true;
+    takeSample(decoder, samples, count);
+    decoder.sample++;
+    decoder.nextIndex++;
+    return count;
+  }
+
+  // Changes only make sense on top of the sample right before them
+  decoder.counters.deltaFrames++;
+  decoder.synced = decoder.synced && gap == 0;
+
+  uint8_t offset = 2;
+  while (offset < length && count < TELEMETRY_MAX_BATCH) {
+    uint8_t mask = payload[offset++];
+    for (uint8_t i = 0; i < TELEMETRY_VALUES; i++) {
+      uint32_t change;
+      if ((mask & (1 << i)) && !readVarint(payload, length, offset, change)) {
+        decoder.synced = false;
+      } else if (mask & (1 << i)) {
+        decoder.values[i] += zigzagDecode(change);
+      }
+    }
+
+    if (decoder.synced) {
+      takeSample(decoder, samples, count);
+    } else {
+      decoder.counters.skipped++;
+    }
+    decoder.sample += decoder.started ? 1 : 0;
+    decoder.nextIndex++;
+  }
+  return count;
+}
@@ -0,0 +1,40 @@
+#ifndef TELEMETRY_STREAM_H
+#define TELEMETRY_STREAM_H
+
+#include <stdint.h>
+
+#include "../Telemetry.h"
+
+// Decoder of the telemetry frames of the chair on the host, see Telemetry.h for the frames
+// It is fed one MSG_TELEMETRY or MSG_TELEMETRY_KEY payload at a time and gives back the samples in it
+
+// One decoded sample
+struct TelemetrySample {
+  uint64_t index;    // Counted from the first key frame, without wrapping
+  uint16_t periodMs; // Time between samples
+  int16_t values[TELEMETRY_VALUES]; // Positions (steps) of stepper1..3, then speeds (steps/sec)
+};
+
+struct TelemetryCounters {
+  uint32_t keyFrames;
+  uint32_t deltaFrames;
+  uint32_t samples;
+  uint32_t lost;    // Samples missing from the sample index, dropped by the chair or the link
+  uint32_t skipped; // Samples that arrived but could not be decoded
+};
+
+struct TelemetryDecoder {
+  int16_t values[TELEMETRY_VALUES];
+  bool started;       // A key frame has been seen
+  bool synced;        // values hold the sample right before the next one
+  uint16_t periodMs;
+  uint16_t nextIndex; // Index the next sample should have
+  uint64_t sample;    // Index of the next sample counted from the first key frame
+  TelemetryCounters counters;
+};
+
+void initTelemetryDecoder(TelemetryDecoder &decoder);
+uint8_t decodeTelemetryFrame(TelemetryDecoder &decoder, uint8_t type, const uint8_t *payload, uint8_t length,
+                             TelemetrySample *samples);
+
+#endif
@@ -0,0 +1,519 @@
+#include <algorithm>
+#include <cmath>
+
+#include "TrackCompiler.h"
+#include "../AxisConfig.h"
+#include "../Effects.h"
+#include "../Kinematics.h"
+#include "../SCurve.h"
+#include "../StepTrack.h"
+
+#define TICKS_PER_SECOND 16000000.0
+
+// The positions are looked at every 50 us, no motor steps that fast
+#define SAMPLE_TICKS 800
+
+// How far past the middle between two steps a motor has to be before it steps
+#define STEP_HYSTERESIS 0.1
+
+static const int32_t MIN_POSITION[3] = { Stepper1Axis::MIN_POSITION, Stepper2Axis::MIN_POSITION, Stepper3Axis::MIN_POSITION };
+static const int32_t MAX_POSITION[3] = { Stepper1Axis::MAX_POSITION, Stepper2Axis::MAX_POSITION, Stepper3Axis::MAX_POSITION };
+static const uint32_t MAX_JERK[3] = { Stepper1Axis::MAX_JERK, Stepper2Axis::MAX_JERK, Stepper3Axis::MAX_JERK };
+
+// One move of all motors, planned like the sketch would play it
+struct PlannedMove {
+  int64_t start;    // Ticks from the start of the ride
+  int64_t duration; // Ticks
+  int32_t from[3];
+  int32_t to[3];
+  bool curve;
+  double speed[3];        // Trapezoid in steps/sec
+  double acceleration[3]; // Trapezoid in steps/sec^2
+  std::vector<int32_t> slices[3]; // S-curve: steps made by the end of each slice
+  uint8_t effect;         // EffectPreset started with the move
+};
+
+enum TrackEventType : uint8_t {
+  EVENT_MOVE_END,
+  EVENT_STEP_UP,
+  EVENT_STEP_DOWN,
+  EVENT_PAUSE // Only in commands
+};
+
+struct TrackEvent {
+  int64_t time;
+  uint8_t type;
+};
+
+// One command before it is encoded, pauses and steps may still be longer than a queue entry
+struct PlannedCommand {
+  uint8_t type;   // TrackEventType
+  uint8_t steps;
+  int64_t ticks;
+};
+
+/**
+ * Function to work out how far a trapezoid move has got
+ * @param distance steps
+ * @param speed steps/sec
+ * @param acceleration steps/sec^2
+ * @param seconds time since the start of the move
+ */
+static double trapezoidPosition(double distance, double speed, double acceleration, double seconds) {
+  double rampTime = speed / acceleration;
+  double cruiseTime = 0;
+  if (distance < speed * rampTime) {
+    rampTime = sqrt(distance / acceleration);
+    speed = acceleration * rampTime;
+  } else {
+    cruiseTime = (distance - speed * rampTime) / speed;
+  }
+  double total = 2 * rampTime + cruiseTime;
+
+  if (seconds <= 0) {
+    return 0;
+  } else if (seconds < rampTime) {
+    return acceleration * seconds * seconds / 2;
+  } else if (seconds < rampTime + cruiseTime) {
+    return acceleration * rampTime * rampTime / 2 + speed * (seconds - rampTime);
+  } else if (seconds < total) {
+    double left = total - seconds;
+    return distance - acceleration * left * left / 2;
+  }
+  return distance;
+}
+
+static double trapezoidDuration(double distance, double speed, double acceleration) {
+  if (distance <= 0) {
+    return 0;
+  }
+  double rampTime = speed / acceleration;
+  if (distance < speed * rampTime) {
+    return 2 * sqrt(distance / acceleration);
+  }
+  return 2 * rampTime + (distance - speed * rampTime) / speed;
+}
+
+/**
+ * Function to plan the S-curve of a move the same way startCurves() in MotionScheduler.cpp does
+ * The motor with the longest way to go sets the plan, at the jerk that keeps every motor within its own limit
+ */
+static SCurvePlan planCurve(const int32_t *from, const int32_t *to, uint32_t speed, uint32_t acceleration) {
+  uint32_t longest = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    longest = std::max(longest, (uint32_t)abs(to[i] - from[i]));
+  }
+
+  uint32_t jerk = 0xFFFFFFFF;
+  for (uint8_t i = 0; i < 3; i++) {
+    uint32_t distance = abs(to[i] - from[i]);
+    if (distance > 0) {
+      jerk = std::min(jerk, (uint32_t)std::min((uint64_t)MAX_JERK[i] * longest / distance, (uint64_t)0xFFFFFFFF));
+    }
+  }
+  return planSCurve(longest, speed, acceleration, jerk);
+}
+
+/**
+ * Function to work out how long the move to a keyframe takes, see TrackCompiler.h
+ */
+int64_t planMoveTicks(const int32_t *from, const int32_t *to, const RideKeyframe &keyframe) {
+  uint32_t speed = PitchAxis::fromFullSteps(keyframe.speed);
+  uint32_t acceleration = PitchAxis::fromFullSteps(keyframe.acceleration);
+
+  double seconds = 0;
+  if (keyframe.curve) {
+    seconds = getSCurveSlices(planCurve(from, to, speed, acceleration)) * (SCURVE_SLICE_MICROS / 1000000.0);
+  } else {
+    MotorProfiles profiles = synchronizeMotion(from, to, speed, acceleration);
+    for (uint8_t i = 0; i < 3; i++) {
+      seconds = std::max(seconds, trapezoidDuration(abs(to[i] - from[i]), profiles.speedInMilliHz[i] / 1000.0, profiles.acceleration[i]));
+    }
+  }
+  return (int64_t)ceil(seconds * TICKS_PER_SECOND);
+}
+
+/**
+ * Function to plan the moves of a ride, one per keyframe
+ * A move starts at the time of its keyframe, or when the move before it has arrived if that is later
+ */
+static std::vector<PlannedMove> planMoves(const std::vector<RideKeyframe> &keyframes) {
+  std::vector<PlannedMove> moves;
+  int32_t current[3] = { 0, 0, 0 };
+  int64_t arrival = 0;
+
+  for (const RideKeyframe &keyframe : keyframes) {
+    PlannedMove move;
+    move.start = std::max((int64_t)keyframe.timeMs * (int64_t)(TICKS_PER_SECOND / 1000), arrival);
+    move.curve = keyframe.curve;
+    move.effect = keyframe.effect;
+
+    MotorTargets targets = mixPose(keyframe.pitch, keyframe.roll, keyframe.yaw);
+    uint32_t speed = PitchAxis::fromFullSteps(keyframe.speed);
+    uint32_t acceleration = PitchAxis::fromFullSteps(keyframe.acceleration);
+    for (uint8_t i = 0; i < 3; i++) {
+      move.from[i] = current[i];
+      move.to[i] = targets.position[i];
+    }
+
+    if (move.curve) {
+      SCurvePlan plan = planCurve(move.from, move.to, speed, acceleration);
+      uint32_t slices = getSCurveSlices(plan);
+      for (uint8_t i = 0; i < 3; i++) {
+        SCurveGenerator generator;
+        SCurveCommand command;
+        startSCurve(generator, plan, move.to[i] - move.from[i]);
+        int32_t made = 0;
+        while (nextSCurveCommand(generator, command)) {
+          made += command.steps;
+          if (move.slices[i].size() < slices) {
+            move.slices[i].push_back(made);
+          } else {
+            move.slices[i].back() = made;
+          }
+        }
+      }
+    } else {
+      MotorProfiles profiles = synchronizeMotion(move.from, move.to, speed, acceleration);
+      for (uint8_t i = 0; i < 3; i++) {
+        move.speed[i] = profiles.speedInMilliHz[i] / 1000.0;
+        move.acceleration[i] = profiles.acceleration[i];
+      }
+    }
+
+    move.duration = planMoveTicks(move.from, move.to, keyframe);
+    arrival = move.start + move.duration;
+    for (uint8_t i = 0; i < 3; i++) {
+      current[i] = move.to[i];
+    }
+    moves.push_back(move);
+  }
+  return moves;
+}
+
+/**
+ * Function to work out where the moves alone put a motor at a time
+ * @param moves the moves of the ride
+ * @param index the motor, 0 is stepper1
+ * @param ticks time from the start of the ride
+ */
+static double basePosition(const std::vector<PlannedMove> &moves, uint8_t index, int64_t ticks) {
+  // The last move that started by then
+  auto after = std::upper_bound(moves.begin(), moves.end(), ticks, [](int64_t time, const PlannedMove &move) {
+    return time < move.start;
+  });
+  if (after == moves.begin()) {
+    return 0;
+  }
+  const PlannedMove &move = *(after - 1);
+  int32_t distance = move.to[index] - move.from[index];
+  if (ticks >= move.start + move.duration || distance == 0) {
+    return move.to[index];
+  }
+
+  double seconds = (ticks - move.start) / TICKS_PER_SECOND;
+  double made;
+  if (move.curve) {
+    // The steps of a slice are spread evenly over it
+    const std::vector<int32_t> &slices = move.slices[index];
+    double slice = seconds * (1000000.0 / SCURVE_SLICE_MICROS);
+    size_t whole = (size_t)slice;
+    if (whole >= slices.size()) {
+      return move.to[index];
+    }
+    double before = whole == 0 ? 0 : slices[whole - 1];
+    made = before + (slices[whole] - before) * (slice - whole);
+  } else {
+    made = trapezoidPosition(abs(distance), move.speed[index], move.acceleration[index], seconds);
+  }
+  return move.from[index] + (distance < 0 ? -made : made);
+}
+
+/**
+ * Function to convert the offset of the running effects into steps of each motor, mixed like mixPose()
+ */
+static void effectSteps(uint32_t atMicros, double *steps) {
+  Pose offset = getEffectOffset(atMicros);
+  double pitch = offset.pitch * (double)PitchAxis::STEPS_PER_REVOLUTION / 36000;
+  double roll = offset.roll * (double)RollAxis::STEPS_PER_REVOLUTION / 36000;
+  steps[0] = pitch + roll;
+  steps[1] = pitch - roll;
+  steps[2] = offset.yaw * (double)YawAxis::STEPS_PER_REVOLUTION / 36000;
+}
+
+/**
+ * Function to work out where a motor is at a time, the moves plus the effects, inside its limits
+ */
+static double motorPosition(const std::vector<PlannedMove> &moves, uint8_t index, int64_t ticks) {
+  double effects[3];
+  effectSteps((uint32_t)(ticks / (int64_t)(TICKS_PER_SECOND / 1000000)), effects);
+  double position = basePosition(moves, index, ticks) + effects[index];
+  return std::min(std::max(position, (double)MIN_POSITION[index]), (double)MAX_POSITION[index]);
+}
+
+/**
+ * Function to find when a motor crosses a position, to the tick
+ * @param low a time before the crossing
+ * @param high a time at or after it
+ * @param upward true if the motor crosses going up
+ */
+static int64_t findCrossing(const std::vector<PlannedMove> &moves, uint8_t index, int64_t low, int64_t high, double level, bool upward) {
+  while (high - low > 1) {
+    int64_t middle = low + (high - low) / 2;
+    double position = motorPosition(moves, index, middle);
+    if (upward ? position >= level : position <= level) {
+      high = middle;
+    } else {
+      low = middle;
+    }
+  }
+  return high;
+}
+
+/**
+ * Function to run the ride and collect the steps of every motor, with the move ends in between
+ * The effects are started as the run gets to their moves, they only know the time they are asked about
+ */
+static void collectEvents(const std::vector<PlannedMove> &moves, std::vector<TrackEvent> *events, TrackStats &stats) {
+  int64_t end = moves.back().start + moves.back().duration;
+  int32_t position[3] = { 0, 0, 0 };
+  int64_t lastStep[3] = { INT64_MIN / 2, INT64_MIN / 2, INT64_MIN / 2 };
+  size_t nextMove = 0;
+  stopEffects(EFFECT_ALL_SLOTS);
+
+  for (int64_t time = 0, previous = 0; previous < end; previous = time, time = std::min(time + SAMPLE_TICKS, end)) {
+    // Move ends and effects that fall into this sample
+    while (nextMove < moves.size() && moves[nextMove].start <= time) {
+      const PlannedMove &move = moves[nextMove++];
+      if (move.effect != RIDE_NO_EFFECT) {
+        startEffect(getEffectPreset(move.effect), (uint32_t)(move.start / (int64_t)(TICKS_PER_SECOND / 1000000)));
+      }
+    }
+
+    for (uint8_t i = 0; i < 3; i++) {
+      double now = motorPosition(moves, i, time);
+      int64_t from = previous;
+
+      while (now >= position[i] + 0.5 + STEP_HYSTERESIS || now <= position[i] - 0.5 - STEP_HYSTERESIS) {
+        bool upward = now > position[i];
+        double level = upward ? position[i] + 0.5 + STEP_HYSTERESIS : position[i] - 0.5 - STEP_HYSTERESIS;
+        int64_t at = findCrossing(moves, i, from, time, level, upward);
+
+        // The queue can't take steps closer together than the fastest step rate
+        if (at < lastStep[i] + TRACK_MIN_STEP_TICKS) {
+          at = lastStep[i] + TRACK_MIN_STEP_TICKS;
+          stats.retimedSteps++;
+        }
+        events[i].push_back({ at, (uint8_t)(upward ? EVENT_STEP_UP : EVENT_STEP_DOWN) });
+        position[i] += upward ? 1 : -1;
+        lastStep[i] = at;
+        from = std::min(at, time);
+      }
+    }
+  }
+
+  // Every motor gets the move ends, in front of any step at the same time
+  for (uint8_t i = 0; i < 3; i++) {
+    for (const PlannedMove &move : moves) {
+      events[i].push_back({ move.start + move.duration, EVENT_MOVE_END });
+    }
+    std::stable_sort(events[i].begin(), events[i].end(), [](const TrackEvent &a, const TrackEvent &b) {
+      return a.time < b.time || (a.time == b.time && a.type == EVENT_MOVE_END && b.type != EVENT_MOVE_END);
+    });
+  }
+}
+
+/**
+ * Function to turn the steps and move ends of one motor into commands
+ * A step lasts until the event after it. A pause too short for the queue is added to the command before it,
+ * which only moves the end of a move a little, never a step.
+ */
+static std::vector<PlannedCommand> planCommands(const std::vector<TrackEvent> &events) {
+  std::vector<PlannedCommand> commands;
+  int64_t cursor = 0;
+  bool stepOpen = false;
+  int64_t stepAt = 0;
+
+  for (const TrackEvent &event : events) {
+    int64_t time = event.time;
+    if (stepOpen) {
+      int64_t ticks = std::max(time - stepAt, (int64_t)TRACK_MIN_STEP_TICKS);
+      commands.back().ticks = ticks;
+      cursor = stepAt + ticks;
+      stepOpen = false;
+    }
+    time = std::max(time, cursor);
+
+    int64_t gap = time - cursor;
+    if (gap >= TRACK_MIN_PAUSE_TICKS) {
+      commands.push_back({ EVENT_PAUSE, 0, gap });
+    } else if (gap > 0) {
+      auto last = std::find_if(commands.rbegin(), commands.rend(), [](const PlannedCommand &command) {
+        return command.type != EVENT_MOVE_END;
+      });
+      if (last != commands.rend()) {
+        last -> ticks += gap;
+      } else {
+        commands.push_back({ EVENT_PAUSE, 0, TRACK_MIN_PAUSE_TICKS });
+        time = cursor + TRACK_MIN_PAUSE_TICKS;
+      }
+    }
+    cursor = time;
+
+    if (event.type == EVENT_MOVE_END) {
+      commands.push_back({ EVENT_MOVE_END, 0, 0 });
+    } else {
+      commands.push_back({ event.type, 1, 0 });
+      stepOpen = true;
+      stepAt = time;
+    }
+  }
+  if (stepOpen) {
+    commands.back().ticks = TRACK_MIN_STEP_TICKS;
+  }
+
+  // Steps of the same length in the same direction share a command
+  // A step longer than a wait entry is played as the step and a pause after it (takeWait() in StepTrack.cpp), which
+  // only works for a single step, so those steps keep a command each
+  std::vector<PlannedCommand> merged;
+  for (const PlannedCommand &command : commands) {
+    PlannedCommand *last = merged.empty() ? nullptr : &merged.back();
+    if (last && command.steps > 0 && last -> type == command.type && last -> ticks == command.ticks &&
+        last -> steps < TRACK_MAX_STEPS && command.ticks <= TRACK_MAX_WAIT_TICKS) {
+      last -> steps++;
+    } else {
+      merged.push_back(command);
+    }
+  }
+  return merged;
+}
+
+static void appendVarint(std::vector<uint8_t> &track, uint32_t value) {
+  uint8_t buffer[5];
+  uint8_t length = writeVarint(buffer, value);
+  track.insert(track.end(), buffer, buffer + length);
+}
+
+/**
+ * Function to encode the commands of one motor, see StepTrack.h
+ */
+static std::vector<uint8_t> encodeCommands(const std::vector<PlannedCommand> &commands) {
+  std::vector<uint8_t> encoded;
+  int64_t lastTicks = 0;
+
+  for (const PlannedCommand &command : commands) {
+    if (command.type == EVENT_MOVE_END) {
+      encoded.push_back(TRACK_MOVE_END);
+      continue;
+    }
+    if (command.type == EVENT_PAUSE) {
+      encoded.push_back(TRACK_PAUSE);
+      appendVarint(encoded, command.ticks);
+      continue;
+    }
+
+    // Only single steps have waits longer than a queue entry, the reader splits them
+    encoded.push_back(command.steps | (command.type == EVENT_STEP_UP ? TRACK_COUNT_UP : 0));
+    appendVarint(encoded, zigzagEncode((int32_t)(command.ticks - lastTicks)));
+    lastTicks = command.ticks;
+  }
+  return encoded;
+}
+
+/**
+ * Function to play a compiled track with the reader of the sketch and check it against the plan
+ */
+static bool verifyTrack(const std::vector<uint8_t> &track, const std::vector<PlannedCommand> *commands, TrackStats &stats, std::string &error) {
+  TrackReader readers[3];
+  if (!openStepTrack(readers, track.data())) {
+    error = "the step track header does not decode";
+    return false;
+  }
+
+  for (uint8_t i = 0; i < 3; i++) {
+    int32_t expectedPosition = 0;
+    uint64_t expectedTicks = 0;
+    uint16_t expectedMoves = 0;
+    for (const PlannedCommand &command : commands[i]) {
+      if (command.type == EVENT_MOVE_END) {
+        expectedMoves++;
+      } else {
+        expectedPosition += command.type == EVENT_STEP_UP ? command.steps : -(int32_t)command.steps;
+        expectedTicks += command.steps > 0 ? command.ticks * command.steps : command.ticks;
+      }
+    }
+
+    int32_t position = 0;
+    uint64_t ticks = 0;
+    TrackCommand command;
+    while (nextTrackCommand(readers[i], command)) {
+      if (command.steps > 0 ? command.ticks < TRACK_MIN_STEP_TICKS : command.ticks < TRACK_MIN_PAUSE_TICKS) {
+        error = "stepper" + std::to_string(i + 1) + " has a command the queue doesn't take";
+        return false;
+      }
+      position += command.countUp ? command.steps : -(int32_t)command.steps;
+      if (position < MIN_POSITION[i] || position > MAX_POSITION[i]) {
+        error = "stepper" + std::to_string(i + 1) + " leaves its limits";
+        return false;
+      }
+      ticks += command.steps > 0 ? (uint32_t)command.ticks * command.steps : command.ticks;
+      stats.commands[i]++;
+      stats.steps[i] += command.steps;
+    }
+
+    if (position != expectedPosition || readers[i].movesEnded != expectedMoves || readers[i].offset != readers[i].end) {
+      error = "the step track of stepper" + std::to_string(i + 1) + " does not decode to its commands";
+      return false;
+    }
+    if (ticks != expectedTicks) {
+      error = "the step track of stepper" + std::to_string(i + 1) + " does not decode to the same times";
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Function to compile a ride into a step track
+ * @param keyframes the keyframes of the ride, as they were read from its CSV
+ * @param track set to the step track
+ * @param stats set to what went into the track
+ * @param error set to what went wrong when false is returned
+ */
+bool compileStepTrack(const std::vector<RideKeyframe> &keyframes, std::vector<uint8_t> &track, TrackStats &stats, std::string &error) {
+  stats = TrackStats();
+  std::vector<PlannedMove> moves = planMoves(keyframes);
+  stats.moves = moves.size();
+  stats.durationMs = (moves.back().start + moves.back().duration) / (int64_t)(TICKS_PER_SECOND / 1000);
+
+  std::vector<TrackEvent> events[3];
+  collectEvents(moves, events, stats);
+
+  std::vector<PlannedCommand> commands[3];
+  std::vector<uint8_t> encoded[3];
+  for (uint8_t i = 0; i < 3; i++) {
+    commands[i] = planCommands(events[i]);
+    encoded[i] = encodeCommands(commands[i]);
+  }
+
+  track.clear();
+  track.push_back(TRACK_MAGIC_0);
+  track.push_back(TRACK_MAGIC_1);
+  track.push_back(TRACK_VERSION);
+  track.push_back(MICROSTEPS & 0xFF);
+  track.push_back(MICROSTEPS >> 8);
+  for (uint8_t i = 0; i < 3; i++) {
+    track.push_back(encoded[i].size() & 0xFF);
+    track.push_back(encoded[i].size() >> 8);
+  }
+  for (uint8_t i = 0; i < 3; i++) {
+    track.insert(track.end(), encoded[i].begin(), encoded[i].end());
+  }
+
+  // The readers of the sketch keep their offsets in 16 bits
+  if (track.size() > 65535) {
+    error = "the step track is larger than 64 KB";
+    return false;
+  }
+  return verifyTrack(track, commands, stats, error);
+}
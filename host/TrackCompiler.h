@@ -0,0 +1,34 @@
+#ifndef TRACK_COMPILER_H
+#define TRACK_COMPILER_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "../RideScript.h"
+
+// Works a ride out into the step commands of a step track, see StepTrack.h
+//
+// The moves are planned the way the sketch plays a ride script: a move starts at the time of its keyframe or as
+// soon as the move before it has arrived, trapezoid moves are scaled with synchronizeMotion() so that the motors
+// arrive together, and S-curve moves are cut into slices by the S-curve generator of the sketch. The effects of
+// Effects.cpp are added on top. A step is placed where the position of its motor crosses the middle between two
+// steps, with a tenth of a step of hysteresis so that a motor resting on the middle doesn't chatter, and the time
+// of the crossing is found to the tick of the step timer.
+
+struct TrackStats {
+  uint32_t steps[3];
+  uint32_t commands[3];  // Queue entries, after long pauses are split
+  uint32_t durationMs;
+  uint16_t moves;
+  uint32_t retimedSteps; // Steps that had to wait to stay under the fastest step rate
+};
+
+bool compileStepTrack(const std::vector<RideKeyframe> &keyframes, std::vector<uint8_t> &track, TrackStats &stats, std::string &error);
+
+// How long the move from the motor positions before a keyframe to its pose takes, planned like compileStepTrack()
+// plans it, in ticks of the step timer. Only the timing is worked out, without the steps or the effects, so it is
+// cheap and can be called from several threads at once.
+int64_t planMoveTicks(const int32_t *from, const int32_t *to, const RideKeyframe &keyframe);
+
+#endif
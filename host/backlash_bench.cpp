@@ -0,0 +1,354 @@
+// Runs the presets of the sketch on motors with play in their gears and measures how well the chair follows
+//
+//   make -C host backlash_bench
+//   host/backlash_bench [--backlash B1,B2,B3] [--seed N]
+//
+// Every preset is run three times, each in a freshly started sketch that homes first:
+//   reference      gears without play, what the preset should look like
+//   uncompensated  gears with the given play, the scheduler is told there is none
+//   compensated    gears with the given play, the scheduler uses what homing measured
+// Before a preset starts, the chair is brought to 0 from below so that every run starts with its gears driven up.
+//
+// It reports, over all three motors:
+//   rms_error      root mean square difference between where the output of the gears is and where it is in the
+//                  reference, in steps, both counted from where they were when the preset started
+//   peak_error     largest such difference in steps
+//   duration_ms    from scheduling the preset until the queue is empty and every motor has stopped
+//
+// The exit status is 1 when homing measured a backlash other than the play of the gears, when compensating doesn't
+// bring the error of a preset down, or when a run doesn't finish.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Arduino.h"
+#include "FastAccelStepper.h"
+#include "Simulator.h"
+#include "MotionScheduler.h"
+#include "AxisConfig.h"
+#include "Homing.h"
+#include "Backlash.h"
+#include "CommandShell.h"
+
+// Sketch functions the presets are started through, from MotionSimulationChair.cpp
+void setup();
+void moveMotor(AxisId axis, int16_t position, uint32_t speed, uint32_t acceleration);
+void performRollerCoasterSimulation();
+void rumble(int numberOfRumbles);
+void suddenTwist();
+
+// Virtual time of one pass, like the default of chair_sim
+#define PASS_MICROS 100
+
+// No preset takes this long, anything that does is stuck
+#define PRESET_TIMEOUT_MICROS 300000000ULL
+
+#define MOTORS 3
+
+// Step pins of stepper1, stepper2 and stepper3
+static const uint8_t STEP_PINS[MOTORS] = { 6, 7, 8 };
+
+enum RunKind {
+  RUN_REFERENCE,
+  RUN_UNCOMPENSATED,
+  RUN_COMPENSATED,
+  RUN_KINDS
+};
+
+static const char *const RUN_NAMES[RUN_KINDS] = { "reference", "uncompensated", "compensated" };
+
+struct Preset {
+  const char *name;
+  void (*start)();
+};
+
+// What a run sends back from its child process
+struct RunHeader {
+  bool finished;
+  uint8_t measured[MOTORS]; // Backlash homing measured
+  uint64_t passes;
+};
+
+struct Run {
+  RunHeader header;
+  std::vector<int32_t> outputs; // Output of every motor on every pass, counted from the start of the preset
+};
+
+static void singleAxis(AxisId axis, int16_t centidegrees) {
+  moveMotor(axis, centidegrees, PitchAxis::fromFullSteps(1000), PitchAxis::fromFullSteps(1000));
+}
+
+static void singlePitch() {
+  singleAxis(AXIS_PITCH, PitchAxis::LIMIT_CENTIDEGREES / 2);
+}
+
+static void singleRoll() {
+  singleAxis(AXIS_ROLL, RollAxis::LIMIT_CENTIDEGREES / 2);
+}
+
+static void singleYaw() {
+  singleAxis(AXIS_YAW, YawAxis::LIMIT_CENTIDEGREES / 2);
+}
+
+static void rumbleTwoSeconds() {
+  rumble(40);
+}
+
+// Swings of each axis, the roller coaster and the two effects, where the motors turn around the most
+static const Preset PRESETS[] = {
+  { "single_pitch", singlePitch },
+  { "single_roll", singleRoll },
+  { "single_yaw", singleYaw },
+  { "roller_coaster", performRollerCoasterSimulation },
+  { "rumble", rumbleTwoSeconds },
+  { "sudden_twist", suddenTwist },
+};
+
+static void usage(const char *program) {
+  fprintf(stderr, "usage: %s [--backlash B1,B2,B3] [--seed N]\n", program);
+  exit(EXIT_FAILURE);
+}
+
+static bool anyStepperRunning() {
+  for (uint8_t i = 0; i < getStepperCount(); i++) {
+    if (getStepper(i) -> isRunning()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to let the scheduler and the steppers run until everything has stopped
+ * @return false if that did not happen within PRESET_TIMEOUT_MICROS
+ */
+static bool runUntilStill() {
+  uint64_t endAt = getSimulationMicros() + PRESET_TIMEOUT_MICROS;
+
+  while (getSimulationMicros() < endAt) {
+    updateScheduler();
+    if (isSchedulerIdle() && !anyStepperRunning()) {
+      return true;
+    }
+    advanceSimulation(PASS_MICROS);
+  }
+  return false;
+}
+
+static bool writeAll(int fd, const void *data, size_t size) {
+  const char *bytes = (const char *)data;
+  while (size > 0) {
+    ssize_t written = write(fd, bytes, size);
+    if (written <= 0) {
+      return false;
+    }
+    bytes += written;
+    size -= written;
+  }
+  return true;
+}
+
+static bool readAll(int fd, void *data, size_t size) {
+  char *bytes = (char *)data;
+  while (size > 0) {
+    ssize_t read_ = read(fd, bytes, size);
+    if (read_ <= 0) {
+      return false;
+    }
+    bytes += read_;
+    size -= read_;
+  }
+  return true;
+}
+
+/**
+ * Function to start the sketch on gears with play, run one preset and record the outputs
+ * Runs in a child process, the sketch can only be set up once
+ * @param fd where the header and the outputs are written
+ */
+static void runChild(const Preset &preset, RunKind kind, const int32_t *backlash, unsigned long seed, int fd) {
+  for (uint8_t i = 0; i < MOTORS; i++) {
+    setGearBacklash(STEP_PINS[i], kind == RUN_REFERENCE ? 0 : backlash[i]);
+  }
+
+  // The EEPROM starts out erased, so setup() homes against the switches first
+  setSerialOutput(fopen("/dev/null", "w"));
+  addHomeSwitch(STEPPER1_HOME_PIN, 6, homeSwitchPosition<Stepper1Axis>());
+  addHomeSwitch(STEPPER2_HOME_PIN, 7, homeSwitchPosition<Stepper2Axis>());
+  addHomeSwitch(STEPPER3_HOME_PIN, 8, homeSwitchPosition<Stepper3Axis>());
+  setup();
+  runUntilStill();
+
+  RunHeader header;
+  for (uint8_t i = 0; i < MOTORS; i++) {
+    header.measured[i] = getBacklash(i);
+  }
+  if (kind == RUN_UNCOMPENSATED) {
+    const uint8_t none[MOTORS] = { 0, 0, 0 };
+    initBacklash(none, 0);
+  }
+
+  // From below, so the gears are driven up when the preset starts
+  scheduleMoveTo(ALL_STEPPERS_MASK, Stepper1Axis::MIN_POSITION / 2, Stepper2Axis::MIN_POSITION / 2,
+                 Stepper3Axis::MIN_POSITION / 2, ALL_STEPPERS_MASK, 0);
+  scheduleMoveTo(ALL_STEPPERS_MASK, 0, 0, 0, ALL_STEPPERS_MASK, 0);
+  header.finished = runUntilStill();
+
+  int32_t start[MOTORS];
+  for (uint8_t i = 0; i < MOTORS; i++) {
+    start[i] = getStepper(i) -> getOutputPosition();
+  }
+
+  std::vector<int32_t> outputs;
+  randomSeed(seed);
+  preset.start();
+
+  uint64_t endAt = getSimulationMicros() + PRESET_TIMEOUT_MICROS;
+  bool finished = false;
+  while (getSimulationMicros() < endAt) {
+    updateScheduler();
+    for (uint8_t i = 0; i < MOTORS; i++) {
+      outputs.push_back(getStepper(i) -> getOutputPosition() - start[i]);
+    }
+    if (isSchedulerIdle() && !anyStepperRunning()) {
+      finished = true;
+      break;
+    }
+    advanceSimulation(PASS_MICROS);
+  }
+
+  header.finished = header.finished && finished;
+  header.passes = outputs.size() / MOTORS;
+  bool sent = writeAll(fd, &header, sizeof(header)) && writeAll(fd, outputs.data(), outputs.size() * sizeof(int32_t));
+  _exit(sent ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * Function to run one preset in a child process and collect what it recorded
+ * The pipe is read while the child runs, the outputs of a long preset don't fit in its buffer
+ * @return false if the child could not be started or died before sending everything
+ */
+static bool runPreset(const Preset &preset, RunKind kind, const int32_t *backlash, unsigned long seed, Run &run) {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    perror("pipe");
+    return false;
+  }
+  fflush(stdout);
+  pid_t child = fork();
+  if (child < 0) {
+    perror("fork");
+    return false;
+  }
+  if (child == 0) {
+    close(fds[0]);
+    runChild(preset, kind, backlash, seed, fds[1]);
+  }
+  close(fds[1]);
+
+  bool received = readAll(fds[0], &run.header, sizeof(run.header));
+  if (received) {
+    run.outputs.resize(run.header.passes * MOTORS);
+    received = readAll(fds[0], run.outputs.data(), run.outputs.size() * sizeof(int32_t));
+  }
+  close(fds[0]);
+
+  int status;
+  waitpid(child, &status, 0);
+  return received && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+}
+
+/**
+ * Function to compare the outputs of a run against the reference, pass by pass
+ * A run that ends earlier or later than the reference is compared against where it came to rest
+ */
+static void measureError(const Run &run, const Run &reference, double &rms, double &peak) {
+  uint64_t passes = run.header.passes > reference.header.passes ? run.header.passes : reference.header.passes;
+  double sumSquares = 0;
+  peak = 0;
+  for (uint64_t pass = 0; pass < passes; pass++) {
+    uint64_t at = pass < run.header.passes ? pass : run.header.passes - 1;
+    uint64_t referenceAt = pass < reference.header.passes ? pass : reference.header.passes - 1;
+    for (uint8_t i = 0; i < MOTORS; i++) {
+      double error = run.outputs[at * MOTORS + i] - reference.outputs[referenceAt * MOTORS + i];
+      sumSquares += error * error;
+      peak = fmax(peak, fabs(error));
+    }
+  }
+  rms = passes > 0 ? sqrt(sumSquares / (passes * MOTORS)) : 0;
+}
+
+int main(int argc, char **argv) {
+  int32_t backlash[MOTORS] = { 6, 6, 6 };
+  unsigned long seed = 1;
+
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--backlash") == 0) {
+      char *end = (char *)value;
+      for (uint8_t motor = 0; motor < MOTORS; motor++) {
+        backlash[motor] = strtol(end, &end, 10);
+        if (backlash[motor] < 0 || backlash[motor] > BACKLASH_MAX_STEPS) {
+          fprintf(stderr, "The backlash has to be from 0 to %d steps\n", BACKLASH_MAX_STEPS);
+          return EXIT_FAILURE;
+        }
+        if (*end == ',') {
+          end++;
+        }
+      }
+    } else if (strcmp(option, "--seed") == 0) {
+      seed = strtoul(value, nullptr, 10);
+    } else {
+      usage(argv[0]);
+    }
+    i++;
+  }
+
+  int failures = 0;
+  printf("Play in the gears: %d, %d, %d steps\n", backlash[0], backlash[1], backlash[2]);
+  printf("%-16s %-14s %9s %10s %11s\n", "preset", "run", "rms_error", "peak_error", "duration_ms");
+  for (const Preset &preset : PRESETS) {
+    Run runs[RUN_KINDS];
+    for (uint8_t kind = 0; kind < RUN_KINDS; kind++) {
+      if (!runPreset(preset, (RunKind)kind, backlash, seed, runs[kind]) || !runs[kind].header.finished ||
+          runs[kind].header.passes == 0) {
+        printf("STUCK %s did not finish the %s run\n", preset.name, RUN_NAMES[kind]);
+        return EXIT_FAILURE;
+      }
+    }
+
+    for (uint8_t i = 0; i < MOTORS; i++) {
+      if (runs[RUN_COMPENSATED].header.measured[i] != backlash[i]) {
+        printf("MISMEASURED %s: homing measured %u steps of backlash on motor %u, the gears have %d\n", preset.name,
+               runs[RUN_COMPENSATED].header.measured[i], i + 1, backlash[i]);
+        failures++;
+      }
+    }
+
+    double rms[RUN_KINDS];
+    double peak[RUN_KINDS];
+    for (uint8_t kind = 0; kind < RUN_KINDS; kind++) {
+      measureError(runs[kind], runs[RUN_REFERENCE], rms[kind], peak[kind]);
+      printf("%-16s %-14s %9.2f %10.0f %11.1f\n", kind == 0 ? preset.name : "", RUN_NAMES[kind], rms[kind], peak[kind],
+             (runs[kind].header.passes - 1) * PASS_MICROS / 1000.0);
+    }
+
+    if (rms[RUN_UNCOMPENSATED] > 0 && rms[RUN_COMPENSATED] >= rms[RUN_UNCOMPENSATED]) {
+      printf("WORSE %s: compensating leaves an rms error of %.2f steps, %.2f without\n", preset.name,
+             rms[RUN_COMPENSATED], rms[RUN_UNCOMPENSATED]);
+      failures++;
+    }
+  }
+
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
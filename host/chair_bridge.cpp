@@ -0,0 +1,723 @@
+// Drives the chair from a game: vehicle telemetry in over UDP, poses out over the serial port
+//
+//   make -C host chair_bridge
+//   host/chair_bridge --serial /dev/ttyACM0
+//
+// The game (or an adapter next to it) sends one UDP datagram per vehicle update to 127.0.0.1:--port, holding the
+// 10 bytes of a MSG_VEHICLE_STATE payload (see MotionCueing.h), optionally followed by the uint64 CLOCK_MONOTONIC
+// time in microseconds it was sent at, little-endian. The bridge puts the chair into streaming, turns the vehicle
+// states into poses with the washout of MotionCueing.cpp and sends them as MSG_POSE frames.
+//
+// Three threads make a pipeline, joined by single-producer single-consumer queues that don't lock:
+//   ingest    receives the datagrams and timestamps them
+//   cueing    runs the washout at its fixed rate on the newest vehicle state
+//   transmit  writes the newest pose to the serial port
+// A stage that falls behind never works through a backlog: the next stage only takes the newest entry and drops
+// the ones before it, and a full queue drops what is pushed into it. A late pose is worth less than none.
+// When the bridge stops, each stage's latency histogram is printed: ingest from the send time to the queue, cueing
+// from receiving the vehicle state to its pose being queued, transmit from then until the frame is written, and
+// the whole way from receiving to written.
+//
+// With --record the session is written to a session log (see SessionLog.h) by a fourth thread: the poses as they are
+// written, and the telemetry the chair sends back, which the bridge turns on for that. The other threads hand their
+// records over through queues of their own, so recording never holds up the pipeline.
+//
+// The poses are predicted ahead to hide the latency on the way to the seat (see PosePredictor.h), by the chair or by
+// the cueing thread. Either way the transmit thread pings the chair every PROBE_INTERVAL_MS and the lead is tuned from
+// the round trip, see LatencyProbe.h. host/predictor_bench.cpp measures what that buys.
+//
+// To try it against the simulator instead of the chair, with a stand-in game on the same host:
+//
+//   host/chair_sim --pty --max-seconds 30 &        # prints the pty to use
+//   host/chair_bridge --serial /dev/pts/N --produce --seconds 20
+//
+// Options:
+//   --serial PATH      serial port of the chair (required)
+//   --port N           UDP port to listen on (4123)
+//   --seconds S        stop after S seconds, otherwise run until interrupted
+//   --produce          also run a stand-in game that sends a drive at CUEING_RATE_HZ
+//   --echo             copy the text the chair prints to stderr
+//   --record FILE      write the session to a session log
+//   --predict MODE     where poses are predicted: chair, bridge or off (chair)
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <thread>
+#include <algorithm>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../SerialProtocol.h"
+#include "../MotionCueing.h"
+#include "../AxisConfig.h"
+#include "../PosePredictor.h"
+#include "LatencyProbe.h"
+#include "SerialPort.h"
+#include "SessionLog.h"
+#include "TelemetryStream.h"
+
+#define DEFAULT_UDP_PORT 4123
+
+// Vehicle state payload plus the optional send time
+#define DATAGRAM_SIZE (VEHICLE_STATE_PAYLOAD_SIZE + 8)
+
+// Entries per queue, a power of two. Only the newest entry is ever used, the rest is room for bursts
+#define QUEUE_SIZE 16
+
+// The cueing updates are pulled in until they come this long after the vehicle states arrive, by at most
+// PHASE_STEP_MICROS per update
+#define PHASE_MARGIN_MICROS 200
+#define PHASE_STEP_MICROS 250
+
+// Records waiting for the recorder, it takes them every RECORD_POLL_MS
+#define RECORD_QUEUE_SIZE 1024
+#define RECORD_POLL_MS 10
+
+// Telemetry while recording: a sample every 10 ms, 4 to a frame
+#define RECORD_TELEMETRY_PERIOD_MS 10
+#define RECORD_TELEMETRY_BATCH 4
+
+// The chair is sent a new link latency when it changed by more than this
+#define RETUNE_MICROS 250
+
+// How long an idle stage sleeps before it looks at its queue again
+#define POLL_MICROS 100
+
+// Latency buckets are powers of two microseconds, the last one takes everything from 2^(BUCKETS - 1) us up
+#define LATENCY_BUCKETS 20
+
+enum PredictMode { PREDICT_OFF, PREDICT_CHAIR, PREDICT_BRIDGE };
+
+static std::atomic<bool> running(true);
+// The recorder runs until the threads that feed it have stopped
+static std::atomic<bool> recorderRunning(true);
+
+static uint64_t monotonicMicros() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/**
+ * Lock-free queue between one producing and one consuming thread
+ * Each index is only written by its own side, the other side reads it with acquire ordering so that the entry it
+ * points past is complete
+ */
+template <class T, size_t Size>
+class SpscQueue {
+  static_assert((Size & (Size - 1)) == 0, "The size must be a power of two");
+
+public:
+  SpscQueue() : head(0), tail(0) {}
+
+  /**
+   * Function to add an entry
+   * @return false if the queue is full and the entry was dropped
+   */
+  bool push(const T &entry) {
+    size_t at = tail.load(std::memory_order_relaxed);
+    if (at - head.load(std::memory_order_acquire) >= Size) {
+      return false;
+    }
+    entries[at & (Size - 1)] = entry;
+    tail.store(at + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Function to take the oldest entry
+   * @return false if the queue was empty
+   */
+  bool pop(T &entry) {
+    size_t first = head.load(std::memory_order_relaxed);
+    if (first == tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    entry = entries[first & (Size - 1)];
+    head.store(first + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Function to take the newest entry, dropping every one before it
+   * @param dropped incremented by the number of entries dropped
+   * @return false if the queue was empty
+   */
+  bool popNewest(T &entry, uint32_t &dropped) {
+    size_t last = tail.load(std::memory_order_acquire);
+    size_t first = head.load(std::memory_order_relaxed);
+    if (first == last) {
+      return false;
+    }
+    entry = entries[(last - 1) & (Size - 1)];
+    dropped += last - 1 - first;
+    head.store(last, std::memory_order_release);
+    return true;
+  }
+
+private:
+  T entries[Size];
+  // On their own cache lines, so the two threads don't keep taking the line from each other
+  alignas(64) std::atomic<size_t> head;
+  alignas(64) std::atomic<size_t> tail;
+};
+
+/**
+ * Histogram of latencies, filled by one stage and read by the main thread
+ */
+struct LatencyHistogram {
+  std::atomic<uint32_t> buckets[LATENCY_BUCKETS];
+  std::atomic<uint64_t> longest;
+
+  LatencyHistogram() : longest(0) {
+    for (size_t i = 0; i < LATENCY_BUCKETS; i++) {
+      buckets[i] = 0;
+    }
+  }
+
+  void add(uint64_t micros) {
+    size_t bucket = 0;
+    while (bucket + 1 < LATENCY_BUCKETS && micros >= (2ULL << bucket)) {
+      bucket++;
+    }
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    if (micros > longest.load(std::memory_order_relaxed)) {
+      longest.store(micros, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Function to get the upper end of the bucket a share of the samples falls in
+   * @param share between 0 and 1, e.g. 0.99 for the 99th percentile
+   */
+  uint64_t percentile(double share) const {
+    uint64_t total = 0;
+    for (size_t i = 0; i < LATENCY_BUCKETS; i++) {
+      total += buckets[i].load(std::memory_order_relaxed);
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < LATENCY_BUCKETS; i++) {
+      seen += buckets[i].load(std::memory_order_relaxed);
+      if (total > 0 && seen >= ceil(share * total)) {
+        return 2ULL << i;
+      }
+    }
+    return 0;
+  }
+};
+
+struct VehicleSample {
+  VehicleState vehicle;
+  uint64_t receivedAt;
+};
+
+struct PoseSample {
+  Pose pose;
+  uint64_t receivedAt;
+  uint64_t queuedAt;
+};
+
+// A pose or telemetry sample on its way to the session log
+struct SessionRecord {
+  uint8_t type;
+  uint64_t micros; // Since the bridge started
+  int16_t values[LOG_MAX_VALUES];
+};
+
+static SpscQueue<VehicleSample, QUEUE_SIZE> vehicleQueue;
+static SpscQueue<PoseSample, QUEUE_SIZE> poseQueue;
+
+// Filled by the transmit and reader threads while recording
+static bool recording = false;
+static uint64_t sessionStartedAt = 0;
+static SpscQueue<SessionRecord, RECORD_QUEUE_SIZE> sentPoses;
+static SpscQueue<SessionRecord, RECORD_QUEUE_SIZE> receivedTelemetry;
+
+// Measured by the reader thread from the pongs of the chair
+static PredictMode predictMode = PREDICT_CHAIR;
+static std::atomic<uint32_t> linkLatency(0);
+static std::atomic<uint32_t> bufferLatency(0);
+static std::atomic<uint32_t> roundTrips(0);
+
+static LatencyHistogram ingestLatency;
+static LatencyHistogram cueingLatency;
+static LatencyHistogram transmitLatency;
+static LatencyHistogram totalLatency;
+
+// Each counter is only written by one stage
+static uint32_t datagramsReceived = 0;
+static uint32_t datagramsMalformed = 0;
+static uint32_t vehicleQueueFull = 0;
+static uint32_t staleVehicleStates = 0;
+static uint32_t cueingUpdates = 0;
+static uint32_t poseQueueFull = 0;
+static uint32_t stalePoses = 0;
+static uint32_t framesWritten = 0;
+static uint32_t recordsDropped = 0;
+static uint32_t recordsWritten = 0;
+
+static void stop(int) {
+  running = false;
+}
+
+static void usage(const char *program) {
+  fprintf(stderr, "usage: %s --serial PATH [--port N] [--seconds S] [--produce] [--echo] [--record FILE] [--predict MODE]\n", program);
+  exit(EXIT_FAILURE);
+}
+
+static int openSocket(uint16_t port) {
+  int udp = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (udp < 0 || bind(udp, (sockaddr *)&address, sizeof(address)) != 0) {
+    perror("bind");
+    return -1;
+  }
+  // Wake up now and then to notice when the bridge stops
+  timeval timeout = { 0, 100000 };
+  setsockopt(udp, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  return udp;
+}
+
+/**
+ * Function to receive vehicle states until the bridge stops
+ */
+static void ingest(int udp) {
+  uint8_t datagram[DATAGRAM_SIZE + 1];
+  while (running) {
+    ssize_t size = recv(udp, datagram, sizeof(datagram), 0);
+    if (size < 0) {
+      continue;
+    }
+    uint64_t now = monotonicMicros();
+    datagramsReceived++;
+    if (size != VEHICLE_STATE_PAYLOAD_SIZE && size != DATAGRAM_SIZE) {
+      datagramsMalformed++;
+      continue;
+    }
+
+    VehicleSample sample = { decodeVehicleState(datagram), now };
+    if (!vehicleQueue.push(sample)) {
+      vehicleQueueFull++;
+      continue;
+    }
+    if (size == DATAGRAM_SIZE) {
+      uint64_t sentAt = readUint32(datagram + VEHICLE_STATE_PAYLOAD_SIZE) |
+                        (uint64_t)readUint32(datagram + VEHICLE_STATE_PAYLOAD_SIZE + 4) << 32;
+      ingestLatency.add(now > sentAt ? now - sentAt : 0);
+    }
+  }
+}
+
+/**
+ * Function to run the washout at its fixed rate, holding the newest vehicle state between updates
+ * The filters need the fixed rate, but a vehicle state that waits for the next update is up to a whole period
+ * old by then. While a game sends at the same rate, the updates are pulled in a little at a time until they come
+ * just after the vehicle states arrive.
+ * Nothing is sent before the first vehicle state arrives, and the chair stays level until then
+ */
+static void cue() {
+  MotionCueing cueing;
+  initMotionCueing(cueing, PitchAxis::LIMIT_CENTIDEGREES, RollAxis::LIMIT_CENTIDEGREES, YawAxis::LIMIT_CENTIDEGREES);
+  PosePredictor predictor;
+  initPosePredictor(predictor, PitchAxis::LIMIT_CENTIDEGREES, RollAxis::LIMIT_CENTIDEGREES, YawAxis::LIMIT_CENTIDEGREES);
+
+  VehicleSample latest;
+  bool started = false;
+  bool wasFresh = false;
+  auto period = std::chrono::microseconds(1000000 / CUEING_RATE_HZ);
+  auto nextUpdateAt = std::chrono::steady_clock::now();
+
+  while (running) {
+    nextUpdateAt += period;
+    std::this_thread::sleep_until(nextUpdateAt);
+
+    bool fresh = vehicleQueue.popNewest(latest, staleVehicleStates);
+    started = started || fresh;
+    if (!started) {
+      continue;
+    }
+
+    PoseSample sample;
+    sample.pose = updateMotionCueing(cueing, latest.vehicle);
+    if (predictMode == PREDICT_BRIDGE) {
+      setPredictorLead(predictor, tunePredictorLead(linkLatency, bufferLatency));
+      sample.pose = predictPose(predictor, sample.pose);
+    }
+    sample.receivedAt = latest.receivedAt;
+    sample.queuedAt = monotonicMicros();
+    cueingUpdates++;
+
+    // Only when every update finds a new vehicle state, a game sending slower would pull the updates ever earlier
+    uint64_t age = sample.queuedAt - sample.receivedAt;
+    if (fresh && wasFresh && age > PHASE_MARGIN_MICROS) {
+      uint64_t shift = (age - PHASE_MARGIN_MICROS) / 4;
+      nextUpdateAt -= std::chrono::microseconds(shift < PHASE_STEP_MICROS ? shift : PHASE_STEP_MICROS);
+    }
+    wasFresh = fresh;
+
+    if (!poseQueue.push(sample)) {
+      poseQueueFull++;
+      continue;
+    }
+    // A held vehicle state is as old as it is, but its latency was already counted
+    if (fresh) {
+      cueingLatency.add(age);
+    }
+  }
+}
+
+static bool writePredictorConfig(int port, uint8_t sequence, bool on, uint32_t linkMicros) {
+  uint8_t payload[PREDICTOR_CONFIG_PAYLOAD_SIZE];
+  payload[0] = on ? 1 : 0;
+  writeUint32(payload + 1, linkMicros);
+  return writeSerialFrame(port, MSG_PREDICTOR_CONFIG, sequence, payload, PREDICTOR_CONFIG_PAYLOAD_SIZE);
+}
+
+/**
+ * Function to write the newest pose to the chair whenever there is one
+ * This is the only thread that writes to the chair while the bridge runs, so the pings and the link latency for
+ * the predictor of the chair go out from here as well
+ */
+static void transmit(int port) {
+  uint8_t sequence = 0;
+  uint64_t lastReceivedAt = 0;
+  uint64_t nextPingAt = 0;
+  uint32_t linkSent = 0;
+  PoseSample sample;
+
+  while (running) {
+    uint64_t now = monotonicMicros();
+    if (now >= nextPingAt) {
+      uint8_t payload[PING_PAYLOAD_SIZE];
+      encodePing(payload, now);
+      writeSerialFrame(port, MSG_PING, sequence++, payload, PING_PAYLOAD_SIZE);
+      nextPingAt = now + PROBE_INTERVAL_MS * 1000ULL;
+    }
+    uint32_t link = linkLatency;
+    if (predictMode == PREDICT_CHAIR && (link > linkSent + RETUNE_MICROS || link + RETUNE_MICROS < linkSent)) {
+      writePredictorConfig(port, sequence++, true, link);
+      linkSent = link;
+    }
+
+    if (!poseQueue.popNewest(sample, stalePoses)) {
+      std::this_thread::sleep_for(std::chrono::microseconds(POLL_MICROS));
+      continue;
+    }
+
+    uint8_t payload[POSE_PAYLOAD_SIZE];
+    encodePose(payload, sample.pose);
+    if (!writeSerialFrame(port, MSG_POSE, sequence++, payload, POSE_PAYLOAD_SIZE)) {
+      perror("write");
+      running = false;
+      break;
+    }
+    now = monotonicMicros();
+    framesWritten++;
+    if (recording) {
+      SessionRecord record = { LOG_POSE, now - sessionStartedAt, { sample.pose.pitch, sample.pose.roll, sample.pose.yaw } };
+      if (!sentPoses.push(record)) {
+        recordsDropped++;
+      }
+    }
+    transmitLatency.add(now - sample.queuedAt);
+    if (sample.receivedAt != lastReceivedAt) {
+      totalLatency.add(now - sample.receivedAt);
+      lastReceivedAt = sample.receivedAt;
+    }
+  }
+}
+
+/**
+ * Function to drain what the chair prints, so that its output never backs up
+ * The pongs in it measure the link for the predictor. While recording, the telemetry frames in it are decoded for the
+ * session log. The chair numbers its samples, so
+ * they are timed from the arrival of the first one and the sample period rather than by when their frame came in.
+ */
+static void readChair(int port, bool echo) {
+  FrameParser parser;
+  initFrameParser(parser);
+  TelemetryDecoder decoder;
+  initTelemetryDecoder(decoder);
+  TelemetrySample samples[TELEMETRY_MAX_BATCH];
+  LatencyProbe probe;
+  initLatencyProbe(probe);
+  bool anchored = false;
+  uint64_t firstSampleAt = 0;
+
+  uint8_t buffer[256];
+  while (running) {
+    ssize_t size = read(port, buffer, sizeof(buffer));
+    for (ssize_t i = 0; i < size; i++) {
+      uint8_t c = buffer[i];
+      if (isParsingFrame(parser) || c == FRAME_SYNC) {
+        if (!parseFrameByte(parser, c)) {
+          continue;
+        }
+        if (parser.type == MSG_PONG && takePong(probe, parser.payload, parser.length, monotonicMicros())) {
+          linkLatency = getLinkLatency(probe);
+          bufferLatency = probe.bufferMicros;
+          roundTrips++;
+        }
+        if (!recording) {
+          continue;
+        }
+        uint8_t count = decodeTelemetryFrame(decoder, parser.type, parser.payload, parser.length, samples);
+        for (uint8_t j = 0; j < count; j++) {
+          uint64_t offset = samples[j].index * samples[j].periodMs * 1000ULL;
+          if (!anchored) {
+            firstSampleAt = monotonicMicros() - sessionStartedAt - offset;
+            anchored = true;
+          }
+          SessionRecord record = { LOG_TELEMETRY, firstSampleAt + offset, { 0 } };
+          for (uint8_t k = 0; k < TELEMETRY_VALUES; k++) {
+            record.values[k] = samples[j].values[k];
+          }
+          if (!receivedTelemetry.push(record)) {
+            recordsDropped++;
+          }
+        }
+      } else if (echo && (c == '\n' || c == '\r' || (c >= 0x20 && c < 0x7F))) {
+        // Replies in frames are binary, only the text is worth showing
+        fputc(c, stderr);
+      }
+    }
+  }
+}
+
+/**
+ * Function to write what the other threads recorded to the session log, in order of time
+ * Each queue is in order on its own, the two are merged a batch at a time
+ */
+static void record(SessionLogWriter *log) {
+  std::vector<SessionRecord> batch;
+  bool last = false;
+  while (!last) {
+    // One more pass after the others have stopped, for what they queued just before
+    last = !recorderRunning;
+    std::this_thread::sleep_for(std::chrono::milliseconds(RECORD_POLL_MS));
+
+    SessionRecord entry;
+    while (sentPoses.pop(entry)) {
+      batch.push_back(entry);
+    }
+    while (receivedTelemetry.pop(entry)) {
+      batch.push_back(entry);
+    }
+    std::stable_sort(batch.begin(), batch.end(), [](const SessionRecord &a, const SessionRecord &b) { return a.micros < b.micros; });
+    for (const SessionRecord &each : batch) {
+      recordsWritten += appendSessionRecord(*log, each.type, each.micros, each.values) ? 1 : 0;
+    }
+    batch.clear();
+  }
+}
+
+/**
+ * Function to stand in for a game: a drive with a launch, a slalom and braking, sent at the rate of the washout
+ */
+static void produce(uint16_t port) {
+  int udp = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  auto period = std::chrono::microseconds(1000000 / CUEING_RATE_HZ);
+  auto nextSendAt = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; running; i++) {
+    double t = fmod((double)i / CUEING_RATE_HZ, 20.0);
+    VehicleState vehicle = { 0, 0, 0, 0, 0 };
+    if (t < 4) {
+      vehicle.surge = 400;
+    } else if (t < 16) {
+      vehicle.sway = (int16_t)(300 * sin(2 * M_PI * 0.5 * t));
+      vehicle.yawRate = (int16_t)(3000 * sin(2 * M_PI * 0.5 * t));
+      vehicle.rollRate = (int16_t)(800 * cos(2 * M_PI * 0.5 * t));
+    } else {
+      vehicle.surge = -800;
+    }
+
+    uint8_t datagram[DATAGRAM_SIZE];
+    encodeVehicleState(datagram, vehicle);
+    uint64_t now = monotonicMicros();
+    writeUint32(datagram + VEHICLE_STATE_PAYLOAD_SIZE, (uint32_t)now);
+    writeUint32(datagram + VEHICLE_STATE_PAYLOAD_SIZE + 4, (uint32_t)(now >> 32));
+    sendto(udp, datagram, sizeof(datagram), 0, (sockaddr *)&address, sizeof(address));
+
+    nextSendAt += period;
+    std::this_thread::sleep_until(nextSendAt);
+  }
+  close(udp);
+}
+
+static void printHistogram(const char *stage, const LatencyHistogram &histogram) {
+  printf("  %-9s %8llu %8llu %8llu   ", stage, (unsigned long long)histogram.percentile(0.5),
+         (unsigned long long)histogram.percentile(0.99), (unsigned long long)histogram.longest.load());
+  for (size_t i = 0; i < LATENCY_BUCKETS; i++) {
+    uint32_t count = histogram.buckets[i].load();
+    if (count > 0) {
+      printf(" <%lluus:%u", 2ULL << i, count);
+    }
+  }
+  printf("\n");
+}
+
+static void printReport(double seconds) {
+  printf("Bridged for %.1f s\n", seconds);
+  printf("  %u datagrams received, %u malformed, %u dropped on a full queue\n", datagramsReceived, datagramsMalformed,
+         vehicleQueueFull);
+  printf("  %u cueing updates, %u stale vehicle states skipped, %u dropped on a full queue\n", cueingUpdates,
+         staleVehicleStates, poseQueueFull);
+  printf("  %u pose frames written, %u stale poses skipped\n", framesWritten, stalePoses);
+  if (recording) {
+    printf("  %u records written to the session log, %u dropped on a full queue\n", recordsWritten, recordsDropped);
+  }
+  static const char *const MODES[] = { "off", "chair", "bridge" };
+  printf("  Prediction %s, %u round trips: link %u us, jitter buffer %u us, lead %u us\n", MODES[predictMode],
+         roundTrips.load(), linkLatency.load(), bufferLatency.load(),
+         predictMode == PREDICT_OFF ? 0 : tunePredictorLead(linkLatency, bufferLatency));
+  printf("\nLatency (us, percentiles are the upper end of their bucket):\n");
+  printf("  %-9s %8s %8s %8s   %s\n", "stage", "p50", "p99", "max", "buckets");
+  printHistogram("ingest", ingestLatency);
+  printHistogram("cueing", cueingLatency);
+  printHistogram("transmit", transmitLatency);
+  printHistogram("total", totalLatency);
+}
+
+int main(int argc, char **argv) {
+  const char *serialPath = nullptr;
+  uint16_t udpPort = DEFAULT_UDP_PORT;
+  double seconds = 0;
+  bool producing = false;
+  bool echo = false;
+  const char *recordPath = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+    if (strcmp(option, "--produce") == 0) {
+      producing = true;
+    } else if (strcmp(option, "--echo") == 0) {
+      echo = true;
+    } else if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--serial") == 0) {
+      serialPath = value;
+      i++;
+    } else if (strcmp(option, "--port") == 0) {
+      udpPort = (uint16_t)atoi(value);
+      i++;
+    } else if (strcmp(option, "--seconds") == 0) {
+      seconds = atof(value);
+      i++;
+    } else if (strcmp(option, "--record") == 0) {
+      recordPath = value;
+      i++;
+    } else if (strcmp(option, "--predict") == 0) {
+      if (strcmp(value, "off") == 0) {
+        predictMode = PREDICT_OFF;
+      } else if (strcmp(value, "chair") == 0) {
+        predictMode = PREDICT_CHAIR;
+      } else if (strcmp(value, "bridge") == 0) {
+        predictMode = PREDICT_BRIDGE;
+      } else {
+        usage(argv[0]);
+      }
+      i++;
+    } else {
+      usage(argv[0]);
+    }
+  }
+  if (!serialPath) {
+    usage(argv[0]);
+  }
+
+  int port = openSerialPort(serialPath);
+  int udp = openSocket(udpPort);
+  if (port < 0 || udp < 0) {
+    return EXIT_FAILURE;
+  }
+  SessionLogWriter log;
+  if (recordPath && !openSessionLog(log, recordPath, SESSION_LOG_DEFAULT_INDEX_MS)) {
+    perror(recordPath);
+    return EXIT_FAILURE;
+  }
+  recording = recordPath != nullptr;
+  sessionStartedAt = monotonicMicros();
+  signal(SIGINT, stop);
+  signal(SIGTERM, stop);
+
+  // STREAM puts the chair into streaming
+  // Until the first round trip, the chair predicts by the lag of its jitter buffer and motors alone
+  writeSerialText(port, "STREAM");
+  writePredictorConfig(port, 0, predictMode == PREDICT_CHAIR, 0);
+  if (recording) {
+    uint8_t payload[TELEMETRY_CONFIG_PAYLOAD_SIZE];
+    writeUint16(payload, RECORD_TELEMETRY_PERIOD_MS);
+    payload[2] = RECORD_TELEMETRY_BATCH;
+    writeSerialFrame(port, MSG_TELEMETRY_CONFIG, 0, payload, TELEMETRY_CONFIG_PAYLOAD_SIZE);
+  }
+
+  auto startedAt = std::chrono::steady_clock::now();
+  std::thread reader(readChair, port, echo);
+  std::thread transmitter(transmit, port);
+  std::thread cueing(cue);
+  std::thread receiver(ingest, udp);
+  std::thread recorder;
+  if (recording) {
+    recorder = std::thread(record, &log);
+  }
+  std::thread producer;
+  if (producing) {
+    producer = std::thread(produce, udpPort);
+  }
+
+  while (running && (seconds <= 0 || std::chrono::steady_clock::now() - startedAt < std::chrono::duration<double>(seconds))) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  running = false;
+
+  if (producer.joinable()) {
+    producer.join();
+  }
+  receiver.join();
+  cueing.join();
+  transmitter.join();
+
+  // The chair brakes to a stop where it is, which also ends the stream, and waits for commands again without
+  // predicting for whatever comes next
+  writeSerialControl(port, CONTROL_STOP);
+  writePredictorConfig(port, 0, false, 0);
+  if (recording) {
+    uint8_t payload[TELEMETRY_CONFIG_PAYLOAD_SIZE] = { 0, 0, 0 };
+    writeSerialFrame(port, MSG_TELEMETRY_CONFIG, 0, payload, TELEMETRY_CONFIG_PAYLOAD_SIZE);
+  }
+  reader.join();
+  recorderRunning = false;
+  if (recorder.joinable()) {
+    recorder.join();
+    if (!closeSessionLog(log)) {
+      perror(recordPath);
+    }
+  }
+
+  printReport(std::chrono::duration<double>(std::chrono::steady_clock::now() - startedAt).count());
+  close(udp);
+  close(port);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,634 @@
+// Plays one ride on several chairs in lockstep and measures how far apart they are
+//
+//   make -C host chair_sync
+//   host/chair_sync --serial /dev/ttyACM0 --serial /dev/ttyACM1 --ride 1
+//   host/chair_sync --sim -200 --sim 0 --sim 300 --ride 3
+//
+// The host keeps the shared timeline, microseconds since it started. Every SYNC_INTERVAL_MS it sends each chair a
+// MSG_SYNC with the timeline at the moment of writing plus the latency of that link, half the fastest round trip of
+// MSG_PING (see ClockSync.h). After --warmup-s it sends every chair a MSG_RIDE_AT for the same start, --lead-ms ahead
+// on the timeline. With --no-sync no syncs are sent and RIDE is typed into every chair at once instead, so each chair
+// plays on its own clock, which is what the chairs did before.
+//
+// The chairs send telemetry with one sample per frame. The samples are timed by when they arrive at the host, as
+// the sample index of a chair runs on its own clock. The skew of a chair is the shift of its motor positions against
+// those of the first chair that lines them up best, found in every window of SKEW_WINDOW_MS in which the first chair
+// moves. For every chair it reports the drift its clock sync measured, the skew in the first and the last window, the
+// mean skew and the largest.
+//
+// With --pause the last chair is sent CONTROL_PAUSE the given seconds into the ride and CONTROL_RESUME the given
+// milliseconds later. A synced ride skips what that chair missed, so its skew in the last window shows whether it
+// got back onto the timeline of the others.
+//
+// With --sim the chairs are simulators on pseudo-terminals, started from chair_sim next to this program with
+// --clock-ppm, so they drift apart like the crystals of real chairs do.
+//
+// Options:
+//   --serial PATH      serial port of a chair, can be repeated
+//   --sim PPM          start a simulated chair whose crystal runs PPM parts per million fast, can be repeated
+//   --ride N           ride from the library, counted from 1 (1)
+//   --warmup-s S       how long the chairs are synced before the ride starts (15)
+//   --lead-ms MS       how far ahead on the timeline the ride starts (1000)
+//   --no-sync          start the ride by typing RIDE into every chair instead
+//   --pause S:MS       pause the last chair S seconds into the ride for MS milliseconds
+//   --csv FILE         write the telemetry of every chair on the host clock
+//   --echo             copy the text the chairs print to stderr
+
+#include <algorithm>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../SerialProtocol.h"
+#include "../ClockSync.h"
+#include "LatencyProbe.h"
+#include "SerialPort.h"
+#include "TelemetryStream.h"
+
+// Telemetry of every chair: a sample every 10 ms, one to a frame so it is timed when it arrives
+#define TELEMETRY_PERIOD_MS 10
+
+// Skew is measured over windows this long, each on its own
+#define SKEW_WINDOW_MS 5000
+
+// Largest skew looked for, either way
+#define SKEW_SEARCH_MS 100
+
+// A window counts once the motors of the first chair move this many steps in it, added up
+#define SKEW_MIN_TRAVEL 50
+
+// Longest ride waited for
+#define RIDE_TIMEOUT_S 600
+
+// How long the chairs get to answer the first ping, a simulator homes first
+#define ANSWER_TIMEOUT_S 10
+
+#define MOTORS 3
+
+struct Sample {
+  double atMs; // On the host clock
+  int32_t position[MOTORS];
+};
+
+struct Chair {
+  std::string path;
+  int port;
+  pid_t simulator;          // 0 for a real chair
+  FILE *simulatorOutput;
+  FrameParser parser;
+  LatencyProbe probe;
+  TelemetryDecoder decoder;
+  std::string line;         // Text printed so far on the current line
+  bool answered;            // A ping has come back, syncs are sent from then on
+  bool complete;            // The ride is complete
+  bool refused;             // The chair did not start the ride
+  std::vector<Sample> samples;
+  bool syncStatsReceived;
+  uint16_t syncs;
+  uint8_t fixes;
+  int32_t driftPpb;
+  int32_t lastCorrection;
+};
+
+// Skew of one chair against the first one
+struct Skew {
+  std::vector<double> windows; // ms, positive when the chair is late
+};
+
+static volatile sig_atomic_t running = 1;
+static bool echo = false;
+static uint64_t epoch = 0;
+
+static void stop(int) {
+  running = 0;
+}
+
+static void usage(const char *program) {
+  fprintf(stderr, "usage: %s [--serial PATH]... [--sim PPM]... [--ride N] [--warmup-s S] [--lead-ms MS] [--no-sync] [--pause S:MS] "
+                  "[--csv FILE] [--echo]\n", program);
+  exit(EXIT_FAILURE);
+}
+
+static uint64_t monotonicMicros() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+/**
+ * Function to get the shared timeline, microseconds since the host started
+ */
+static uint32_t timelineMicros() {
+  return (uint32_t)(monotonicMicros() - epoch);
+}
+
+static void initChair(Chair &chair, const std::string &path) {
+  chair.path = path;
+  chair.port = -1;
+  chair.simulator = 0;
+  chair.simulatorOutput = nullptr;
+  initFrameParser(chair.parser);
+  initLatencyProbe(chair.probe);
+  initTelemetryDecoder(chair.decoder);
+  chair.answered = false;
+  chair.complete = false;
+  chair.refused = false;
+  chair.syncStatsReceived = false;
+  chair.syncs = 0;
+  chair.fixes = 0;
+  chair.driftPpb = 0;
+  chair.lastCorrection = 0;
+}
+
+/**
+ * Function to start a simulated chair on a pseudo-terminal and wait for it to print its path
+ * @param chair set to the chair
+ * @param simulatorPath chair_sim
+ * @param ppm how fast its crystal runs
+ * @return false if it did not come up
+ */
+static bool startSimulator(Chair &chair, const std::string &simulatorPath, const char *ppm) {
+  int output[2];
+  if (pipe(output) != 0) {
+    perror("pipe");
+    return false;
+  }
+  pid_t pid = fork();
+  if (pid == 0) {
+    dup2(output[1], STDERR_FILENO);
+    close(output[0]);
+    close(output[1]);
+    execl(simulatorPath.c_str(), simulatorPath.c_str(), "--pty", "--clock-ppm", ppm, "--max-seconds", "3600", (char *)nullptr);
+    perror(simulatorPath.c_str());
+    _exit(EXIT_FAILURE);
+  }
+  close(output[1]);
+
+  initChair(chair, "");
+  chair.simulator = pid;
+  chair.simulatorOutput = fdopen(output[0], "r");
+  char text[256];
+  const char *prefix = "Serial port on ";
+  while (fgets(text, sizeof(text), chair.simulatorOutput)) {
+    if (strncmp(text, prefix, strlen(prefix)) == 0) {
+      chair.path = std::string(text + strlen(prefix));
+      chair.path.erase(chair.path.find_last_not_of("\r\n") + 1);
+      fprintf(stderr, "Simulated chair at %s ppm on %s\n", ppm, chair.path.c_str());
+      return true;
+    }
+  }
+  fprintf(stderr, "%s did not start\n", simulatorPath.c_str());
+  return false;
+}
+
+static void sendFrame(Chair &chair, uint8_t type, const uint8_t *payload, uint8_t length) {
+  writeSerialFrame(chair.port, type, 0, payload, length);
+}
+
+/**
+ * Function to send a sync, stamped as late as possible
+ * The frame reaches the chair a link latency later, so that is added to the timeline. It is half the fastest round
+ * trip rather than the median: a round trip also waits for the chair to get around to answering, which changes
+ * with what it is doing and would show up as drift.
+ */
+static void sendSync(Chair &chair) {
+  uint8_t payload[SYNC_PAYLOAD_SIZE];
+  writeUint32(payload, timelineMicros() + chair.probe.fastest / 2);
+  sendFrame(chair, MSG_SYNC, payload, SYNC_PAYLOAD_SIZE);
+}
+
+static void sendPing(Chair &chair) {
+  uint8_t payload[PING_PAYLOAD_SIZE];
+  encodePing(payload, monotonicMicros());
+  sendFrame(chair, MSG_PING, payload, PING_PAYLOAD_SIZE);
+}
+
+static void sendTelemetryConfig(Chair &chair, uint16_t periodMs) {
+  uint8_t payload[TELEMETRY_CONFIG_PAYLOAD_SIZE];
+  writeUint16(payload, periodMs);
+  payload[2] = 1;
+  sendFrame(chair, MSG_TELEMETRY_CONFIG, payload, TELEMETRY_CONFIG_PAYLOAD_SIZE);
+}
+
+/**
+ * Function to act on a line the chair printed
+ */
+static void takeLine(Chair &chair) {
+  if (echo) {
+    fprintf(stderr, "%s: %s\n", chair.path.c_str(), chair.line.c_str());
+  }
+  if (chair.line.find("Ride complete!") != std::string::npos) {
+    chair.complete = true;
+  } else if (chair.line.find("not synced") != std::string::npos || chair.line.find("There is no ride") != std::string::npos ||
+             chair.line.find("already running") != std::string::npos) {
+    fprintf(stderr, "%s did not start the ride: %s\n", chair.path.c_str(), chair.line.c_str());
+    chair.refused = true;
+  }
+  chair.line.clear();
+}
+
+/**
+ * Function to take in the frame the parser of a chair has just finished
+ */
+static void takeFrame(Chair &chair, double atMs) {
+  FrameParser &parser = chair.parser;
+  if (parser.type == MSG_PONG && takePong(chair.probe, parser.payload, parser.length, monotonicMicros())) {
+    chair.answered = true;
+    return;
+  }
+  if (parser.type == MSG_SYNC_STATS && parser.length == SYNC_STATS_PAYLOAD_SIZE) {
+    chair.syncs = readUint16(parser.payload);
+    chair.fixes = parser.payload[2];
+    chair.driftPpb = (int32_t)readUint32(parser.payload + 3);
+    chair.lastCorrection = (int32_t)readUint32(parser.payload + 7);
+    chair.syncStatsReceived = true;
+    return;
+  }
+
+  TelemetrySample samples[TELEMETRY_MAX_BATCH];
+  uint8_t count = decodeTelemetryFrame(chair.decoder, parser.type, parser.payload, parser.length, samples);
+  for (uint8_t i = 0; i < count; i++) {
+    Sample sample;
+    sample.atMs = atMs;
+    for (uint8_t j = 0; j < MOTORS; j++) {
+      sample.position[j] = samples[i].values[j];
+    }
+    chair.samples.push_back(sample);
+  }
+}
+
+/**
+ * Function to read whatever the chairs sent, waiting at most a millisecond for it
+ */
+static void readChairs(std::vector<Chair> &chairs) {
+  std::vector<pollfd> ports(chairs.size());
+  for (size_t i = 0; i < chairs.size(); i++) {
+    ports[i].fd = chairs[i].port;
+    ports[i].events = POLLIN;
+  }
+  if (poll(ports.data(), ports.size(), 1) <= 0) {
+    return;
+  }
+
+  for (size_t i = 0; i < chairs.size(); i++) {
+    if (!(ports[i].revents & POLLIN)) {
+      continue;
+    }
+    Chair &chair = chairs[i];
+    double atMs = (monotonicMicros() - epoch) / 1000.0;
+    uint8_t buffer[256];
+    ssize_t size = read(chair.port, buffer, sizeof(buffer));
+    for (ssize_t j = 0; j < size; j++) {
+      uint8_t c = buffer[j];
+      if (isParsingFrame(chair.parser) || c == FRAME_SYNC) {
+        if (parseFrameByte(chair.parser, c)) {
+          takeFrame(chair, atMs);
+        }
+      } else if (c == '\n') {
+        takeLine(chair);
+      } else if (c >= 0x20 && c < 0x7F) {
+        chair.line += (char)c;
+      }
+    }
+  }
+}
+
+/**
+ * Function to find a motor position of a chair at a time between its samples
+ * @param samples the samples, in the order they arrived
+ * @param atMs the time on the host clock
+ * @param motor the motor
+ */
+static double positionAt(const std::vector<Sample> &samples, double atMs, uint8_t motor) {
+  auto after = std::lower_bound(samples.begin(), samples.end(), atMs, [](const Sample &sample, double at) {
+    return sample.atMs < at;
+  });
+  if (after == samples.begin()) {
+    return after -> position[motor];
+  }
+  if (after == samples.end()) {
+    return samples.back().position[motor];
+  }
+  const Sample &before = *(after - 1);
+  double span = after -> atMs - before.atMs;
+  double share = span > 0 ? (atMs - before.atMs) / span : 0;
+  return before.position[motor] + share * (after -> position[motor] - before.position[motor]);
+}
+
+/**
+ * Function to add up how far the motors of a chair are from the first chair shifted by a skew
+ * @return the squared error per sample
+ */
+static double skewError(const std::vector<Sample> &reference, const std::vector<Sample> &samples, size_t from, size_t to,
+                        double skewMs) {
+  double error = 0;
+  for (size_t i = from; i < to; i++) {
+    for (uint8_t j = 0; j < MOTORS; j++) {
+      double difference = samples[i].position[j] - positionAt(reference, samples[i].atMs - skewMs, j);
+      error += difference * difference;
+    }
+  }
+  return error / (to - from);
+}
+
+/**
+ * Function to measure the skew of a chair against the first one, window by window
+ * The shift is first found to the millisecond and then to a twentieth of one around that
+ */
+static Skew measureSkew(const std::vector<Sample> &reference, const std::vector<Sample> &samples, double fromMs) {
+  Skew skew;
+  if (reference.empty() || samples.empty()) {
+    return skew;
+  }
+
+  for (double windowAt = fromMs; windowAt < samples.back().atMs; windowAt += SKEW_WINDOW_MS) {
+    auto inWindow = [&](const std::vector<Sample> &list, size_t &from, size_t &to) {
+      auto byTime = [](const Sample &sample, double at) { return sample.atMs < at; };
+      from = std::lower_bound(list.begin(), list.end(), windowAt, byTime) - list.begin();
+      to = std::lower_bound(list.begin(), list.end(), windowAt + SKEW_WINDOW_MS, byTime) - list.begin();
+    };
+    size_t from, to;
+    inWindow(reference, from, to);
+    double travel = 0;
+    for (size_t i = from + 1; i < to; i++) {
+      for (uint8_t j = 0; j < MOTORS; j++) {
+        travel += std::abs(reference[i].position[j] - reference[i - 1].position[j]);
+      }
+    }
+    inWindow(samples, from, to);
+    if (travel < SKEW_MIN_TRAVEL || to - from < 2) {
+      continue;
+    }
+
+    double best = 0;
+    double bestError = INFINITY;
+    for (double shift = -SKEW_SEARCH_MS; shift <= SKEW_SEARCH_MS; shift += 1) {
+      double error = skewError(reference, samples, from, to, shift);
+      if (error < bestError) {
+        bestError = error;
+        best = shift;
+      }
+    }
+    double coarse = best;
+    for (double shift = coarse - 1; shift <= coarse + 1; shift += 0.05) {
+      double error = skewError(reference, samples, from, to, shift);
+      if (error < bestError) {
+        bestError = error;
+        best = shift;
+      }
+    }
+    skew.windows.push_back(best);
+  }
+  return skew;
+}
+
+static void writeCsv(const char *path, const std::vector<Chair> &chairs) {
+  FILE *csv = fopen(path, "w");
+  if (!csv) {
+    perror(path);
+    return;
+  }
+  fprintf(csv, "chair,time_ms,position1,position2,position3\n");
+  for (size_t i = 0; i < chairs.size(); i++) {
+    for (const Sample &sample : chairs[i].samples) {
+      fprintf(csv, "%zu,%.3f,%d,%d,%d\n", i + 1, sample.atMs, sample.position[0], sample.position[1], sample.position[2]);
+    }
+  }
+  fclose(csv);
+}
+
+static void printReport(const std::vector<Chair> &chairs, bool synced, double rideAtMs) {
+  printf("%s, skew against %s in windows of %d ms (ms, positive is late)\n\n", synced ? "Synced" : "Not synced",
+         chairs[0].path.c_str(), SKEW_WINDOW_MS);
+  printf("%-14s %9s %6s %10s %8s %8s %8s %8s %8s\n", "chair", "drift_ppm", "fixes", "correction", "samples", "first",
+         "mean", "worst", "last");
+  for (size_t i = 0; i < chairs.size(); i++) {
+    const Chair &chair = chairs[i];
+    printf("%-14s %9.1f %6u %10d %8zu", chair.path.c_str(), chair.driftPpb / 1000.0, chair.fixes, chair.lastCorrection,
+           chair.samples.size());
+    if (i == 0) {
+      printf(" %8s\n", "reference");
+      continue;
+    }
+    Skew skew = measureSkew(chairs[0].samples, chair.samples, rideAtMs);
+    if (skew.windows.empty()) {
+      printf(" %8s\n", "no motion");
+      continue;
+    }
+    double sum = 0;
+    double worst = 0;
+    for (double window : skew.windows) {
+      sum += window;
+      worst = std::abs(window) > std::abs(worst) ? window : worst;
+    }
+    printf(" %8.2f %8.2f %8.2f %8.2f\n", skew.windows.front(), sum / skew.windows.size(), worst, skew.windows.back());
+  }
+}
+
+int main(int argc, char **argv) {
+  std::vector<Chair> chairs;
+  std::vector<const char *> serialPaths;
+  std::vector<const char *> simulated;
+  int ride = 1;
+  double warmupSeconds = 15;
+  uint32_t leadMs = 1000;
+  bool synced = true;
+  const char *csvPath = nullptr;
+  double pauseAtSeconds = -1;
+  uint32_t pauseMs = 0;
+
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+    if (strcmp(option, "--no-sync") == 0) {
+      synced = false;
+    } else if (strcmp(option, "--echo") == 0) {
+      echo = true;
+    } else if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--serial") == 0) {
+      serialPaths.push_back(value);
+      i++;
+    } else if (strcmp(option, "--sim") == 0) {
+      simulated.push_back(value);
+      i++;
+    } else if (strcmp(option, "--ride") == 0) {
+      ride = atoi(value);
+      i++;
+    } else if (strcmp(option, "--warmup-s") == 0) {
+      warmupSeconds = atof(value);
+      i++;
+    } else if (strcmp(option, "--lead-ms") == 0) {
+      leadMs = (uint32_t)atoi(value);
+      i++;
+    } else if (strcmp(option, "--pause") == 0) {
+      const char *colon = strchr(value, ':');
+      if (!colon) {
+        usage(argv[0]);
+      }
+      pauseAtSeconds = atof(value);
+      pauseMs = (uint32_t)atoi(colon + 1);
+      i++;
+    } else if (strcmp(option, "--csv") == 0) {
+      csvPath = value;
+      i++;
+    } else {
+      usage(argv[0]);
+    }
+  }
+  if (serialPaths.size() + simulated.size() < 2 || ride < 1 || ride > 255) {
+    usage(argv[0]);
+  }
+
+  // chair_sim is built next to this program
+  std::string program(argv[0]);
+  std::string simulatorPath = program.substr(0, program.find_last_of('/') + 1) + "chair_sim";
+
+  for (const char *path : serialPaths) {
+    Chair chair;
+    initChair(chair, path);
+    chairs.push_back(chair);
+  }
+  bool failed = false;
+  for (const char *ppm : simulated) {
+    Chair chair;
+    failed = failed || !startSimulator(chair, simulatorPath, ppm);
+    chairs.push_back(chair);
+  }
+  for (Chair &chair : chairs) {
+    chair.port = failed ? -1 : openSerialPort(chair.path.c_str());
+    failed = failed || chair.port < 0;
+  }
+  signal(SIGINT, stop);
+  signal(SIGTERM, stop);
+
+  epoch = monotonicMicros();
+  uint64_t nextSyncAt = 0;
+  uint64_t nextPingAt = 0;
+  uint64_t answeredAt = 0;
+  uint64_t rideSentAt = 0;
+  uint64_t completeAt = 0;
+  bool rideSent = false;
+  uint64_t pausedAt = 0;
+  bool resumed = false;
+
+  while (running && !failed) {
+    uint64_t now = monotonicMicros() - epoch;
+
+    if (now >= nextPingAt) {
+      for (Chair &chair : chairs) {
+        sendPing(chair);
+      }
+      nextPingAt += PROBE_INTERVAL_MS * 1000;
+    }
+
+    // A chair only gets syncs once it answers, before that they would wait in its buffer and arrive all at once
+    bool allAnswered = true;
+    for (Chair &chair : chairs) {
+      allAnswered = allAnswered && chair.answered;
+    }
+    if (now >= nextSyncAt) {
+      for (Chair &chair : chairs) {
+        if (synced && chair.answered) {
+          sendSync(chair);
+        }
+      }
+      nextSyncAt += SYNC_INTERVAL_MS * 1000;
+    }
+    if (!allAnswered && now > ANSWER_TIMEOUT_S * 1000000ULL) {
+      fprintf(stderr, "A chair did not answer\n");
+      failed = true;
+      break;
+    }
+    if (allAnswered && answeredAt == 0) {
+      answeredAt = now;
+      for (Chair &chair : chairs) {
+        sendTelemetryConfig(chair, TELEMETRY_PERIOD_MS);
+      }
+    }
+
+    // Every chair gets the same start, or the RIDE command one right after the other
+    if (!rideSent && answeredAt > 0 && now - answeredAt >= (uint64_t)(warmupSeconds * 1000000)) {
+      uint32_t startsAt = timelineMicros() + leadMs * 1000;
+      for (Chair &chair : chairs) {
+        if (synced) {
+          uint8_t payload[RIDE_AT_PAYLOAD_SIZE];
+          payload[0] = (uint8_t)ride;
+          writeUint32(payload + 1, startsAt);
+          sendFrame(chair, MSG_RIDE_AT, payload, RIDE_AT_PAYLOAD_SIZE);
+        } else {
+          writeSerialText(chair.port, ("RIDE " + std::to_string(ride)).c_str());
+        }
+      }
+      rideSent = true;
+      rideSentAt = now;
+      fprintf(stderr, "Ride %d started\n", ride);
+    }
+
+    // The ride starts --lead-ms after it was sent
+    uint64_t intoRide = rideSent && now > rideSentAt + leadMs * 1000ULL ? now - rideSentAt - leadMs * 1000ULL : 0;
+    if (pauseAtSeconds >= 0 && pausedAt == 0 && intoRide >= (uint64_t)(pauseAtSeconds * 1000000)) {
+      writeSerialControl(chairs.back().port, CONTROL_PAUSE);
+      pausedAt = now;
+      fprintf(stderr, "Paused %s\n", chairs.back().path.c_str());
+    }
+    if (pausedAt > 0 && !resumed && now - pausedAt >= pauseMs * 1000ULL) {
+      writeSerialControl(chairs.back().port, CONTROL_RESUME);
+      resumed = true;
+      fprintf(stderr, "Resumed %s\n", chairs.back().path.c_str());
+    }
+
+    bool allComplete = rideSent;
+    for (Chair &chair : chairs) {
+      allComplete = allComplete && chair.complete;
+      failed = failed || chair.refused;
+    }
+    // The last moves are still sampled for a moment after the chairs report the ride complete
+    if (allComplete && completeAt == 0) {
+      completeAt = now;
+      for (Chair &chair : chairs) {
+        sendFrame(chair, MSG_SYNC_STATS_REQUEST, nullptr, 0);
+      }
+    }
+    if (completeAt > 0 && now - completeAt > 500000) {
+      break;
+    }
+    if (rideSent && now - rideSentAt > RIDE_TIMEOUT_S * 1000000ULL) {
+      fprintf(stderr, "The ride did not complete on every chair\n");
+      failed = true;
+    }
+
+    readChairs(chairs);
+  }
+
+  for (Chair &chair : chairs) {
+    if (chair.port >= 0) {
+      sendTelemetryConfig(chair, 0);
+      close(chair.port);
+    }
+    if (chair.simulator > 0) {
+      kill(chair.simulator, SIGTERM);
+      waitpid(chair.simulator, nullptr, 0);
+      fclose(chair.simulatorOutput);
+    }
+  }
+  if (failed || !running) {
+    return EXIT_FAILURE;
+  }
+
+  if (csvPath) {
+    writeCsv(csvPath, chairs);
+  }
+  printReport(chairs, synced, rideSentAt / 1000.0);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+// Compares the fixed-point washout in MotionCueing.cpp with the floating point reference
+// and times both on the host
+//
+//   g++ -O2 -o cueing_bench cueing_bench.cpp MotionCueingReference.cpp ../MotionCueing.cpp ../SerialProtocol.cpp
+//   ./cueing_bench [trace.csv]
+//
+// The cycles per update on the ATmega2560 are measured on the chair itself with a MSG_CUEING_BENCHMARK_REQUEST frame
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "MotionCueingReference.h"
+
+// Envelope of the chair in centidegrees
+static const int16_t PITCH_LIMIT = 3000;
+static const int16_t ROLL_LIMIT = 3000;
+static const int16_t YAW_LIMIT = 2000;
+
+// A minute of driving: launch, slalom, braking, bumps and a bit of noise
+static std::vector<VehicleState> makeDrive() {
+  std::vector<VehicleState> drive;
+  uint32_t noise = 12345;
+
+  for (int i = 0; i < 60 * CUEING_RATE_HZ; i++) {
+    double t = (double)i / CUEING_RATE_HZ;
+    VehicleState vehicle = { 0, 0, 0, 0, 0 };
+
+    noise = noise * 1103515245u + 12345u;
+    int16_t jitter = (int16_t)((noise >> 16) % 41) - 20;
+
+    if (t < 5) {
+      vehicle.surge = 400;
+    } else if (t < 25) {
+      vehicle.sway = (int16_t)(300 * sin(2 * M_PI * 0.5 * t));
+      vehicle.yawRate = (int16_t)(3000 * sin(2 * M_PI * 0.5 * t));
+      vehicle.rollRate = (int16_t)(800 * cos(2 * M_PI * 0.5 * t));
+    } else if (t < 30) {
+      vehicle.surge = -800;
+    } else if (t < 45) {
+      vehicle.pitchRate = (fmod(t, 1.0) < 0.1) ? 4000 : -400;
+    } else {
+      vehicle.surge = 150;
+      vehicle.yawRate = -1500;
+    }
+
+    vehicle.surge += jitter;
+    vehicle.sway += jitter;
+    drive.push_back(vehicle);
+  }
+  return drive;
+}
+
+struct AxisError {
+  double maximum = 0;
+  double sumOfSquares = 0;
+
+  void add(double error) {
+    maximum = std::max(maximum, std::fabs(error));
+    sumOfSquares += error * error;
+  }
+};
+
+int main(int argc, char **argv) {
+  std::vector<VehicleState> drive = makeDrive();
+  FILE *trace = argc > 1 ? fopen(argv[1], "w") : nullptr;
+  if (trace) {
+    fprintf(trace, "time,pitch,roll,yaw,reference_pitch,reference_roll,reference_yaw\n");
+  }
+
+  MotionCueing cueing;
+  MotionCueingReference reference;
+  initMotionCueing(cueing, PITCH_LIMIT, ROLL_LIMIT, YAW_LIMIT);
+  initMotionCueingReference(reference, PITCH_LIMIT, ROLL_LIMIT, YAW_LIMIT);
+
+  AxisError pitchError, rollError, yawError;
+  for (size_t i = 0; i < drive.size(); i++) {
+    Pose pose = updateMotionCueing(cueing, drive[i]);
+    ReferencePose expected = updateMotionCueingReference(reference, drive[i]);
+
+    pitchError.add(pose.pitch - expected.pitch);
+    rollError.add(pose.roll - expected.roll);
+    yawError.add(pose.yaw - expected.yaw);
+
+    if (trace) {
+      fprintf(trace, "%.3f,%d,%d,%d,%.2f,%.2f,%.2f\n", (double)i / CUEING_RATE_HZ, pose.pitch, pose.roll, pose.yaw,
+              expected.pitch, expected.roll, expected.yaw);
+    }
+  }
+  if (trace) {
+    fclose(trace);
+  }
+
+  double count = (double)drive.size();
+  printf("Fixed point against float reference over %zu updates (centidegrees)\n", drive.size());
+  printf("  pitch: max %.2f, rms %.3f\n", pitchError.maximum, sqrt(pitchError.sumOfSquares / count));
+  printf("  roll:  max %.2f, rms %.3f\n", rollError.maximum, sqrt(rollError.sumOfSquares / count));
+  printf("  yaw:   max %.2f, rms %.3f\n", yawError.maximum, sqrt(yawError.sumOfSquares / count));
+
+  // Time both versions over the same drive many times
+  const int passes = 200;
+  volatile int32_t sink = 0;
+
+  auto started = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++) {
+    for (size_t i = 0; i < drive.size(); i++) {
+      sink = sink + updateMotionCueing(cueing, drive[i]).pitch;
+    }
+  }
+  double fixedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started).count();
+
+  started = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++) {
+    for (size_t i = 0; i < drive.size(); i++) {
+      sink = sink + (int32_t)updateMotionCueingReference(reference, drive[i]).pitch;
+    }
+  }
+  double floatNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started).count();
+
+  double updates = count * passes;
+  printf("Host time per update: fixed point %.1f ns, float reference %.1f ns\n", fixedNs / updates, floatNs / updates);
+  return 0;
+}
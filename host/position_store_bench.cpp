@@ -0,0 +1,153 @@
+// Runs many short rides that end where they started and counts how often every byte of the position store is written
+//
+//   make -C host position_store_bench
+//   host/position_store_bench [--cycles N]
+//
+// The sketch homes once, then every cycle moves the chair down, brings it back to 0 and lets it rest until its
+// positions are saved, like a ride that parks the chair level. The EEPROM cells last about 100000 writes, so what
+// counts is the byte that is written most, not the total.
+//
+// It reports the writes of the busiest byte of the store and how many rides that byte lasts. The exit status is 1
+// when that byte takes more than its share of a ring that is written evenly: a record and a cleared mark per slot
+// and lap, or when a cycle doesn't come to rest.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Arduino.h"
+#include "FastAccelStepper.h"
+#include "Simulator.h"
+#include "MotionScheduler.h"
+#include "AxisConfig.h"
+#include "Homing.h"
+#include "PositionStore.h"
+
+// Sketch function, from MotionSimulationChair.cpp
+void setup();
+
+// Virtual time of one pass, like the default of chair_sim
+#define PASS_MICROS 100
+
+// No cycle takes this long, anything that does is stuck
+#define CYCLE_TIMEOUT_MICROS 60000000ULL
+
+// Time left after the chair stopped for the positions to settle and the record to be written a byte a pass
+#define SAVE_MICROS ((POSITION_SETTLE_MS + 500) * 1000ULL)
+
+// Writes a byte of the EEPROM lasts
+#define EEPROM_ENDURANCE 100000
+
+#define STORE_BYTES (POSITION_STORE_SLOTS * POSITION_RECORD_SIZE)
+
+static void usage(const char *program) {
+  fprintf(stderr, "usage: %s [--cycles N]\n", program);
+  exit(EXIT_FAILURE);
+}
+
+static bool anyStepperRunning() {
+  for (uint8_t i = 0; i < getStepperCount(); i++) {
+    if (getStepper(i) -> isRunning()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to run passes the way loop() does for the scheduler and the store until the chair has stopped, and then
+ * long enough for its positions to be saved
+ * @return false if the chair did not stop within CYCLE_TIMEOUT_MICROS
+ */
+static bool runUntilSaved() {
+  uint64_t endAt = getSimulationMicros() + CYCLE_TIMEOUT_MICROS;
+  uint64_t savedAt = 0;
+
+  while (getSimulationMicros() < endAt) {
+    updateScheduler();
+    updatePositionStore(isSchedulerIdle());
+    if (!isSchedulerIdle() || anyStepperRunning()) {
+      savedAt = 0;
+    } else if (savedAt == 0) {
+      savedAt = getSimulationMicros() + SAVE_MICROS;
+    } else if (getSimulationMicros() >= savedAt) {
+      return true;
+    }
+    advanceSimulation(PASS_MICROS);
+  }
+  return false;
+}
+
+int main(int argc, char **argv) {
+  long cycles = 1000;
+
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--cycles") == 0) {
+      cycles = strtol(value, nullptr, 10);
+      if (cycles < 1) {
+        usage(argv[0]);
+      }
+    } else {
+      usage(argv[0]);
+    }
+    i++;
+  }
+
+  // The EEPROM starts out erased, so setup() homes against the switches first
+  setSerialOutput(fopen("/dev/null", "w"));
+  addHomeSwitch(STEPPER1_HOME_PIN, 6, homeSwitchPosition<Stepper1Axis>());
+  addHomeSwitch(STEPPER2_HOME_PIN, 7, homeSwitchPosition<Stepper2Axis>());
+  addHomeSwitch(STEPPER3_HOME_PIN, 8, homeSwitchPosition<Stepper3Axis>());
+  setup();
+  if (!runUntilSaved()) {
+    printf("STUCK homing did not come to rest\n");
+    return EXIT_FAILURE;
+  }
+
+  uint32_t before[STORE_BYTES];
+  for (uint16_t i = 0; i < STORE_BYTES; i++) {
+    before[i] = getEepromWrites(POSITION_STORE_ADDRESS + i);
+  }
+
+  for (long cycle = 0; cycle < cycles; cycle++) {
+    scheduleMoveTo(ALL_STEPPERS_MASK, Stepper1Axis::MIN_POSITION / 2, Stepper2Axis::MIN_POSITION / 2,
+                   Stepper3Axis::MIN_POSITION / 2, ALL_STEPPERS_MASK, 0);
+    scheduleMoveTo(ALL_STEPPERS_MASK, 0, 0, 0, ALL_STEPPERS_MASK, 0);
+    if (!runUntilSaved()) {
+      printf("STUCK cycle %ld did not come to rest\n", cycle + 1);
+      return EXIT_FAILURE;
+    }
+  }
+
+  uint32_t total = 0;
+  uint32_t busiest = 0;
+  uint16_t busiestAddress = POSITION_STORE_ADDRESS;
+  for (uint16_t i = 0; i < STORE_BYTES; i++) {
+    uint32_t writes = getEepromWrites(POSITION_STORE_ADDRESS + i) - before[i];
+    total += writes;
+    if (writes > busiest) {
+      busiest = writes;
+      busiestAddress = POSITION_STORE_ADDRESS + i;
+    }
+  }
+
+  // Every lap over the ring writes each mark byte once good and once cleared, the other bytes of a record at most
+  // once. The first lap also writes over the erased slots.
+  uint32_t allowed = 2 * (cycles / POSITION_STORE_SLOTS + 2);
+
+  printf("cycles          %ld\n", cycles);
+  printf("writes          %u, %.1f per cycle\n", total, (double)total / cycles);
+  printf("busiest byte    %u writes at address %u, %.3f per cycle\n", busiest, busiestAddress, (double)busiest / cycles);
+  printf("rides it lasts  %.0f\n", busiest > 0 ? (double)EEPROM_ENDURANCE * cycles / busiest : 0.0);
+
+  if (busiest > allowed) {
+    printf("FAILED the busiest byte is written more than the %u writes of an evenly worn ring\n", allowed);
+    return EXIT_FAILURE;
+  }
+  printf("PASSED\n");
+  return EXIT_SUCCESS;
+}
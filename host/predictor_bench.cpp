@@ -0,0 +1,537 @@
+// Measures how much of the lag of a pose stream the predictor of PosePredictor.h hides, and the overshoot it costs
+//
+//   make -C host predictor_bench
+//   host/predictor_bench [--link-ms MS] [--jitter-ms MS] [--seed N] [LOG]...
+//
+// The sketch runs in virtual time like in chair_sim, and a stand-in host streams poses to it at the stream tick
+// rate. Every frame crosses a link that delays it by --link-ms plus up to --jitter-ms, in both directions, and the
+// host measures that link with MSG_PING the way chair_bridge does. The streams are the poses of recorded sessions,
+// given as session logs (see SessionLog.h, written by chair_bridge --record or session_log record). Without any,
+// three built-in streams are used: the drive of chair_bridge --produce through the washout, slow waves on every
+// axis and a slalom of quick turns that stop dead.
+//
+// Every stream is played with:
+//   off      the poses as they are
+//   chair    predicted by the chair, with the lead it tunes from the link latency measured by the host
+//   bridge   predicted by the host before sending, with the lead tuned from the round trip and the jitter buffer
+//            wait in MSG_PONG
+//   N ms     predicted by the host with a fixed lead, to show the trade-off
+//
+// For every run it reports, from the motor positions against the stream poses mixed into motor positions:
+//   lead_ms        lead of the predictor at the end of the run
+//   lag_ms         shift of the stream that lines it up best with the motors, the lag the rider feels
+//   rms_steps      error between the motors and the stream at the same time
+//   overshoot      largest distance a motor goes past anything the stream asked for within OVERSHOOT_WINDOW_MS
+//                  either side, in steps
+//   over_ms        time some motor spends more than a step past that
+// One step of a motor is 0.36 degrees of the seat.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "FastAccelStepper.h"
+#include "Simulator.h"
+#include "MotionScheduler.h"
+#include "SerialProtocol.h"
+#include "PoseStream.h"
+#include "PosePredictor.h"
+#include "MotionCueing.h"
+#include "Kinematics.h"
+#include "AxisConfig.h"
+#include "Homing.h"
+#include "LatencyProbe.h"
+#include "SessionLog.h"
+
+void setup();
+void loop();
+extern PosePredictor predictor;
+
+// Virtual time of one pass, like the default of chair_sim
+#define PASS_MICROS 100
+
+// The motors and the stream are compared every millisecond
+#define SAMPLE_MICROS 1000
+
+// The start of a stream is left out while the predictor and the jitter buffer settle
+#define WARMUP_MS 500
+
+// Range of shifts tried for the lag
+#define MIN_LAG_MS -100
+#define MAX_LAG_MS 300
+
+#define OVERSHOOT_WINDOW_MS 250
+
+// Length of the built-in streams
+#define BUILT_IN_SECONDS 20
+
+// The chair is sent a new link latency when it changed by more than this
+#define RETUNE_MICROS 250
+
+#define MOTORS 3
+
+struct Stream {
+  std::string name;
+  std::vector<Pose> poses; // One per STREAM_TICK_MICROS
+};
+
+enum Mode { MODE_OFF, MODE_CHAIR, MODE_BRIDGE, MODE_FIXED };
+
+struct Run {
+  const char *label;
+  Mode mode;
+  uint32_t leadMicros;
+};
+
+static const Run RUNS[] = {
+  { "off", MODE_OFF, 0 },
+  { "chair", MODE_CHAIR, 0 },
+  { "bridge", MODE_BRIDGE, 0 },
+  { "25 ms", MODE_FIXED, 25000 },
+  { "50 ms", MODE_FIXED, 50000 },
+  { "75 ms", MODE_FIXED, 75000 },
+  { "100 ms", MODE_FIXED, 100000 },
+};
+
+struct Result {
+  double leadMs;
+  double lagMs;
+  double rmsSteps;
+  double overshoot;
+  double overMs;
+};
+
+// A pong on its way back over the link
+struct PendingPong {
+  uint64_t arrivesAt;
+  uint8_t payload[PONG_PAYLOAD_SIZE];
+};
+
+// The link between the stand-in host and the chair
+// Frames keep their order, a frame never overtakes the one before it
+struct Link {
+  double latencyMicros;
+  double jitterMicros;
+  std::mt19937 random;
+  uint64_t lastArrival[2]; // Towards the chair and back
+};
+
+// Serial output of the sketch, read back for the pongs
+static char *output = nullptr;
+static size_t outputSize = 0;
+static size_t outputRead = 0;
+static FILE *outputFile = nullptr;
+static FrameParser outputParser;
+static std::deque<PendingPong> pendingPongs;
+
+static uint8_t sequence = 0;
+
+static void usage(const char *program) {
+  fprintf(stderr, "usage: %s [--link-ms MS] [--jitter-ms MS] [--seed N] [LOG]...\n", program);
+  exit(EXIT_FAILURE);
+}
+
+static bool anyStepperRunning() {
+  for (uint8_t i = 0; i < getStepperCount(); i++) {
+    if (getStepper(i) -> isRunning()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to work out when something sent now arrives at the far end of the link
+ * @param direction 0 towards the chair, 1 back to the host
+ */
+static uint64_t arrivalTime(Link &link, uint8_t direction) {
+  std::uniform_real_distribution<double> jitter(0, link.jitterMicros);
+  uint64_t arrival = getSimulationMicros() + (uint64_t)(link.latencyMicros + jitter(link.random));
+  arrival = std::max(arrival, link.lastArrival[direction]);
+  link.lastArrival[direction] = arrival;
+  return arrival;
+}
+
+static void sendToChair(Link &link, uint8_t type, const uint8_t *payload, uint8_t length) {
+  uint8_t frame[FRAME_MAX_SIZE];
+  uint8_t size = encodeFrame(frame, type, sequence++, payload, length);
+  queueSerialInput(arrivalTime(link, 0), std::string((const char *)frame, size));
+}
+
+/**
+ * Function to look through what the sketch printed since the last pass and send its pongs back over the link
+ */
+static void collectPongs(Link &link) {
+  fflush(outputFile);
+  for (; outputRead < outputSize; outputRead++) {
+    uint8_t c = (uint8_t)output[outputRead];
+    if ((isParsingFrame(outputParser) || c == FRAME_SYNC) && parseFrameByte(outputParser, c) &&
+        outputParser.type == MSG_PONG && outputParser.length == PONG_PAYLOAD_SIZE) {
+      PendingPong pong;
+      pong.arrivesAt = arrivalTime(link, 1);
+      memcpy(pong.payload, outputParser.payload, PONG_PAYLOAD_SIZE);
+      pendingPongs.push_back(pong);
+    }
+  }
+}
+
+/**
+ * Function to run one pass through loop() and let the virtual time move on
+ */
+static void pass(Link &link) {
+  loop();
+  advanceSimulation(PASS_MICROS);
+  collectPongs(link);
+}
+
+/**
+ * Function to hand the host the pongs that have made it back
+ * @return true if a round trip was measured
+ */
+static bool receivePongs(LatencyProbe &probe) {
+  bool measured = false;
+  while (!pendingPongs.empty() && pendingPongs.front().arrivesAt <= getSimulationMicros()) {
+    measured = takePong(probe, pendingPongs.front().payload, PONG_PAYLOAD_SIZE, getSimulationMicros()) || measured;
+    pendingPongs.pop_front();
+  }
+  return measured;
+}
+
+static void sendPredictorConfig(Link &link, bool on, uint32_t linkMicros) {
+  uint8_t payload[PREDICTOR_CONFIG_PAYLOAD_SIZE];
+  payload[0] = on ? 1 : 0;
+  writeUint32(payload + 1, linkMicros);
+  sendToChair(link, MSG_PREDICTOR_CONFIG, payload, PREDICTOR_CONFIG_PAYLOAD_SIZE);
+}
+
+/**
+ * Function to get the largest or smallest value within a window either side of every value
+ * @param values the values
+ * @param half samples on either side
+ * @param largest whether to take the largest
+ */
+static std::vector<int32_t> slidingExtreme(const std::vector<int32_t> &values, size_t half, bool largest) {
+  std::vector<int32_t> extremes(values.size());
+  std::deque<size_t> window;
+  size_t added = 0;
+  for (size_t i = 0; i < values.size(); i++) {
+    for (; added < values.size() && added <= i + half; added++) {
+      while (!window.empty() && (largest ? values[window.back()] <= values[added] : values[window.back()] >= values[added])) {
+        window.pop_back();
+      }
+      window.push_back(added);
+    }
+    while (window.front() + half < i) {
+      window.pop_front();
+    }
+    extremes[i] = values[window.front()];
+  }
+  return extremes;
+}
+
+/**
+ * Function to measure how well the motors followed the stream
+ * @param targets stream poses mixed into motor positions, one per SAMPLE_MICROS
+ * @param positions motor positions at the same times
+ */
+static void measure(const std::vector<int32_t> *targets, const std::vector<int32_t> *positions, Result &result) {
+  int samples = (int)targets[0].size();
+  int first = WARMUP_MS * 1000 / SAMPLE_MICROS;
+  int last = samples + MIN_LAG_MS * 1000 / SAMPLE_MICROS;
+
+  // Every shift is compared over the same samples
+  double best = -1;
+  result.rmsSteps = 0;
+  for (int lag = MIN_LAG_MS; lag <= MAX_LAG_MS; lag++) {
+    int shift = lag * 1000 / SAMPLE_MICROS;
+    double sum = 0;
+    int count = 0;
+    for (int i = std::max(first, MAX_LAG_MS * 1000 / SAMPLE_MICROS); i < last; i++) {
+      for (uint8_t m = 0; m < MOTORS; m++) {
+        double error = positions[m][i] - targets[m][i - shift];
+        sum += error * error;
+        count++;
+      }
+    }
+    if (best < 0 || sum < best) {
+      best = sum;
+      result.lagMs = lag;
+    }
+    if (lag == 0) {
+      result.rmsSteps = count > 0 ? sqrt(sum / count) : 0;
+    }
+  }
+
+  size_t half = OVERSHOOT_WINDOW_MS * 1000 / SAMPLE_MICROS;
+  std::vector<bool> past(samples, false);
+  result.overshoot = 0;
+  for (uint8_t m = 0; m < MOTORS; m++) {
+    std::vector<int32_t> highest = slidingExtreme(targets[m], half, true);
+    std::vector<int32_t> lowest = slidingExtreme(targets[m], half, false);
+    for (int i = first; i < samples; i++) {
+      int32_t beyond = std::max(positions[m][i] - highest[i], lowest[i] - positions[m][i]);
+      result.overshoot = std::max(result.overshoot, (double)beyond);
+      past[i] = past[i] || beyond > 1;
+    }
+  }
+  result.overMs = std::count(past.begin(), past.end(), true) * SAMPLE_MICROS / 1000.0;
+}
+
+/**
+ * Function to stream poses to the sketch and follow what the motors do
+ * The chair is put into streaming with STREAM, and afterwards taken out of it and back to level
+ */
+static bool runStream(const Stream &stream, const Run &run, Link &link, Result &result) {
+  queueSerialInput(getSimulationMicros(), "STREAM\n");
+  uint64_t timeout = getSimulationMicros() + 5000000;
+  while (!isPoseStreaming()) {
+    if (getSimulationMicros() > timeout) {
+      return false;
+    }
+    pass(link);
+  }
+
+  LatencyProbe probe;
+  initLatencyProbe(probe);
+  PosePredictor hostPredictor;
+  initPosePredictor(hostPredictor, PitchAxis::LIMIT_CENTIDEGREES, RollAxis::LIMIT_CENTIDEGREES, YawAxis::LIMIT_CENTIDEGREES);
+  setPredictorLead(hostPredictor, run.mode == MODE_FIXED ? run.leadMicros : tunePredictorLead(0, 0));
+  sendPredictorConfig(link, run.mode == MODE_CHAIR, 0);
+  uint32_t linkSent = 0;
+
+  std::vector<int32_t> targets[MOTORS];
+  std::vector<int32_t> positions[MOTORS];
+  uint64_t startedAt = getSimulationMicros();
+  uint64_t nextPingAt = startedAt;
+  size_t sent = 0;
+  Pose current = stream.poses[0];
+
+  while (sent < stream.poses.size()) {
+    uint64_t elapsed = getSimulationMicros() - startedAt;
+
+    if (getSimulationMicros() >= nextPingAt) {
+      uint8_t payload[PING_PAYLOAD_SIZE];
+      encodePing(payload, getSimulationMicros());
+      sendToChair(link, MSG_PING, payload, PING_PAYLOAD_SIZE);
+      nextPingAt += PROBE_INTERVAL_MS * 1000ULL;
+    }
+    if (receivePongs(probe)) {
+      uint32_t linkMicros = getLinkLatency(probe);
+      if (run.mode == MODE_BRIDGE) {
+        setPredictorLead(hostPredictor, tunePredictorLead(linkMicros, probe.bufferMicros));
+      } else if (run.mode == MODE_CHAIR && (linkMicros > linkSent + RETUNE_MICROS || linkMicros + RETUNE_MICROS < linkSent)) {
+        sendPredictorConfig(link, true, linkMicros);
+        linkSent = linkMicros;
+      }
+    }
+
+    if (elapsed >= sent * (uint64_t)STREAM_TICK_MICROS) {
+      current = stream.poses[sent++];
+      Pose pose = run.mode == MODE_BRIDGE || run.mode == MODE_FIXED ? predictPose(hostPredictor, current) : current;
+      uint8_t payload[POSE_PAYLOAD_SIZE];
+      encodePose(payload, pose);
+      sendToChair(link, MSG_POSE, payload, POSE_PAYLOAD_SIZE);
+    }
+
+    if (elapsed % SAMPLE_MICROS == 0) {
+      MotorTargets target = mixPose(current.pitch, current.roll, current.yaw);
+      for (uint8_t m = 0; m < MOTORS; m++) {
+        targets[m].push_back(target.position[m]);
+        positions[m].push_back(getStepper(m) -> getCurrentPosition());
+      }
+    }
+    pass(link);
+  }
+
+  result.leadMs = 0;
+  if (run.mode != MODE_OFF) {
+    result.leadMs = (run.mode == MODE_CHAIR ? getPredictorLead(predictor) : getPredictorLead(hostPredictor)) / 1000.0;
+  }
+  measure(targets, positions, result);
+
+  // Any line ends the stream, then back to level for the next run
+  queueSerialInput(getSimulationMicros(), "STOP\n");
+  while (isPoseStreaming() || getPendingSerialInput() > 0) {
+    pass(link);
+  }
+  scheduleMoveTo(ALL_STEPPERS_MASK, 0, 0, 0, ALL_STEPPERS_MASK, 0);
+  while (!isSchedulerIdle() || anyStepperRunning()) {
+    pass(link);
+  }
+  return true;
+}
+
+/**
+ * Function to make the drive of chair_bridge --produce, through the washout
+ */
+static Stream driveStream() {
+  Stream stream = { "drive", {} };
+  MotionCueing cueing;
+  initMotionCueing(cueing, PitchAxis::LIMIT_CENTIDEGREES, RollAxis::LIMIT_CENTIDEGREES, YawAxis::LIMIT_CENTIDEGREES);
+  for (uint32_t i = 0; i < BUILT_IN_SECONDS * CUEING_RATE_HZ; i++) {
+    double t = fmod((double)i / CUEING_RATE_HZ, 20.0);
+    VehicleState vehicle = { 0, 0, 0, 0, 0 };
+    if (t < 4) {
+      vehicle.surge = 400;
+    } else if (t < 16) {
+      vehicle.sway = (int16_t)(300 * sin(2 * M_PI * 0.5 * t));
+      vehicle.yawRate = (int16_t)(3000 * sin(2 * M_PI * 0.5 * t));
+      vehicle.rollRate = (int16_t)(800 * cos(2 * M_PI * 0.5 * t));
+    } else {
+      vehicle.surge = -800;
+    }
+    stream.poses.push_back(updateMotionCueing(cueing, vehicle));
+  }
+  return stream;
+}
+
+/**
+ * Function to make slow waves on every axis, like a boat or a plane in light turbulence
+ */
+static Stream wavesStream() {
+  Stream stream = { "waves", {} };
+  for (uint32_t i = 0; i < BUILT_IN_SECONDS * 1000000ULL / STREAM_TICK_MICROS; i++) {
+    double t = i * STREAM_TICK_MICROS / 1e6;
+    Pose pose;
+    pose.pitch = (int16_t)(1200 * sin(2 * M_PI * 0.25 * t) + 400 * sin(2 * M_PI * 0.9 * t));
+    pose.roll = (int16_t)(900 * sin(2 * M_PI * 0.4 * t + 1));
+    pose.yaw = (int16_t)(800 * sin(2 * M_PI * 0.15 * t));
+    stream.poses.push_back(pose);
+  }
+  return stream;
+}
+
+/**
+ * Function to make a slalom: quick rolls from side to side that stop dead, held for a moment each
+ */
+static Stream slalomStream() {
+  Stream stream = { "slalom", {} };
+  const double turnSeconds = 0.3;
+  const double holdSeconds = 0.7;
+  for (uint32_t i = 0; i < BUILT_IN_SECONDS * 1000000ULL / STREAM_TICK_MICROS; i++) {
+    double t = i * STREAM_TICK_MICROS / 1e6;
+    int turn = (int)(t / (turnSeconds + holdSeconds));
+    double into = fmin((t - turn * (turnSeconds + holdSeconds)) / turnSeconds, 1.0);
+    double from = turn == 0 ? 0 : (turn % 2 ? 1 : -1);
+    double to = turn % 2 ? -1 : 1;
+    double share = from + (to - from) * (1 - cos(M_PI * into)) / 2;
+    Pose pose;
+    pose.pitch = 0;
+    pose.roll = (int16_t)(1500 * share);
+    pose.yaw = (int16_t)(-1000 * share);
+    stream.poses.push_back(pose);
+  }
+  return stream;
+}
+
+/**
+ * Function to take the poses of a session log, holding each until the next one at the stream tick rate
+ */
+static bool loadStream(const char *path, Stream &stream) {
+  SessionLogReader log;
+  if (!openSessionReader(log, path)) {
+    perror(path);
+    return false;
+  }
+  std::vector<LogRecord> poses;
+  LogRecord record;
+  while (nextSessionRecord(log, record)) {
+    if (record.type == LOG_POSE) {
+      poses.push_back(record);
+    }
+  }
+  closeSessionReader(log);
+  if (poses.empty()) {
+    fprintf(stderr, "%s: no poses in the log\n", path);
+    return false;
+  }
+
+  const char *name = strrchr(path, '/');
+  stream.name = name ? name + 1 : path;
+  size_t next = 0;
+  Pose held = { poses[0].values[0], poses[0].values[1], poses[0].values[2] };
+  for (uint64_t t = poses[0].micros; t <= poses.back().micros; t += STREAM_TICK_MICROS) {
+    for (; next < poses.size() && poses[next].micros <= t; next++) {
+      held = { poses[next].values[0], poses[next].values[1], poses[next].values[2] };
+    }
+    stream.poses.push_back(held);
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  double linkMs = 10;
+  double jitterMs = 2;
+  unsigned long seed = 1;
+  std::vector<Stream> streams;
+
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (option[0] != '-') {
+      Stream stream;
+      if (!loadStream(option, stream)) {
+        return EXIT_FAILURE;
+      }
+      streams.push_back(stream);
+      continue;
+    }
+    if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--link-ms") == 0) {
+      linkMs = atof(value);
+    } else if (strcmp(option, "--jitter-ms") == 0) {
+      jitterMs = atof(value);
+    } else if (strcmp(option, "--seed") == 0) {
+      seed = strtoul(value, nullptr, 10);
+    } else {
+      usage(argv[0]);
+    }
+    i++;
+  }
+  if (streams.empty()) {
+    streams.push_back(driveStream());
+    streams.push_back(wavesStream());
+    streams.push_back(slalomStream());
+  }
+
+  // The EEPROM starts out erased, so setup() homes against the switches first
+  outputFile = open_memstream(&output, &outputSize);
+  setSerialOutput(outputFile);
+  initFrameParser(outputParser);
+  addHomeSwitch(STEPPER1_HOME_PIN, 6, homeSwitchPosition<Stepper1Axis>());
+  addHomeSwitch(STEPPER2_HOME_PIN, 7, homeSwitchPosition<Stepper2Axis>());
+  addHomeSwitch(STEPPER3_HOME_PIN, 8, homeSwitchPosition<Stepper3Axis>());
+  randomSeed(seed);
+  setup();
+
+  Link link;
+  link.latencyMicros = linkMs * 1000;
+  link.jitterMicros = jitterMs * 1000;
+  link.random.seed(seed);
+  link.lastArrival[0] = 0;
+  link.lastArrival[1] = 0;
+
+  printf("Link %.1f ms + up to %.1f ms of jitter each way\n\n", linkMs, jitterMs);
+  printf("%-12s %-8s %8s %8s %10s %10s %8s\n", "stream", "mode", "lead_ms", "lag_ms", "rms_steps", "overshoot", "over_ms");
+  for (const Stream &stream : streams) {
+    for (const Run &run : RUNS) {
+      Result result;
+      if (!runStream(stream, run, link, result)) {
+        printf("STUCK the chair did not start streaming\n");
+        return EXIT_FAILURE;
+      }
+      printf("%-12s %-8s %8.1f %8.0f %10.2f %10.0f %8.0f\n", stream.name.c_str(), run.label, result.leadMs, result.lagMs,
+             result.rmsSteps, result.overshoot, result.overMs);
+    }
+    printf("\n");
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,466 @@
+// Runs every preset motion of the sketch in the simulator and measures how it moves
+//
+//   make -C host bench            compare against ride_bench_baseline.json
+//   make -C host bench-baseline   store the current results as the new baseline
+//
+//   host/ride_bench [--json FILE] [--baseline FILE] [--tolerance PERCENT] [--seed N]
+//
+// For every preset it reports:
+//   duration_ms    from scheduling the preset until the queue is empty and every motor has stopped
+//   idle_ms        time within that in which no motor moves (holds and waits between moves)
+//   peak_rate      highest step rate of each motor in steps/sec
+//   peak_accel     highest acceleration of each motor in steps/sec^2
+//   sync_error_ms  largest difference between the arrival of stepper1 and stepper2 at the end of a
+//                  move they both take part in
+//
+// Rates and accelerations are measured from the positions the motors actually stepped to, the way
+// the chair would feel them, and not from the commands the motors were given. A motor only has a
+// thousand steps per turn, so the rates are the slopes of lines fitted to RATE_FIT_MILLIS of positions
+// and the accelerations the slopes of lines fitted to ACCELERATION_FIT_MILLIS of rates.
+//
+// With --baseline the results are compared against a stored run. A preset fails when it takes
+// longer, sits idle longer, accelerates harder or arrives less synchronized than the baseline by
+// more than the tolerance. The peak rates are only reported, a faster ride is not a regression.
+// The exit status is 1 when anything failed.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "FastAccelStepper.h"
+#include "Simulator.h"
+#include "MotionScheduler.h"
+#include "AxisConfig.h"
+#include "Homing.h"
+#include "CommandShell.h"
+
+// Sketch functions and state the presets are started through, from MotionSimulationChair.cpp
+void setup();
+void moveMotor(AxisId axis, int16_t position, uint32_t speed, uint32_t acceleration);
+void performFullExperienceMotion();
+void performRollerCoasterSimulation();
+void rumble(int numberOfRumbles);
+void suddenTwist();
+
+// Virtual time of one pass, like the default of chair_sim
+#define PASS_MICROS 100
+
+// The positions are sampled every millisecond for the rates and accelerations
+#define SAMPLE_MICROS 1000
+#define SAMPLE_PASSES (SAMPLE_MICROS / PASS_MICROS)
+
+// Lengths of the fits, an odd number of samples so that each is centred on one
+#define RATE_FIT_MILLIS 21
+#define ACCELERATION_FIT_MILLIS 121
+
+// No preset takes this long, anything that does is stuck
+#define PRESET_TIMEOUT_MICROS 300000000ULL
+
+// Absolute slack on top of the relative tolerance, so that tiny values don't fail on rounding
+#define DURATION_SLACK_MS 1.0
+#define ACCELERATION_SLACK 50.0
+
+#define MOTORS 3
+
+struct Preset {
+  const char *name;
+  void (*start)();
+};
+
+struct Result {
+  std::string name;
+  double durationMs;
+  double idleMs;
+  double peakRate[MOTORS];
+  double peakAcceleration[MOTORS];
+  double syncErrorMs;
+};
+
+static void singleAxis(AxisId axis, int16_t centidegrees) {
+  moveMotor(axis, centidegrees, PitchAxis::fromFullSteps(1000), PitchAxis::fromFullSteps(1000));
+}
+
+static void singlePitch() {
+  singleAxis(AXIS_PITCH, PitchAxis::LIMIT_CENTIDEGREES);
+}
+
+static void singleRoll() {
+  singleAxis(AXIS_ROLL, RollAxis::LIMIT_CENTIDEGREES);
+}
+
+static void singleYaw() {
+  singleAxis(AXIS_YAW, YawAxis::LIMIT_CENTIDEGREES);
+}
+
+static void rumbleTwoSeconds() {
+  rumble(40);
+}
+
+// MOVE for each axis, the full experience, the roller coaster and the two effects
+static const Preset PRESETS[] = {
+  { "single_pitch", singlePitch },
+  { "single_roll", singleRoll },
+  { "single_yaw", singleYaw },
+  { "full_experience", performFullExperienceMotion },
+  { "roller_coaster", performRollerCoasterSimulation },
+  { "rumble", rumbleTwoSeconds },
+  { "sudden_twist", suddenTwist },
+};
+
+static void usage(const char *program) {
+  fprintf(stderr, "usage: %s [--json FILE] [--baseline FILE] [--tolerance PERCENT] [--seed N]\n", program);
+  exit(EXIT_FAILURE);
+}
+
+static bool anyStepperRunning() {
+  for (uint8_t i = 0; i < getStepperCount(); i++) {
+    if (getStepper(i) -> isRunning()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to let the scheduler and the steppers run until everything has stopped
+ * @return false if that did not happen within PRESET_TIMEOUT_MICROS
+ */
+static bool runUntilStill() {
+  uint64_t endAt = getSimulationMicros() + PRESET_TIMEOUT_MICROS;
+
+  while (getSimulationMicros() < endAt) {
+    updateScheduler();
+    if (isSchedulerIdle() && !anyStepperRunning()) {
+      return true;
+    }
+    advanceSimulation(PASS_MICROS);
+  }
+  return false;
+}
+
+/**
+ * Function to fit a straight line to the samples around one sample, by least squares
+ * The slope is an average of the rate of change with positive weights, so it never
+ * reads higher than the steepest part of the window
+ * @param samples values sampled every SAMPLE_MICROS
+ * @param centre the sample to fit around, with half samples on both sides
+ * @return the slope per second
+ */
+static double fitSlope(const std::vector<double> &samples, size_t centre, int half) {
+  double sum = 0;
+  double sumSquares = 0;
+  for (int k = -half; k <= half; k++) {
+    sum += k * samples[centre + k];
+    sumSquares += (double)k * k;
+  }
+  return sum / sumSquares / (SAMPLE_MICROS / 1000000.0);
+}
+
+/**
+ * Function to run one preset from the home position and measure it
+ * The positions of every pass are kept and looked at once the preset has finished
+ */
+static bool runPreset(const Preset &preset, unsigned long seed, Result &result) {
+  std::vector<int32_t> positions[MOTORS];
+  std::vector<bool> running[MOTORS];
+
+  randomSeed(seed);
+  preset.start();
+
+  uint64_t endAt = getSimulationMicros() + PRESET_TIMEOUT_MICROS;
+  bool finished = false;
+
+  while (getSimulationMicros() < endAt) {
+    updateScheduler();
+
+    bool still = isSchedulerIdle();
+    for (uint8_t i = 0; i < MOTORS; i++) {
+      FastAccelStepper *stepper = getStepper(i);
+      positions[i].push_back(stepper -> getCurrentPosition());
+      running[i].push_back(stepper -> isRunning());
+      still = still && !stepper -> isRunning();
+    }
+    if (still) {
+      finished = true;
+      break;
+    }
+    advanceSimulation(PASS_MICROS);
+  }
+
+  size_t passes = positions[0].size();
+  result.name = preset.name;
+  result.durationMs = (passes - 1) * PASS_MICROS / 1000.0;
+  result.idleMs = 0;
+  result.syncErrorMs = 0;
+
+  for (size_t pass = 0; pass + 1 < passes; pass++) {
+    if (!running[0][pass] && !running[1][pass] && !running[2][pass]) {
+      result.idleMs += PASS_MICROS / 1000.0;
+    }
+  }
+
+  // The motors are at rest before and after the preset, so the samples are padded with the end positions
+  const int rateHalf = RATE_FIT_MILLIS / 2;
+  const int accelerationHalf = ACCELERATION_FIT_MILLIS / 2;
+  const int padding = rateHalf + accelerationHalf;
+  for (uint8_t i = 0; i < MOTORS; i++) {
+    std::vector<double> samples(padding, positions[i].front());
+    for (size_t pass = 0; pass < passes; pass += SAMPLE_PASSES) {
+      samples.push_back(positions[i][pass]);
+    }
+    samples.insert(samples.end(), padding, positions[i].back());
+
+    std::vector<double> rates(samples.size(), 0.0);
+    result.peakRate[i] = 0;
+    for (size_t centre = rateHalf; centre + rateHalf < samples.size(); centre++) {
+      rates[centre] = fitSlope(samples, centre, rateHalf);
+      result.peakRate[i] = fmax(result.peakRate[i], fabs(rates[centre]));
+    }
+
+    result.peakAcceleration[i] = 0;
+    for (size_t centre = padding; centre + padding < samples.size(); centre++) {
+      result.peakAcceleration[i] = fmax(result.peakAcceleration[i], fabs(fitSlope(rates, centre, accelerationHalf)));
+    }
+  }
+
+  // A move of the seat lasts as long as either seat motor runs, the motors should make their last steps together
+  size_t lastStep[2] = { 0, 0 };
+  bool moved[2] = { false, false };
+  for (size_t pass = 1; pass < passes; pass++) {
+    for (uint8_t i = 0; i < 2; i++) {
+      if (positions[i][pass] != positions[i][pass - 1]) {
+        lastStep[i] = pass;
+        moved[i] = true;
+      }
+    }
+
+    bool moveOver = !running[0][pass] && !running[1][pass];
+    if (moveOver) {
+      if (moved[0] && moved[1]) {
+        double errorMs = fabs((double)lastStep[0] - (double)lastStep[1]) * PASS_MICROS / 1000.0;
+        result.syncErrorMs = fmax(result.syncErrorMs, errorMs);
+      }
+      moved[0] = false;
+      moved[1] = false;
+    }
+  }
+
+  return finished;
+}
+
+static void writeResults(FILE *file, const std::vector<Result> &results) {
+  fprintf(file, "{\n  \"presets\": [\n");
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result &result = results[i];
+    fprintf(file, "    { \"name\": \"%s\", \"duration_ms\": %.1f, \"idle_ms\": %.1f, ", result.name.c_str(), result.durationMs, result.idleMs);
+    fprintf(file, "\"peak_rate\": [%.0f, %.0f, %.0f], ", result.peakRate[0], result.peakRate[1], result.peakRate[2]);
+    fprintf(file, "\"peak_accel\": [%.0f, %.0f, %.0f], ", result.peakAcceleration[0], result.peakAcceleration[1], result.peakAcceleration[2]);
+    fprintf(file, "\"sync_error_ms\": %.1f }%s\n", result.syncErrorMs, i + 1 < results.size() ? "," : "");
+  }
+  fprintf(file, "  ]\n}\n");
+}
+
+/**
+ * Function to find the numbers of a key in one preset object of a results file
+ * Only reads what writeResults() writes, it is not a general JSON parser
+ * @return false if the key or one of its numbers is missing
+ */
+static bool readNumbers(const std::string &object, const char *key, double *values, uint8_t count) {
+  std::string quoted = std::string("\"") + key + "\"";
+  size_t at = object.find(quoted);
+  if (at == std::string::npos) {
+    return false;
+  }
+  const char *cursor = object.c_str() + at + quoted.size();
+
+  for (uint8_t i = 0; i < count; i++) {
+    cursor += strspn(cursor, " \t\n:[,");
+    char *end;
+    values[i] = strtod(cursor, &end);
+    if (end == cursor) {
+      return false;
+    }
+    cursor = end;
+  }
+  return true;
+}
+
+static bool readBaseline(const char *path, std::vector<Result> &baseline) {
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    perror(path);
+    return false;
+  }
+  std::string text;
+  char buffer[4096];
+  size_t read;
+  while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    text.append(buffer, read);
+  }
+  fclose(file);
+
+  // Every preset is one object inside the presets array
+  size_t at = text.find('[');
+  while (at != std::string::npos && (at = text.find('{', at)) != std::string::npos) {
+    size_t end = text.find('}', at);
+    if (end == std::string::npos) {
+      break;
+    }
+    std::string object = text.substr(at, end - at + 1);
+    at = end;
+
+    size_t nameAt = object.find("\"name\"");
+    size_t open = nameAt == std::string::npos ? nameAt : object.find('"', nameAt + 6);
+    size_t close = open == std::string::npos ? open : object.find('"', open + 1);
+    Result result;
+    if (close == std::string::npos ||
+        !readNumbers(object, "duration_ms", &result.durationMs, 1) ||
+        !readNumbers(object, "idle_ms", &result.idleMs, 1) ||
+        !readNumbers(object, "peak_rate", result.peakRate, MOTORS) ||
+        !readNumbers(object, "peak_accel", result.peakAcceleration, MOTORS) ||
+        !readNumbers(object, "sync_error_ms", &result.syncErrorMs, 1)) {
+      fprintf(stderr, "%s: can't read preset %s\n", path, object.c_str());
+      return false;
+    }
+    result.name = object.substr(open + 1, close - open - 1);
+    baseline.push_back(result);
+  }
+  return true;
+}
+
+static bool worse(const char *preset, const char *metric, double now, double before, double tolerance, double slack) {
+  if (now <= before * (1 + tolerance) + slack) {
+    return false;
+  }
+  printf("REGRESSION %s %s: %.1f, baseline %.1f (%+.1f%%)\n", preset, metric, now, before,
+         before > 0 ? (now / before - 1) * 100 : 100.0);
+  return true;
+}
+
+/**
+ * Function to compare a run against the baseline
+ * @return the number of regressions, presets missing from either side count as one
+ */
+static int compareResults(const std::vector<Result> &results, const std::vector<Result> &baseline, double tolerance) {
+  int regressions = 0;
+
+  for (const Result &result : results) {
+    const Result *before = nullptr;
+    for (const Result &candidate : baseline) {
+      if (candidate.name == result.name) {
+        before = &candidate;
+      }
+    }
+    if (!before) {
+      printf("MISSING %s is not in the baseline\n", result.name.c_str());
+      regressions++;
+      continue;
+    }
+
+    const char *name = result.name.c_str();
+    regressions += worse(name, "duration_ms", result.durationMs, before -> durationMs, tolerance, DURATION_SLACK_MS);
+    regressions += worse(name, "idle_ms", result.idleMs, before -> idleMs, tolerance, DURATION_SLACK_MS);
+    regressions += worse(name, "sync_error_ms", result.syncErrorMs, before -> syncErrorMs, tolerance, DURATION_SLACK_MS);
+    for (uint8_t i = 0; i < MOTORS; i++) {
+      char metric[32];
+      snprintf(metric, sizeof(metric), "peak_accel[%u]", i);
+      regressions += worse(name, metric, result.peakAcceleration[i], before -> peakAcceleration[i], tolerance, ACCELERATION_SLACK);
+    }
+  }
+
+  for (const Result &before : baseline) {
+    bool found = false;
+    for (const Result &result : results) {
+      found = found || result.name == before.name;
+    }
+    if (!found) {
+      printf("MISSING %s is in the baseline but was not run\n", before.name.c_str());
+      regressions++;
+    }
+  }
+  return regressions;
+}
+
+int main(int argc, char **argv) {
+  const char *jsonPath = nullptr;
+  const char *baselinePath = nullptr;
+  double tolerance = 0.05;
+  unsigned long seed = 1;
+
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--json") == 0) {
+      jsonPath = value;
+    } else if (strcmp(option, "--baseline") == 0) {
+      baselinePath = value;
+    } else if (strcmp(option, "--tolerance") == 0) {
+      tolerance = atof(value) / 100;
+    } else if (strcmp(option, "--seed") == 0) {
+      seed = strtoul(value, nullptr, 10);
+    } else {
+      usage(argv[0]);
+    }
+    i++;
+  }
+
+  // Read the baseline first so that a broken one fails before the presets run
+  std::vector<Result> baseline;
+  if (baselinePath && !readBaseline(baselinePath, baseline)) {
+    return EXIT_FAILURE;
+  }
+
+  // The segment messages of the presets aren't needed
+  // The EEPROM starts out erased, so setup() homes against the switches first
+  setSerialOutput(fopen("/dev/null", "w"));
+  addHomeSwitch(STEPPER1_HOME_PIN, 6, homeSwitchPosition<Stepper1Axis>());
+  addHomeSwitch(STEPPER2_HOME_PIN, 7, homeSwitchPosition<Stepper2Axis>());
+  addHomeSwitch(STEPPER3_HOME_PIN, 8, homeSwitchPosition<Stepper3Axis>());
+  setup();
+
+  std::vector<Result> results;
+  int failures = 0;
+
+  printf("%-16s %11s %9s %19s %22s %8s\n", "preset", "duration_ms", "idle_ms", "peak_rate", "peak_accel", "sync_ms");
+  for (const Preset &preset : PRESETS) {
+    Result result;
+    if (!runPreset(preset, seed, result)) {
+      printf("STUCK %s did not finish\n", preset.name);
+      failures++;
+    }
+    results.push_back(result);
+
+    printf("%-16s %11.1f %9.1f %6.0f %6.0f %5.0f %7.0f %7.0f %6.0f %8.1f\n", result.name.c_str(), result.durationMs, result.idleMs,
+           result.peakRate[0], result.peakRate[1], result.peakRate[2],
+           result.peakAcceleration[0], result.peakAcceleration[1], result.peakAcceleration[2], result.syncErrorMs);
+
+    // Every preset starts from home, moving back there is not part of the measurement
+    scheduleMoveTo(ALL_STEPPERS_MASK, 0, 0, 0, ALL_STEPPERS_MASK, 0);
+    if (!runUntilStill()) {
+      printf("STUCK %s did not return home\n", preset.name);
+      failures++;
+    }
+  }
+
+  if (jsonPath) {
+    FILE *file = fopen(jsonPath, "w");
+    if (!file) {
+      perror(jsonPath);
+      return EXIT_FAILURE;
+    }
+    writeResults(file, results);
+    fclose(file);
+  }
+
+  if (baselinePath) {
+    failures += compareResults(results, baseline, tolerance);
+    printf("%s against %s (tolerance %.0f%%)\n", failures ? "FAILED" : "PASSED", baselinePath, tolerance * 100);
+  }
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,247 @@
+// Compiles ride scripts written as CSV into RideLibrary.cpp, see RideScript.h for the binary format
+//
+//   make -C host ride_compiler
+//   ./ride_compiler ../RideLibrary.cpp rides/*.csv
+//
+// A ride script has one keyframe per line:
+//
+//   # name: Roller Coaster
+//   time,pitch,roll,yaw,speed,accel,curve,effect
+//   0,    0,   0,  0, 1000, 1000,  , gravel
+//   1.5, -30,  0,  0,     ,     , 1
+//
+// time is when the move starts in seconds from the start of the ride, pitch, roll and yaw are the pose in
+// degrees, speed and accel are the caps of the move in full steps/sec and full steps/sec^2, and curve set to 1
+// makes the move a jerk-limited S-curve. An empty speed or accel keeps the one of the keyframe before.
+// effect starts one of the effects of Effects.h with the move: gravel, engine, bump, or stop to end them all.
+// Lines starting with # are comments, a "# name:" comment names the ride.
+//
+// A "# precompile" comment also compiles the ride into a step track, see StepTrack.h and TrackCompiler.h. The
+// sketch then plays the ride by copying step commands into the queues of the motors instead of working out the
+// ramps while it runs. A track takes a few bytes per step, so it is meant for the dense rides.
+//
+// Every compiled ride is decoded again with the decoder of the sketch and compared with the CSV, and every step
+// track with the reader of the sketch and compared with the planned commands.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../RideScript.h"
+#include "RideCsv.h"
+#include "TrackCompiler.h"
+
+struct Ride {
+  std::string name;
+  std::string source;
+  std::vector<RideKeyframe> keyframes;
+  std::vector<uint8_t> script;
+  bool precompile = false;
+  std::vector<uint8_t> track;
+  TrackStats trackStats;
+};
+
+static void fail(const std::string &where, const std::string &message) {
+  fprintf(stderr, "%s: %s\n", where.c_str(), message.c_str());
+  exit(EXIT_FAILURE);
+}
+
+static Ride readRide(const std::string &path) {
+  RideCsv csv = readRideCsv(path);
+  Ride ride;
+  ride.name = csv.name;
+  ride.source = csv.source;
+  ride.keyframes = csv.keyframes;
+  ride.precompile = csv.precompile;
+  return ride;
+}
+
+static void appendVarint(std::vector<uint8_t> &script, uint32_t value) {
+  uint8_t buffer[5];
+  uint8_t length = writeVarint(buffer, value);
+  script.insert(script.end(), buffer, buffer + length);
+}
+
+static void encodeRide(Ride &ride) {
+  std::vector<uint8_t> &script = ride.script;
+  uint16_t count = ride.keyframes.size();
+
+  script.push_back(RIDE_MAGIC_0);
+  script.push_back(RIDE_MAGIC_1);
+  script.push_back(RIDE_VERSION);
+  script.push_back(count & 0xFF);
+  script.push_back(count >> 8);
+  script.push_back(ride.name.size());
+  script.insert(script.end(), ride.name.begin(), ride.name.end());
+
+  RideKeyframe previous = { 0, 0, 0, 0, 0, 0, false, RIDE_NO_EFFECT };
+  for (const RideKeyframe &keyframe : ride.keyframes) {
+    uint8_t flags = 0;
+    if (keyframe.pitch != previous.pitch) flags |= KEYFRAME_PITCH;
+    if (keyframe.roll != previous.roll) flags |= KEYFRAME_ROLL;
+    if (keyframe.yaw != previous.yaw) flags |= KEYFRAME_YAW;
+    if (keyframe.speed != previous.speed) flags |= KEYFRAME_SPEED;
+    if (keyframe.acceleration != previous.acceleration) flags |= KEYFRAME_ACCELERATION;
+    if (keyframe.curve) flags |= KEYFRAME_CURVE;
+    if (keyframe.effect != RIDE_NO_EFFECT) flags |= KEYFRAME_EFFECT;
+
+    script.push_back(flags);
+    appendVarint(script, keyframe.timeMs - previous.timeMs);
+    if (flags & KEYFRAME_PITCH) appendVarint(script, zigzagEncode(keyframe.pitch - previous.pitch));
+    if (flags & KEYFRAME_ROLL) appendVarint(script, zigzagEncode(keyframe.roll - previous.roll));
+    if (flags & KEYFRAME_YAW) appendVarint(script, zigzagEncode(keyframe.yaw - previous.yaw));
+    if (flags & KEYFRAME_SPEED) appendVarint(script, keyframe.speed);
+    if (flags & KEYFRAME_ACCELERATION) appendVarint(script, keyframe.acceleration);
+    if (flags & KEYFRAME_EFFECT) appendVarint(script, keyframe.effect);
+    previous = keyframe;
+  }
+
+  if (script.size() > 65535) {
+    fail(ride.source, "compiles to more than 64 KB");
+  }
+}
+
+/**
+ * Function to decode a compiled ride with the decoder of the sketch and compare it with the CSV
+ */
+static void verifyRide(const Ride &ride) {
+  RideDecoder decoder;
+  if (!openRide(decoder, ride.script.data())) {
+    fail(ride.source, "the compiled header does not decode");
+  }
+
+  char name[RIDE_NAME_LENGTH + 1];
+  getRideName(ride.script.data(), name, sizeof(name));
+  if (ride.name != name || getRideKeyframeCount(ride.script.data()) != ride.keyframes.size()) {
+    fail(ride.source, "the compiled header does not match");
+  }
+
+  for (const RideKeyframe &expected : ride.keyframes) {
+    if (!nextKeyframe(decoder)) {
+      fail(ride.source, "the compiled ride ends early");
+    }
+    const RideKeyframe &decoded = decoder.keyframe;
+    if (decoded.timeMs != expected.timeMs || decoded.pitch != expected.pitch || decoded.roll != expected.roll ||
+        decoded.yaw != expected.yaw || decoded.speed != expected.speed || decoded.acceleration != expected.acceleration ||
+        decoded.curve != expected.curve || decoded.effect != expected.effect) {
+      fail(ride.source, "keyframe at " + std::to_string(expected.timeMs) + " ms does not decode to the same values");
+    }
+  }
+  if (nextKeyframe(decoder) || decoder.offset != ride.script.size()) {
+    fail(ride.source, "the compiled ride has bytes left over");
+  }
+}
+
+static void writeLibrary(const std::string &path, const std::vector<Ride> &rides) {
+  FILE *out = fopen(path.c_str(), "w");
+  if (!out) {
+    fail(path, "can't be written");
+  }
+
+  fprintf(out, "// Generated by host/ride_compiler.cpp, edit the ride scripts instead and compile them again\n");
+  fprintf(out, "// Sources:");
+  for (const Ride &ride : rides) {
+    fprintf(out, " %s", ride.source.c_str());
+  }
+  fprintf(out, "\n\n#include \"RideLibrary.h\"\n");
+
+  for (size_t i = 0; i < rides.size(); i++) {
+    const Ride &ride = rides[i];
+    fprintf(out, "\n// %s: %zu keyframes, %.1f s, %zu bytes\n", ride.name.c_str(), ride.keyframes.size(),
+            ride.keyframes.back().timeMs / 1000.0, ride.script.size());
+    fprintf(out, "static const uint8_t RIDE_%zu[] PROGMEM = {", i);
+    for (size_t j = 0; j < ride.script.size(); j++) {
+      fprintf(out, "%s0x%02X,", j % 16 == 0 ? "\n  " : " ", ride.script[j]);
+    }
+    fprintf(out, "\n};\n");
+
+    if (ride.precompile) {
+      const TrackStats &stats = ride.trackStats;
+      fprintf(out, "\n// %s as a step track: %u + %u + %u steps, %u + %u + %u queue entries, %zu bytes\n", ride.name.c_str(),
+              stats.steps[0], stats.steps[1], stats.steps[2], stats.commands[0], stats.commands[1], stats.commands[2],
+              ride.track.size());
+      fprintf(out, "static const uint8_t TRACK_%zu[] PROGMEM = {", i);
+      for (size_t j = 0; j < ride.track.size(); j++) {
+        fprintf(out, "%s0x%02X,", j % 16 == 0 ? "\n  " : " ", ride.track[j]);
+      }
+      fprintf(out, "\n};\n");
+    }
+  }
+
+  fprintf(out, "\nstatic const uint8_t *const RIDES[] PROGMEM = {\n");
+  for (size_t i = 0; i < rides.size(); i++) {
+    fprintf(out, "  RIDE_%zu,\n", i);
+  }
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "static const uint8_t *const TRACKS[] PROGMEM = {\n");
+  for (size_t i = 0; i < rides.size(); i++) {
+    if (rides[i].precompile) {
+      fprintf(out, "  TRACK_%zu,\n", i);
+    } else {
+      fprintf(out, "  nullptr,\n");
+    }
+  }
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "uint8_t getRideCount() {\n");
+  fprintf(out, "  return sizeof(RIDES) / sizeof(RIDES[0]);\n");
+  fprintf(out, "}\n\n");
+  fprintf(out, "/**\n * Function to get a ride script in flash\n * @param index 0 to getRideCount() - 1\n */\n");
+  fprintf(out, "const uint8_t *getRide(uint8_t index) {\n");
+  fprintf(out, "#ifdef __AVR__\n");
+  fprintf(out, "  return (const uint8_t *)pgm_read_word(&RIDES[index]);\n");
+  fprintf(out, "#else\n");
+  fprintf(out, "  return RIDES[index];\n");
+  fprintf(out, "#endif\n");
+  fprintf(out, "}\n\n");
+  fprintf(out, "/**\n * Function to get the step track a ride was precompiled into\n * @param index 0 to getRideCount() - 1\n");
+  fprintf(out, " * @return the track in flash, or nullptr if the ride is only a script\n */\n");
+  fprintf(out, "const uint8_t *getRideTrack(uint8_t index) {\n");
+  fprintf(out, "#ifdef __AVR__\n");
+  fprintf(out, "  return (const uint8_t *)pgm_read_word(&TRACKS[index]);\n");
+  fprintf(out, "#else\n");
+  fprintf(out, "  return TRACKS[index];\n");
+  fprintf(out, "#endif\n");
+  fprintf(out, "}\n");
+  fclose(out);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s RideLibrary.cpp ride.csv ...\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (argc - 2 > 255) {
+    fail(argv[1], "more than 255 rides");
+  }
+
+  std::vector<Ride> rides;
+  size_t total = 0;
+  for (int i = 2; i < argc; i++) {
+    Ride ride = readRide(argv[i]);
+    encodeRide(ride);
+    verifyRide(ride);
+    total += ride.script.size();
+    printf("%-24s %5zu keyframes %7.1f s %6zu bytes\n", ride.name.c_str(), ride.keyframes.size(),
+           ride.keyframes.back().timeMs / 1000.0, ride.script.size());
+
+    if (ride.precompile) {
+      std::string error;
+      if (!compileStepTrack(ride.keyframes, ride.track, ride.trackStats, error)) {
+        fail(ride.source, error);
+      }
+      const TrackStats &stats = ride.trackStats;
+      total += ride.track.size();
+      printf("%-24s %5u steps     %7.1f s %6zu bytes as a step track, %u steps retimed\n", "", stats.steps[0] + stats.steps[1] + stats.steps[2],
+             stats.durationMs / 1000.0, ride.track.size(), stats.retimedSteps);
+    }
+    rides.push_back(ride);
+  }
+
+  writeLibrary(argv[1], rides);
+  printf("%zu rides, %zu bytes of flash\n", rides.size(), total);
+  return EXIT_SUCCESS;
+}
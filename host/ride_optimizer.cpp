@@ -0,0 +1,628 @@
+// Searches the speeds, accelerations and times of a ride script for a ride that keeps to its timeline, or a shorter one
+//
+//   make -C host ride_optimizer
+//   host/ride_optimizer rides/ocean_waves.csv --out rides/ocean_waves.csv
+//   host/ride_optimizer rides/roller_coaster.csv --stretch 0.8 --out /tmp/faster_coaster.csv
+//
+// The speeds and accelerations of a ride are picked by hand, and whether a move fills the time to the next keyframe,
+// or doesn't make it there in time, only shows on the chair. The optimizer plays candidate rides on the model the
+// ride compiler plans step tracks with instead (planMoveTicks() in TrackCompiler.h): a move starts at the time of its
+// keyframe or when the move before it has arrived, trapezoids are synchronized and S-curves are cut into the slices
+// of the sketch, exact to the tick of the step timer. The model keeps no state, so the same candidates always make
+// the same ride.
+//
+// Dead time is the chair standing still between two moves. A pause of at least --keep-pause-ms in the ride as written
+// is taken to be meant, like the hold at the bottom of a drop, and is kept. Anything else is slack: a move that
+// dashes to its pose and waits there for the next keyframe.
+//
+// It works in one of two ways:
+//   timeline   (the default) the keyframes keep the times of the ride, or those of --stretch or --target. A move that
+//              would still be running when the next keyframe is due is sped up until it isn't, so the ride doesn't
+//              fall behind its timeline, and a move with slack is slowed down until it fills the time up to the
+//              pause kept after it. A ride of short moves with waits in between turns into one flowing motion.
+//   compact    with --compact every keyframe starts as soon as the move before it has arrived and the pause kept
+//              before it is over, and every move gets the speed and acceleration that make it shortest, which makes
+//              the ride as short as it can be.
+// Of the speeds and accelerations that do equally well, a move keeps the ones closest to those picked by hand, so a
+// move that is only held back by its acceleration keeps its speed, and a move that already fits stays as it was.
+//
+// The limits of the search:
+//   --speed N  fastest speed of any move in full steps/sec, by default the fastest of the ride as written
+//   --accel N  hardest acceleration of any move in full steps/sec^2, by default the hardest of the ride as written
+//   --jerk N   jerk budget of the trapezoid moves in full steps/sec^2. A trapezoid switches its acceleration on and
+//              off at once (SCurve.h), a jolt of the whole acceleration, so this is the hardest acceleration a
+//              trapezoid may use, by default the hardest trapezoid of the ride as written. S-curve moves build
+//              their acceleration up at the jerk limits of AxisConfig.h and only count against --accel.
+// None of them can be set past the limits of the axes in AxisConfig.h. The poses are never changed, and each move
+// only goes from one pose to the next, so every motor stays within the positions of the keyframes. A keyframe that
+// mixes pitch and roll past the limits of a seat motor is reported, the sketch stops that motor at its limit and so
+// does the model.
+//
+// The search goes over the keyframes in order and plays the whole ride with every pair from a ladder of speeds and
+// accelerations, a quarter octave apart from a sixteenth of the hand-picked value up to the limit, keeping the best
+// pair, until a pass over the ride changes nothing. The candidates of a keyframe are played on a pool of worker
+// threads, one per core. Every result is kept by its candidate and compared in order afterwards, so the ride that
+// comes out is the same with any number of threads.
+//
+// Options:
+//   --out FILE          write the optimized ride there, in the layout and with the comments of the input
+//   --stretch F         keep to the times of the ride scaled by F, 0.8 plays it in four fifths of the time
+//   --target FILE       keep to the times in FILE, one per keyframe in seconds, lines starting with # are comments
+//   --compact           make the ride as short as it can be instead of keeping to a timeline
+//   --keep-pause-ms MS  shortest pause that is kept as meant, 0 takes every pause for slack (1500)
+//   --speed N, --accel N, --jerk N
+//                       limits of the search, see above
+//   --threads N         worker threads (one per core)
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../AxisConfig.h"
+#include "../Kinematics.h"
+#include "../RideScript.h"
+#include "../SCurve.h"
+#include "RideCsv.h"
+#include "TrackCompiler.h"
+
+#define TICKS_PER_MS (SCURVE_TICKS_PER_SECOND / 1000)
+
+// Candidate speeds and accelerations per doubling, and how many doublings below the hand-picked value they start
+#define LADDER_STEPS_PER_OCTAVE 4
+#define LADDER_OCTAVES_BELOW 4
+
+// Differences shorter than this in how long a move takes or the slack after it aren't felt, within them a move keeps
+// the values closest to the hand-picked ones. Being late is compared to the tick, it adds up over the ride.
+#define TIMING_RESOLUTION_MS 50
+#define TIMING_RESOLUTION_TICKS (TIMING_RESOLUTION_MS * TICKS_PER_MS)
+
+// A pass that still changes something after this many is cut off, each pass only makes the ride better
+#define MAX_PASSES 20
+
+// Fastest speed and hardest acceleration a ride script can ask for, in full steps
+#define SCRIPT_MAX_SPEED (PitchAxis::MAX_SPEED / MICROSTEPS)
+#define SCRIPT_MAX_ACCELERATION (PitchAxis::MAX_ACCELERATION / MICROSTEPS)
+
+struct SearchLimits {
+  uint16_t speed;
+  uint16_t acceleration;
+  uint16_t jerk; // Hardest acceleration of a trapezoid move
+};
+
+// The ride the search works on, shared read-only by the workers
+struct RideProblem {
+  std::vector<RideKeyframe> written; // As picked by hand
+  std::vector<MotorTargets> poses;   // Motor positions of every keyframe
+  bool compact;
+  std::vector<int64_t> due;          // When each keyframe is due on the timeline, in ticks
+  std::vector<int64_t> pause;        // Pause kept before each keyframe, in ticks
+  SearchLimits limits;
+};
+
+// What a ride comes to on the model, in ticks
+struct RideTiming {
+  int64_t end;   // When the last move arrives
+  int64_t late;  // How long after their time the keyframes start, summed
+  int64_t dead;  // How long the chair stands still between moves, summed
+  int64_t slack; // The dead time that isn't a kept pause
+
+  // What the search compares, summed over the moves in whole TIMING_RESOLUTION_MS
+  int64_t feltLength;
+  int64_t feltSlack;
+};
+
+// How good a candidate is: first what the search is for, then how far it is from the hand-picked values
+struct CandidateScore {
+  int64_t first;  // Compact: the length of the moves, timeline: how late they start
+  int64_t second; // The slack
+  double change;
+};
+
+// Worker threads that play the candidates of one keyframe at a time
+struct WorkerPool {
+  std::vector<std::thread> threads;
+  std::mutex mutex;
+  std::condition_variable started;
+  std::condition_variable finished;
+  const std::function<void(size_t)> *job = nullptr;
+  size_t size = 0;
+  std::atomic<size_t> next;
+  size_t busy = 0;
+  uint64_t batch = 0;
+  bool stopping = false;
+};
+
+static void usage(const char *program) {
+  fprintf(stderr, "usage: %s ride.csv [--out FILE] [--stretch F | --target FILE | --compact] [--keep-pause-ms MS]\n", program);
+  fprintf(stderr, "       [--speed N] [--accel N] [--jerk N] [--threads N]\n");
+  exit(EXIT_FAILURE);
+}
+
+static void fail(const std::string &where, const std::string &message) {
+  fprintf(stderr, "%s: %s\n", where.c_str(), message.c_str());
+  exit(EXIT_FAILURE);
+}
+
+static void workerLoop(WorkerPool *pool) {
+  uint64_t seen = 0;
+  std::unique_lock<std::mutex> lock(pool->mutex);
+  while (true) {
+    pool->started.wait(lock, [&] { return pool->stopping || pool->batch != seen; });
+    if (pool->stopping) {
+      return;
+    }
+    seen = pool->batch;
+    lock.unlock();
+
+    for (size_t i = pool->next++; i < pool->size; i = pool->next++) {
+      (*pool->job)(i);
+    }
+
+    lock.lock();
+    if (--pool->busy == 0) {
+      pool->finished.notify_one();
+    }
+  }
+}
+
+static void startPool(WorkerPool &pool, unsigned threads) {
+  for (unsigned i = 0; i < threads; i++) {
+    pool.threads.push_back(std::thread(workerLoop, &pool));
+  }
+}
+
+/**
+ * Function to run a job for every index of a batch on the workers and wait until all of them are done
+ * The workers take the indices in turns, so the job has to keep its results by index
+ */
+static void runPool(WorkerPool &pool, size_t size, const std::function<void(size_t)> &job) {
+  std::unique_lock<std::mutex> lock(pool.mutex);
+  pool.job = &job;
+  pool.size = size;
+  pool.next = 0;
+  pool.busy = pool.threads.size();
+  pool.batch++;
+  pool.started.notify_all();
+  pool.finished.wait(lock, [&] { return pool.busy == 0; });
+}
+
+static void stopPool(WorkerPool &pool) {
+  {
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.stopping = true;
+  }
+  pool.started.notify_all();
+  for (std::thread &thread : pool.threads) {
+    thread.join();
+  }
+}
+
+/**
+ * Function to work out how long the move to a keyframe takes on the model
+ * @param problem the ride
+ * @param index the keyframe
+ * @param keyframe the keyframe with the speed and acceleration to try
+ */
+static int64_t moveTicks(const RideProblem &problem, size_t index, const RideKeyframe &keyframe) {
+  static const MotorTargets LEVEL = { { 0, 0, 0 } };
+  const MotorTargets &from = index == 0 ? LEVEL : problem.poses[index - 1];
+  return planMoveTicks(from.position, problem.poses[index].position, keyframe);
+}
+
+/**
+ * Function to play a ride on the model
+ * In a compact ride a keyframe is due once the move before it has arrived, on the next millisecond as the times of a
+ * script are in milliseconds, and the pause kept before it is over
+ * @param problem the ride
+ * @param durations how long every move takes
+ * @param changed a keyframe to play with another duration, or SIZE_MAX
+ * @param duration the other duration
+ * @param dues set to when every keyframe is due, can be nullptr
+ */
+static RideTiming playRide(const RideProblem &problem, const std::vector<int64_t> &durations, size_t changed, int64_t duration,
+                           std::vector<int64_t> *dues) {
+  RideTiming timing = { 0, 0, 0, 0, 0, 0 };
+  int64_t arrival = 0;
+
+  for (size_t i = 0; i < durations.size(); i++) {
+    int64_t due = problem.due[i];
+    if (problem.compact && i > 0) {
+      due = (arrival + TICKS_PER_MS - 1) / TICKS_PER_MS * TICKS_PER_MS + problem.pause[i];
+    }
+
+    int64_t start = std::max(due, arrival);
+    timing.late += start - due;
+    if (i > 0) {
+      int64_t slack = std::max(start - arrival - problem.pause[i], (int64_t)0);
+      timing.dead += start - arrival;
+      timing.slack += slack;
+      timing.feltSlack += slack / TIMING_RESOLUTION_TICKS;
+    }
+    if (dues) {
+      dues->push_back(due);
+    }
+
+    int64_t length = i == changed ? duration : durations[i];
+    timing.feltLength += (length + TIMING_RESOLUTION_TICKS - 1) / TIMING_RESOLUTION_TICKS;
+    arrival = start + length;
+  }
+  timing.end = arrival;
+  return timing;
+}
+
+/**
+ * Function to get how far a speed and acceleration are from the hand-picked ones, in factors rather than steps
+ */
+static double changeFrom(const RideKeyframe &written, uint16_t speed, uint16_t acceleration) {
+  return fabs(log((double)speed / written.speed)) + fabs(log((double)acceleration / written.acceleration));
+}
+
+/**
+ * Function to make the values a speed or acceleration is tried with
+ * @param picked the hand-picked value, the ladder is laid out around it, or around the limit if that is lower
+ * @param limit the largest value
+ */
+static std::vector<uint16_t> makeLadder(uint16_t picked, uint16_t limit) {
+  std::vector<uint16_t> ladder;
+  picked = std::min(picked, limit);
+  for (int step = -LADDER_OCTAVES_BELOW * LADDER_STEPS_PER_OCTAVE;; step++) {
+    long value = std::max(lround(picked * pow(2.0, (double)step / LADDER_STEPS_PER_OCTAVE)), 1L);
+    if (value >= limit) {
+      break;
+    }
+    if (ladder.empty() || ladder.back() != value) {
+      ladder.push_back(value);
+    }
+  }
+  ladder.push_back(limit);
+  return ladder;
+}
+
+static uint16_t accelerationLimit(const SearchLimits &limits, const RideKeyframe &keyframe) {
+  return keyframe.curve ? limits.acceleration : std::min(limits.acceleration, limits.jerk);
+}
+
+static bool isBetter(const CandidateScore &score, const CandidateScore &than) {
+  if (score.first != than.first) {
+    return score.first < than.first;
+  }
+  if (score.second != than.second) {
+    return score.second < than.second;
+  }
+  return score.change < than.change;
+}
+
+/**
+ * Function to search the speed and acceleration of every keyframe, see the top of the file
+ * @param keyframes the ride to start from, changed into the best one found
+ * @param candidates set to the number of candidates played
+ * @return the number of passes over the ride
+ */
+static int searchRide(const RideProblem &problem, std::vector<RideKeyframe> &keyframes, WorkerPool &pool, uint64_t &candidates) {
+  std::vector<int64_t> durations;
+  for (size_t i = 0; i < keyframes.size(); i++) {
+    durations.push_back(moveTicks(problem, i, keyframes[i]));
+  }
+
+  candidates = 0;
+  int passes = 0;
+  bool changed = true;
+  while (changed && passes < MAX_PASSES) {
+    changed = false;
+    passes++;
+
+    for (size_t index = 0; index < keyframes.size(); index++) {
+      const RideKeyframe &written = problem.written[index];
+      std::vector<uint16_t> speeds = makeLadder(written.speed, problem.limits.speed);
+      std::vector<uint16_t> accelerations = makeLadder(written.acceleration, accelerationLimit(problem.limits, written));
+      std::vector<CandidateScore> scores(speeds.size() * accelerations.size());
+
+      std::function<void(size_t)> play = [&](size_t candidate) {
+        RideKeyframe keyframe = keyframes[index];
+        keyframe.speed = speeds[candidate / accelerations.size()];
+        keyframe.acceleration = accelerations[candidate % accelerations.size()];
+        RideTiming timing = playRide(problem, durations, index, moveTicks(problem, index, keyframe), nullptr);
+        scores[candidate].first = problem.compact ? timing.feltLength : timing.late;
+        scores[candidate].second = timing.feltSlack;
+        scores[candidate].change = changeFrom(written, keyframe.speed, keyframe.acceleration);
+      };
+      runPool(pool, scores.size(), play);
+      candidates += scores.size();
+
+      size_t best = 0;
+      for (size_t i = 1; i < scores.size(); i++) {
+        if (isBetter(scores[i], scores[best])) {
+          best = i;
+        }
+      }
+
+      uint16_t speed = speeds[best / accelerations.size()];
+      uint16_t acceleration = accelerations[best % accelerations.size()];
+      if (speed != keyframes[index].speed || acceleration != keyframes[index].acceleration) {
+        keyframes[index].speed = speed;
+        keyframes[index].acceleration = acceleration;
+        durations[index] = moveTicks(problem, index, keyframes[index]);
+        changed = true;
+      }
+    }
+  }
+  return passes;
+}
+
+/**
+ * Function to play a ride on the model with the keyframes it has
+ * @param dues set to when every keyframe is due, can be nullptr
+ */
+static RideTiming timeRide(const RideProblem &problem, const std::vector<RideKeyframe> &keyframes, std::vector<int64_t> *dues) {
+  std::vector<int64_t> durations;
+  for (size_t i = 0; i < keyframes.size(); i++) {
+    durations.push_back(moveTicks(problem, i, keyframes[i]));
+  }
+  return playRide(problem, durations, SIZE_MAX, 0, dues);
+}
+
+/**
+ * Function to read the times of a target timeline, one per line in seconds
+ */
+static std::vector<int64_t> readTargets(const char *path) {
+  std::ifstream file(path);
+  if (!file) {
+    fail(path, "can't be opened");
+  }
+
+  std::vector<int64_t> targets;
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(file, line)) {
+    lineNumber++;
+    size_t first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#') {
+      continue;
+    }
+    char *end = nullptr;
+    double seconds = strtod(line.c_str() + first, &end);
+    if (end == line.c_str() + first || strspn(end, " \t\r") != strlen(end) || seconds < 0) {
+      fail(std::string(path) + ":" + std::to_string(lineNumber), "expected a time in seconds");
+    }
+    targets.push_back(llround(seconds * 1000) * TICKS_PER_MS);
+  }
+  return targets;
+}
+
+/**
+ * Function to check that a timeline can be written as a ride script
+ */
+static void checkTimeline(const std::string &where, const std::vector<int64_t> &due) {
+  for (size_t i = 1; i < due.size(); i++) {
+    if (due[i] < due[i - 1]) {
+      fail(where, "the times have to be in order");
+    }
+    if (due[i] - due[i - 1] > 65535 * (int64_t)TICKS_PER_MS) {
+      fail(where, "keyframes more than 65 seconds apart");
+    }
+  }
+}
+
+/**
+ * Function to report the keyframes whose pose is past the limits of a motor
+ */
+static void checkEnvelope(const RideCsv &ride, const std::vector<MotorTargets> &poses) {
+  for (size_t i = 0; i < ride.keyframes.size(); i++) {
+    const RideKeyframe &keyframe = ride.keyframes[i];
+    int32_t pitch = PitchAxis::toSteps(keyframe.pitch);
+    int32_t roll = RollAxis::toSteps(keyframe.roll);
+    int32_t mixed[2] = { pitch + roll, pitch - roll };
+    for (uint8_t motor = 0; motor < 2; motor++) {
+      if (mixed[motor] != poses[i].position[motor]) {
+        printf("  the keyframe at %.3f s mixes pitch and roll past the limits of stepper%u, it stops there\n",
+               keyframe.timeMs / 1000.0, motor + 1);
+      }
+    }
+  }
+}
+
+static void printTiming(const char *label, const RideTiming &timing) {
+  printf("  %-14s %8.2f s %8.2f s %8.2f s %8.2f s\n", label, timing.end / (double)SCURVE_TICKS_PER_SECOND,
+         timing.dead / (double)SCURVE_TICKS_PER_SECOND, timing.slack / (double)SCURVE_TICKS_PER_SECOND,
+         timing.late / (double)SCURVE_TICKS_PER_SECOND);
+}
+
+/**
+ * Function to read a limit of the search and check it against the axes
+ */
+static uint16_t parseLimit(const char *value, uint32_t axisLimit, const char *option) {
+  long limit = atol(value);
+  if (limit < 1 || limit > (long)axisLimit) {
+    fail(option, "has to be between 1 and " + std::to_string(axisLimit) + ", the limit of the axes");
+  }
+  return limit;
+}
+
+int main(int argc, char **argv) {
+  const char *ridePath = nullptr;
+  const char *outPath = nullptr;
+  const char *targetPath = nullptr;
+  double stretch = 0;
+  bool compact = false;
+  int64_t keepPauseMs = 1500;
+  SearchLimits limits = { 0, 0, 0 };
+  unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+    if (option[0] != '-' && !ridePath) {
+      ridePath = option;
+    } else if (strcmp(option, "--compact") == 0) {
+      compact = true;
+    } else if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--out") == 0) {
+      outPath = value;
+      i++;
+    } else if (strcmp(option, "--stretch") == 0) {
+      stretch = atof(value);
+      i++;
+    } else if (strcmp(option, "--target") == 0) {
+      targetPath = value;
+      i++;
+    } else if (strcmp(option, "--keep-pause-ms") == 0) {
+      keepPauseMs = atol(value);
+      i++;
+    } else if (strcmp(option, "--speed") == 0) {
+      limits.speed = parseLimit(value, SCRIPT_MAX_SPEED, option);
+      i++;
+    } else if (strcmp(option, "--accel") == 0) {
+      limits.acceleration = parseLimit(value, SCRIPT_MAX_ACCELERATION, option);
+      i++;
+    } else if (strcmp(option, "--jerk") == 0) {
+      limits.jerk = parseLimit(value, SCRIPT_MAX_ACCELERATION, option);
+      i++;
+    } else if (strcmp(option, "--threads") == 0) {
+      threads = std::max(1, atoi(value));
+      i++;
+    } else {
+      usage(argv[0]);
+    }
+  }
+  if (!ridePath || (targetPath != nullptr) + (stretch != 0) + compact > 1 || stretch < 0 || keepPauseMs < 0) {
+    usage(argv[0]);
+  }
+
+  RideCsv ride = readRideCsv(ridePath);
+  RideProblem problem;
+  problem.written = ride.keyframes;
+  problem.compact = false;
+  for (const RideKeyframe &keyframe : ride.keyframes) {
+    problem.poses.push_back(mixPose(keyframe.pitch, keyframe.roll, keyframe.yaw));
+    problem.due.push_back((int64_t)keyframe.timeMs * TICKS_PER_MS);
+    problem.pause.push_back(0);
+  }
+
+  // The limits that aren't given are the hardest the ride already asks for
+  uint16_t fastest = 0, hardest = 0, hardestTrapezoid = 0;
+  for (const RideKeyframe &keyframe : ride.keyframes) {
+    fastest = std::max(fastest, keyframe.speed);
+    hardest = std::max(hardest, keyframe.acceleration);
+    if (!keyframe.curve) {
+      hardestTrapezoid = std::max(hardestTrapezoid, keyframe.acceleration);
+    }
+  }
+  problem.limits.speed = limits.speed ? limits.speed : fastest;
+  problem.limits.acceleration = limits.acceleration ? limits.acceleration : hardest;
+  problem.limits.jerk = limits.jerk ? limits.jerk : (hardestTrapezoid ? hardestTrapezoid : hardest);
+
+  printf("%s: %zu keyframes, %s\n", ride.name.c_str(), ride.keyframes.size(), compact ? "compacted" : "kept to a timeline");
+  printf("  limits: speed %u, accel %u, trapezoid accel %u full steps\n", problem.limits.speed, problem.limits.acceleration,
+         std::min(problem.limits.acceleration, problem.limits.jerk));
+  checkEnvelope(ride, problem.poses);
+
+  // The ride as written, on its own timeline, tells which pauses are meant
+  std::vector<int64_t> durations;
+  for (size_t i = 0; i < ride.keyframes.size(); i++) {
+    durations.push_back(moveTicks(problem, i, ride.keyframes[i]));
+  }
+  RideTiming written = playRide(problem, durations, SIZE_MAX, 0, nullptr);
+
+  int64_t arrival = 0;
+  uint32_t kept = 0;
+  int64_t keptTicks = 0;
+  written.slack = written.dead;
+  for (size_t i = 0; i < ride.keyframes.size(); i++) {
+    int64_t start = std::max(problem.due[i], arrival);
+    int64_t pause = start - arrival;
+    if (i > 0 && keepPauseMs > 0 && pause >= keepPauseMs * (int64_t)TICKS_PER_MS) {
+      // A pause on a stretched timeline is stretched with it
+      problem.pause[i] = llround(pause / TICKS_PER_MS * (stretch != 0 ? stretch : 1.0)) * TICKS_PER_MS;
+      kept++;
+      keptTicks += problem.pause[i];
+      written.slack -= pause;
+    }
+    arrival = start + durations[i];
+  }
+
+  if (compact) {
+    problem.compact = true;
+  } else if (targetPath) {
+    problem.due = readTargets(targetPath);
+    if (problem.due.size() != ride.keyframes.size()) {
+      fail(targetPath, "has " + std::to_string(problem.due.size()) + " times for " + std::to_string(ride.keyframes.size()) + " keyframes");
+    }
+    checkTimeline(targetPath, problem.due);
+  } else if (stretch != 0) {
+    for (size_t i = 0; i < ride.keyframes.size(); i++) {
+      problem.due[i] = llround(ride.keyframes[i].timeMs * stretch) * TICKS_PER_MS;
+    }
+    checkTimeline("--stretch", problem.due);
+  }
+
+  // The search starts from the hand-picked values, brought within the limits
+  std::vector<RideKeyframe> keyframes = ride.keyframes;
+  for (RideKeyframe &keyframe : keyframes) {
+    keyframe.speed = std::min(keyframe.speed, problem.limits.speed);
+    keyframe.acceleration = std::min(keyframe.acceleration, accelerationLimit(problem.limits, keyframe));
+  }
+  RideTiming retimed = timeRide(problem, keyframes, nullptr);
+
+  WorkerPool pool;
+  startPool(pool, threads);
+  uint64_t candidates = 0;
+  std::chrono::steady_clock::time_point began = std::chrono::steady_clock::now();
+  int passes = searchRide(problem, keyframes, pool, candidates);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - began).count();
+  stopPool(pool);
+
+  std::vector<int64_t> dues;
+  RideTiming optimized = timeRide(problem, keyframes, &dues);
+  checkTimeline(ride.source, dues);
+  for (size_t i = 0; i < keyframes.size(); i++) {
+    keyframes[i].timeMs = dues[i] / TICKS_PER_MS;
+  }
+
+  printf("  %u pauses of at least %lld ms kept, %.2f s\n", kept, (long long)keepPauseMs, keptTicks / (double)SCURVE_TICKS_PER_SECOND);
+  printf("                   duration  dead time      slack       late\n");
+  printTiming("as written", written);
+  printTiming(problem.compact ? "compacted" : "retimed", retimed);
+  printTiming("optimized", optimized);
+  printf("  %llu candidates in %d passes on %u threads, %.2f s\n", (unsigned long long)candidates, passes, threads, seconds);
+
+  printf("  keyframe       time            speed             accel\n");
+  for (size_t i = 0; i < keyframes.size(); i++) {
+    const RideKeyframe &before = ride.keyframes[i];
+    const RideKeyframe &after = keyframes[i];
+    if (before.timeMs != after.timeMs || before.speed != after.speed || before.acceleration != after.acceleration) {
+      printf("  %-8zu %6.2f->%-6.2f %6u->%-6u %6u->%-6u\n", i + 1, before.timeMs / 1000.0, after.timeMs / 1000.0,
+             before.speed, after.speed, before.acceleration, after.acceleration);
+    }
+  }
+
+  if (outPath) {
+    writeRideCsv(outPath, ride, keyframes);
+
+    // Read back, so that a ride that doesn't come out the same is never left behind as if it did
+    RideCsv check = readRideCsv(outPath);
+    for (size_t i = 0; i < keyframes.size(); i++) {
+      const RideKeyframe &expected = keyframes[i];
+      const RideKeyframe &read = check.keyframes.size() == keyframes.size() ? check.keyframes[i] : expected;
+      if (check.keyframes.size() != keyframes.size() || read.timeMs != expected.timeMs || read.speed != expected.speed ||
+          read.acceleration != expected.acceleration || read.pitch != expected.pitch || read.roll != expected.roll ||
+          read.yaw != expected.yaw || read.curve != expected.curve || read.effect != expected.effect) {
+        fail(outPath, "does not read back as the optimized ride");
+      }
+    }
+    printf("  written to %s\n", outPath);
+  }
+  return EXIT_SUCCESS;
+}
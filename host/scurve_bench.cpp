@@ -0,0 +1,142 @@
+// Compares the S-curve moves of SCurve.cpp with the trapezoid ramps of FastAccelStepper
+// for the moves of the rides, and checks that every S-curve lands exactly on its target
+//
+//   g++ -O2 -o scurve_bench scurve_bench.cpp ../SCurve.cpp
+//   ./scurve_bench
+//
+// Both profiles are looked at on the same 2 ms slice grid. The trapezoid switches its acceleration
+// within one slice, so its peak jerk is the acceleration divided by the slice length.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../SCurve.h"
+
+static const double SLICE_SECONDS = SCURVE_SLICE_MICROS / 1000000.0;
+
+// Full step values of the axes, from AxisConfig.h
+static const uint32_t SEAT_JERK = 100000;
+static const uint32_t YAW_JERK = 50000;
+
+struct RideMove {
+  const char *name;
+  uint32_t distance;
+  uint32_t speed;
+  uint32_t acceleration;
+  uint32_t jerk;
+};
+
+// Moves of the rides in full steps
+static const RideMove MOVES[] = {
+  { "fastFall", 1666, 3000, 1500, SEAT_JERK },
+  { "sharpTurn", 1110, 2000, 1000, YAW_JERK },
+  { "sharpTurn (from center)", 555, 2000, 1000, YAW_JERK },
+  { "fullExperience", 1666, 1000, 1000, SEAT_JERK },
+  { "smallHill", 416, 3000, 1500, SEAT_JERK },
+  { "rumble", 30, 1000, 1000, SEAT_JERK },
+};
+
+struct ProfileResult {
+  double seconds;
+  double peakSpeed;
+  double peakAcceleration;
+  double peakJerk;
+  long steps;
+};
+
+/**
+ * Function to measure the trapezoid ramp FastAccelStepper would run for a move
+ */
+static ProfileResult measureTrapezoid(const RideMove &move, uint32_t acceleration) {
+  ProfileResult result;
+  double d = move.distance;
+  double v = move.speed;
+  double a = acceleration;
+
+  if (d >= v * v / a) {
+    result.seconds = d / v + v / a;
+    result.peakSpeed = v;
+  } else {
+    result.seconds = 2 * sqrt(d / a);
+    result.peakSpeed = sqrt(d * a);
+  }
+  result.peakAcceleration = a;
+  result.peakJerk = a / SLICE_SECONDS;
+  result.steps = move.distance;
+  return result;
+}
+
+/**
+ * Function to run the S-curve generator for a move and measure what it hands to the stepper queue
+ * The kinematics are read from the generator after every slice, the duration and the steps from the commands
+ */
+static ProfileResult measureSCurve(const RideMove &move, uint32_t acceleration) {
+  ProfileResult result = { 0, 0, 0, 0, 0 };
+  SCurvePlan plan = planSCurve(move.distance, move.speed, acceleration, move.jerk);
+  SCurveGenerator generator;
+  startSCurve(generator, plan, move.distance);
+
+  const double q32 = 4294967296.0;
+  double previousAcceleration = 0;
+  uint64_t ticks = 0;
+  SCurveCommand command;
+
+  while (nextSCurveCommand(generator, command)) {
+    ticks += command.steps == 0 ? command.ticks : (uint64_t)command.ticks * command.steps;
+    result.steps += command.steps;
+
+    double speed = generator.velocity / q32 / SLICE_SECONDS;
+    double accelerationNow = generator.acceleration / q32 / (SLICE_SECONDS * SLICE_SECONDS);
+    double jerk = fabs(accelerationNow - previousAcceleration) / SLICE_SECONDS;
+    previousAcceleration = accelerationNow;
+
+    result.peakSpeed = fmax(result.peakSpeed, speed);
+    result.peakAcceleration = fmax(result.peakAcceleration, fabs(accelerationNow));
+    result.peakJerk = fmax(result.peakJerk, jerk);
+  }
+
+  result.seconds = (double)ticks / SCURVE_TICKS_PER_SECOND;
+  return result;
+}
+
+static void printResult(const char *label, const ProfileResult &result) {
+  printf("  %-22s %7.3f s  %7.0f steps/s  %7.0f steps/s^2  %9.0f steps/s^3  %5ld steps\n",
+         label, result.seconds, result.peakSpeed, result.peakAcceleration, result.peakJerk, result.steps);
+}
+
+int main() {
+  bool failed = false;
+
+  for (const RideMove &move : MOVES) {
+    ProfileResult trapezoid = measureTrapezoid(move, move.acceleration);
+    ProfileResult sCurve = measureSCurve(move, move.acceleration);
+    ProfileResult sCurveFaster = measureSCurve(move, move.acceleration * 2);
+
+    printf("%s: %u steps at %u steps/s, %u steps/s^2\n", move.name, move.distance, move.speed, move.acceleration);
+    printResult("trapezoid", trapezoid);
+    printResult("s-curve", sCurve);
+    printResult("s-curve, 2x accel", sCurveFaster);
+
+    if (sCurve.steps != (long)move.distance || sCurveFaster.steps != (long)move.distance) {
+      printf("  FAILED: the s-curve did not land on the target\n");
+      failed = true;
+    }
+    if (sCurve.peakSpeed > move.speed * 1.001 || sCurve.peakAcceleration > move.acceleration * 1.001 ||
+        sCurve.peakJerk > move.jerk * 1.001) {
+      printf("  FAILED: the s-curve went over a limit\n");
+      failed = true;
+    }
+  }
+
+  // Every distance of a seat motor should land exactly, including the very short ones
+  for (uint32_t distance = 1; distance <= 3332; distance++) {
+    RideMove move = { "sweep", distance, 3000, 1500, SEAT_JERK };
+    if (measureSCurve(move, move.acceleration).steps != (long)distance) {
+      printf("FAILED: %u steps did not land on the target\n", distance);
+      failed = true;
+    }
+  }
+
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
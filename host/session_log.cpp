@@ -0,0 +1,389 @@
+// Records sessions with the chair to session logs, replays them and turns them into rides
+//
+//   make -C host session_log
+//
+//   host/session_log record FILE --serial PATH [--send TEXT]... [--seconds S]
+//       turns telemetry on, types each TEXT as a command (e.g. COASTER) and records what the
+//       motors do until S seconds have passed or it is interrupted. Game sessions are recorded by
+//       chair_bridge --record, which logs the poses it sends as well.
+//   host/session_log replay FILE --serial PATH [--speed X] [--from S] [--to S]
+//       streams the session back to the chair, X times as fast, from S seconds in. The poses of the log are sent
+//       as they were; a log with only telemetry is turned back into poses from the motor positions.
+//   host/session_log info FILE [--at S]
+//       prints the length and index of the log, and with --at the first records from S seconds in
+//   host/session_log export FILE RIDE.csv [--every MS] [--name NAME] [--from S] [--to S]
+//       writes the session as a ride script for ride_compiler, a keyframe every MS milliseconds (250)
+//
+// Seeking only reads the index and the records between the checkpoint before the time and the time itself, so
+// scrubbing through a session of hours is as fast as through one of seconds, see SessionLog.h.
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../SerialProtocol.h"
+#include "../AxisConfig.h"
+#include "../Kinematics.h"
+#include "SerialPort.h"
+#include "SessionLog.h"
+#include "TelemetryStream.h"
+
+// Telemetry while recording: a sample every 10 ms, 4 to a frame
+#define RECORD_TELEMETRY_PERIOD_MS 10
+#define RECORD_TELEMETRY_BATCH 4
+
+#define DEFAULT_KEYFRAME_MS 250
+
+// Slowest speed and acceleration a ride keyframe is given, in full steps
+#define MIN_EXPORT_CAP 100
+
+// Ride keyframes may not be further apart than the 16-bit hold time of the sketch
+#define MAX_KEYFRAME_GAP_MS 60000
+
+// Records printed by info --at
+#define INFO_RECORDS 5
+
+static volatile sig_atomic_t interrupted = 0;
+
+static void stop(int) {
+  interrupted = 1;
+}
+
+static void usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s record FILE --serial PATH [--send TEXT]... [--seconds S]\n"
+          "       %s replay FILE --serial PATH [--speed X] [--from S] [--to S]\n"
+          "       %s info FILE [--at S]\n"
+          "       %s export FILE RIDE.csv [--every MS] [--name NAME] [--from S] [--to S]\n",
+          program, program, program, program);
+  exit(EXIT_FAILURE);
+}
+
+struct Options {
+  const char *serial = nullptr;
+  std::vector<const char *> sends;
+  double seconds = 0;
+  double speed = 1;
+  double from = 0;
+  double to = -1;
+  double at = -1;
+  uint32_t everyMs = DEFAULT_KEYFRAME_MS;
+  const char *name = nullptr;
+};
+
+static Options parseOptions(int argc, char **argv, int first) {
+  Options options;
+  for (int i = first; i < argc; i += 2) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--serial") == 0) {
+      options.serial = value;
+    } else if (strcmp(option, "--send") == 0) {
+      options.sends.push_back(value);
+    } else if (strcmp(option, "--seconds") == 0) {
+      options.seconds = atof(value);
+    } else if (strcmp(option, "--speed") == 0) {
+      options.speed = atof(value) > 0 ? atof(value) : 1;
+    } else if (strcmp(option, "--from") == 0) {
+      options.from = atof(value);
+    } else if (strcmp(option, "--to") == 0) {
+      options.to = atof(value);
+    } else if (strcmp(option, "--at") == 0) {
+      options.at = atof(value);
+    } else if (strcmp(option, "--every") == 0) {
+      options.everyMs = atoi(value) > 0 ? atoi(value) : DEFAULT_KEYFRAME_MS;
+    } else if (strcmp(option, "--name") == 0) {
+      options.name = value;
+    } else {
+      usage(argv[0]);
+    }
+  }
+  return options;
+}
+
+static uint64_t toMicros(double seconds) {
+  return seconds > 0 ? (uint64_t)(seconds * 1000000) : 0;
+}
+
+/**
+ * Function to turn motor positions back into the pose that puts them there, the inverse of mixPose()
+ */
+static Pose poseFromPositions(const int16_t *positions) {
+  double pitchSteps = (positions[0] + positions[1]) / 2.0;
+  double rollSteps = (positions[0] - positions[1]) / 2.0;
+  Pose pose;
+  pose.pitch = (int16_t)lround(pitchSteps * 36000 / PitchAxis::STEPS_PER_REVOLUTION);
+  pose.roll = (int16_t)lround(rollSteps * 36000 / RollAxis::STEPS_PER_REVOLUTION);
+  pose.yaw = (int16_t)lround(positions[2] * 36000.0 / YawAxis::STEPS_PER_REVOLUTION);
+  return pose;
+}
+
+/**
+ * Function to read on to the next record that holds a pose
+ * A log with poses gives those, one with only telemetry gives the poses of the motor positions
+ */
+static bool nextPose(SessionLogReader &log, Pose &pose, uint64_t &micros) {
+  uint8_t wanted = (log.flags & LOG_HAS_POSES) ? LOG_POSE : LOG_TELEMETRY;
+  LogRecord record;
+  while (nextSessionRecord(log, record)) {
+    if (record.type != wanted) {
+      continue;
+    }
+    if (wanted == LOG_POSE) {
+      pose.pitch = record.values[0];
+      pose.roll = record.values[1];
+      pose.yaw = record.values[2];
+    } else {
+      pose = poseFromPositions(record.values);
+    }
+    micros = record.micros;
+    return true;
+  }
+  return false;
+}
+
+static int recordSession(const char *path, const Options &options) {
+  int port = openSerialPort(options.serial);
+  if (port < 0) {
+    return EXIT_FAILURE;
+  }
+  SessionLogWriter log;
+  if (!openSessionLog(log, path, SESSION_LOG_DEFAULT_INDEX_MS)) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+
+  uint8_t config[TELEMETRY_CONFIG_PAYLOAD_SIZE];
+  writeUint16(config, RECORD_TELEMETRY_PERIOD_MS);
+  config[2] = RECORD_TELEMETRY_BATCH;
+  writeSerialFrame(port, MSG_TELEMETRY_CONFIG, 0, config, TELEMETRY_CONFIG_PAYLOAD_SIZE);
+  for (const char *text : options.sends) {
+    writeSerialText(port, text);
+  }
+  signal(SIGINT, stop);
+  signal(SIGTERM, stop);
+
+  FrameParser parser;
+  initFrameParser(parser);
+  TelemetryDecoder decoder;
+  initTelemetryDecoder(decoder);
+  TelemetrySample samples[TELEMETRY_MAX_BATCH];
+  uint32_t records = 0;
+
+  // Samples are timed by their index, from the first key frame
+  auto startedAt = std::chrono::steady_clock::now();
+  uint8_t buffer[256];
+  while (!interrupted && (options.seconds <= 0 || std::chrono::steady_clock::now() - startedAt < std::chrono::duration<double>(options.seconds))) {
+    ssize_t size = read(port, buffer, sizeof(buffer));
+    for (ssize_t i = 0; i < size; i++) {
+      if ((!isParsingFrame(parser) && buffer[i] != FRAME_SYNC) || !parseFrameByte(parser, buffer[i])) {
+        continue;
+      }
+      uint8_t count = decodeTelemetryFrame(decoder, parser.type, parser.payload, parser.length, samples);
+      for (uint8_t j = 0; j < count; j++) {
+        uint64_t micros = samples[j].index * samples[j].periodMs * 1000ULL;
+        records += appendSessionRecord(log, LOG_TELEMETRY, micros, samples[j].values) ? 1 : 0;
+      }
+    }
+  }
+
+  memset(config, 0, sizeof(config));
+  writeSerialFrame(port, MSG_TELEMETRY_CONFIG, 0, config, TELEMETRY_CONFIG_PAYLOAD_SIZE);
+  close(port);
+  if (!closeSessionLog(log)) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+  const TelemetryCounters &counters = decoder.counters;
+  printf("Recorded %u telemetry samples, %u lost on the way, %u could not be decoded\n", records, counters.lost,
+         counters.skipped);
+  return EXIT_SUCCESS;
+}
+
+static int replaySession(SessionLogReader &log, const Options &options) {
+  int port = openSerialPort(options.serial);
+  if (port < 0) {
+    return EXIT_FAILURE;
+  }
+  signal(SIGINT, stop);
+  signal(SIGTERM, stop);
+
+  uint64_t from = toMicros(options.from);
+  uint64_t to = options.to >= 0 ? toMicros(options.to) : UINT64_MAX;
+  seekSessionLog(log, from);
+
+  // STREAM puts the chair into streaming
+  writeSerialText(port, "STREAM");
+  auto startedAt = std::chrono::steady_clock::now();
+  uint8_t sequence = 0;
+  uint32_t sent = 0;
+  Pose pose;
+  uint64_t micros;
+
+  while (!interrupted && nextPose(log, pose, micros) && micros <= to) {
+    std::chrono::duration<double> due((micros - from) / 1000000.0 / options.speed);
+    std::this_thread::sleep_until(startedAt + std::chrono::duration_cast<std::chrono::steady_clock::duration>(due));
+
+    uint8_t payload[POSE_PAYLOAD_SIZE];
+    encodePose(payload, pose);
+    if (!writeSerialFrame(port, MSG_POSE, sequence++, payload, POSE_PAYLOAD_SIZE)) {
+      perror("write");
+      break;
+    }
+    sent++;
+  }
+
+  // Any line ends the stream, STOP also drops whatever was left queued
+  writeSerialText(port, "STOP");
+  close(port);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startedAt).count();
+  printf("Replayed %u poses %s in %.1f s\n", sent, (log.flags & LOG_HAS_POSES) ? "as recorded" : "from telemetry", seconds);
+  return EXIT_SUCCESS;
+}
+
+static int printInfo(SessionLogReader &log, const Options &options) {
+  printf("Duration:    %.3f s\n", getSessionDuration(log) / 1000000.0);
+  printf("Contents:   %s%s\n", (log.flags & LOG_HAS_POSES) ? " poses" : "", (log.flags & LOG_HAS_TELEMETRY) ? " telemetry" : "");
+  printf("Size:        %zu bytes\n", log.size);
+  printf("Checkpoints: %zu%s\n", log.indexCount, log.rebuilt ? " (the log was not closed, the index was rebuilt)" : "");
+
+  if (options.at >= 0) {
+    auto seekStartedAt = std::chrono::steady_clock::now();
+    seekSessionLog(log, toMicros(options.at));
+    double seekMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - seekStartedAt).count();
+    printf("\nFrom %.3f s (found in %.1f us):\n", options.at, seekMicros);
+
+    LogRecord record;
+    for (int i = 0; i < INFO_RECORDS && nextSessionRecord(log, record); i++) {
+      printf("  %12.3f  %-9s", record.micros / 1000000.0, record.type == LOG_POSE ? "pose" : "telemetry");
+      for (int j = 0; j < (record.type == LOG_POSE ? 3 : 6); j++) {
+        printf(" %6d", record.values[j]);
+      }
+      printf("\n");
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
+/**
+ * Function to get the speed and acceleration that move the motors from one pose to the next in a time
+ * The motor with the longest move accelerates for half the time and brakes for the other half
+ */
+static void keyframeCaps(const Pose &from, const Pose &to, double seconds, uint32_t &speed, uint32_t &acceleration) {
+  MotorTargets start = mixPose(from.pitch, from.roll, from.yaw);
+  MotorTargets end = mixPose(to.pitch, to.roll, to.yaw);
+  double longest = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    longest = fmax(longest, fabs((double)(end.position[i] - start.position[i]) / MICROSTEPS));
+  }
+  speed = (uint32_t)lround(fmin(fmax(2 * longest / seconds, MIN_EXPORT_CAP), PitchAxis::MAX_SPEED / MICROSTEPS));
+  acceleration = (uint32_t)lround(fmin(fmax(4 * longest / (seconds * seconds), MIN_EXPORT_CAP), PitchAxis::MAX_ACCELERATION / MICROSTEPS));
+}
+
+static int exportRide(SessionLogReader &log, const char *path, const char *logPath, const Options &options) {
+  FILE *ride = fopen(path, "w");
+  if (!ride) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+
+  uint64_t from = toMicros(options.from);
+  uint64_t to = options.to >= 0 ? toMicros(options.to) : UINT64_MAX;
+  uint64_t every = (uint64_t)options.everyMs * 1000;
+  seekSessionLog(log, from);
+
+  fprintf(ride, "# name: %s\n", options.name ? options.name : "Recorded Session");
+  fprintf(ride, "# Exported from %s, a keyframe every %u ms\n", logPath, options.everyMs);
+  fprintf(ride, "time,pitch,roll,yaw,speed,accel,curve\n\n");
+
+  // The pose at the end of each interval, each move starts at the beginning of its interval
+  Pose previous = { 0, 0, 0 };
+  Pose pose = { 0, 0, 0 };
+  Pose next;
+  uint64_t micros;
+  bool more = nextPose(log, next, micros);
+  uint64_t lastKeyframeAt = 0;
+  uint32_t keyframes = 0;
+
+  for (uint64_t end = from + every; more && end - every <= to; end += every) {
+    while (more && micros <= end) {
+      pose = next;
+      more = nextPose(log, next, micros);
+    }
+    uint64_t start = end - every - from;
+    bool changed = pose.pitch != previous.pitch || pose.roll != previous.roll || pose.yaw != previous.yaw;
+    if (keyframes > 0 && !changed && start - lastKeyframeAt < MAX_KEYFRAME_GAP_MS * 1000ULL) {
+      continue;
+    }
+
+    uint32_t speed;
+    uint32_t acceleration;
+    keyframeCaps(previous, pose, every / 1000000.0, speed, acceleration);
+    fprintf(ride, "%.3f, %.2f, %.2f, %.2f, %u, %u, 0\n", start / 1000000.0, pose.pitch / 100.0, pose.roll / 100.0,
+            pose.yaw / 100.0, speed, acceleration);
+    previous = pose;
+    lastKeyframeAt = start;
+    keyframes++;
+  }
+
+  // Back to level at the end
+  uint32_t speed;
+  uint32_t acceleration;
+  Pose level = { 0, 0, 0 };
+  keyframeCaps(previous, level, 1.0, speed, acceleration);
+  fprintf(ride, "%.3f, 0, 0, 0, %u, %u, 0\n", (lastKeyframeAt + every) / 1000000.0, speed, acceleration);
+  fclose(ride);
+
+  printf("Wrote %u keyframes to %s, compile it with ride_compiler\n", keyframes + 1, path);
+  return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    usage(argv[0]);
+  }
+  const char *command = argv[1];
+  const char *path = argv[2];
+
+  if (strcmp(command, "record") == 0) {
+    Options options = parseOptions(argc, argv, 3);
+    if (!options.serial) {
+      usage(argv[0]);
+    }
+    return recordSession(path, options);
+  }
+
+  bool exporting = strcmp(command, "export") == 0;
+  if (exporting && argc < 4) {
+    usage(argv[0]);
+  }
+  Options options = parseOptions(argc, argv, exporting ? 4 : 3);
+
+  SessionLogReader log;
+  if (!openSessionReader(log, path)) {
+    fprintf(stderr, "%s is not a session log\n", path);
+    return EXIT_FAILURE;
+  }
+
+  int result;
+  if (strcmp(command, "replay") == 0 && options.serial) {
+    result = replaySession(log, options);
+  } else if (strcmp(command, "info") == 0) {
+    result = printInfo(log, options);
+  } else if (exporting) {
+    result = exportRide(log, argv[3], path, options);
+  } else {
+    usage(argv[0]);
+  }
+  closeSessionReader(log);
+  return result;
+}
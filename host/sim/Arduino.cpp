@@ -0,0 +1,300 @@
+#include <ctype.h>
+#include <deque>
+#include <utility>
+
+#include "Arduino.h"
+#include "Simulator.h"
+
+HardwareSerial Serial;
+
+static uint64_t now = 0;
+static uint32_t randomState = 1;
+
+// Bytes waiting to arrive, with the virtual time they arrive at
+static std::deque<std::pair<uint64_t, uint8_t> > serialInput;
+static FILE *serialOutput = stdout;
+
+// Bytes written wait in the transmit buffer of the core and go out one at a time at the baud rate
+// Like on the chair, a write to a full buffer waits until there is room
+#define SERIAL_TX_BUFFER_SIZE 64
+static double byteMicros = 0;
+static double transmitDoneAt = 0;
+
+uint64_t getSimulationMicros() {
+  return now;
+}
+
+/**
+ * Function to move the virtual clock forward, stepping the steppers as it goes
+ */
+void advanceSimulation(uint32_t micros) {
+  advanceSteppers(micros);
+  now += micros;
+}
+
+unsigned long millis() {
+  return (unsigned long)(now / 1000);
+}
+
+unsigned long micros() {
+  // Wraps like the 32-bit counter on the chair
+  return (uint32_t)now;
+}
+
+void delay(unsigned long ms) {
+  while (ms-- > 0) {
+    advanceSimulation(1000);
+  }
+}
+
+void delayMicroseconds(unsigned int us) {
+  advanceSimulation(us);
+}
+
+/**
+ * Function to get the next number of a fixed pseudo-random sequence, so that runs can be repeated
+ */
+static uint32_t nextRandom() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+long random(long max) {
+  return max <= 0 ? 0 : (long)(nextRandom() % (uint32_t)max);
+}
+
+long random(long min, long max) {
+  return max <= min ? min : min + random(max - min);
+}
+
+void randomSeed(unsigned long seed) {
+  randomState = seed != 0 ? (uint32_t)seed : 1;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t pin) {
+  return readSwitchPin(pin);
+}
+
+void queueSerialInput(uint64_t atMicros, const std::string &bytes) {
+  for (size_t i = 0; i < bytes.size(); i++) {
+    serialInput.push_back(std::make_pair(atMicros, (uint8_t)bytes[i]));
+  }
+}
+
+size_t getPendingSerialInput() {
+  return serialInput.size();
+}
+
+void setSerialOutput(FILE *output) {
+  serialOutput = output;
+}
+
+// String //
+
+String::String(const char *text) : text(text ? text : "") {}
+String::String(char character) : text(1, character) {}
+String::String(int value) : text(std::to_string(value)) {}
+String::String(unsigned int value) : text(std::to_string(value)) {}
+String::String(long value) : text(std::to_string(value)) {}
+String::String(unsigned long value) : text(std::to_string(value)) {}
+
+String::String(double value, unsigned char decimalPlaces) {
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", decimalPlaces, value);
+  text = buffer;
+}
+
+unsigned int String::length() const {
+  return text.size();
+}
+
+const char *String::c_str() const {
+  return text.c_str();
+}
+
+void String::trim() {
+  size_t first = 0;
+  while (first < text.size() && isspace((unsigned char)text[first])) {
+    first++;
+  }
+  size_t last = text.size();
+  while (last > first && isspace((unsigned char)text[last - 1])) {
+    last--;
+  }
+  text = text.substr(first, last - first);
+}
+
+bool String::equals(const String &other) const {
+  return text == other.text;
+}
+
+bool String::equalsIgnoreCase(const String &other) const {
+  if (text.size() != other.text.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < text.size(); i++) {
+    if (tolower((unsigned char)text[i]) != tolower((unsigned char)other.text[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+long String::toInt() const {
+  return atol(text.c_str());
+}
+
+float String::toFloat() const {
+  return atof(text.c_str());
+}
+
+String &String::operator+=(const String &other) {
+  text += other.text;
+  return *this;
+}
+
+bool String::operator==(const String &other) const {
+  return text == other.text;
+}
+
+bool String::operator!=(const String &other) const {
+  return text != other.text;
+}
+
+String operator+(const String &left, const String &right) {
+  String result(left);
+  result += right;
+  return result;
+}
+
+// HardwareSerial //
+
+// Start bit, 8 data bits and a stop bit
+void HardwareSerial::begin(unsigned long baud) {
+  byteMicros = baud > 0 ? 10 * 1000000.0 / baud : 0;
+  transmitDoneAt = now;
+}
+
+/**
+ * Function to get how many bytes are still waiting to go out
+ */
+static int transmitQueued() {
+  if (byteMicros == 0 || transmitDoneAt <= now) {
+    return 0;
+  }
+  return (int)ceil((transmitDoneAt - now) / byteMicros);
+}
+void HardwareSerial::end() {}
+
+HardwareSerial::operator bool() const {
+  return true;
+}
+
+int HardwareSerial::available() {
+  int count = 0;
+  for (size_t i = 0; i < serialInput.size() && serialInput[i].first <= now; i++) {
+    count++;
+  }
+  return count;
+}
+
+int HardwareSerial::peek() {
+  if (serialInput.empty() || serialInput.front().first > now) {
+    return -1;
+  }
+  return serialInput.front().second;
+}
+
+int HardwareSerial::read() {
+  int next = peek();
+  if (next >= 0) {
+    serialInput.pop_front();
+  }
+  return next;
+}
+
+int HardwareSerial::availableForWrite() {
+  return SERIAL_TX_BUFFER_SIZE - 1 - transmitQueued();
+}
+
+void HardwareSerial::flush() {
+  fflush(serialOutput);
+}
+
+size_t HardwareSerial::write(uint8_t value) {
+  if (byteMicros > 0) {
+    while (availableForWrite() <= 0) {
+      advanceSimulation((uint32_t)ceil(byteMicros));
+    }
+    transmitDoneAt = (transmitDoneAt > now ? transmitDoneAt : now) + byteMicros;
+  }
+  fputc(value, serialOutput);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    write(buffer[i]);
+  }
+  return size;
+}
+
+size_t HardwareSerial::print(const char *text) {
+  return write((const uint8_t *)text, strlen(text));
+}
+
+size_t HardwareSerial::print(const __FlashStringHelper *text) {
+  return print(reinterpret_cast<const char *>(text));
+}
+
+size_t HardwareSerial::print(const String &text) {
+  return print(text.c_str());
+}
+
+size_t HardwareSerial::print(char value) {
+  return write((uint8_t)value);
+}
+
+size_t HardwareSerial::print(int value, int base) {
+  return print((long)value, base);
+}
+
+size_t HardwareSerial::print(unsigned int value, int base) {
+  return print((unsigned long)value, base);
+}
+
+size_t HardwareSerial::print(long value, int base) {
+  if (value < 0 && base == 10) {
+    return print('-') + print((unsigned long)-value, base);
+  }
+  return print((unsigned long)value, base);
+}
+
+size_t HardwareSerial::print(unsigned long value, int base) {
+  char buffer[8 * sizeof(unsigned long) + 1];
+  char *digit = buffer + sizeof(buffer) - 1;
+  *digit = '\0';
+  if (base < 2) {
+    base = 10;
+  }
+  do {
+    unsigned long remainder = value % base;
+    *--digit = remainder < 10 ? '0' + remainder : 'A' + remainder - 10;
+    value /= base;
+  } while (value > 0);
+  return print(digit);
+}
+
+size_t HardwareSerial::print(double value, int digits) {
+  char buffer[48];
+  snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+  return print(buffer);
+}
+
+size_t HardwareSerial::println() {
+  return print("\r\n");
+}
@@ -0,0 +1,145 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Stand-in for the parts of the Arduino core the sketch uses, so it can run on a Linux host
+// Time is virtual: millis() and micros() only move when the simulator advances them, see Simulator.h
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <string>
+#include <type_traits>
+
+#define PROGMEM
+#define PSTR(text) (text)
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_word(address) (*(const uint16_t *)(address))
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
+#define pgm_read_ptr(address) (*(const void *const *)(address))
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcasecmp_P strcasecmp
+
+// Text kept in flash with F() on the chair is ordinary text here, only its type tells print() where it lives
+class __FlashStringHelper;
+#define F(text) (reinterpret_cast<const __FlashStringHelper *>(PSTR(text)))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+// The simulated controller is an ATmega2560 at 16 MHz
+#define F_CPU 16000000UL
+#define clockCyclesPerMicrosecond() (F_CPU / 1000000L)
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// Functions instead of the macros of the Arduino core, so that they don't clash with the standard library
+template <class T, class U>
+typename std::common_type<T, U>::type min(T a, U b) {
+  return a < b ? a : b;
+}
+
+template <class T, class U>
+typename std::common_type<T, U>::type max(T a, U b) {
+  return a > b ? a : b;
+}
+
+template <class T, class L, class H>
+T constrain(T value, L low, H high) {
+  return value < low ? low : (value > high ? high : value);
+}
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+// Only the String members the sketch uses
+class String {
+public:
+  String(const char *text = "");
+  String(char character);
+  String(int value);
+  String(unsigned int value);
+  String(long value);
+  String(unsigned long value);
+  String(double value, unsigned char decimalPlaces = 2);
+
+  unsigned int length() const;
+  const char *c_str() const;
+  void trim();
+  bool equals(const String &other) const;
+  bool equalsIgnoreCase(const String &other) const;
+  long toInt() const;
+  float toFloat() const;
+
+  String &operator+=(const String &other);
+  bool operator==(const String &other) const;
+  bool operator!=(const String &other) const;
+
+private:
+  std::string text;
+};
+
+String operator+(const String &left, const String &right);
+
+// Serial port fed from the simulator's input script, output goes to a file (stdout by default)
+class HardwareSerial {
+public:
+  void begin(unsigned long baud);
+  void end();
+  operator bool() const;
+
+  int available();
+  int peek();
+  int read();
+  int availableForWrite();
+  void flush();
+
+  size_t write(uint8_t value);
+  size_t write(const uint8_t *buffer, size_t size);
+
+  size_t print(const char *text);
+  size_t print(const __FlashStringHelper *text);
+  size_t print(const String &text);
+  size_t print(char value);
+  size_t print(int value, int base = 10);
+  size_t print(unsigned int value, int base = 10);
+  size_t print(long value, int base = 10);
+  size_t print(unsigned long value, int base = 10);
+  size_t print(double value, int digits = 2);
+
+  size_t println();
+  template <class T>
+  size_t println(const T &value) {
+    size_t written = print(value);
+    return written + println();
+  }
+  template <class T>
+  size_t println(const T &value, int format) {
+    size_t written = print(value, format);
+    return written + println();
+  }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,90 @@
+#include <string.h>
+
+#include "EEPROM.h"
+#include "Simulator.h"
+
+// Time the ATmega2560 takes to erase and write one byte
+#define EEPROM_WRITE_MICROS 3300
+
+EEPROMClass EEPROM;
+
+static uint8_t memory[E2END + 1];
+static uint32_t writeCounts[E2END + 1];
+static bool erased = false;
+static uint64_t writeDoneAt = 0;
+
+static void eraseOnce() {
+  if (!erased) {
+    memset(memory, 0xFF, sizeof(memory));
+    erased = true;
+  }
+}
+
+bool eeprom_is_ready() {
+  return getSimulationMicros() >= writeDoneAt;
+}
+
+uint8_t EEPROMClass::read(int address) {
+  eraseOnce();
+  // Reading waits for a write that is still going on, like eeprom_read_byte()
+  while (!eeprom_is_ready()) {
+    advanceSimulation(writeDoneAt - getSimulationMicros());
+  }
+  return memory[address & E2END];
+}
+
+void EEPROMClass::write(int address, uint8_t value) {
+  eraseOnce();
+  while (!eeprom_is_ready()) {
+    advanceSimulation(writeDoneAt - getSimulationMicros());
+  }
+  memory[address & E2END] = value;
+  writeCounts[address & E2END]++;
+  writeDoneAt = getSimulationMicros() + EEPROM_WRITE_MICROS;
+}
+
+void EEPROMClass::update(int address, uint8_t value) {
+  if (read(address) != value) {
+    write(address, value);
+  }
+}
+
+uint16_t EEPROMClass::length() {
+  return E2END + 1;
+}
+
+/**
+ * Function to get how often a byte has been written since power on, every write wears the cell
+ */
+uint32_t getEepromWrites(uint16_t address) {
+  return writeCounts[address & E2END];
+}
+
+/**
+ * Function to fill the EEPROM from a file, a missing file leaves it erased
+ */
+bool loadEeprom(const char *path) {
+  eraseOnce();
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return false;
+  }
+  size_t size = fread(memory, 1, sizeof(memory), file);
+  fclose(file);
+  return size == sizeof(memory);
+}
+
+/**
+ * Function to write the EEPROM to a file, as it is at the end of the run
+ * A byte that is still being written when the run stops is kept, like one that finishes before power goes
+ */
+bool saveEeprom(const char *path) {
+  eraseOnce();
+  FILE *file = fopen(path, "wb");
+  if (!file) {
+    return false;
+  }
+  size_t size = fwrite(memory, 1, sizeof(memory), file);
+  fclose(file);
+  return size == sizeof(memory);
+}
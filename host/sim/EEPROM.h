@@ -0,0 +1,25 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+// Stand-in for the EEPROM library of the Arduino core
+//
+// The ATmega2560 has 4 KB of EEPROM, erased to 0xFF. Writing a byte takes 3.3 ms: eeprom_is_ready() is false
+// until it is done, and a write before then waits for it like on the chip.
+
+#include <stdint.h>
+
+#define E2END 0xFFF
+
+bool eeprom_is_ready();
+
+class EEPROMClass {
+public:
+  uint8_t read(int address);
+  void write(int address, uint8_t value);
+  void update(int address, uint8_t value);
+  uint16_t length();
+};
+
+extern EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,384 @@
+#include "FastAccelStepper.h"
+#include "Simulator.h"
+
+// The ramps are integrated in steps of at most this long
+#define RAMP_STEP_MICROS 50
+
+// On the ATmega2560 the steppers run off timer 4, which only reaches pins 6, 7 and 8
+static const uint8_t STEP_PINS[] = { 6, 7, 8 };
+#define MAX_STEPPERS (sizeof(STEP_PINS) / sizeof(STEP_PINS[0]))
+
+static FastAccelStepper *connected[MAX_STEPPERS] = { nullptr, nullptr, nullptr };
+static uint8_t connectedCount = 0;
+
+// Where the motors are at power on, by step pin
+static int32_t startPositions[MAX_STEPPERS] = { 0, 0, 0 };
+
+// Play in the gears behind the motors, by step pin
+static int32_t gearBacklash[MAX_STEPPERS] = { 0, 0, 0 };
+
+// Limit switches that close (read LOW) while the output of the motor on a step pin is at or below a physical position
+struct HomeSwitch {
+  uint8_t pin;
+  uint8_t stepPin;
+  int32_t position;
+};
+#define MAX_HOME_SWITCHES 8
+static HomeSwitch homeSwitches[MAX_HOME_SWITCHES];
+static uint8_t homeSwitchCount = 0;
+
+FastAccelStepper::FastAccelStepper(uint8_t stepPin)
+  : stepPin(stepPin), hasDirectionPin(false), speedInMilliHz(0), acceleration(0), rampActive(false), target(0),
+    exactPosition(0), velocity(0), queueHead(0), queueCount(0), commandTicks(0), commandSteps(0), position(0), origin(0),
+    backlash(0), output(0) {}
+
+uint8_t FastAccelStepper::getStepPin() const {
+  return stepPin;
+}
+
+void FastAccelStepper::setDirectionPin(uint8_t, bool, uint16_t) {
+  hasDirectionPin = true;
+}
+
+void FastAccelStepper::setEnablePin(uint8_t, bool) {}
+void FastAccelStepper::setAutoEnable(bool) {}
+
+int8_t FastAccelStepper::setSpeedInHz(uint32_t speed_hz) {
+  return setSpeedInMilliHz(speed_hz * 1000);
+}
+
+int8_t FastAccelStepper::setSpeedInMilliHz(uint32_t speed_mhz) {
+  if (speed_mhz == 0) {
+    return -1;
+  }
+  speedInMilliHz = speed_mhz;
+  return 0;
+}
+
+uint32_t FastAccelStepper::getSpeedInMilliHz() {
+  return speedInMilliHz;
+}
+
+uint32_t FastAccelStepper::getMaxSpeedInHz() {
+  return TICKS_PER_S / MIN_DELTA_TICKS;
+}
+
+int8_t FastAccelStepper::setAcceleration(int32_t step_s_s) {
+  if (step_s_s <= 0) {
+    return -1;
+  }
+  acceleration = step_s_s;
+  return 0;
+}
+
+int32_t FastAccelStepper::getAcceleration() {
+  return acceleration;
+}
+
+// Speed and acceleration changes are picked up on every ramp step anyway
+void FastAccelStepper::applySpeedAcceleration() {}
+
+int8_t FastAccelStepper::moveTo(int32_t position, bool blocking) {
+  if (!hasDirectionPin) {
+    return MOVE_ERR_NO_DIRECTION_PIN;
+  }
+  if (speedInMilliHz == 0) {
+    return MOVE_ERR_SPEED_IS_UNDEFINED;
+  }
+  if (acceleration == 0) {
+    return MOVE_ERR_ACCELERATION_IS_UNDEFINED;
+  }
+
+  target = position;
+  rampActive = target != this -> position || velocity != 0;
+
+  if (blocking) {
+    waitUntilStopped();
+  }
+  return MOVE_OK;
+}
+
+int8_t FastAccelStepper::move(int32_t move, bool blocking) {
+  int32_t from = rampActive ? target : getPositionAfterCommandsCompleted();
+  return moveTo(from + move, blocking);
+}
+
+void FastAccelStepper::stopMove() {
+  if (!rampActive || velocity == 0) {
+    return;
+  }
+  double stoppingDistance = ceil(velocity * velocity / (2.0 * acceleration));
+  target = lround(exactPosition + (velocity > 0 ? stoppingDistance : -stoppingDistance));
+}
+
+void FastAccelStepper::forceStop() {
+  rampActive = false;
+  velocity = 0;
+  queueCount = 0;
+  commandTicks = 0;
+  commandSteps = 0;
+  exactPosition = position;
+  target = position;
+}
+
+void FastAccelStepper::forceStopAndNewPosition(int32_t new_pos) {
+  forceStop();
+  setCurrentPosition(new_pos);
+}
+
+bool FastAccelStepper::isRunning() {
+  return rampActive || queueCount > 0;
+}
+
+bool FastAccelStepper::isRampGeneratorActive() {
+  return rampActive;
+}
+
+int32_t FastAccelStepper::getCurrentPosition() {
+  return position;
+}
+
+void FastAccelStepper::setCurrentPosition(int32_t new_pos) {
+  int32_t shift = new_pos - position;
+  position = new_pos;
+  origin -= shift;
+  exactPosition += shift;
+  target += shift;
+}
+
+int32_t FastAccelStepper::targetPos() {
+  return queueCount > 0 ? getPositionAfterCommandsCompleted() : target;
+}
+
+int32_t FastAccelStepper::getCurrentSpeedInMilliHz() {
+  return (int32_t)(velocity * 1000);
+}
+
+int8_t FastAccelStepper::addQueueEntry(const stepper_command_s *cmd, bool) {
+  // The library does not let raw commands and the ramp generator drive a stepper at the same time
+  if (rampActive) {
+    return AQE_DEVICE_NOT_READY;
+  }
+  if (queueCount >= QUEUE_LEN) {
+    return AQE_QUEUE_FULL;
+  }
+  if (cmd -> steps > 0 ? cmd -> ticks < MIN_DELTA_TICKS : cmd -> ticks < MIN_CMD_TICKS) {
+    return AQE_ERROR_TICKS_TOO_LOW;
+  }
+
+  queue[(queueHead + queueCount) % QUEUE_LEN] = *cmd;
+  queueCount++;
+  return AQE_OK;
+}
+
+bool FastAccelStepper::isQueueEmpty() {
+  return queueCount == 0;
+}
+
+bool FastAccelStepper::isQueueFull() {
+  return queueCount >= QUEUE_LEN;
+}
+
+int32_t FastAccelStepper::getPositionAfterCommandsCompleted() {
+  int32_t after = position;
+  for (uint8_t i = 0; i < queueCount; i++) {
+    const stepper_command_s &cmd = queue[(queueHead + i) % QUEUE_LEN];
+    int32_t steps = i == 0 ? cmd.steps - commandSteps : cmd.steps;
+    after += cmd.count_up ? steps : -steps;
+  }
+  return after;
+}
+
+int32_t FastAccelStepper::getPhysicalPosition() {
+  return origin + position;
+}
+
+int32_t FastAccelStepper::getOutputPosition() {
+  return output;
+}
+
+/**
+ * Function to drag the output along once the motor has taken up the play on either side
+ * Driven up the output trails the motor by (backlash + 1) / 2, driven down it leads by backlash / 2, which is how
+ * Backlash.h splits it
+ */
+void FastAccelStepper::turnGears() {
+  int32_t motor = origin + position;
+  if (output < motor - (backlash + 1) / 2) {
+    output = motor - (backlash + 1) / 2;
+  } else if (output > motor + backlash / 2) {
+    output = motor + backlash / 2;
+  }
+}
+
+/**
+ * Function to step the stepper for a while, called by the simulator for every stepper
+ */
+void FastAccelStepper::advance(uint32_t micros) {
+  if (queueCount > 0) {
+    advanceQueue((uint64_t)micros * (TICKS_PER_S / 1000000));
+    return;
+  }
+
+  while (rampActive && micros > 0) {
+    uint32_t step = micros < RAMP_STEP_MICROS ? micros : RAMP_STEP_MICROS;
+    advanceRamp(step / 1000000.0);
+    micros -= step;
+  }
+}
+
+/**
+ * Function to integrate the trapezoid ramp towards the target
+ * Accelerates up to the speed, cruises, and brakes once the stopping distance reaches the target
+ */
+void FastAccelStepper::advanceRamp(double seconds) {
+  double maxSpeed = speedInMilliHz / 1000.0;
+  double change = acceleration * seconds;
+  double remaining = target - exactPosition;
+  double direction = remaining >= 0 ? 1 : -1;
+  double stoppingDistance = velocity * velocity / (2.0 * acceleration);
+
+  if (velocity * direction < 0 || stoppingDistance >= fabs(remaining) || fabs(velocity) > maxSpeed) {
+    // Brake, towards a stop or down to the new speed
+    double lowest = velocity * direction < 0 || stoppingDistance >= fabs(remaining) ? 0 : maxSpeed;
+    double speed = fabs(velocity) - change;
+    speed = speed < lowest ? lowest : speed;
+    velocity = velocity < 0 ? -speed : speed;
+  } else {
+    double speed = fabs(velocity) + change;
+    speed = speed > maxSpeed ? maxSpeed : speed;
+    velocity = direction * speed;
+  }
+
+  exactPosition += velocity * seconds;
+  double left = target - exactPosition;
+
+  // Arrived once the target is reached at a crawl, or passed slowly enough to stop within a step
+  // Passing it any faster overshoots like the library does: the ramp brakes, turns around and comes back
+  bool passed = left * remaining <= 0;
+  if ((passed && velocity * velocity <= 2.0 * acceleration) || (fabs(left) < 0.5 && fabs(velocity) <= change * 2)) {
+    exactPosition = target;
+    velocity = 0;
+    rampActive = false;
+  }
+  position = lround(exactPosition);
+  turnGears();
+}
+
+/**
+ * Function to step out the raw commands as timed, a command makes its first step right away
+ */
+void FastAccelStepper::advanceQueue(uint64_t ticks) {
+  while (ticks > 0 && queueCount > 0) {
+    const stepper_command_s &cmd = queue[queueHead];
+    uint64_t duration = cmd.steps == 0 ? cmd.ticks : (uint64_t)cmd.ticks * cmd.steps;
+    uint64_t until = commandTicks + ticks < duration ? commandTicks + ticks : duration;
+
+    while (commandSteps < cmd.steps && (uint64_t)commandSteps * cmd.ticks < until) {
+      position += cmd.count_up ? 1 : -1;
+      commandSteps++;
+      turnGears();
+    }
+    velocity = cmd.steps == 0 ? 0 : (cmd.count_up ? 1.0 : -1.0) * TICKS_PER_S / cmd.ticks;
+
+    ticks -= until - commandTicks;
+    commandTicks = until;
+    if (commandTicks >= duration) {
+      queueHead = (queueHead + 1) % QUEUE_LEN;
+      queueCount--;
+      commandTicks = 0;
+      commandSteps = 0;
+    }
+  }
+
+  if (queueCount == 0) {
+    velocity = 0;
+  }
+  exactPosition = position;
+  target = position;
+}
+
+void FastAccelStepper::waitUntilStopped() {
+  while (isRunning()) {
+    advanceSimulation(RAMP_STEP_MICROS);
+  }
+}
+
+void FastAccelStepperEngine::init() {}
+
+/**
+ * Function to hand out a stepper on one of the pins timer 4 can drive
+ * @return nullptr for any other pin, or a pin that is already taken
+ */
+FastAccelStepper *FastAccelStepperEngine::stepperConnectToPin(uint8_t stepPin) {
+  for (uint8_t i = 0; i < MAX_STEPPERS; i++) {
+    if (STEP_PINS[i] != stepPin) {
+      continue;
+    }
+    for (uint8_t j = 0; j < connectedCount; j++) {
+      if (connected[j] -> getStepPin() == stepPin) {
+        return nullptr;
+      }
+    }
+    FastAccelStepper *stepper = new FastAccelStepper(stepPin);
+    stepper -> origin = startPositions[i];
+    stepper -> backlash = gearBacklash[i];
+    stepper -> output = startPositions[i];
+    connected[connectedCount] = stepper;
+    return connected[connectedCount++];
+  }
+  return nullptr;
+}
+
+void advanceSteppers(uint32_t micros) {
+  for (uint8_t i = 0; i < connectedCount; i++) {
+    connected[i] -> advance(micros);
+  }
+}
+
+uint8_t getStepperCount() {
+  return connectedCount;
+}
+
+FastAccelStepper *getStepper(uint8_t index) {
+  return index < connectedCount ? connected[index] : nullptr;
+}
+
+void setStartPosition(uint8_t stepPin, int32_t position) {
+  for (uint8_t i = 0; i < MAX_STEPPERS; i++) {
+    if (STEP_PINS[i] == stepPin) {
+      startPositions[i] = position;
+    }
+  }
+}
+
+void setGearBacklash(uint8_t stepPin, int32_t steps) {
+  for (uint8_t i = 0; i < MAX_STEPPERS; i++) {
+    if (STEP_PINS[i] == stepPin) {
+      gearBacklash[i] = steps > 0 ? steps : 0;
+    }
+  }
+}
+
+void addHomeSwitch(uint8_t pin, uint8_t stepPin, int32_t position) {
+  if (homeSwitchCount < MAX_HOME_SWITCHES) {
+    homeSwitches[homeSwitchCount++] = { pin, stepPin, position };
+  }
+}
+
+/**
+ * Function to read a pin a limit switch is wired to, other pins read HIGH like an open input with a pull-up
+ */
+int readSwitchPin(uint8_t pin) {
+  for (uint8_t i = 0; i < homeSwitchCount; i++) {
+    if (homeSwitches[i].pin != pin) {
+      continue;
+    }
+    for (uint8_t j = 0; j < connectedCount; j++) {
+      if (connected[j] -> getStepPin() == homeSwitches[i].stepPin) {
+        return connected[j] -> getOutputPosition() <= homeSwitches[i].position ? LOW : HIGH;
+      }
+    }
+  }
+  return HIGH;
+}
@@ -0,0 +1,121 @@
+#ifndef FAST_ACCEL_STEPPER_H
+#define FAST_ACCEL_STEPPER_H
+
+// Stand-in for the FastAccelStepper library, modelling the steppers in virtual time
+//
+// Moves follow trapezoid ramps like the library's ramp generator, and raw commands added with
+// addQueueEntry() are stepped out exactly as timed. Limits that the real library enforces on the
+// ATmega2560 (3 steppers on pins 6, 7 and 8, a queue of 16 commands, the shortest step period) are
+// enforced here too, so code that breaks them on the chair breaks in the simulator as well.
+
+#include "Arduino.h"
+
+#define TICKS_PER_S 16000000L
+#define MIN_DELTA_TICKS (TICKS_PER_S / 50000)
+#define MIN_CMD_TICKS (TICKS_PER_S / 5000)
+#define QUEUE_LEN 16
+
+#define MOVE_OK 0
+#define MOVE_ERR_NO_DIRECTION_PIN -1
+#define MOVE_ERR_SPEED_IS_UNDEFINED -2
+#define MOVE_ERR_ACCELERATION_IS_UNDEFINED -3
+
+#define AQE_OK 0
+#define AQE_QUEUE_FULL 1
+#define AQE_DIR_PIN_IS_BUSY 2
+#define AQE_WAIT_FOR_ENABLE_PIN_ACTIVE 3
+#define AQE_DEVICE_NOT_READY 4
+#define AQE_ERROR_TICKS_TOO_LOW -1
+#define AQE_ERROR_EMPTY_QUEUE_TO_START -2
+#define AQE_ERROR_NO_DIR_PIN_TO_TOGGLE -3
+
+struct stepper_command_s {
+  uint16_t ticks;
+  uint8_t steps;
+  bool count_up;
+};
+
+class FastAccelStepper {
+public:
+  FastAccelStepper(uint8_t stepPin);
+
+  uint8_t getStepPin() const;
+  void setDirectionPin(uint8_t dirPin, bool dirHighCountsUp = true, uint16_t dir_change_delay_us = 0);
+  void setEnablePin(uint8_t enablePin, bool low_active_enables_stepper = true);
+  void setAutoEnable(bool autoEnable);
+
+  int8_t setSpeedInHz(uint32_t speed_hz);
+  int8_t setSpeedInMilliHz(uint32_t speed_mhz);
+  uint32_t getSpeedInMilliHz();
+  uint32_t getMaxSpeedInHz();
+  int8_t setAcceleration(int32_t step_s_s);
+  int32_t getAcceleration();
+  void applySpeedAcceleration();
+
+  int8_t moveTo(int32_t position, bool blocking = false);
+  int8_t move(int32_t move, bool blocking = false);
+  void stopMove();
+  void forceStop();
+  void forceStopAndNewPosition(int32_t new_pos);
+
+  bool isRunning();
+  bool isRampGeneratorActive();
+  int32_t getCurrentPosition();
+  void setCurrentPosition(int32_t new_pos);
+  int32_t targetPos();
+  int32_t getCurrentSpeedInMilliHz();
+
+  int8_t addQueueEntry(const stepper_command_s *cmd, bool start = true);
+  bool isQueueEmpty();
+  bool isQueueFull();
+  int32_t getPositionAfterCommandsCompleted();
+
+  // Simulator only: step for this long
+  void advance(uint32_t micros);
+  // Simulator only: where the motor really is, the position counter starts at 0 wherever that is
+  int32_t getPhysicalPosition();
+  // Simulator only: where the output of the gears really is, it only follows the motor once the play is taken up
+  int32_t getOutputPosition();
+
+private:
+  friend class FastAccelStepperEngine;
+
+  void advanceRamp(double seconds);
+  void advanceQueue(uint64_t ticks);
+  void waitUntilStopped();
+  void turnGears();
+
+  uint8_t stepPin;
+  bool hasDirectionPin;
+
+  uint32_t speedInMilliHz;
+  int32_t acceleration;
+
+  // Ramp generator
+  bool rampActive;
+  int32_t target;
+  double exactPosition;
+  double velocity; // steps/sec, negative when counting down
+
+  // Raw command queue
+  stepper_command_s queue[QUEUE_LEN];
+  uint8_t queueHead;
+  uint8_t queueCount;
+  uint64_t commandTicks; // Ticks spent on the command at the head of the queue
+  uint8_t commandSteps;  // Steps already made by that command
+
+  int32_t position;
+  int32_t origin; // Physical position of step 0
+
+  // Gears
+  int32_t backlash; // Steps the motor turns around before the output follows
+  int32_t output;   // Physical position of the output
+};
+
+class FastAccelStepperEngine {
+public:
+  void init();
+  FastAccelStepper *stepperConnectToPin(uint8_t stepPin);
+};
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+// Hooks of the host simulator into the stand-in Arduino core and FastAccelStepper
+//
+// Nothing moves on its own: the simulator calls advanceSimulation() between passes through loop(),
+// which moves the virtual clock and lets the modelled steppers step for that long.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+
+class FastAccelStepper;
+
+uint64_t getSimulationMicros();
+void advanceSimulation(uint32_t micros);
+
+// Model of the steppers, in FastAccelStepper.cpp
+void advanceSteppers(uint32_t micros);
+uint8_t getStepperCount();
+FastAccelStepper *getStepper(uint8_t index);
+
+// The motors don't have to be at 0 at power on, only their position counters are
+// The gears behind the motor on stepPin have steps of play, at power on the output is in the middle of it
+// A home switch reads LOW while the output of the motor on stepPin is at or below position, counted from where the
+// motor is at 0. Once it is lifted off, the output is a step past the switch when it opens.
+void setStartPosition(uint8_t stepPin, int32_t position);
+void setGearBacklash(uint8_t stepPin, int32_t steps);
+void addHomeSwitch(uint8_t pin, uint8_t stepPin, int32_t position);
+int readSwitchPin(uint8_t pin);
+
+// Model of the EEPROM, in EEPROM.cpp, kept in a file between runs
+bool loadEeprom(const char *path);
+bool saveEeprom(const char *path);
+uint32_t getEepromWrites(uint16_t address);
+
+// Serial input arrives at set virtual times, output goes to a file
+void queueSerialInput(uint64_t atMicros, const std::string &bytes);
+size_t getPendingSerialInput();
+void setSerialOutput(FILE *output);
+
+#endif
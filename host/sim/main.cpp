@@ -0,0 +1,345 @@
+// Runs the sketch on the host in virtual time
+//
+//   make -C host sim
+//   host/chair_sim --send 0:COASTER --until-idle --trace trace.csv
+//
+// setup() runs once, then loop() runs over and over with the virtual clock moving --loop-us between passes.
+// Serial output goes to stdout, a summary with the wall time and the final positions goes to stderr.
+// The home switches of Homing.h are wired up, so the chair homes when the EEPROM holds no good positions.
+// The trace has one line every --trace-ms with the position (steps) and speed (steps/sec) of every stepper, and with
+// --backlash where the output of its gears is (steps, physical).
+//
+// Options:
+//   --send MS:TEXT     type TEXT followed by a newline at MS milliseconds of virtual time, can be repeated
+//   --send-frame MS:TYPE[:HEX]
+//                      send a binary frame of message TYPE (e.g. 7 or 0x07) at MS, with the payload bytes given
+//                      in hex (e.g. 0a0002), can be repeated
+//   --control MS:BYTE  send a control byte at MS, stop, pause or resume (see SerialProtocol.h), can be repeated
+//   --until-idle       stop once everything has been sent and the chair has been still for a second
+//   --max-seconds S    stop after S seconds of virtual time (600)
+//   --loop-us US       virtual time of one pass through loop() (100)
+//   --trace FILE       write the trace to FILE
+//   --trace-ms MS      time between trace lines (10)
+//   --seed N           seed of random()
+//   --quiet            drop the serial output
+//   --eeprom FILE      load the EEPROM from FILE at power on and write it back when the run stops, so that runs
+//                      pick up where the last one was switched off
+//   --start-position P1,P2,P3
+//                      where the motors really are at power on, in steps from 0 (0,0,0)
+//   --backlash B1,B2,B3
+//                      play in the gears behind the motors in steps, the switches and the trace go by the output
+//                      of the gears (0,0,0)
+//   --pty              talk over a pseudo-terminal instead of stdin and stdout and run in real time, so that host
+//                      programs can drive the chair like on its USB port. The path to open is printed on stderr
+//   --clock-ppm PPM    with --pty, the crystal of the chair runs PPM parts per million fast against the wall clock
+//                      (slow when negative), like the crystals of two chairs never quite agree. Everything on the
+//                      chair runs at its rate, micros() as well as the steps
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "Arduino.h"
+#include "FastAccelStepper.h"
+#include "Simulator.h"
+#include "MotionScheduler.h"
+#include "SerialProtocol.h"
+#include "AxisConfig.h"
+#include "Homing.h"
+
+void setup();
+void loop();
+
+static void usage(const char *program) {
+  fprintf(stderr, "usage: %s [--send MS:TEXT]... [--send-frame MS:TYPE[:HEX]]... [--control MS:BYTE]... [--until-idle] [--max-seconds S] [--loop-us US] "
+                  "[--trace FILE] [--trace-ms MS] [--seed N] [--quiet] [--eeprom FILE] [--start-position P1,P2,P3] [--backlash B1,B2,B3] [--pty] [--clock-ppm PPM]\n", program);
+  exit(EXIT_FAILURE);
+}
+
+static bool anyStepperRunning() {
+  for (uint8_t i = 0; i < getStepperCount(); i++) {
+    if (getStepper(i) -> isRunning()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to open a pseudo-terminal for the serial port of the chair
+ * The far end is set to raw so that frames go through untouched, and is kept open so that the port stays up
+ * while programs open and close it
+ * @return the file descriptor of the near end, or -1
+ */
+static int openSerialPty() {
+  int pty = posix_openpt(O_RDWR | O_NOCTTY);
+  if (pty < 0 || grantpt(pty) != 0 || unlockpt(pty) != 0) {
+    perror("posix_openpt");
+    return -1;
+  }
+  int port = open(ptsname(pty), O_RDWR | O_NOCTTY);
+  termios settings;
+  if (port < 0 || tcgetattr(port, &settings) != 0) {
+    perror(ptsname(pty));
+    return -1;
+  }
+  cfmakeraw(&settings);
+  tcsetattr(port, TCSANOW, &settings);
+  fcntl(pty, F_SETFL, O_NONBLOCK);
+  fprintf(stderr, "Serial port on %s\n", ptsname(pty));
+  return pty;
+}
+
+/**
+ * Function to pass whatever came in on the pseudo-terminal to the serial port of the sketch
+ */
+static void readSerialPty(int pty) {
+  char buffer[256];
+  ssize_t size;
+  while ((size = read(pty, buffer, sizeof(buffer))) > 0) {
+    queueSerialInput(getSimulationMicros(), std::string(buffer, size));
+  }
+}
+
+static void writeTrace(FILE *trace, bool gears) {
+  fprintf(trace, "%.3f", getSimulationMicros() / 1000.0);
+  for (uint8_t i = 0; i < getStepperCount(); i++) {
+    FastAccelStepper *stepper = getStepper(i);
+    fprintf(trace, ",%d,%.1f", stepper -> getCurrentPosition(), stepper -> getCurrentSpeedInMilliHz() / 1000.0);
+    if (gears) {
+      fprintf(trace, ",%d", stepper -> getOutputPosition());
+    }
+  }
+  fprintf(trace, "\n");
+}
+
+int main(int argc, char **argv) {
+  bool untilIdle = false;
+  double maxSeconds = 600;
+  uint32_t loopMicros = 100;
+  uint32_t traceMicros = 10000;
+  FILE *trace = nullptr;
+  const char *eepromPath = nullptr;
+  int pty = -1;
+  double clockPpm = 0;
+  uint64_t lastInputAt = 0;
+  bool gears = false;
+
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+    if (strcmp(option, "--until-idle") == 0) {
+      untilIdle = true;
+    } else if (strcmp(option, "--quiet") == 0) {
+      setSerialOutput(fopen("/dev/null", "w"));
+    } else if (strcmp(option, "--pty") == 0) {
+      pty = openSerialPty();
+      if (pty < 0) {
+        return EXIT_FAILURE;
+      }
+      setSerialOutput(fdopen(dup(pty), "w"));
+    } else if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--send") == 0) {
+      const char *colon = strchr(value, ':');
+      if (!colon) {
+        usage(argv[0]);
+      }
+      uint64_t at = (uint64_t)(atof(value) * 1000);
+      queueSerialInput(at, std::string(colon + 1) + "\n");
+      lastInputAt = at > lastInputAt ? at : lastInputAt;
+      i++;
+    } else if (strcmp(option, "--send-frame") == 0) {
+      const char *colon = strchr(value, ':');
+      if (!colon) {
+        usage(argv[0]);
+      }
+      char *end;
+      uint8_t type = (uint8_t)strtoul(colon + 1, &end, 0);
+      uint8_t payload[FRAME_MAX_PAYLOAD];
+      uint8_t length = 0;
+      if (*end == ':') {
+        for (const char *hex = end + 1; hex[0] && hex[1] && length < FRAME_MAX_PAYLOAD; hex += 2) {
+          char byte[3] = { hex[0], hex[1], '\0' };
+          payload[length++] = (uint8_t)strtoul(byte, nullptr, 16);
+        }
+      }
+      uint8_t frame[FRAME_MAX_SIZE];
+      uint8_t size = encodeFrame(frame, type, 0, payload, length);
+      uint64_t at = (uint64_t)(atof(value) * 1000);
+      queueSerialInput(at, std::string((const char *)frame, size));
+      lastInputAt = at > lastInputAt ? at : lastInputAt;
+      i++;
+    } else if (strcmp(option, "--control") == 0) {
+      const char *colon = strchr(value, ':');
+      if (!colon) {
+        usage(argv[0]);
+      }
+      char control = 0;
+      if (strcmp(colon + 1, "stop") == 0) {
+        control = CONTROL_STOP;
+      } else if (strcmp(colon + 1, "pause") == 0) {
+        control = CONTROL_PAUSE;
+      } else if (strcmp(colon + 1, "resume") == 0) {
+        control = CONTROL_RESUME;
+      } else {
+        usage(argv[0]);
+      }
+      uint64_t at = (uint64_t)(atof(value) * 1000);
+      queueSerialInput(at, std::string(1, control));
+      lastInputAt = at > lastInputAt ? at : lastInputAt;
+      i++;
+    } else if (strcmp(option, "--clock-ppm") == 0) {
+      clockPpm = atof(value);
+      i++;
+    } else if (strcmp(option, "--max-seconds") == 0) {
+      maxSeconds = atof(value);
+      i++;
+    } else if (strcmp(option, "--loop-us") == 0) {
+      loopMicros = atoi(value) > 0 ? atoi(value) : 1;
+      i++;
+    } else if (strcmp(option, "--trace") == 0) {
+      trace = fopen(value, "w");
+      if (!trace) {
+        perror(value);
+        return EXIT_FAILURE;
+      }
+      i++;
+    } else if (strcmp(option, "--trace-ms") == 0) {
+      traceMicros = (uint32_t)(atof(value) * 1000);
+      traceMicros = traceMicros > 0 ? traceMicros : 1;
+      i++;
+    } else if (strcmp(option, "--seed") == 0) {
+      randomSeed(strtoul(value, nullptr, 10));
+      i++;
+    } else if (strcmp(option, "--eeprom") == 0) {
+      eepromPath = value;
+      i++;
+    } else if (strcmp(option, "--start-position") == 0) {
+      // stepper1, stepper2 and stepper3 are on step pins 6, 7 and 8
+      char *end = (char *)value;
+      for (uint8_t pin = 6; pin <= 8; pin++) {
+        setStartPosition(pin, strtol(end, &end, 10));
+        if (*end == ',') {
+          end++;
+        }
+      }
+      i++;
+    } else if (strcmp(option, "--backlash") == 0) {
+      char *end = (char *)value;
+      for (uint8_t pin = 6; pin <= 8; pin++) {
+        int32_t steps = strtol(end, &end, 10);
+        setGearBacklash(pin, steps);
+        gears = gears || steps > 0;
+        if (*end == ',') {
+          end++;
+        }
+      }
+      i++;
+    } else {
+      usage(argv[0]);
+    }
+  }
+
+  auto startedAt = std::chrono::steady_clock::now();
+  uint64_t endAt = (uint64_t)(maxSeconds * 1000000);
+  uint64_t loops = 0;
+  uint64_t stillSince = 0;
+  uint64_t nextTraceAt = 0;
+
+  if (eepromPath) {
+    loadEeprom(eepromPath);
+  }
+  addHomeSwitch(STEPPER1_HOME_PIN, 6, homeSwitchPosition<Stepper1Axis>());
+  addHomeSwitch(STEPPER2_HOME_PIN, 7, homeSwitchPosition<Stepper2Axis>());
+  addHomeSwitch(STEPPER3_HOME_PIN, 8, homeSwitchPosition<Stepper3Axis>());
+
+  setup();
+  // Homing in setup() can take a while, the chair has only been still since it finished
+  stillSince = getSimulationMicros();
+
+  if (trace) {
+    fprintf(trace, "time_ms");
+    for (uint8_t i = 0; i < getStepperCount(); i++) {
+      fprintf(trace, ",position%d,speed%d", i + 1, i + 1);
+      if (gears) {
+        fprintf(trace, ",output%d", i + 1);
+      }
+    }
+    fprintf(trace, "\n");
+  }
+
+  // In real time the virtual clock is held back to the wall clock, within about a pass so that input is timed closely
+  auto clockStartedAt = std::chrono::steady_clock::now();
+  uint64_t clockStartedMicros = getSimulationMicros();
+
+  while (getSimulationMicros() < endAt) {
+    if (pty >= 0) {
+      readSerialPty(pty);
+    }
+    loop();
+    loops++;
+    advanceSimulation(loopMicros);
+
+    if (pty >= 0) {
+      Serial.flush();
+      std::chrono::microseconds ahead((int64_t)((getSimulationMicros() - clockStartedMicros) / (1 + clockPpm / 1e6)));
+      auto wallAt = clockStartedAt + ahead;
+      if (wallAt - std::chrono::steady_clock::now() > std::chrono::microseconds(100)) {
+        std::this_thread::sleep_until(wallAt);
+      }
+    }
+
+    uint64_t now = getSimulationMicros();
+    if (trace && now >= nextTraceAt) {
+      writeTrace(trace, gears);
+      nextTraceAt += traceMicros;
+    }
+
+    if (untilIdle) {
+      bool still = now >= lastInputAt && getPendingSerialInput() == 0 && isSchedulerIdle() && !anyStepperRunning();
+      if (!still) {
+        stillSince = now;
+      } else if (now - stillSince >= 1000000) {
+        break;
+      }
+    }
+  }
+  fflush(stdout);
+
+  double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startedAt).count();
+  fprintf(stderr, "Simulated %.3f s in %.1f ms of wall time (%llu passes through loop)\n",
+          getSimulationMicros() / 1000000.0, wallMs, (unsigned long long)loops);
+  fprintf(stderr, "Final positions:");
+  for (uint8_t i = 0; i < getStepperCount(); i++) {
+    fprintf(stderr, " %d", getStepper(i) -> getCurrentPosition());
+  }
+  fprintf(stderr, "\nPhysical positions:");
+  for (uint8_t i = 0; i < getStepperCount(); i++) {
+    fprintf(stderr, " %d", getStepper(i) -> getPhysicalPosition());
+  }
+  if (gears) {
+    fprintf(stderr, "\nOutput positions:");
+    for (uint8_t i = 0; i < getStepperCount(); i++) {
+      fprintf(stderr, " %d", getStepper(i) -> getOutputPosition());
+    }
+  }
+  fprintf(stderr, "\n");
+
+  if (eepromPath && !saveEeprom(eepromPath)) {
+    perror(eepromPath);
+  }
+
+  if (trace) {
+    fclose(trace);
+  }
+  return EXIT_SUCCESS;
+}
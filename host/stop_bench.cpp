@@ -0,0 +1,374 @@
+// Measures how quickly the control bytes of SerialProtocol.h stop the chair, and that a pause carries on afterwards
+//
+//   make -C host stop_bench
+//   host/stop_bench [--points N]
+//
+// The sketch runs in virtual time like in chair_sim. Every scenario is a command typed into the shell, and the
+// stream is a slalom sent as MSG_POSE frames. Each one is run once as it is, then interrupted at --points times
+// spread over the time its motors are running in that run, so none of them lands in a hold: once with CONTROL_STOP,
+// and once with CONTROL_PAUSE followed by CONTROL_RESUME PAUSE_HOLD_MS after the chair has come to rest.
+//
+// For every scenario it reports the worst of its runs:
+//   stop_ms      from the control byte to the last step of any motor
+//   rest_ms      from the control byte to the chair reporting every motor at rest, which includes pauses still in the
+//                step queues
+//   travel       furthest a motor stepped after the control byte, in steps
+//   resumed      paused runs that finished where the run without a pause finishes
+// and for all of them the longest pass through loop(), prints included. A control byte is read on the pass after it
+// arrives, so the longest pass bounds the time until the motors are sent braking. The exit status is 1 when a paused
+// run did not finish where it should or a motor left its limits.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Arduino.h"
+#include "FastAccelStepper.h"
+#include "Simulator.h"
+#include "MotionScheduler.h"
+#include "SerialProtocol.h"
+#include "PoseStream.h"
+#include "AxisConfig.h"
+#include "Homing.h"
+
+void setup();
+void loop();
+extern bool rideQueued;
+
+// Virtual time of one pass, like the default of chair_sim
+#define PASS_MICROS 100
+
+// How long a paused chair is left at rest before it is resumed
+#define PAUSE_HOLD_MS 500
+
+// Length of the slalom that is streamed
+#define STREAM_SECONDS 6
+
+// No run takes this long, anything that does is stuck
+#define RUN_TIMEOUT_MICROS 300000000ULL
+
+#define DEFAULT_POINTS 10
+#define MOTORS 3
+
+static const int32_t MIN_POSITION[MOTORS] = { Stepper1Axis::MIN_POSITION, Stepper2Axis::MIN_POSITION, Stepper3Axis::MIN_POSITION };
+static const int32_t MAX_POSITION[MOTORS] = { Stepper1Axis::MAX_POSITION, Stepper2Axis::MAX_POSITION, Stepper3Axis::MAX_POSITION };
+
+struct Scenario {
+  const char *name;
+  const char *command; // Typed into the shell
+  bool stream;         // Whether the slalom is streamed once the chair is streaming
+};
+
+// A fast trapezoid, the presets, the rides of the library (the first and the last are step tracks) and a stream
+static const Scenario SCENARIOS[] = {
+  { "fast_pitch", "MOVE PITCH 30 SPEED 10000 ACCEL 10000", false },
+  { "full_experience", "FULL", false },
+  { "roller_coaster", "COASTER", false },
+  { "ride_1_track", "RIDE 1", false },
+  { "ride_2_script", "RIDE 2", false },
+  { "ride_3_track", "RIDE 3", false },
+  { "stream", "STREAM", true },
+};
+
+enum Interruption { INTERRUPT_NONE, INTERRUPT_STOP, INTERRUPT_PAUSE };
+
+struct Run {
+  bool finished;     // Idle and still again within RUN_TIMEOUT_MICROS
+  double durationMs; // From the command until then
+  int32_t end[MOTORS];
+  double stopMs;
+  double restMs;
+  int32_t travel;
+  bool inLimits;
+  std::vector<std::pair<uint64_t, uint64_t> > moving; // From and until when a motor was running, counted from the command
+};
+
+static std::vector<Pose> slalom;
+static uint64_t longestPass = 0;
+
+static void usage(const char *program) {
+  fprintf(stderr, "usage: %s [--points N]\n", program);
+  exit(EXIT_FAILURE);
+}
+
+static bool anyStepperRunning() {
+  for (uint8_t i = 0; i < getStepperCount(); i++) {
+    if (getStepper(i) -> isRunning()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Function to run one pass through loop() and let the virtual time move on, keeping the longest pass
+ */
+static void pass() {
+  uint64_t startedAt = getSimulationMicros();
+  loop();
+  advanceSimulation(PASS_MICROS);
+  longestPass = std::max(longestPass, getSimulationMicros() - startedAt);
+}
+
+/**
+ * Function to make quick rolls from side to side with a turn of the yaw, ending level
+ */
+static std::vector<Pose> slalomStream() {
+  std::vector<Pose> poses;
+  for (uint32_t i = 0; i < STREAM_SECONDS * 1000000ULL / STREAM_TICK_MICROS; i++) {
+    double t = i * STREAM_TICK_MICROS / 1e6;
+    double share = t < STREAM_SECONDS - 1 ? sin(2 * M_PI * 0.5 * t) : 0;
+    Pose pose;
+    pose.pitch = (int16_t)(800 * sin(2 * M_PI * 0.3 * t) * (t < STREAM_SECONDS - 1));
+    pose.roll = (int16_t)(2500 * share);
+    pose.yaw = (int16_t)(-1500 * share);
+    poses.push_back(pose);
+  }
+  return poses;
+}
+
+static void sendPose(const Pose &pose) {
+  uint8_t payload[POSE_PAYLOAD_SIZE];
+  uint8_t frame[FRAME_MAX_SIZE];
+  encodePose(payload, pose);
+  uint8_t size = encodeFrame(frame, MSG_POSE, 0, payload, POSE_PAYLOAD_SIZE);
+  queueSerialInput(getSimulationMicros(), std::string((const char *)frame, size));
+}
+
+/**
+ * Function to run a scenario from level, interrupted or not, until the chair is idle and still again
+ * @param scenario the scenario
+ * @param interruption what is sent
+ * @param atMicros when it is sent, counted from the command
+ * @param run set to what was measured
+ */
+static void runScenario(const Scenario &scenario, Interruption interruption, uint64_t atMicros, Run &run) {
+  uint64_t startedAt = getSimulationMicros();
+  queueSerialInput(startedAt, std::string(scenario.command) + "\n");
+
+  bool sent = false;
+  bool resumed = false;
+  uint64_t controlAt = 0;
+  uint64_t lastStepAt = 0;
+  uint64_t restAt = 0;
+  uint16_t halts = getHaltStats().halts;
+  int32_t controlPosition[MOTORS] = { 0, 0, 0 };
+  int32_t previous[MOTORS];
+  for (uint8_t i = 0; i < MOTORS; i++) {
+    previous[i] = getStepper(i) -> getCurrentPosition();
+  }
+
+  bool streamStarted = false;
+  bool streamEnded = !scenario.stream;
+  uint64_t streamStartedAt = 0;
+  size_t posesSent = 0;
+
+  run.finished = false;
+  run.travel = 0;
+  run.inLimits = true;
+  run.moving.clear();
+  bool wasRunning = false;
+
+  while (getSimulationMicros() - startedAt < RUN_TIMEOUT_MICROS) {
+    uint64_t now = getSimulationMicros();
+
+    if (interruption != INTERRUPT_NONE && !sent && now - startedAt >= atMicros) {
+      queueSerialInput(now, std::string(1, interruption == INTERRUPT_STOP ? CONTROL_STOP : CONTROL_PAUSE));
+      sent = true;
+      controlAt = now;
+      for (uint8_t i = 0; i < MOTORS; i++) {
+        controlPosition[i] = getStepper(i) -> getCurrentPosition();
+      }
+      // A stopped stream is over
+      streamEnded = streamEnded || interruption == INTERRUPT_STOP;
+    }
+    if (interruption == INTERRUPT_PAUSE && restAt > 0 && !resumed && now - restAt >= PAUSE_HOLD_MS * 1000ULL) {
+      queueSerialInput(now, std::string(1, CONTROL_RESUME));
+      resumed = true;
+    }
+
+    // The slalom goes on during a pause, like a game would
+    if (!streamEnded) {
+      if (!streamStarted && isPoseStreaming()) {
+        streamStarted = true;
+        streamStartedAt = now;
+      }
+      if (streamStarted && posesSent < slalom.size() && now - streamStartedAt >= posesSent * (uint64_t)STREAM_TICK_MICROS) {
+        sendPose(slalom[posesSent++]);
+      } else if (posesSent == slalom.size()) {
+        queueSerialInput(now, "STOP\n");
+        streamEnded = true;
+      }
+    }
+
+    pass();
+
+    for (uint8_t i = 0; i < MOTORS; i++) {
+      int32_t position = getStepper(i) -> getCurrentPosition();
+      if (position < MIN_POSITION[i] || position > MAX_POSITION[i]) {
+        run.inLimits = false;
+      }
+      if (sent && restAt == 0) {
+        if (position != previous[i]) {
+          lastStepAt = getSimulationMicros();
+        }
+        run.travel = std::max(run.travel, std::abs(position - controlPosition[i]));
+      }
+      previous[i] = position;
+    }
+    bool running = anyStepperRunning();
+    if (running && !wasRunning) {
+      run.moving.push_back(std::make_pair(getSimulationMicros() - startedAt, getSimulationMicros() - startedAt));
+    }
+    if (running) {
+      run.moving.back().second = getSimulationMicros() - startedAt;
+    }
+    wasRunning = running;
+    if (sent && restAt == 0 && getHaltStats().halts != halts) {
+      restAt = getSimulationMicros();
+    }
+
+    bool waiting = getPendingSerialInput() > 0 || !streamEnded || isPoseStreaming() || rideQueued ||
+                   (interruption == INTERRUPT_PAUSE && !resumed) || (interruption != INTERRUPT_NONE && !sent);
+    if (!waiting && isSchedulerIdle() && !running) {
+      run.finished = true;
+      break;
+    }
+  }
+
+  run.durationMs = (getSimulationMicros() - startedAt) / 1000.0;
+  run.stopMs = lastStepAt > controlAt ? (lastStepAt - controlAt) / 1000.0 : 0;
+  run.restMs = restAt > controlAt ? (restAt - controlAt) / 1000.0 : 0;
+  for (uint8_t i = 0; i < MOTORS; i++) {
+    run.end[i] = getStepper(i) -> getCurrentPosition();
+  }
+}
+
+/**
+ * Function to find the time of an interruption, spread over the time the motors were running
+ * @param run the run without an interruption
+ * @param k the interruption counted from 1
+ * @param points how many there are
+ * @return when to send it, counted from the command
+ */
+static uint64_t movingPoint(const Run &run, int k, int points) {
+  uint64_t total = 0;
+  for (const auto &span : run.moving) {
+    total += span.second - span.first;
+  }
+  uint64_t left = total * k / (points + 1);
+  for (const auto &span : run.moving) {
+    if (left < span.second - span.first) {
+      return span.first + left;
+    }
+    left -= span.second - span.first;
+  }
+  return run.moving.empty() ? 0 : run.moving.back().second;
+}
+
+/**
+ * Function to bring the chair back to level between runs
+ */
+static bool returnHome() {
+  scheduleMoveTo(ALL_STEPPERS_MASK, 0, 0, 0, ALL_STEPPERS_MASK, 0);
+  uint64_t endAt = getSimulationMicros() + RUN_TIMEOUT_MICROS;
+  while (getSimulationMicros() < endAt) {
+    pass();
+    if (isSchedulerIdle() && !anyStepperRunning()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int main(int argc, char **argv) {
+  int points = DEFAULT_POINTS;
+
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+    if (!value) {
+      usage(argv[0]);
+    } else if (strcmp(option, "--points") == 0) {
+      points = atoi(value) > 0 ? atoi(value) : 1;
+    } else {
+      usage(argv[0]);
+    }
+    i++;
+  }
+
+  // The messages of the sketch aren't needed
+  // The EEPROM starts out erased, so setup() homes against the switches first
+  setSerialOutput(fopen("/dev/null", "w"));
+  addHomeSwitch(STEPPER1_HOME_PIN, 6, homeSwitchPosition<Stepper1Axis>());
+  addHomeSwitch(STEPPER2_HOME_PIN, 7, homeSwitchPosition<Stepper2Axis>());
+  addHomeSwitch(STEPPER3_HOME_PIN, 8, homeSwitchPosition<Stepper3Axis>());
+  setup();
+  slalom = slalomStream();
+
+  int failures = 0;
+  double worstStopMs = 0;
+  double worstRestMs = 0;
+
+  printf("%d stops and %d pauses of %d ms spread over the moves of each scenario\n\n", points, points, PAUSE_HOLD_MS);
+  printf("%-16s %11s %8s %8s %7s %8s\n", "scenario", "duration_ms", "stop_ms", "rest_ms", "travel", "resumed");
+  for (const Scenario &scenario : SCENARIOS) {
+    Run plain;
+    runScenario(scenario, INTERRUPT_NONE, 0, plain);
+    if (!plain.finished || !returnHome()) {
+      printf("STUCK %s did not finish\n", scenario.name);
+      return EXIT_FAILURE;
+    }
+
+    double stopMs = 0;
+    double restMs = 0;
+    int32_t travel = 0;
+    int resumedRuns = 0;
+    for (int k = 1; k <= points; k++) {
+      uint64_t at = movingPoint(plain, k, points);
+
+      Run stopped;
+      runScenario(scenario, INTERRUPT_STOP, at, stopped);
+      stopMs = std::max(stopMs, stopped.stopMs);
+      restMs = std::max(restMs, stopped.restMs);
+      travel = std::max(travel, stopped.travel);
+      if (!stopped.finished || !stopped.inLimits || !returnHome()) {
+        printf("FAILED %s stopped at %.0f ms %s\n", scenario.name, at / 1000.0, stopped.inLimits ? "did not come to rest" : "left the limits");
+        failures++;
+      }
+
+      Run paused;
+      runScenario(scenario, INTERRUPT_PAUSE, at, paused);
+      stopMs = std::max(stopMs, paused.stopMs);
+      restMs = std::max(restMs, paused.restMs);
+      travel = std::max(travel, paused.travel);
+      if (paused.finished && paused.inLimits && std::equal(paused.end, paused.end + MOTORS, plain.end)) {
+        resumedRuns++;
+      } else {
+        printf("FAILED %s paused at %.0f ms ended at %d %d %d instead of %d %d %d%s\n", scenario.name, at / 1000.0,
+               paused.end[0], paused.end[1], paused.end[2], plain.end[0], plain.end[1], plain.end[2],
+               paused.inLimits ? "" : ", out of its limits");
+        failures++;
+      }
+      if (!returnHome()) {
+        printf("STUCK %s did not return home\n", scenario.name);
+        return EXIT_FAILURE;
+      }
+    }
+
+    worstStopMs = std::max(worstStopMs, stopMs);
+    worstRestMs = std::max(worstRestMs, restMs);
+    printf("%-16s %11.1f %8.1f %8.1f %7d %5d/%-2d\n", scenario.name, plain.durationMs, stopMs, restMs, travel, resumedRuns, points);
+  }
+
+  const HaltStats &halts = getHaltStats();
+  printf("\nWorst stop %.1f ms, at rest after %.1f ms (%.1f ms on the chair over %u halts)\n", worstStopMs, worstRestMs,
+         halts.maxMicros / 1000.0, halts.halts);
+  printf("Longest pass through loop() %.1f ms, the most a control byte waits to be read\n", longestPass / 1000.0);
+  return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
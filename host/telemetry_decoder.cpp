@@ -0,0 +1,77 @@
+// Turns the telemetry stream of the chair into a CSV of the stepper positions and speeds
+//
+//   make -C host telemetry_decoder
+//   host/telemetry_decoder capture.bin > telemetry.csv
+//
+// The input is whatever came out of the serial port after telemetry was turned on with a
+// MSG_TELEMETRY_CONFIG frame, for example from the simulator at 100 Hz with 4 samples per frame:
+//
+//   host/chair_sim --send-frame 0:8:0a0004 --send 0:COASTER --until-idle > capture.bin
+//
+// Text from the menu and other frames are skipped. Every sample that arrived is one line of the CSV:
+// the sample index, its time from the first key frame, and the position (steps) and speed (steps/sec)
+// of every stepper. Delta frames before the first key frame, or after a gap, can't be decoded and are
+// counted as lost until the next key frame. A summary goes to stderr.
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "../SerialProtocol.h"
+#include "TelemetryStream.h"
+
+static void printSample(const TelemetrySample &sample) {
+  printf("%llu,%llu", (unsigned long long)sample.index, (unsigned long long)(sample.index * sample.periodMs));
+  for (uint8_t i = 0; i < TELEMETRY_VALUES; i++) {
+    printf(",%d", sample.values[i]);
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  if (argc > 2) {
+    fprintf(stderr, "usage: %s [capture.bin]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  FILE *input = argc == 2 ? fopen(argv[1], "rb") : stdin;
+  if (!input) {
+    perror(argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  FrameParser parser;
+  initFrameParser(parser);
+
+  TelemetryDecoder decoder;
+  initTelemetryDecoder(decoder);
+  TelemetrySample samples[TELEMETRY_MAX_BATCH];
+  uint64_t bytes = 0;
+  uint32_t frameBytes = 0; // On the wire, escapes included
+  int c;
+
+  printf("sample,time_ms,position1,position2,position3,speed1,speed2,speed3\n");
+
+  while ((c = fgetc(input)) != EOF) {
+    if (!isParsingFrame(parser) && c != FRAME_SYNC) {
+      continue;
+    }
+    frameBytes = isParsingFrame(parser) ? frameBytes + 1 : 1;
+    if (!parseFrameByte(parser, c) || (parser.type != MSG_TELEMETRY && parser.type != MSG_TELEMETRY_KEY) || parser.length < 2) {
+      continue;
+    }
+    bytes += frameBytes;
+
+    uint8_t count = decodeTelemetryFrame(decoder, parser.type, parser.payload, parser.length, samples);
+    for (uint8_t i = 0; i < count; i++) {
+      printSample(samples[i]);
+    }
+  }
+
+  const TelemetryCounters &counters = decoder.counters;
+  fprintf(stderr, "%u samples decoded from %u key and %u delta frames, %.1f bytes per sample\n", counters.samples,
+          counters.keyFrames, counters.deltaFrames, counters.samples ? (double)bytes / counters.samples : 0.0);
+  fprintf(stderr, "%u samples lost, %u could not be decoded\n", counters.lost, counters.skipped);
+  if (parser.stats.corrupt > 0) {
+    fprintf(stderr, "%u corrupt frames were skipped\n", parser.stats.corrupt);
+  }
+  return counters.samples > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
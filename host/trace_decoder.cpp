@@ -0,0 +1,280 @@
+// Turns the event trace of the chair into a timeline
+//
+//   make -C host trace_decoder
+//   host/trace_decoder capture.bin
+//
+// The input is whatever came out of the serial port after a MSG_TRACE_REQUEST frame was sent, for
+// example from the simulator:
+//
+//   host/chair_sim --send 0:COASTER --send-frame 20000:7 --max-seconds 21 > capture.bin
+//
+// Text from the menu is skipped, every MSG_TRACE dump in the capture is printed as a timeline
+// followed by where the time went: how long commands took to move a motor, how long each kind of
+// task ran, the longest gaps between events and the time spent in each state of loop().
+
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <vector>
+
+#include "../SerialProtocol.h"
+#include "../Trace.h"
+
+// In the order of the State enum in MotionSimulationChair.cpp
+static const char *STATE_NAMES[] = {
+  "WAIT_FOR_COMMAND", "STREAMING"
+};
+
+// In the order of MotionTaskType in MotionScheduler.h
+static const char *TASK_NAMES[] = {
+  "CALL", "MOVE_TO", "MOVE", "MOVE_POSE", "MOVE_CURVE", "SET_SPEED", "WAIT", "EFFECT", "PLAY_TRACK", "WAIT_UNTIL", "RELEASE"
+};
+
+// In the order of HaltMode in MotionScheduler.h
+static const char *HALT_NAMES[] = {
+  "NONE", "STOP", "PAUSE"
+};
+
+static const char *EVENT_NAMES[] = {
+  "?", "command received", "state changed", "task queued", "task started",
+  "move started", "hold started", "task finished", "queue full", "halted", "halt at rest", "resumed"
+};
+
+// How many of the longest gaps between events are listed
+#define LONGEST_GAPS 5
+
+struct Event {
+  uint64_t micros; // Unwrapped, micros() on the chair wraps every 71 minutes
+  uint8_t type;
+  uint8_t arg;
+};
+
+struct Dump {
+  std::vector<Event> events;
+  uint32_t recorded;
+  uint16_t missed;
+};
+
+template <size_t N>
+static const char *lookup(const char *(&names)[N], uint8_t index) {
+  return index < N ? names[index] : "?";
+}
+
+static void describe(const Event &event, char *text, size_t size) {
+  switch (event.type) {
+    case TRACE_COMMAND_RECEIVED:
+      if (event.arg >= 0x20 && event.arg < 0x7F) {
+        snprintf(text, size, "line '%c...'", event.arg);
+      } else if (isControlByte(event.arg)) {
+        snprintf(text, size, "control %s", event.arg == CONTROL_STOP ? "STOP" : event.arg == CONTROL_PAUSE ? "PAUSE" : "RESUME");
+      } else {
+        snprintf(text, size, "frame 0x%02X", event.arg);
+      }
+      break;
+    case TRACE_STATE_CHANGED:
+      snprintf(text, size, "%s", lookup(STATE_NAMES, event.arg));
+      break;
+    case TRACE_MOVE_STARTED:
+      snprintf(text, size, "steppers%s%s%s", event.arg & 1 ? " 1" : "", event.arg & 2 ? " 2" : "", event.arg & 4 ? " 3" : "");
+      break;
+    case TRACE_TASK_QUEUED:
+    case TRACE_TASK_STARTED:
+    case TRACE_HOLD_STARTED:
+    case TRACE_TASK_FINISHED:
+    case TRACE_QUEUE_FULL:
+      snprintf(text, size, "%s", lookup(TASK_NAMES, event.arg));
+      break;
+    case TRACE_HALTED:
+    case TRACE_HALT_AT_REST:
+      snprintf(text, size, "%s", lookup(HALT_NAMES, event.arg));
+      break;
+    default:
+      snprintf(text, size, "arg %u", event.arg);
+  }
+}
+
+static void printTimeline(const Dump &dump) {
+  uint32_t kept = dump.events.size();
+  printf("Trace of %u events (%u recorded, %u overwritten, %u missed while sending)\n\n", kept, dump.recorded,
+         dump.recorded - kept, dump.missed);
+  printf("%12s %10s  %-17s %s\n", "time_ms", "delta_ms", "event", "detail");
+
+  for (size_t i = 0; i < dump.events.size(); i++) {
+    const Event &event = dump.events[i];
+    double delta = i > 0 ? (event.micros - dump.events[i - 1].micros) / 1000.0 : 0;
+    char detail[32];
+    describe(event, detail, sizeof(detail));
+    printf("%12.3f %10.3f  %-17s %s\n", event.micros / 1000.0, delta, lookup(EVENT_NAMES, event.type), detail);
+  }
+}
+
+static void printSummary(const Dump &dump) {
+  const std::vector<Event> &events = dump.events;
+  if (events.empty()) {
+    return;
+  }
+
+  // Commands to the first move after them
+  printf("\nCommand to motion:\n");
+  bool anyCommand = false;
+  for (size_t i = 0; i < events.size(); i++) {
+    if (events[i].type != TRACE_COMMAND_RECEIVED) {
+      continue;
+    }
+    anyCommand = true;
+    char detail[32];
+    describe(events[i], detail, sizeof(detail));
+    size_t j = i + 1;
+    while (j < events.size() && events[j].type != TRACE_MOVE_STARTED && events[j].type != TRACE_COMMAND_RECEIVED) {
+      j++;
+    }
+    if (j < events.size() && events[j].type == TRACE_MOVE_STARTED) {
+      printf("  %12.3f  %-14s %10.3f ms\n", events[i].micros / 1000.0, detail, (events[j].micros - events[i].micros) / 1000.0);
+    } else {
+      printf("  %12.3f  %-14s %13s\n", events[i].micros / 1000.0, detail, "no motion");
+    }
+  }
+  if (!anyCommand) {
+    printf("  none in the trace\n");
+  }
+
+  // Tasks from starting to finishing, a task only runs after the one before it has finished
+  struct Totals {
+    uint32_t count;
+    uint64_t total;
+    uint64_t longest;
+  };
+  std::map<uint8_t, Totals> tasks;
+  const Event *started = nullptr;
+  for (const Event &event : events) {
+    if (event.type == TRACE_TASK_STARTED) {
+      started = &event;
+    } else if (event.type == TRACE_TASK_FINISHED && started && started -> arg == event.arg) {
+      Totals &totals = tasks[event.arg];
+      uint64_t duration = event.micros - started -> micros;
+      totals.count++;
+      totals.total += duration;
+      totals.longest = duration > totals.longest ? duration : totals.longest;
+      started = nullptr;
+    }
+  }
+  printf("\nTasks:\n  %-11s %6s %12s %12s\n", "type", "count", "mean_ms", "longest_ms");
+  for (const auto &entry : tasks) {
+    printf("  %-11s %6u %12.3f %12.3f\n", lookup(TASK_NAMES, entry.first), entry.second.count,
+           entry.second.total / 1000.0 / entry.second.count, entry.second.longest / 1000.0);
+  }
+
+  // Where nothing was recorded for a long time
+  std::vector<size_t> gaps;
+  for (size_t i = 1; i < events.size(); i++) {
+    gaps.push_back(i);
+  }
+  auto gapOf = [&](size_t i) { return events[i].micros - events[i - 1].micros; };
+  size_t listed = gaps.size() < LONGEST_GAPS ? gaps.size() : LONGEST_GAPS;
+  for (size_t i = 0; i < listed; i++) {
+    for (size_t j = i + 1; j < gaps.size(); j++) {
+      if (gapOf(gaps[j]) > gapOf(gaps[i])) {
+        size_t swap = gaps[i];
+        gaps[i] = gaps[j];
+        gaps[j] = swap;
+      }
+    }
+  }
+  printf("\nLongest gaps:\n");
+  for (size_t i = 0; i < listed; i++) {
+    const Event &before = events[gaps[i] - 1];
+    const Event &after = events[gaps[i]];
+    printf("  %10.3f ms after %-17s at %12.3f, until %s\n", gapOf(gaps[i]) / 1000.0, lookup(EVENT_NAMES, before.type),
+           before.micros / 1000.0, lookup(EVENT_NAMES, after.type));
+  }
+
+  // States of loop(), the first one is only known once it changes
+  std::map<uint8_t, uint64_t> states;
+  const Event *entered = nullptr;
+  for (const Event &event : events) {
+    if (event.type == TRACE_STATE_CHANGED) {
+      if (entered) {
+        states[entered -> arg] += event.micros - entered -> micros;
+      }
+      entered = &event;
+    }
+  }
+  if (entered) {
+    states[entered -> arg] += events.back().micros - entered -> micros;
+  }
+  printf("\nTime in each state of loop():\n");
+  if (states.empty()) {
+    printf("  no state changes in the trace\n");
+  }
+  for (const auto &entry : states) {
+    printf("  %-22s %12.3f ms\n", lookup(STATE_NAMES, entry.first), entry.second / 1000.0);
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv) {
+  if (argc > 2) {
+    fprintf(stderr, "usage: %s [capture.bin]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  FILE *input = argc == 2 ? fopen(argv[1], "rb") : stdin;
+  if (!input) {
+    perror(argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  FrameParser parser;
+  initFrameParser(parser);
+
+  Dump dump = { {}, 0, 0 };
+  uint32_t lastMicros = 0;
+  uint64_t wraps = 0;
+  int dumps = 0;
+  int c;
+
+  while ((c = fgetc(input)) != EOF) {
+    if (!isParsingFrame(parser) && c != FRAME_SYNC) {
+      continue;
+    }
+    if (!parseFrameByte(parser, c) || parser.type != MSG_TRACE || parser.length < 1) {
+      continue;
+    }
+
+    uint8_t count = parser.payload[0];
+    if (count == 0 && parser.length == TRACE_END_PAYLOAD_SIZE) {
+      dump.recorded = readUint32(parser.payload + 1);
+      dump.missed = readUint16(parser.payload + 5);
+      if (dumps > 0) {
+        printf("\n");
+      }
+      printTimeline(dump);
+      printSummary(dump);
+      dumps++;
+      dump.events.clear();
+      wraps = 0;
+      continue;
+    }
+
+    for (uint8_t i = 0; i < count && 1 + (i + 1) * TRACE_EVENT_SIZE <= parser.length; i++) {
+      const uint8_t *bytes = parser.payload + 1 + i * TRACE_EVENT_SIZE;
+      uint32_t micros = readUint32(bytes);
+      if (!dump.events.empty() && micros < lastMicros) {
+        wraps += 1ULL << 32;
+      }
+      lastMicros = micros;
+      dump.events.push_back({ wraps + micros, bytes[4], bytes[5] });
+    }
+  }
+
+  if (parser.stats.corrupt > 0) {
+    fprintf(stderr, "%u corrupt frames were skipped\n", parser.stats.corrupt);
+  }
+  if (!dump.events.empty()) {
+    fprintf(stderr, "The capture ends in the middle of a trace, %zu events were not printed\n", dump.events.size());
+  }
+  if (dumps == 0) {
+    fprintf(stderr, "No trace in the capture, send a MSG_TRACE_REQUEST frame first\n");
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}